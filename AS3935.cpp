@@ -1,18 +1,20 @@
-#include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
 #include "AS3935.h"
-#include "FreqCounter.h"
-#include "hardware/gpio.h"
-#include "hardware/i2c.h"
-#include "settings.h"
 #include <ctime>
 
+#if defined(I2C_HOST_BUILD)
+#define dbgprintf(...) ((void)0) ///< ホストビルドではデバッグ出力しない
+#define sleep_ms(ms) ((void)0)   ///< ホストビルドのAS3935Simは、キャパシタを変えるとすぐ周波数が変わる
+#else
+#include "pico/stdlib.h"
+#include "Settings.h"
 #include "printfDebug.h"
 
+extern Settings settings; // dbgprintfが出力の有無を判断する
+#endif
+
 // https://www.ne.jp/asahi/shared/o-family/ElecRoom/AVRMCOM/AS3935/AS3935_test.html
 // https://esphome.io/components/sensor/as3935.html
 
-using namespace ardPort;
-using namespace ardPort::spi;
 // ダイレクトコマンド
 #define PRESET_DEFAULT 0x3C96 ///< デフォルト値にリセットするためのダイレクトコマンド
 #define CALIB_RCO 0x3D96      ///< RCOキャリブレーションを開始するためのダイレクトコマンド
@@ -43,7 +45,7 @@ using namespace ardPort::spi;
 
 // Interrupt Noise LEVEL
 #define INTNOISE_TOHIGH 0b0001          ///< ノイズレベル過大割り込み
-#define INTNOISE_DISTERBERDETECT 0b0010 ///< ディスターバ検出割り込み
+#define INTNOISE_DISTERBERDETECT 0b0100 ///< ディスターバ検出割り込み（データシートのINT_D）
 #define INTNOISE_LIGHTNINGINTR 0b1000   ///< 雷検出割り込み
 #define INTNOISE_CLEARSTATSTICS 0b0000  ///< 統計情報クリア割り込み
 
@@ -54,11 +56,7 @@ using namespace ardPort::spi;
 
 
 
-// 設定情報
-extern Settings settings;
-
-AS3935::AS3935(Adafruit_ILI9341* a_pTft) :
-	m_pTft(a_pTft),
+AS3935::AS3935() :
 	m_bufAlarmSummary(100),
 	m_bufAlarmDist(100),
 	m_bufSingleEnergy(100),
@@ -71,7 +69,7 @@ AS3935::AS3935(Adafruit_ILI9341* a_pTft) :
  * @details
  * この関数は、AS3935雷センサーの初期化を行います。
  * 指定されたI2Cアドレス、I2Cポート番号、SDAピン、SCLピン、IRQピンを用いて、
- * I2C通信の初期化、IRQピンの初期化（gpio_init, gpio_set_dir）、
+ * I2C通信の初期化、IRQピンの初期化（トランスポートのinitIrqPin）、
  * そしてAS3935のレジスタをデフォルト値にリセット（PresetDefault）します。
  * いずれかの初期化に失敗した場合はfalseを返します。
  * センサー利用開始時に必ず呼び出してください。
@@ -92,11 +90,15 @@ bool AS3935::Init(uint8_t a_u8I2CAddress, uint8_t a_u8I2cPort, uint8_t a_u8SdaPi
 		return false; // I2C初期化失敗
 	}
 	// IRQピンの初期化
-	gpio_init(m_u8IrqPin);
-	gpio_set_dir(m_u8IrqPin, GPIO_IN);
+	m_pTransport->initIrqPin(m_u8IrqPin);
 
 	// AS3935の初期化処理
 	bRet = PresetDefault();
+	if (bRet == false) {
+		// SDAが固まっている可能性があるので、一度だけバス復旧を試みてから再送する
+		recoverBus();
+		bRet = PresetDefault();
+	}
 
 	return bRet;
 }
@@ -124,8 +126,8 @@ void AS3935::StartCalibration(uint16_t a_timeCalibration)
 	if (m_timeCalibration == 0) {
 		m_u8calibratedCap = 4;
 	} else {
-		writeRegAndData_1(REG00_AFEGB_PWD, (settings.value.gainBoost << 1));
-		writeRegAndData_1(REG01_NFLEV_WDTH, (settings.value.noiseFloor << 4) | settings.value.watchDogThreshold); // ノイズレベルとウォッチドッグスレッショルドを設定
+		writeRegAndData_1(REG00_AFEGB_PWD, (m_config.gainBoost << 1));
+		writeRegAndData_1(REG01_NFLEV_WDTH, (m_config.noiseFloor << 4) | m_config.watchDogThreshold); // ノイズレベルとウォッチドッグスレッショルドを設定
 		writeRegAndData_1(REG03_LCOFDIV_MDIST_INT, FDIV_RATIO_1_16 | MASK_DISTURBER_FALSE);                       // LCO Frequency Division Ratio = 1/16, Mask Disturber = 0, Interrupt = 0
 		/*
 		writeRegAndData_1(REG00_AFEGB_PWD, (AFE_GB_INDOOR << 1));
@@ -138,11 +140,12 @@ void AS3935::StartCalibration(uint16_t a_timeCalibration)
 	writeRegAndData_1(REG08_LCO_SRCO_TRCO_CAP, (DISPLCO_OFF | m_u8calibratedCap)); // キャリブレーションされたキャパシタの値を設定、IRQピンへの出力をオフにする
 	// AFEのゲインブースト、ノイズフロアレベル、ウォッチドッグスレッショルドを設定
 	Reset(); // AS3935をリセットして、設定を適用する
+	m_isConfigured = true; // 以降のバス復旧ではこの設定を再適用する
 
 	/*
-	writeRegAndData_1(REG00_AFEGB_PWD, (settings.value.gainBoost << 1));
-	writeRegAndData_1(REG01_NFLEV_WDTH, (settings.value.noiseFloor << 4) | settings.value.watchDogThreshold); // ノイズレベルとウォッチドッグスレッショルドを設定
-	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, (settings.value.minimumEvent << 4) || settings.value.spikeReject); // 最小イベント数とスパイクリジェクトを設定
+	writeRegAndData_1(REG00_AFEGB_PWD, (m_config.gainBoost << 1));
+	writeRegAndData_1(REG01_NFLEV_WDTH, (m_config.noiseFloor << 4) | m_config.watchDogThreshold); // ノイズレベルとウォッチドッグスレッショルドを設定
+	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, (m_config.minimumEvent << 4) || m_config.spikeReject); // 最小イベント数とスパイクリジェクトを設定
 	writeRegAndData_1(REG03_LCOFDIV_MDIST_INT, FDIV_RATIO_1_16 | MASK_DISTURBER_FALSE);                                // LCO Frequency Division Ratio = 1/16, Mask Disturber = 0, Interrupt = 0
 	*/
 }
@@ -153,7 +156,7 @@ void AS3935::StartCalibration(uint16_t a_timeCalibration)
  * 各キャパシタ値（0～15）ごとにIRQピンの周波数を測定し、frecCnt配列に格納します。
  * 測定した周波数はFDIV_RATIO_1_16の設定により1/16されているため、16倍して実際の周波数に戻します。
  * その後、各キャパシタ値での周波数と基準値（500000Hz）との差分を計算し、最も差分が小さいキャパシタ値をm_u8calibratedCapに保存します。
- * 測定結果はTFTディスプレイに表示され、最適なキャパシタ値をAS3935に設定します。
+ * 測定の進み具合はデバッグ出力に表示され、最適なキャパシタ値をAS3935に設定します。
  *
  * @return キャリブレーションで選択されたキャパシタ値での実測周波数（Hz）
  */
@@ -163,11 +166,11 @@ uint32_t AS3935::Calibrate()
 	uint32_t minDif = 0xFFFFFFFF; // 最小の周波数分周比
 	m_u8calibratedCap = 0;        // キャリブレーションされたキャパシタの値
 	// 周波数をカウントしていく
-	for (byte b = 0; b < 0x10; b++) {
+	for (uint8_t b = 0; b < 0x10; b++) {
 		writeRegAndData_1(REG08_LCO_SRCO_TRCO_CAP, DISPLCO_ON | (TUN_CAP_MASK & b));
-		delay(50);
+		sleep_ms(50);
 		// 指定した秒数（デフォルト１秒）の間、IRQピンの周波数をカウントする
-		frecCnt[b] = FreqCounter::start(m_u8IrqPin, m_timeCalibration);
+		frecCnt[b] = m_pTransport->countIrqPulses(m_u8IrqPin, m_timeCalibration);
 		// カウントを1000msに換算しておく
 		if (m_timeCalibration != 1000) {
 			frecCnt[b] = uint32_t(((double)frecCnt[b] / (double)m_timeCalibration) * 1000); // 1秒間のパルス数（周波数）を取得
@@ -179,7 +182,6 @@ uint32_t AS3935::Calibrate()
 			minDif = curDif;       // 最小の周波数分周比を更新
 			m_u8calibratedCap = b; // キャリブレーションされたキャパシタの値を更新
 		}
-		// m_pTft->printf("Cap:%3dpF Freq:%4.1fKHz\n", b * 8, (float)frecCnt[b] / 1000);
 		dbgprintf("o");
 	}
 	dbgprintf("\n");
@@ -193,10 +195,12 @@ uint32_t AS3935::Calibrate()
  * レジスタREG03_LCOFDIV_MDIST_INTのINTフラグや、REG07_DISTの距離推定値、
  * REG02_CLSTAT_MINNUMLIGH_SREJのステータスなどを参照し、
  * ノイズやディスターバ（誤検出）でないかを判定します。
+ * トレース記録が設定されている場合は、読み出したレジスタ値をIRQ時刻とともに記録します。
  *
+ * @param a_u64IrqUs IRQ発生時刻（us）。0の場合は読み出し時の時刻を使う
  * @return 有効な雷信号と判定した場合true、ノイズや誤検出の場合はfalse
  */
-AS3935_SIGNAL AS3935::validateSignal()
+AS3935_SIGNAL AS3935::validateSignal(uint64_t a_u64IrqUs)
 {
 	/*
 	テスト。検出を強制的に登録する
@@ -265,29 +269,34 @@ AS3935_SIGNAL AS3935::validateSignal()
 	uint8_t u8LIGMM;
 	unsigned long lEnergy = 0; // 雷のエネルギーを格納する変数
 
-	if (settings.geti2cReadMode() == 1) {
-		uint8_t regBuffer[9] = {0};
+	uint8_t regBuffer[9] = {0}; // REG00～REG08（シングルリード時はREG03～REG07のみ）
+	uint16_t u16RegMask;        // 実際に読んだレジスタ（トレースの有効ビット）
+	if (m_config.isBlockRead) {
 		readBlockReg(regBuffer); // レジスタの値を読み込む
+		u16RegMask = SENSOR_TRACE_ALL_REGS;
 		dbgprintf("validateSignal: I2C Bulk Read : ");
 		for (int i = 0; i < 9; i++) {
 			dbgprintf("  %d-", regBuffer[i]);
 		}
 		dbgprintf("\n");
-		u8IntSrc = regBuffer[3] & 0x0F; // REG03_LCOFDIV_MDIST_INTの下位4ビットを取得
-		u8Dist = regBuffer[7] & 0x3F;           // 距離推定値を取得（0x00: 検出なし, 0x01-0x3F: 距離, 0x3F: 遠すぎる）
-		u8LIGL = regBuffer[4];                  // 雷のエネルギーを読み込む
-		u8LIGM = regBuffer[5];                  // 雷のエネルギーを読み込む
-		u8LIGMM = regBuffer[6];                 // 雷のエネルギーを読み込む
-
 	} else {
 		dbgprintf("validateSignal: I2C Single Read\n");
-		u8IntSrc = readReg(REG03_LCOFDIV_MDIST_INT) & 0x0F;
-		dbgprintf("validateSignal: I2C Single Read : u8IntSrc:%02X\n", u8IntSrc);
-		u8Dist = readReg(REG07_DIST) /*& 0x3F*/; // 距離推定値を取得（0x00: 検出なし, 0x01-0x3F: 距離, 0x3F: 遠すぎる）
-		u8LIGL = readReg(REG04_S_LIGL);          // 雷のエネルギーを読み込む
-		u8LIGM = readReg(REG05_S_LIGM);          // 雷のエネルギーを読み込む
-		u8LIGMM = readReg(REG06_S_LIGMM);        // 雷のエネルギーを読み込む
+		regBuffer[REG03_LCOFDIV_MDIST_INT] = readReg(REG03_LCOFDIV_MDIST_INT);
+		dbgprintf("validateSignal: I2C Single Read : u8IntSrc:%02X\n", regBuffer[REG03_LCOFDIV_MDIST_INT] & 0x0F);
+		regBuffer[REG07_DIST] = readReg(REG07_DIST);
+		regBuffer[REG04_S_LIGL] = readReg(REG04_S_LIGL);
+		regBuffer[REG05_S_LIGM] = readReg(REG05_S_LIGM);
+		regBuffer[REG06_S_LIGMM] = readReg(REG06_S_LIGMM);
+		u16RegMask = (1 << REG03_LCOFDIV_MDIST_INT) | (1 << REG04_S_LIGL) | (1 << REG05_S_LIGM) | (1 << REG06_S_LIGMM) | (1 << REG07_DIST);
 	}
+	if (m_pRecorder != nullptr) {
+		m_pRecorder->record((a_u64IrqUs != 0) ? a_u64IrqUs : m_pTransport->timeUs(), regBuffer, u16RegMask); // 再生用にIRQ時刻と、読んだレジスタだけを有効にした生データを記録
+	}
+	u8IntSrc = regBuffer[REG03_LCOFDIV_MDIST_INT] & 0x0F; // REG03_LCOFDIV_MDIST_INTの下位4ビットを取得
+	u8Dist = regBuffer[REG07_DIST] & 0x3F;                // 距離推定値を取得（0x00: 検出なし, 0x01-0x3F: 距離, 0x3F: 遠すぎる）
+	u8LIGL = regBuffer[REG04_S_LIGL];                     // 雷のエネルギーを読み込む
+	u8LIGM = regBuffer[REG05_S_LIGM];                     // 雷のエネルギーを読み込む
+	u8LIGMM = regBuffer[REG06_S_LIGMM];                   // 雷のエネルギーを読み込む
 
 	dbgprintf("validateSignal: u8IntSrc:%02X u8Dist:%02X u8LIGL:%02X u8LIGM:%02X u8LIGMM:%02X\n", u8IntSrc, u8Dist, u8LIGL, u8LIGM, u8LIGMM);
 
@@ -371,20 +380,14 @@ AS3935_SIGNAL AS3935::validateSignal()
 uint8_t AS3935::readReg(uint8_t reg)
 {
 	uint8_t val = 0;
-	// レジスタアドレス送信（リピートスタート）
-	i2c_write_blocking((m_u8I2cPort == 0 ? i2c0 : i2c1), m_u8I2CAddress, &reg, 1, true);
-	// データ受信
-	i2c_read_blocking((m_u8I2cPort == 0 ? i2c0 : i2c1), m_u8I2CAddress, &val, 1, false);
+	readRegs(reg, &val, 1); // レジスタアドレス送信（リピートスタート）後にデータ受信
 	return val;
 }
 
 void AS3935::readBlockReg(uint8_t* a_regVal)
 {
-	uint8_t* regVal = a_regVal;
-	uint8_t reg = REG00_AFEGB_PWD;
-	i2c_write_blocking((m_u8I2cPort == 0 ? i2c0 : i2c1), m_u8I2CAddress, &reg, 1, true);
 	int iReadCnt;
-	iReadCnt = i2c_read_blocking((m_u8I2cPort == 0 ? i2c0 : i2c1), m_u8I2CAddress, regVal, 9, false); // REG00_AFEGB_PWD
+	iReadCnt = readRegs(REG00_AFEGB_PWD, a_regVal, 9); // REG00_AFEGB_PWD～REG08_LCO_SRCO_TRCO_CAP
 	dbgprintf("AS3935 readBlockReg: %d bytes read, ",iReadCnt);
 	for (int i = 0; i < 9; i++) {
 		dbgprintf("%02X-\n", a_regVal[i]);
@@ -483,12 +486,34 @@ bool AS3935::GetLatestFalseAlarm(uint8_t idx, uint8_t& a_u8AlarmSummary, uint8_t
 void AS3935::Reset()
 {
 	// PresetDefault();
-	writeRegAndData_1(REG00_AFEGB_PWD, (settings.value.gainBoost << 1));
-	writeRegAndData_1(REG01_NFLEV_WDTH, (settings.value.noiseFloor << 4) | settings.value.watchDogThreshold);                      // ノイズレベルとウォッチドッグスレッショルドを設定
-	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b00000000 | (settings.value.minimumEvent << 4) | settings.value.spikeReject); // 最小イベント数とスパイクリジェクトを設定
+	writeRegAndData_1(REG00_AFEGB_PWD, (m_config.gainBoost << 1));
+	writeRegAndData_1(REG01_NFLEV_WDTH, (m_config.noiseFloor << 4) | m_config.watchDogThreshold);                      // ノイズレベルとウォッチドッグスレッショルドを設定
+	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b00000000 | (m_config.minimumEvent << 4) | m_config.spikeReject); // 最小イベント数とスパイクリジェクトを設定
 	writeRegAndData_1(REG03_LCOFDIV_MDIST_INT, FDIV_RATIO_1_16 | MASK_DISTURBER_FALSE);                                            // LCO Frequency Division Ratio = 1/16, Mask Disturber = 0, Interrupt = 0
-	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b01000000 | (settings.value.minimumEvent << 4) | settings.value.spikeReject); // 内部データのクリア。ビット６をストローブする
-	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b00000000 | (settings.value.minimumEvent << 4) | settings.value.spikeReject); //
-	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b01000000 | (settings.value.minimumEvent << 4) | settings.value.spikeReject); //
+	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b01000000 | (m_config.minimumEvent << 4) | m_config.spikeReject); // 内部データのクリア。ビット６をストローブする
+	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b00000000 | (m_config.minimumEvent << 4) | m_config.spikeReject); //
+	writeRegAndData_1(REG02_CLSTAT_MINNUMLIGH_SREJ, 0b01000000 | (m_config.minimumEvent << 4) | m_config.spikeReject); //
 	writeRegAndData_1(REG08_LCO_SRCO_TRCO_CAP, (DISPLCO_OFF | m_u8calibratedCap));                                                 // キャリブレーションされたキャパシタの値を設定する
 }
+
+/**
+ * @brief I2Cバス復旧後にAS3935の設定を再適用する
+ * @details
+ * キャリブレーション完了前はデフォルト値へのリセット（PresetDefault）のみ行います。
+ * キャリブレーション後は、Reset()で設定値とキャリブレーション済みキャパシタ値を書き戻し、
+ * REG08を読み戻して値が反映されていることを確認します。
+ *
+ * @retval true  再設定成功
+ * @retval false 再設定失敗
+ */
+bool AS3935::onBusRecovered()
+{
+	if (m_isConfigured == false) {
+		return PresetDefault();
+	}
+	Reset();
+	uint8_t u8Reg08 = 0;
+	if (readRegs(REG08_LCO_SRCO_TRCO_CAP, &u8Reg08, 1) < 0) return false;
+	dbgprintf("AS3935::onBusRecovered: REG08:%02X\n", u8Reg08);
+	return (u8Reg08 & TUN_CAP_MASK) == m_u8calibratedCap;
+}
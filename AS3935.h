@@ -4,11 +4,7 @@
 #include <ctime>
 #include "RingBuffer.h"
 #include "I2CBase.h"
-#include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
-// Forward declaration to avoid include errors if only pointer is used
-
-using namespace ardPort;
-using namespace ardPort::spi;
+#include "SensorTrace.h"
 
 //  Analog Front End Gain Boost
 #define AFE_GB_MIN 0b00000     ///< AFEゲインブースト最小値（0）
@@ -64,6 +60,21 @@ using namespace ardPort::spi;
 #define WDTH (WDTH_DEFAULT) // デフォルトのウォッチドッグスレッショルドを設定
 */
 
+/**
+ * @brief AS3935に書き込む設定値
+ * @details
+ * アプリケーションがSettingsの値を詰めて AS3935::setConfig() で渡す。AS3935クラスは液晶やSettingsに依存しないので、
+ * I2C_HOST_BUILDを定義したホストビルドでもAS3935Simと組み合わせて動かせる。
+ */
+struct AS3935Config {
+	uint8_t gainBoost = AFE_GB_INDOOR;          ///< AFEゲインブースト（0-31）
+	uint8_t noiseFloor = NFLEV_DEF;             ///< ノイズフロアレベル（0-7）
+	uint8_t watchDogThreshold = WDTH_DEFAULT;   ///< ウォッチドッグスレッショルド（0-15）
+	uint8_t spikeReject = SREJ_DEFAULT;         ///< スパイクリジェクト
+	uint8_t minimumEvent = NUMLIGHT_DEFAULT;    ///< 最小イベント数（0-3）
+	bool isBlockRead = false;                   ///< REG00～REG08をまとめて読むか（falseなら必要なレジスタだけ読む）
+};
+
 enum AS3935_SIGNAL {
 	NONE = 0,    // 信号が無効(信号なし)
 	VALID = 1,   // 信号が有効（雷の検出）
@@ -74,12 +85,13 @@ enum AS3935_SIGNAL {
 class AS3935 : public I2CBase
 {
   private:
-	Adafruit_ILI9341* m_pTft;
-
+	AS3935Config m_config; // レジスタに書き込む設定値
 	uint8_t m_u8IrqPin;
 	uint8_t m_u8calibratedCap;
 	uint16_t m_timeCalibration;
 	uint32_t m_FreqCalibration;
+	bool m_isConfigured = false; // キャリブレーション済みで、バス復旧時に設定を再適用できるか
+	SensorTraceRecorder* m_pRecorder = nullptr; // IRQトレースの記録先（nullptrなら記録しない）
 
 	AS3935_SIGNAL m_latestSignalValid = AS3935_SIGNAL::NONE; // 最新の信号が有効かどうか
 	uint8_t m_latestBufAlarmSummary = 0;
@@ -87,6 +99,16 @@ class AS3935 : public I2CBase
 	int m_latestBufSingleEnergy = 0;
 	time_t m_latestBufDateTime = 0; // 最新の日時
 
+  protected:
+	/**
+	 * @brief I2Cバス復旧後にAS3935の設定を再適用する
+	 * @details
+	 * キャリブレーション済みであれば設定値とキャパシタ値を書き戻し、REG08の読み戻しで確認する。
+	 * @retval true 再設定成功
+	 * @retval false 再設定失敗
+	 */
+	bool onBusRecovered() override;
+
   public:
 	const uint8_t SUMM_NONE = 0x00;     // アラームサマリー
 	const uint8_t SUMM_THUNDER = 0x01;  // アラームサマリー
@@ -115,7 +137,14 @@ class AS3935 : public I2CBase
     uint32_t getFreqCalibration() const { return m_FreqCalibration; }
 
   public:
-	AS3935(Adafruit_ILI9341* a_pTft);
+	AS3935();
+	/**
+	 * @brief レジスタに書き込む設定値を指定する
+	 * @details 書き込むのは次の Reset()（キャリブレーション、バス復旧を含む）のとき。
+	 * @param a_config 設定値
+	 */
+	void setConfig(const AS3935Config& a_config) { m_config = a_config; }
+	const AS3935Config& getConfig() const { return m_config; } ///< レジスタに書き込む設定値
 	bool Init(uint8_t a_u8IU2cAddress, uint8_t a_u8I2cPort, uint8_t a_u8SdaPin, uint8_t a_u8SclPin, uint8_t a_u8IrqPin);
 	// キャリブレーション実行
 	uint32_t Calibrate();
@@ -123,7 +152,12 @@ class AS3935 : public I2CBase
 	bool PresetDefault();
 	void StartCalibration(uint16_t a_timeCalibration = 1000); // デフォルトで1秒間キャリブレーションを行う
 
-	AS3935_SIGNAL validateSignal();
+	AS3935_SIGNAL validateSignal(uint64_t a_u64IrqUs = 0);
+	/**
+	 * @brief IRQトレースの記録先を設定する
+	 * @param a_pRecorder 記録先（nullptrで記録しない）
+	 */
+	void setRecorder(SensorTraceRecorder* a_pRecorder) { m_pRecorder = a_pRecorder; }
 	/**
 	 * @brief 指定レジスタから1バイト読み出す
 	 * @details
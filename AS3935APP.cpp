@@ -12,13 +12,23 @@
 #include "lib-9341/XPT2046_Touchscreen/XPT2046_Touchscreen.h"
 // 漢字フォント情報ファイル　　　　　　　　　＜＜＜＜＜　追加　　（４）　
 #include "Kanji/Fonts/JF-Dot-Shinonome16_16x16_ALL.inc"
-#include "pictData.h" // 画像データ
+#if defined(AS3935_TEXT_BENCH)
+#include "Kanji/Fonts/misaki_gothic_2nd_08x08_ALL.inc"
+#include "Kanji/Fonts/JF-Dot-Shinonome12_12x12_ALL.inc"
+#include "Kanji/Fonts/ipag_24x24_SCHOOL.inc"
+#endif
+#include "pictPacked.h" // 画像データ（アイコンは透過しない区間で表したスプライト）
 #include "FlashMem.h"
 #include "Settings.h"
 #include "InetAction.h"
 #include "DispClock.h"
 #include "TouchCalibration.h"
 #include "GUIMsgBox.h"
+#include "SensorTrace.h"
+#include "AS3935Sim.h"
+#include "StormGenerator.h"
+#include "MainScreen.h"
+#include "Kanji/GlyphCache.h"
 
 #include "pico/cyw43_arch.h"
 #include "pico/stdlib.h"
@@ -36,6 +46,7 @@ using namespace ardPort::spi;
 #define TFT_DC 20   ///< 液晶画面のDCピン番号（データ/コマンド切替）
 #define TFT_RST 21  ///< 液晶画面のリセットピン番号
 #define TFT_CS 22   ///< 液晶画面のチップセレクトピン番号
+#define TFT_PIO_FREQ 62500000 ///< PIOで液晶に送るときのSCK周波数（clk_sys 125MHzの1/2）
 
 #define TOUCH_MISO 16 ///< タッチパネルのMISOピン番号（SPIデータ入力）
 #define TOUCH_CS 17   ///< タッチパネルのチップセレクトピン番号
@@ -114,11 +125,16 @@ bool InitDMA()
 	return RetVal;
 }
 bool isIRQTriggered = false; // IRQがトリガーされたかどうかのフラグ
+SensorTraceRecorder traceRecorder; // IRQトレースの記録先
+#define GLYPH_CACHE_BUDGET (16 * 1024) ///< 展開済み文字のキャッシュに使うメモリ（バイト）
+GlyphCache glyphCache; // 展開済み文字のキャッシュ
+TftPioStream tftPio;   // 液晶へのPIOの送信経路（ウインドウ指定とピクセルをまとめて送る）
 /// @brief IRQピンの割り込みに対するコールバック関数
 /// @param gpio
 /// @param events
 static void as3935IRQCallback(uint gpio, uint32_t events)
 {
+	irqTimeUs = time_us_64(); // IRQの発生時刻を記録
 	isIRQTriggered = true; // IRQがトリガーされたことを記録
 }
 /// @brief 	タイマー割り込みのコールバック関数
@@ -148,116 +164,6 @@ enum APPMode {
 	APP_MODE_NORMAL,   // キャリブレーションモード
 	APP_MODE_SETTING,  // エラーモード
 } appMode;
-bool mustRedraw = false;
-// 雷センサーの画面表示
-void mainDisplay(Adafruit_ILI9341& tft, AS3935& as3935, bool isSignal, bool isBanner, bool isClock, bool isBody)
-{
-	if (mustRedraw) {
-		isBanner = true;
-		isClock = true;
-		isBody = true;
-		isSignal = false;   // 強制再描画の場合、信号検出は行わない。IRQがトリガーされていないのにvalidateSignalを呼びだしてレジスタアクセスしないようにするため。
-		mustRedraw = false; // 再描画フラグをリセット
-	}
-	if (isBanner) {
-		tft.fillScreen(STDCOLOR.SUPERDARK_GRAY); // 画面を暗い灰色で塗りつぶす
-		tft.setCursor(0, 2);
-		tft.fillRoundRect(0, 0, 240, 20, 4, STDCOLOR.DARK_GRAY); // 画面の上部に帯を描画
-		tft.setTextColor(STDCOLOR.WHITE, STDCOLOR.WHITE);
-		tft.printf("Lightning Sensor\n");
-		tft.setCursor(0, 22);
-		if (settings.getIsEnableWifi()) {
-			tft.drawRGBBitmap(240 - 16, 2, wifiIcon_OK, 16, 16, STDCOLOR.BLACK);
-		} else {
-			tft.drawRGBBitmap(240 - 16, 2, wifiIcon_NG, 16, 16, STDCOLOR.BLACK);
-		}
-	}
-	if (isBody) {
-		uint8_t u8Summary;
-		uint8_t u8Distance;
-		long lEnergy;
-		time_t eventtime;
-
-		// 最新情報表示エリアをクリア
-		tft.fillRect(0, 100, 240, 32, STDCOLOR.SUPERDARK_GRAY); // 前のメッセージを消す
-		tft.setTextColor(STDCOLOR.WHITE, STDCOLOR.SUPERDARK_GRAY);
-		tft.setCursor(0, 100);
-
-		// 雷信号の検証
-		AS3935_SIGNAL sigValid;
-		if (isSignal) {
-			sleep_ms(2); // 300ミリ秒待機してから信号を検証
-			sigValid = as3935.validateSignal();
-			time_t tm = time(NULL);
-			struct tm* t = localtime(&tm);
-			// 　こちらは信号を検出したことに伴うもの
-			if (sigValid == AS3935_SIGNAL::VALID) {
-				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.RED); // 検出された場合は黄色の丸を表示
-			} else if (sigValid == AS3935_SIGNAL::INVALID) {
-				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.YELLOW); // 無効な信号の場合は赤色の丸を表示
-			} else if (sigValid == AS3935_SIGNAL::STATCLEAR) {
-				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.GREEN); // 信号がない場合は青色の丸を表示
-			} else {
-				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.DARK_BLUE); // その他の場合は灰色の丸を表示
-			}
-
-			if (sigValid == AS3935_SIGNAL::VALID || sigValid == AS3935_SIGNAL::INVALID) { // 雷が検出された場合
-				tft.printf("%02d/%02d %02d:%02d:%02d %s %s\n", t->tm_mon, t->tm_mday, t->tm_hour, t->tm_min, t->tm_sec, (sigValid == AS3935_SIGNAL::VALID) ? "検出" : "ーー", as3935.getLatestSummaryStr());
-				tft.printf("距離:%3d km 強さ:%d\n", as3935.getLatestDist(), as3935.getLatestEnergy());
-			} else {
-				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.BLUE);
-				tft.fillRect(0, 100, 240, 32, STDCOLOR.SUPERDARK_GRAY); // 前のメッセージを消す
-				tft.setTextColor(STDCOLOR.GRAY, STDCOLOR.SUPERDARK_GRAY);
-				tft.setCursor(0, 100);
-			}
-		} else {
-			// こちらは画面再描画に伴うもの
-			AS3935_SIGNAL sigValid = as3935.getLatestSignalValid();
-			if (sigValid == AS3935_SIGNAL::VALID || sigValid == AS3935_SIGNAL::INVALID) { // 雷が検出された場合
-				time_t tm = as3935.getLatestDateTime();
-				struct tm* t = localtime(&tm);
-				tft.printf("%02d/%02d %02d:%02d:%02d %s %s\n", t->tm_mon, t->tm_mday, t->tm_hour, t->tm_min, t->tm_sec, (sigValid == AS3935_SIGNAL::VALID) ? "検出" : "ーー", as3935.getLatestSummaryStr());
-				tft.printf("距離:%3d km 強さ:%d\n", as3935.getLatestDist(), as3935.getLatestEnergy());
-			} else {
-				tft.fillRect(0, 100, 240, 32, STDCOLOR.SUPERDARK_GRAY); // 前のメッセージを消す
-				tft.setTextColor(STDCOLOR.GRAY, STDCOLOR.SUPERDARK_GRAY);
-				tft.setCursor(0, 100);
-			}
-			as3935.GetLatestAlarm(0, u8Summary, u8Distance, lEnergy, eventtime);
-		}
-		tft.setTextColor(STDCOLOR.WHITE, STDCOLOR.SUPERDARK_GRAY);
-
-		// 最新から5個のアラームをアイコンで表示
-		tft.setCursor(0, 150);
-
-		for (int i = 0; i < 8; i++) {
-			int16_t curY = tft.getCursorY();
-			bool bRet = as3935.GetLatestEvent(i, u8Summary, u8Distance, lEnergy, eventtime);
-			if (bRet == false) {
-				break; // 取得できなかったら終了
-			}
-			struct tm* t = localtime(&eventtime);
-			int hour = t->tm_hour;
-			int min = t->tm_min;
-			if (u8Summary == as3935.SUMM_THUNDER) {
-				tft.drawRGBBitmap((int16_t)0, curY, picThndr, 15, 15, STDCOLOR.BLACK);
-				tft.setCursor(24, curY);
-				tft.printf("%02d:%02d  %3d km 強さ %d\n", hour, min, u8Distance, lEnergy);
-			} else {
-				tft.drawRGBBitmap((int16_t)0, curY, picFalse, 15, 15, STDCOLOR.BLACK);
-				tft.setCursor(24, curY);
-				tft.printf("%02d:%02d  --- km\n", hour, min, u8Distance);
-			}
-		}
-		// マークを消して、元の状態に戻す
-		tft.fillRect(0, 320 - 20, 16, 16, STDCOLOR.SUPERDARK_GRAY);
-	}
-
-	if (isClock) {
-		// それ以外の処理があればここに追加
-		DispClock::show(32, 30); // 時計の更新
-	}
-}
 
 /**
  * @brief アプリケーションの初期化処理
@@ -276,7 +182,7 @@ void mainDisplay(Adafruit_ILI9341& tft, AS3935& as3935, bool isSignal, bool isBa
 void Initialize(Adafruit_ILI9341& tft, XPT2046_Touchscreen& ts, AS3935& as3935 , InetAction& iNet)
 {
 	// 画面を黒で塗りつぶす　　　　　　　　　　　　＜＜＜＜＜　追加　（５）　
-	tft.fillScreen(ILI9341_BLACK);
+	clearScreen(tft, ILI9341_BLACK);
 
 	tft.fillRect(0, 0, 240, 24, STDCOLOR.BLUE);
 	tft.setTextColor(STDCOLOR.WHITE, STDCOLOR.BLUE);
@@ -289,6 +195,7 @@ void Initialize(Adafruit_ILI9341& tft, XPT2046_Touchscreen& ts, AS3935& as3935 ,
 	// --- I2C初期化とAS3935のIRQピン設定 ---
 	{
 		tft.printlocf(0, 20, "I2C");
+		as3935.setConfig(settings.getAS3935Config()); ///< レジスタに書き込む設定値
 		bool bRet = as3935.Init(settings.value.i2cAddr, I2C_PORT, I2C_SDA, I2C_SCL, AS3935_IRQ); ///< AS3935の初期化
 		if (bRet) {
 			tft.printlocf(200, 20, "〇\n");
@@ -389,6 +296,147 @@ void Initialize(Adafruit_ILI9341& tft, XPT2046_Touchscreen& ts, AS3935& as3935 ,
 }
 
 
+#if defined(AS3935_REPLAY)
+/**
+ * @brief フラッシュに保存したIRQトレースを再生する
+ * @details
+ * SENSOR_TRACE_FLASH_BLOCKからトレースを読み込み、AS3935のトランスポートをAS3935Simに差し替えて
+ * validateSignal～表示処理を1倍速で再実行する。終了後は実機のトランスポートに戻す。
+ * 処理時間の集計はシリアルに出力する。
+ * @param tft TFTディスプレイ
+ * @param as3935 AS3935インスタンス
+ * @retval なし
+ */
+static void replayTrace(Adafruit_ILI9341& tft, AS3935& as3935)
+{
+	static uint8_t buf[sizeof(SensorTraceHeader) + sizeof(SensorTraceRecord) * SENSOR_TRACE_CAPACITY];
+	FlashMem flash(SENSOR_TRACE_FLASH_BLOCK, 1);
+	flash.read(0, buf, sizeof(buf));
+	static AS3935Sim sim(settings.value.i2cAddr);
+	SensorTraceReplay replay(&sim);
+	if (replay.load(buf, sizeof(buf)) == false) {
+		dbgprintf("replayTrace: no trace in flash\n");
+		return;
+	}
+	struct Ctx {
+		Adafruit_ILI9341* pTft;
+		AS3935* pAs3935;
+	} ctx = {&tft, &as3935};
+	as3935.setRecorder(nullptr);
+	as3935.setTransport(&sim);
+	as3935.InitI2C(settings.value.i2cAddr, I2C_PORT, I2C_SDA, I2C_SCL);
+	replay.setClock([]() { return time_us_64(); }, [](uint64_t us) { sleep_us(us); });
+	SensorReplayStats stats;
+	replay.run(true, [](void* p) {
+		Ctx* c = static_cast<Ctx*>(p);
+		irqTimeUs = time_us_64();
+		mainDisplay(*c->pTft, *c->pAs3935, true, false, false, true);
+	}, &ctx, stats);
+	printf("replay: events:%lu irqs:%lu avg:%lluus max:%luus elapsed:%llums\n", stats.events, stats.irqs,
+	       (stats.irqs > 0) ? stats.pipelineUs / stats.irqs : 0, stats.pipelineMaxUs, stats.elapsedUs / 1000);
+	as3935.setTransport(nullptr);
+	as3935.InitI2C(settings.value.i2cAddr, I2C_PORT, I2C_SDA, I2C_SCL);
+	as3935.setRecorder(&traceRecorder);
+}
+#endif
+
+#if defined(AS3935_TEXT_BENCH)
+/**
+ * @brief 文字描画の速度（文字/秒）を計測する
+ * @details
+ * 8/12/16/24ドットのフォントそれぞれで、背景あり（ウインドウ描画）・透過・２倍拡大の３通りを計測し、シリアルに出力する。
+ * 終了後は16ドットフォントに戻し、画面の再描画を要求する。
+ * @param tft TFTディスプレイ
+ * @retval なし
+ */
+static void textBench(Adafruit_ILI9341& tft)
+{
+	static const struct {
+		const char* name;
+		const KanjiData* pFont;
+		const uint8_t* pBmp;
+	} fonts[] = {
+		{"8", misaki_gothic_2nd_08x08_ALL, misaki_gothic_2nd_08x08_ALL_bitmap},
+		{"12", JFDotShinonome12_12x12_ALL, JFDotShinonome12_12x12_ALL_bitmap},
+		{"16", JFDotShinonome16_16x16_ALL, JFDotShinonome16_16x16_ALL_bitmap},
+		{"24", ipag_24x24_SCHOOL, ipag_24x24_SCHOOL_bitmap},
+	};
+	static const char* text = "雷検出距離強さ0123456789km"; // 20文字
+	const int textChars = 20;
+	const int loops = 20;
+
+	for (auto& f : fonts) {
+		tft.setFont(f.pFont, f.pBmp);
+		for (int mode = 0; mode < 3; mode++) {
+			clearScreen(tft, ILI9341_BLACK);
+			tft.setTextSize(mode == 2 ? 2 : 1);
+			if (mode == 1) {
+				tft.setTextColor(STDCOLOR.WHITE); // 透過
+			} else {
+				tft.setTextColor(STDCOLOR.WHITE, STDCOLOR.DARK_BLUE);
+			}
+			uint64_t start = time_us_64();
+			for (int i = 0; i < loops; i++) {
+				tft.setCursor(0, (i * 24) % 280);
+				tft.print(text);
+			}
+			uint64_t us = time_us_64() - start;
+			printf("text font:%s %s: %lu chars/s\n", f.name, (mode == 0) ? "opaque" : (mode == 1) ? "transparent" : "x2",
+			       (unsigned long)((uint64_t)textChars * loops * 1000000 / (us ? us : 1)));
+		}
+	}
+	tft.setTextSize(1);
+	tft.setFont(JFDotShinonome16_16x16_ALL, JFDotShinonome16_16x16_ALL_bitmap);
+	mustRedraw = true;
+}
+#endif
+
+#if defined(AS3935_STORM_BENCH)
+/**
+ * @brief 疑似雷雨で取りこぼしベンチマークを行う
+ * @details
+ * AS3935のトランスポートをAS3935Simに差し替え、発生率を上げながらStormBenchを実行する。
+ * パイプラインは実機と同じvalidateSignal～表示処理で、処理時間は実時間で計測する。
+ * 結果はシリアルに出力し、終了後は実機のトランスポートに戻す。
+ * @param tft TFTディスプレイ
+ * @param as3935 AS3935インスタンス
+ * @retval なし
+ */
+static void stormBench(Adafruit_ILI9341& tft, AS3935& as3935)
+{
+	static AS3935Sim sim(settings.value.i2cAddr);
+	struct Ctx {
+		Adafruit_ILI9341* pTft;
+		AS3935* pAs3935;
+	} ctx = {&tft, &as3935};
+	as3935.setRecorder(nullptr);
+	as3935.setTransport(&sim);
+	as3935.InitI2C(settings.value.i2cAddr, I2C_PORT, I2C_SDA, I2C_SCL);
+	as3935.Reset(); ///< 設定値（最小雷数・MASK_DIST等）をモデルにも反映する
+	static const double rates[] = {0.5, 2, 5, 10, 20};
+	for (double rate : rates) {
+		StormConfig config = StormGenerator::defaultConfig();
+		config.eventsPerSec = rate;
+		config.durationSec = 60;
+		StormGenerator gen(config);
+		StormBench bench(&sim);
+		bench.setClock([]() { return time_us_64(); });
+		StormBenchStats stats;
+		bench.run(gen, [](void* p) {
+			Ctx* c = static_cast<Ctx*>(p);
+			mainDisplay(*c->pTft, *c->pAs3935, true, false, false, true);
+		}, &ctx, stats);
+		printf("storm %4.1f/s: gen:%lu filt:%lu drop:%lu proc:%lu lat p50:%lu p90:%lu p99:%lu max:%luus cpu:%luus/ev\n", rate,
+		       stats.generated, stats.filtered, stats.dropped, stats.processed,
+		       stats.latencyP50, stats.latencyP90, stats.latencyP99, stats.latencyMax, stats.cpuUsPerEvent);
+	}
+	as3935.setTransport(nullptr);
+	as3935.InitI2C(settings.value.i2cAddr, I2C_PORT, I2C_SDA, I2C_SCL);
+	as3935.setRecorder(&traceRecorder);
+	mustRedraw = true;
+}
+#endif
+
 /**
  * @brief アプリケーションのエントリーポイント
  * @details
@@ -415,11 +463,21 @@ int main()
 	SPI.setTX(TFT_MOSI); ///< SPI0のTX(MOSI)ピン設定
 	SPI.setSCK(TFT_SCK); ///< SPI0のSCKピン設定
 	tft.begin(); ///< TFT初期化
+	// 大きな描画はPIOで送る（Wi-Fiチップのドライバはpio1を優先して使うのでpio0）。使えなければSPIのまま
+	if (tftPio.init(pio0, TFT_SCK, TFT_MOSI, TFT_DC, TFT_CS, TFT_PIO_FREQ)) {
+		tft.setPioStream(&tftPio);
+	}
 
-	AS3935 as3935(&tft); ///< 雷センサインスタンス
+	AS3935 as3935; ///< 雷センサインスタンス
+	as3935.setRecorder(&traceRecorder); ///< IRQトレースを記録する
 
 	// 漢字フォント設定
 	tft.setFont(JFDotShinonome16_16x16_ALL, JFDotShinonome16_16x16_ALL_bitmap); ///< 日本語フォント設定
+	mainScreenInit(tft, JFDotShinonome16_16x16_ALL, JFDotShinonome16_16x16_ALL_bitmap); ///< 時計・最新情報・イベント履歴の描画先（行キャンバスにも日本語フォントを設定）
+	if (glyphCache.init(GLYPH_CACHE_BUDGET)) { ///< よく使う文字を展開済みで保持する
+		tft.setGlyphCache(&glyphCache);
+		compositor.getCanvas()->setGlyphCache(&glyphCache);
+	}
 	// 文字表示高速化
 	tft.useWindowMode(true); ///< ウィンドウモード有効化
 
@@ -432,7 +490,7 @@ int main()
 			delay(100);
 			touchCnt++;
 			if (touchCnt > 20) { ///< 2秒以上タッチで初期化ダイアログ
-				tft.fillScreen(ILI9341_BLACK); ///< 画面クリア
+				clearScreen(tft, ILI9341_BLACK); ///< 画面クリア
 				touchCnt = 0; ///< カウンタリセット
 				GUIMsgBox msgbox(&tft, &ts);
 				bool bRet = msgbox.showOKCancel(30, 100, "確認", "設定を初期化します", "  OK  ", " CANCEL");
@@ -448,7 +506,7 @@ int main()
 	// シリアルデバッグ有効時はユーザー操作待機
 	if (settings.isSerialDebug()) {
 		GUIMsgBox msgbox(&tft, &ts);
-		tft.fillScreen(ILI9341_BLACK); ///< 画面クリア
+		clearScreen(tft, ILI9341_BLACK); ///< 画面クリア
 		msgbox.showOK(30, 100, "シリアルデバッグ", "COMポートを接続後、\nOKを押してください。", "  OK  ");
 	}
 
@@ -457,6 +515,15 @@ int main()
 	delay(1000); ///< 初期化後の待機
 
 	mainDisplay(tft, as3935, false, true, false, false); ///< 初期画面バナー表示
+#if defined(AS3935_REPLAY)
+	replayTrace(tft, as3935); ///< 保存したトレースを再生する
+#endif
+#if defined(AS3935_STORM_BENCH)
+	stormBench(tft, as3935); ///< 疑似雷雨で取りこぼしを計測する
+#endif
+#if defined(AS3935_TEXT_BENCH)
+	textBench(tft); ///< 文字描画の速度を計測する
+#endif
 
 	// --- 割り込み・タイマー・メインループ ---
 	dbgprintf("AS3935_IRQ %s PIN:%d\n","Enable", AS3935_IRQ ); ///< IRQ有効化ログ
@@ -464,11 +531,22 @@ int main()
 	repeating_timer_t timer; ///< 1秒ごとのハートビートタイマー
 	add_repeating_timer_ms(500, hartbeatCallback, NULL, &timer);
 	appMode = APP_MODE_NORMAL; ///< 通常モードへ
+	bool isRecheckIrqLevel = false; ///< IRQを有効に戻した直後の１回だけ、INTのレベルを見る
 	while (true) {
 		if (appMode == APP_MODE_NORMAL) {
+			if (as3935.checkBusHealth() == false) { ///< I2Cバス異常時は復旧を試みる（バックオフ付き）。INTが下がらなくても毎回見る
+				dbgprintf("I2C bus error NACK:%lu TIMEOUT:%lu RECOVER:%lu FAIL:%lu\n", as3935.getNackCount(), as3935.getTimeoutCount(), as3935.getRecoveryCount(), as3935.getRecoveryFailCount());
+			}
 
 			isIRQTriggered = false; ///< IRQトリガーフラグリセット
-			__wfe(); ///< 割り込み待機（低消費電力）
+			bool isLevelIrq = false; ///< INTのレベルで処理したイベント
+			if (isRecheckIrqLevel && gpio_get(AS3935_IRQ)) {
+				isIRQTriggered = true; ///< IRQ無効中に届いたイベント（立ち上がりエッジは失われている）を処理する
+				isLevelIrq = true;
+			} else {
+				__wfe(); ///< 割り込み待機（低消費電力）
+			}
+			isRecheckIrqLevel = false;
 
 			if (isIRQTriggered) { ///< 雷センサIRQ発生時
 				dbgprintf("AS3935_IRQ %s PIN:%d\n", "Disable", AS3935_IRQ);
@@ -476,6 +554,7 @@ int main()
 				mainDisplay(tft, as3935, true, false, false, true); ///< 雷検出画面更新
 				dbgprintf("AS3935_IRQ %s PIN:%d\n", "Enable", AS3935_IRQ);
 				gpio_set_irq_enabled(AS3935_IRQ, GPIO_IRQ_EDGE_RISE, true); ///< IRQ再有効化
+				isRecheckIrqLevel = (isLevelIrq == false); ///< レベルで処理した後は見直さない（バスが固まってINTが下がらないときに回り続けない）
 
 			} else {
 				if (ts.touched()) {
@@ -492,15 +571,33 @@ int main()
 			dbgprintf("AS3935_IRQ %s PIN:%d\n", "Disable", AS3935_IRQ);
 			gpio_set_irq_enabled(AS3935_IRQ, GPIO_IRQ_EDGE_RISE, false); ///< IRQ無効化
 			cancel_repeating_timer(&timer); ///< タイマー停止
+			if (settings.isSerialDebug() && traceRecorder.getCount() > 0) {
+				traceRecorder.dump(); ///< IRQトレースをシリアルに出力
+				if (traceRecorder.hasUnsaved()) {
+					traceRecorder.saveToFlash(); ///< 前回の保存から増えていれば、IRQ停止中にフラッシュへ保存
+				}
+			}
+			if (settings.isSerialDebug()) {
+				as3935.dumpTrace(); ///< I2Cのトレースとレイテンシをシリアルに出力
+				tft.dumpProfile(dbgprintf); ///< メイン画面の描画の送信量と時間をシリアルに出力
+				tft.resetProfile();
+			}
+			eventList.reset(); ///< 設定画面はスクロールしていない状態で描く
 			tft.setCursor(0, 0);
 			tft.printf("設定モード");
-			settings.run2(&tft, &ts); ///< 設定画面実行
+			{
+				TftProfileScope profileScope(tft, "settings");
+				settings.run2(&tft, &ts); ///< 設定画面実行
+			}
+			compositor.invalidate(); ///< 設定画面が画面全体を描き直したので、タイルの差分は使えない
+			as3935.setConfig(settings.getAS3935Config()); ///< 変更した設定値は次のReset（バス復旧を含む）で書き込む
 			mustRedraw = true; ///< 再描画フラグ
 			DispClock::setRedrawFlag(); ///< 時計再描画フラグ
 			appMode = APP_MODE_NORMAL; ///< 通常モード復帰
 			add_repeating_timer_ms(500, hartbeatCallback, NULL, &timer);
 			dbgprintf("AS3935_IRQ %s PIN:%d\n", "Enable", AS3935_IRQ);
 			gpio_set_irq_enabled(AS3935_IRQ, GPIO_IRQ_EDGE_RISE, true); ///< IRQ復旧
+			isRecheckIrqLevel = true; ///< 設定中に届いたイベントを拾う
 		}
 	}
 }
@@ -0,0 +1,341 @@
+/**
+ * @file AS3935Sim.cpp
+ * @brief AS3935の動作モデル（シミュレーション用I2Cトランスポート）の実装
+ * @details
+ * - レジスタの初期値・書き込み可能ビット・クリアオンリードはAS3935データシートに従う。
+ * - LCO周波数はアンテナのLと（基本容量＋チューニングキャパシタ×8pF）から求める。
+ * - 仮想時刻はI2C転送ビット数と通信速度から進める。
+ */
+#include "AS3935Sim.h"
+#include <cmath>
+
+#define SIM_REG00 0x00 ///< AFE_GB / PWD
+#define SIM_REG02 0x02 ///< CL_STAT / MIN_NUM_LIGH / SREJ
+#define SIM_REG03 0x03 ///< LCO_FDIV / MASK_DIST / INT
+#define SIM_REG04 0x04 ///< S_LIG_L
+#define SIM_REG05 0x05 ///< S_LIG_M
+#define SIM_REG06 0x06 ///< S_LIG_MM
+#define SIM_REG07 0x07 ///< DISTANCE
+#define SIM_REG08 0x08 ///< DISP_LCO / DISP_SRCO / DISP_TRCO / TUN_CAP
+#define SIM_REG3A 0x3A ///< TRCO_CALIB_DONE / NOK
+#define SIM_REG3B 0x3B ///< SRCO_CALIB_DONE / NOK
+#define SIM_REG3C 0x3C ///< PRESET_DEFAULT
+#define SIM_REG3D 0x3D ///< CALIB_RCOS
+#define SIM_DIRECT_CMD 0x96 ///< ダイレクトコマンドの書き込み値
+
+#define SIM_INT_NH 0x01 ///< ノイズレベル過大
+#define SIM_INT_D 0x04  ///< ディスターバ検出
+#define SIM_INT_L 0x08  ///< 雷検出
+
+#define SIM_SRCO_HZ 1100000 ///< SRCOの周波数（Hz）
+#define SIM_TRCO_HZ 32768   ///< TRCOの周波数（Hz）
+
+/**
+ * @brief コンストラクタ
+ * @details
+ * レジスタをデータシートの初期値に設定し、アンテナは100uH/950pF（TUN_CAP=8付近で500kHz）とする。
+ * @param a_u8Addr 応答するI2Cアドレス
+ */
+AS3935Sim::AS3935Sim(uint8_t a_u8Addr) :
+	m_u8Addr(a_u8Addr),
+	m_u8Pointer(0),
+	m_isIrqHigh(false),
+	m_isClStatHigh(true),
+	m_u8StrikeCount(0),
+	m_u64NowUs(0),
+	m_u32Baud(400 * 1000),
+	m_u32NackPending(0),
+	m_isBusStuck(false),
+	m_isSdaHeld(false),
+	m_dLcoInductance(100e-6),
+	m_dLcoBaseCap(950e-12),
+	m_u32Transactions(0)
+{
+	presetDefault();
+}
+
+/**
+ * @brief レジスタをデータシートの初期値に戻す（PRESET_DEFAULT相当）
+ * @retval なし
+ */
+void AS3935Sim::presetDefault()
+{
+	for (int i = 0; i < REG_COUNT; i++) {
+		m_regs[i] = 0;
+	}
+	m_regs[SIM_REG00] = 0x24; // AFE_GB=10010(屋内), PWD=0
+	m_regs[0x01] = 0x22;      // NF_LEV=2, WDTH=2
+	m_regs[SIM_REG02] = 0xC2; // CL_STAT=1, MIN_NUM_LIGH=0, SREJ=2
+	m_regs[SIM_REG07] = 0x3F; // 範囲外
+	m_isClStatHigh = true;
+	m_u8StrikeCount = 0;
+	m_isIrqHigh = false;
+}
+
+/**
+ * @brief 1レジスタへの書き込みを処理する
+ * @details
+ * 読み出し専用ビットを保護し、ダイレクトコマンドとCL_STATの立ち上がり（統計クリア）を処理する。
+ * @param reg レジスタアドレス
+ * @param val 書き込み値
+ * @retval なし
+ */
+void AS3935Sim::writeReg(uint8_t reg, uint8_t val)
+{
+	reg %= REG_COUNT;
+	switch (reg) {
+		case SIM_REG3C:
+			if (val == SIM_DIRECT_CMD) presetDefault();
+			return;
+		case SIM_REG3D:
+			if (val == SIM_DIRECT_CMD) {
+				m_regs[SIM_REG3A] = 0x80; // TRCO_CALIB_DONE
+				m_regs[SIM_REG3B] = 0x80; // SRCO_CALIB_DONE
+			}
+			return;
+		case SIM_REG02:
+			if (!m_isClStatHigh && (val & 0x40)) {
+				// CL_STATのHigh-Low-Highで距離推定の統計をクリアする
+				m_u8StrikeCount = 0;
+				m_regs[SIM_REG07] = 0x3F;
+			}
+			m_isClStatHigh = (val & 0x40) != 0;
+			m_regs[reg] = val;
+			return;
+		case SIM_REG03:
+			m_regs[reg] = (val & 0xF0) | (m_regs[reg] & 0x0F); // INTは読み出し専用
+			return;
+		case SIM_REG04:
+		case SIM_REG05:
+		case SIM_REG06:
+		case SIM_REG07:
+		case SIM_REG3A:
+		case SIM_REG3B:
+			return; // 読み出し専用
+		default:
+			m_regs[reg] = val;
+			return;
+	}
+}
+
+/**
+ * @brief 転送バイト数に応じて仮想時刻を進める
+ * @details
+ * アドレスバイトを含め、1バイトあたり9ビット（ACK含む）として計算する。
+ * @param len データバイト数
+ * @retval なし
+ */
+void AS3935Sim::advanceBusTime(size_t len)
+{
+	uint64_t bits = (uint64_t)(len + 1) * 9;
+	uint64_t us = bits * 1000000ULL / m_u32Baud;
+	m_u64NowUs += (us > 0) ? us : 1;
+}
+
+/**
+ * @brief 距離（km）をREG07の距離推定値に変換する
+ * @details
+ * データシートの距離テーブル（1=頭上, 5～40km, 0x3F=範囲外）で、指定距離以上の最小値を返す。
+ * @param a_iKm 距離（km）
+ * @retval REG07の値
+ */
+uint8_t AS3935Sim::distanceToReg(int a_iKm)
+{
+	static const uint8_t table[] = {1, 5, 6, 8, 10, 12, 14, 17, 20, 24, 27, 31, 34, 37, 40};
+	if (a_iKm <= 1) return 1;
+	for (uint8_t d : table) {
+		if (a_iKm <= d) return d;
+	}
+	return 0x3F;
+}
+
+/**
+ * @brief モデルを初期化する
+ * @details
+ * 通信速度だけを保持し、転送時間の計算に使う。
+ * @retval true 常に成功
+ */
+bool AS3935Sim::init(uint8_t a_u8I2cPort, uint8_t a_u8SdaPin, uint8_t a_u8SclPin, uint32_t a_u32Baud)
+{
+	m_u32Baud = (a_u32Baud > 0) ? a_u32Baud : 400 * 1000;
+	return true;
+}
+
+/**
+ * @brief I2C書き込みを模擬する
+ * @details
+ * 先頭バイトでレジスタポインタを設定し、続くバイトを順にレジスタへ書き込む。
+ * アドレス不一致・NACK注入時はI2C_ERR_GENERIC、バス固着時はI2C_ERR_TIMEOUTを返す。
+ * @retval int 送信バイト数（負値はエラー）
+ */
+int AS3935Sim::write(uint8_t addr, const uint8_t* src, size_t len, bool nostop, uint32_t timeoutUs)
+{
+	m_u32Transactions++;
+	if (m_isBusStuck) {
+		m_u64NowUs += timeoutUs;
+		return I2C_ERR_TIMEOUT;
+	}
+	if (addr != m_u8Addr || m_u32NackPending > 0) {
+		if (m_u32NackPending > 0) m_u32NackPending--;
+		advanceBusTime(0);
+		return I2C_ERR_GENERIC;
+	}
+	advanceBusTime(len);
+	if (len == 0) return 0;
+	m_u8Pointer = src[0] % REG_COUNT;
+	for (size_t i = 1; i < len; i++) {
+		writeReg((uint8_t)(m_u8Pointer + i - 1), src[i]);
+	}
+	return (int)len;
+}
+
+/**
+ * @brief I2C読み出しを模擬する
+ * @details
+ * レジスタポインタから連続して読み出す。読み出し範囲にREG03が含まれる場合は
+ * 読み出し後に割り込み要因（INT）をクリアし、IRQをLowに戻す。
+ * @retval int 受信バイト数（負値はエラー）
+ */
+int AS3935Sim::read(uint8_t addr, uint8_t* dst, size_t len, bool nostop, uint32_t timeoutUs)
+{
+	m_u32Transactions++;
+	if (m_isBusStuck) {
+		m_u64NowUs += timeoutUs;
+		return I2C_ERR_TIMEOUT;
+	}
+	if (addr != m_u8Addr || m_u32NackPending > 0) {
+		if (m_u32NackPending > 0) m_u32NackPending--;
+		advanceBusTime(0);
+		return I2C_ERR_GENERIC;
+	}
+	advanceBusTime(len);
+	bool isIntRead = false;
+	for (size_t i = 0; i < len; i++) {
+		uint8_t reg = (uint8_t)((m_u8Pointer + i) % REG_COUNT);
+		dst[i] = m_regs[reg];
+		if (reg == SIM_REG03) isIntRead = true;
+	}
+	if (isIntRead) {
+		m_regs[SIM_REG03] &= 0xF0; // 割り込み要因はクリアオンリード
+		m_isIrqHigh = false;
+	}
+	return (int)len;
+}
+
+/**
+ * @brief バス復旧を模擬する
+ * @details
+ * バス固着とNACK注入を解除する。holdSdaLow()でSDAを保持している間は解除できない。
+ * @retval true SDAが解放された
+ * @retval false SDAがLowのまま
+ */
+bool AS3935Sim::recoverBus()
+{
+	if (m_isSdaHeld) {
+		m_u64NowUs += 100;
+		return false;
+	}
+	m_isBusStuck = false;
+	m_u32NackPending = 0;
+	m_u64NowUs += 100; // 9クロック＋STOP＋再初期化の時間
+	return true;
+}
+
+/**
+ * @brief 現在のチューニングキャパシタ設定でのLCO共振周波数を求める
+ * @details
+ * f = 1 / (2π√(L(C0 + TUN_CAP×8pF)))
+ * @retval uint32_t 周波数（Hz）
+ */
+uint32_t AS3935Sim::getLcoFrequency() const
+{
+	double cap = m_dLcoBaseCap + (m_regs[SIM_REG08] & 0x0F) * 8e-12;
+	return (uint32_t)(1.0 / (2.0 * M_PI * std::sqrt(m_dLcoInductance * cap)));
+}
+
+/**
+ * @brief IRQピンに出力される発振のパルス数を求める
+ * @details
+ * REG08のDISP_LCO/DISP_SRCO/DISP_TRCOに応じた周波数で、指定時間分のパルス数を返す。
+ * LCOはREG03のLCO_FDIVで分周される。計測時間だけ仮想時刻を進める。
+ * @param a_u8IrqPin IRQピン番号（未使用）
+ * @param a_u16Ms 計測時間（ms）
+ * @retval uint32_t パルス数
+ */
+uint32_t AS3935Sim::countIrqPulses(uint8_t a_u8IrqPin, uint16_t a_u16Ms)
+{
+	uint64_t freq = 0;
+	uint8_t reg08 = m_regs[SIM_REG08];
+	if (reg08 & 0x80) {
+		uint32_t div = 16u << ((m_regs[SIM_REG03] >> 6) & 0x03);
+		freq = getLcoFrequency() / div;
+	} else if (reg08 & 0x40) {
+		freq = SIM_SRCO_HZ;
+	} else if (reg08 & 0x20) {
+		freq = SIM_TRCO_HZ;
+	}
+	m_u64NowUs += (uint64_t)a_u16Ms * 1000;
+	return (uint32_t)(freq * a_u16Ms / 1000);
+}
+
+/**
+ * @brief 雷イベントを発生させる
+ * @retval true 割り込みを発生させた
+ * @retval false パワーダウン中、または最小雷数に未達
+ */
+bool AS3935Sim::injectLightning(int a_iKm, uint32_t a_u32Energy)
+{
+	static const uint8_t minNum[4] = {1, 5, 9, 16};
+	if (m_regs[SIM_REG00] & 0x01) return false; // パワーダウン中
+	if (m_u8StrikeCount < 0xFF) m_u8StrikeCount++;
+	if (m_u8StrikeCount < minNum[(m_regs[SIM_REG02] >> 4) & 0x03]) return false;
+	m_regs[SIM_REG04] = a_u32Energy & 0xFF;
+	m_regs[SIM_REG05] = (a_u32Energy >> 8) & 0xFF;
+	m_regs[SIM_REG06] = (a_u32Energy >> 16) & 0x1F;
+	m_regs[SIM_REG07] = distanceToReg(a_iKm);
+	m_regs[SIM_REG03] = (m_regs[SIM_REG03] & 0xF0) | SIM_INT_L;
+	m_isIrqHigh = true;
+	return true;
+}
+
+/**
+ * @brief ディスターバ（人工ノイズ）イベントを発生させる
+ * @retval true 割り込みを発生させた
+ * @retval false パワーダウン中、またはMASK_DISTが有効
+ */
+bool AS3935Sim::injectDisturber()
+{
+	if (m_regs[SIM_REG00] & 0x01) return false;
+	if (m_regs[SIM_REG03] & 0x20) return false; // MASK_DIST
+	m_regs[SIM_REG03] = (m_regs[SIM_REG03] & 0xF0) | SIM_INT_D;
+	m_isIrqHigh = true;
+	return true;
+}
+
+/**
+ * @brief ノイズレベル過大イベントを発生させる
+ * @retval true 割り込みを発生させた
+ * @retval false パワーダウン中
+ */
+bool AS3935Sim::injectNoiseHigh()
+{
+	if (m_regs[SIM_REG00] & 0x01) return false;
+	m_regs[SIM_REG03] = (m_regs[SIM_REG03] & 0xF0) | SIM_INT_NH;
+	m_isIrqHigh = true;
+	return true;
+}
+
+/**
+ * @brief REG00～REG08をまとめて設定する（トレース再生用）
+ * @param a_regs REG00～REG08の値（9バイト）
+ * @param a_u16Mask 設定するレジスタ（ビットnがREGn）
+ * @retval なし
+ */
+void AS3935Sim::loadRegisters(const uint8_t* a_regs, uint16_t a_u16Mask)
+{
+	for (int i = SIM_REG00; i <= SIM_REG08; i++) {
+		if (a_u16Mask & (1 << i)) m_regs[i] = a_regs[i];
+	}
+	if (a_u16Mask & (1 << SIM_REG02)) m_isClStatHigh = (m_regs[SIM_REG02] & 0x40) != 0;
+	m_isIrqHigh = (m_regs[SIM_REG03] & 0x0F) != 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file AS3935Sim.h
+ * @brief AS3935の動作モデル（シミュレーション用I2Cトランスポート）定義
+ * @details
+ * - I2CTransportを実装し、AS3935のレジスタマップと動作をソフトウェアで模擬する。
+ * - 割り込み要因のクリアオンリード、距離/エネルギーレジスタ、チューニングキャパシタに応じたLCO周波数、
+ *   ダイレクトコマンド（PRESET_DEFAULT/CALIB_RCO）、CL_STATストローブによる統計クリアを扱う。
+ * - 時刻は実時間ではなく、I2C転送時間とadvanceUs()で進む仮想時刻を使う。
+ *   そのためPC上でも実機上でも、実時間より高速にイベント処理を回せる。
+ * - pico-sdkに依存しないので、I2C_HOST_BUILDを定義したホストビルドでも使用できる。
+ */
+#pragma once
+#include <stdint.h>
+#include <cstddef>
+#include "I2CTransport.h"
+
+/**
+ * @brief AS3935の動作モデル
+ * @details
+ * I2CBase::setTransport()に渡すと、AS3935クラスのロジックを実機無しで動かせる。
+ * injectLightning()等でイベントを発生させ、isIrqHigh()でIRQピンの状態を確認する。
+ */
+class AS3935Sim : public I2CTransport {
+  public:
+	static const uint8_t REG_COUNT = 0x40; ///< モデル化するレジスタ空間のサイズ
+
+  private:
+	uint8_t m_u8Addr;             ///< 応答するI2Cアドレス
+	uint8_t m_regs[REG_COUNT];    ///< レジスタ値
+	uint8_t m_u8Pointer;          ///< レジスタポインタ（最後に書き込まれたアドレス）
+	bool m_isIrqHigh;             ///< IRQピンの状態
+	bool m_isClStatHigh;          ///< REG02 CL_STATビットの前回値（ストローブ検出用）
+	uint8_t m_u8StrikeCount;      ///< 統計クリア後の雷検出数（最小雷数判定用）
+	uint64_t m_u64NowUs;          ///< 仮想時刻（us）
+	uint32_t m_u32Baud;           ///< 模擬するI2C通信速度（転送時間の計算用）
+	uint32_t m_u32NackPending;    ///< この回数だけ次のトランザクションをNACKにする
+	bool m_isBusStuck;            ///< trueの間はバスが固まっている（recoverBusで解除）
+	bool m_isSdaHeld;             ///< trueの間はrecoverBusでもSDAが解放されない
+	double m_dLcoInductance;      ///< アンテナのインダクタンス（H）
+	double m_dLcoBaseCap;         ///< チューニングキャパシタ以外の容量（F）
+	uint32_t m_u32Transactions;   ///< 処理したトランザクション数
+
+	void presetDefault();
+	void writeReg(uint8_t reg, uint8_t val);
+	void advanceBusTime(size_t len);
+	static uint8_t distanceToReg(int a_iKm);
+
+  public:
+	/**
+	 * @brief コンストラクタ
+	 * @param a_u8Addr 応答するI2Cアドレス
+	 */
+	AS3935Sim(uint8_t a_u8Addr = 0x03);
+
+	// --- I2CTransport ---
+	bool init(uint8_t a_u8I2cPort, uint8_t a_u8SdaPin, uint8_t a_u8SclPin, uint32_t a_u32Baud) override;
+	int write(uint8_t addr, const uint8_t* src, size_t len, bool nostop, uint32_t timeoutUs) override;
+	int read(uint8_t addr, uint8_t* dst, size_t len, bool nostop, uint32_t timeoutUs) override;
+	bool recoverBus() override;
+	uint64_t timeUs() override { return m_u64NowUs; }
+	void initIrqPin(uint8_t a_u8IrqPin) override {}
+	uint32_t countIrqPulses(uint8_t a_u8IrqPin, uint16_t a_u16Ms) override;
+
+	// --- イベント注入 ---
+	/**
+	 * @brief 雷イベントを発生させる
+	 * @details
+	 * 距離・エネルギーレジスタを更新し、INT_L(0x08)を立ててIRQをHighにする。
+	 * パワーダウン中、または統計上の雷数が最小雷数（REG02 MIN_NUM_LIGH）に達していない場合は割り込みを出さない。
+	 * @param a_iKm 雷までの距離（km）。40kmを超える場合は範囲外（0x3F）になる
+	 * @param a_u32Energy エネルギー（20ビット）
+	 * @retval true 割り込みを発生させた
+	 * @retval false 割り込みを発生させなかった
+	 */
+	bool injectLightning(int a_iKm, uint32_t a_u32Energy);
+	/**
+	 * @brief ディスターバ（人工ノイズ）イベントを発生させる
+	 * @details
+	 * MASK_DIST（REG03ビット5）が立っている場合は割り込みを出さない。
+	 * @retval true 割り込みを発生させた
+	 * @retval false 割り込みを発生させなかった
+	 */
+	bool injectDisturber();
+	/**
+	 * @brief ノイズレベル過大イベントを発生させる
+	 * @retval true 割り込みを発生させた
+	 * @retval false 割り込みを発生させなかった
+	 */
+	bool injectNoiseHigh();
+	/**
+	 * @brief 次のa_u32Count回のトランザクションをNACKにする
+	 * @param a_u32Count NACKにする回数
+	 * @retval なし
+	 */
+	void injectNack(uint32_t a_u32Count) { m_u32NackPending = a_u32Count; }
+	/**
+	 * @brief バスが固まった状態（全トランザクションがタイムアウト）を模擬する
+	 * @param a_isStuck trueで固まった状態にする。recoverBus()で解除される
+	 * @retval なし
+	 */
+	void setBusStuck(bool a_isStuck) { m_isBusStuck = a_isStuck; }
+	/**
+	 * @brief スレーブがSDAをLowに保持し続ける状態を模擬する
+	 * @details trueの間はrecoverBus()がfalseを返し、バスの固着も解除されない（復旧の失敗とバックオフの確認用）。
+	 * @param a_isHeld trueでSDAを離さない
+	 * @retval なし
+	 */
+	void holdSdaLow(bool a_isHeld) { m_isSdaHeld = a_isHeld; }
+	/**
+	 * @brief REG00～REG08をまとめて設定する（トレース再生用）
+	 * @details
+	 * 読み出し専用ビットも含めて記録値をそのまま設定し、INTが0以外ならIRQをHighにする。
+	 * a_u16Maskのビットが0のレジスタ（記録時に読まなかったもの）は変えない。
+	 * @param a_regs REG00～REG08の値（9バイト）
+	 * @param a_u16Mask 設定するレジスタ（ビットnがREGn）
+	 * @retval なし
+	 */
+	void loadRegisters(const uint8_t* a_regs, uint16_t a_u16Mask = 0x01FF);
+	/**
+	 * @brief 割り込み要因を変えずにIRQをHighにする（トレース再生用）
+	 * @details INTが0のまま読まれる割り込み（統計クリア）を再現する。
+	 * @retval なし
+	 */
+	void raiseIrq() { m_isIrqHigh = true; }
+
+	// --- 状態参照 ---
+	/**
+	 * @brief 仮想時刻を進める
+	 * @param a_u64Us 進める時間（us）
+	 * @retval なし
+	 */
+	void advanceUs(uint64_t a_u64Us) { m_u64NowUs += a_u64Us; }
+	/**
+	 * @brief IRQピンの状態を取得する
+	 * @retval true High（未読の割り込みあり）
+	 */
+	bool isIrqHigh() const { return m_isIrqHigh; }
+	/**
+	 * @brief レジスタ値を直接参照する
+	 * @param reg レジスタアドレス
+	 * @retval レジスタ値
+	 */
+	uint8_t peekReg(uint8_t reg) const { return m_regs[reg % REG_COUNT]; }
+	/**
+	 * @brief 現在のチューニングキャパシタ設定でのLCO共振周波数を取得する
+	 * @retval 周波数（Hz）
+	 */
+	uint32_t getLcoFrequency() const;
+	/**
+	 * @brief アンテナの特性を設定する
+	 * @param a_dInductance インダクタンス（H）
+	 * @param a_dBaseCap チューニングキャパシタ以外の容量（F）
+	 * @retval なし
+	 */
+	void setAntenna(double a_dInductance, double a_dBaseCap)
+	{
+		m_dLcoInductance = a_dInductance;
+		m_dLcoBaseCap = a_dBaseCap;
+	}
+	/**
+	 * @brief 処理したトランザクション数を取得する
+	 * @retval トランザクション数
+	 */
+	uint32_t getTransactionCount() const { return m_u32Transactions; }
+};
@@ -2,13 +2,12 @@
  * @file DispClock.h
  * @brief TFTディスプレイ用時計描画ユーティリティクラス定義
  * @details
- * - pictData.hのビットマップを利用し、時・分・秒・AM/PMをグラフィカルに描画。
+ * - pictData.hのビットマップ（pictPacked.hに圧縮したもの）を利用し、時・分・秒・AM/PMをグラフィカルに描画。
  * - 24時間/12時間表示切替、描画最適化のための前回値キャッシュ、再描画フラグ制御などを提供。
  * - インスタンス化不要のstaticユーティリティ設計。
  */
 #pragma once
 #include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
-#include "pictData.h"
 #include <ctime>
 
 using namespace ardPort;
@@ -22,7 +21,9 @@ using namespace ardPort::spi;
  */
 class DispClock {
 public:
-  static Adafruit_ILI9341* pTFT;           ///< TFTディスプレイへのポインタ
+  static Adafruit_GFX* pTFT;               ///< 描画先（液晶、またはホストのTftFramebuffer）
+  static TftDisplayList* pList;            ///< 描画の記録先（nullptrなら直接描く）
+  static Adafruit_SPITFT* pListTFT;        ///< 記録したリストを送る液晶
   static bool isClock24Hour;               ///< 24時間表示かどうかのフラグ
   static uint8_t prevHour;                 ///< 前回表示した時（12h用）
   static uint8_t prevHourU;                ///< 前回表示した時の十の位（24h用）
@@ -32,7 +33,7 @@ public:
   static uint8_t prevSeconds;              ///< 前回表示した秒
   static uint8_t prevAmPm;                 ///< 前回表示したAM/PM
 
-  static const uint16_t* numTable[13];     ///< 0～12の数字ビットマップテーブル
+  static const PackedImage* numTable[13];  ///< 0～12の数字ビットマップテーブル
   /**
    * @brief 時計描画用の初期化
    * @details
@@ -41,11 +42,23 @@ public:
    * @param a_isClock24Hour 24時間表示かどうか
    * @retval なし
    */
-  static void init(Adafruit_ILI9341* a_ptft,bool a_isClock24Hour);
+  static void init(Adafruit_GFX* a_ptft,bool a_isClock24Hour);
+  /**
+   * @brief 時計の描画を描画命令リストに記録するようにする
+   * @details
+   * 数字のビットマップは展開してリストに写す。リストを送るのは呼び出し側（一杯になったときだけ、ここでa_pTftに送る）。
+   * @param a_pList 記録先のリスト（nullptrで直接描く）
+   * @param a_pTft リストを送る液晶
+   * @retval なし
+   */
+  static void setList(TftDisplayList* a_pList, Adafruit_SPITFT* a_pTft) {
+    pList = a_pList;
+    pListTFT = a_pTft;
+  }
   /**
    * @brief 現在時刻をTFT画面に描画する
    * @details
-   * pictData.hのビットマップをdrawRGBBitmapで表示し、時刻をグラフィカルに描画。
+   * 圧縮したビットマップをdrawPackedImageで表示し、時刻をグラフィカルに描画。
    * 24時間/12時間表示切替、AM/PM表示、前回値キャッシュによる描画最適化。
    * 秒表示は15秒ごとに異なるビットマップでアニメーション風に表示。
    * @param x ビットマップ表示のX座標
@@ -68,4 +81,8 @@ public:
     prevSeconds = 0xFF;   ///< 秒をリセット
     prevAmPm = 0xFF;      ///< AM/PMをリセット
  }
+
+private:
+  static void drawBitmap(int x, int y, const PackedImage& img);
+  static void fillRect(int x, int y, int w, int h, uint16_t color);
 };
@@ -26,7 +26,7 @@ using namespace ardPort::spi;
  * @param a_psk スクリーンキーボード用ポインタ
  */
 GUIEditBox::GUIEditBox(Adafruit_GFX* a_ptft, XPT2046_Touchscreen* a_pts, ScreenKeyboard* a_psk)
-    : ptft(static_cast<Adafruit_ILI9341*>(a_ptft)), pts(a_pts), psk(a_psk)
+    : ptft(a_ptft), pts(a_pts), psk(a_psk), saveUnder(a_ptft)
 {
     // 初期化処理が必要ならここに追加
 }
@@ -37,6 +37,7 @@ GUIEditBox::GUIEditBox(Adafruit_GFX* a_ptft, XPT2046_Touchscreen* a_pts, ScreenK
  * - 画面キーボードからの入力を監視し、各種キーイベント（Enter, ESC, カーソル移動, 挿入/上書き切替, バックスペース, デリート, 通常文字）を処理します。
  * - カーソル点滅や再描画、バッファサイズ制御、挿入/上書きモードの切替も行います。
  * - 編集確定時はtrue、キャンセル時はfalseを返します。
+ * - キーボードの下は表示前に保存し、終了時に書き戻します（できたかはisRestored()）。
  *
  * @param a_x 編集欄X座標
  * @param a_y 編集欄Y座標
@@ -52,9 +53,11 @@ bool GUIEditBox::show(uint16_t a_x, uint16_t a_y, char* a_pText, size_t a_size,E
 	if(mode == MODE_NUMPADOVERWRITE) {
 		isInsert = false; ///< 上書きモード
 		edtCursor = 0;    ///< カーソルを先頭に設定
+		saveUnder.save(0, ptft->height() - psk->KB_HEIGHT, psk->NP_WIDTH, psk->KB_HEIGHT); // 終わったら書き戻す
 		psk->showNumPad(ptft->height() - psk->KB_HEIGHT); // キーボードを表示
 	} else {
 		edtCursor = strlen(a_pText); ///< 既存文字列の末尾にカーソル
+		saveUnder.save(0, ptft->height() - psk->KB_HEIGHT, psk->KB_WIDTH, psk->KB_HEIGHT); // 終わったら書き戻す
 		psk->show(ptft->height() - psk->KB_HEIGHT); // キーボードを表示
 		isInsert = true; ///< 挿入モード
 	}
@@ -157,6 +160,7 @@ bool GUIEditBox::show(uint16_t a_x, uint16_t a_y, char* a_pText, size_t a_size,E
 		ptft->setCursor(edtX, edtY);
 		ptft->printf(p);
 	}
+	isKbRestored = saveUnder.restore(); ///< キーボードの下を書き戻す
 	return retReason; // trueならEnterキーが押された、falseならESCキーが押された
 }
 
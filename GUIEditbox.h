@@ -13,6 +13,7 @@
 #include "FlashMem.h"
 #include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
 #include "lib-9341/XPT2046_Touchscreen/XPT2046_Touchscreen.h"
+#include "GUISaveUnder.h"
 /**
  * @namespace ardPort
  * @brief Arduino互換ポートラッパーの名前空間
@@ -46,7 +47,7 @@ enum EditMode {
  */
 class GUIEditBox {
 public:
-    Adafruit_ILI9341* ptft; ///< ディスプレイ制御用ポインタ
+    Adafruit_GFX* ptft; ///< ディスプレイ制御用ポインタ
     XPT2046_Touchscreen* pts; ///< タッチスクリーン制御用ポインタ
     ScreenKeyboard* psk; ///< スクリーンキーボード用ポインタ
 
@@ -56,6 +57,8 @@ public:
 	uint16_t edtY = 0; ///< 編集欄Y座標
 	bool isInsert = false; ///< 挿入モード
 	EditMode mode; ///< 編集モード
+	GUISaveUnder saveUnder; ///< キーボードの下になる矩形の保存先
+	bool isKbRestored = false; ///< 編集を終えたときにキーボードの下を書き戻したか
 
 	/**
 	 * @brief コンストラクタ
@@ -86,5 +89,11 @@ public:
 	 * @param isDeleteCursor trueでカーソル消去、falseで点滅
 	 */
 	void dispCursor(int tick, bool isDeleteCursor = false);
+	/**
+	 * @brief 編集を終えたときにキーボードの下を書き戻したか
+	 * @details falseのときはキーボードが画面に残っているので、呼び出し側で描き直すこと。
+	 * @return 書き戻したらtrue
+	 */
+	bool isRestored() const { return isKbRestored; }
 	
 };
@@ -2,11 +2,11 @@
 #include "pico/stdlib.h"
 #include <cstring>
 
-GUIMsgBox::GUIMsgBox(Adafruit_ILI9341* tft, XPT2046_Touchscreen* ts)
-    : m_tft(tft), m_ts(ts) {}
+GUIMsgBox::GUIMsgBox(Adafruit_GFX* tft, XPT2046_Touchscreen* ts)
+    : m_tft(tft), m_ts(ts), m_saveUnder(tft) {}
 
 // ユーティリティ: \r\n区切りで複数行を描画
-static void drawMultiline(Adafruit_ILI9341* tft, int x, int y, const char* message, uint16_t textColor, uint16_t bgColor, int lineHeight = 18) {
+static void drawMultiline(Adafruit_GFX* tft, int x, int y, const char* message, uint16_t textColor, uint16_t bgColor, int lineHeight = 18) {
     char buf[128];
     strncpy(buf, message, sizeof(buf) - 1);
     buf[sizeof(buf) - 1] = '\0';
@@ -30,6 +30,8 @@ static void drawMultiline(Adafruit_ILI9341* tft, int x, int y, const char* messa
  * - タッチ入力を監視し、OK/Cancelボタン押下でtrue/falseを返す。
  * - ボタン色や位置はUIガイドラインに準拠。
  * - テキストカラーはpush/popで復元。
+ * - ダイアログの下は表示前に保存し、閉じるときに書き戻す（できたかはisRestored()）。
+ * - 描画はダイアログの矩形でクリップするので、長いメッセージも書き戻す範囲からはみ出さない。
  *
  * @param x ダイアログ左上X座標
  * @param y ダイアログ左上Y座標
@@ -44,6 +46,8 @@ bool GUIMsgBox::showOKCancel(int x, int y, const char* caption, const char* mess
 {
 	m_tft->pushTextColor();
 	const int w = 180, h = 126; ///< ダイアログ幅・高さ
+    m_saveUnder.save(x, y, w, h); // 閉じるときに書き戻す
+    bool isClipped = m_tft->pushClipRect(x, y, w, h); // 長いメッセージも、書き戻す範囲の外には描かない
     m_tft->fillRoundRect(x, y, w, h, 8, 0x7BEF); // 薄グレー
     m_tft->drawRoundRect(x, y, w, h, 8, 0xFFFF); // 白枠
     m_tft->setTextColor(0x0000, 0x7BEF);
@@ -65,6 +69,7 @@ bool GUIMsgBox::showOKCancel(int x, int y, const char* caption, const char* mess
     m_tft->setTextColor(0xFFFF, 0x8000);
     m_tft->setCursor(cancelX + 5, cancelY + 8);
     m_tft->printf("%s", cancelMsg);
+    if (isClipped) m_tft->popClipRect();
 
     while (true) {
         if (m_ts->touched()) {
@@ -73,11 +78,13 @@ bool GUIMsgBox::showOKCancel(int x, int y, const char* caption, const char* mess
             // OKボタン
             if (p.x >= okX && p.x <= okX + btnW && p.y >= okY && p.y <= okY + btnH) {
                 m_tft->popTextColor(); // テキストカラーを元に戻す
+                m_isRestored = m_saveUnder.restore(); // ダイアログの下を書き戻す
                 return true;
             }
             // Cancelボタン
             if (p.x >= cancelX && p.x <= cancelX + btnW && p.y >= cancelY && p.y <= cancelY + btnH) {
 				m_tft->popTextColor(); // テキストカラーを元に戻す
+				m_isRestored = m_saveUnder.restore(); // ダイアログの下を書き戻す
 				return false;
 			}
         }
@@ -91,6 +98,8 @@ bool GUIMsgBox::showOKCancel(int x, int y, const char* caption, const char* mess
  * - 指定座標にキャプション・複数行メッセージ・OKボタンを描画。
  * - タッチ入力を監視し、OKボタン押下で復帰。
  * - ボタン色や位置はUIガイドラインに準拠。
+ * - ダイアログの下は表示前に保存し、閉じるときに書き戻す（できたかはisRestored()）。
+ * - 描画はダイアログの矩形でクリップするので、長いメッセージも書き戻す範囲からはみ出さない。
  *
  * @param x ダイアログ左上X座標
  * @param y ダイアログ左上Y座標
@@ -101,6 +110,8 @@ bool GUIMsgBox::showOKCancel(int x, int y, const char* caption, const char* mess
  */
 void GUIMsgBox::showOK(int x, int y, const char* caption, const char* message, const char* okMsg) {
     const int w = 180, h = 126; ///< ダイアログ幅・高さ
+    m_saveUnder.save(x, y, w, h); // 閉じるときに書き戻す
+    bool isClipped = m_tft->pushClipRect(x, y, w, h); // 長いメッセージも、書き戻す範囲の外には描かない
     m_tft->fillRoundRect(x, y, w, h, 8, 0x7BEF);
     m_tft->drawRoundRect(x, y, w, h, 8, 0xFFFF);
     m_tft->setTextColor(0x0000, 0x7BEF);
@@ -115,6 +126,7 @@ void GUIMsgBox::showOK(int x, int y, const char* caption, const char* message, c
     m_tft->setTextColor(0xFFFF, 0x0010);
     m_tft->setCursor(okX + 10, okY + 8);
     m_tft->printf("%s", okMsg);
+    if (isClipped) m_tft->popClipRect();
 
     while (true) {
         if (m_ts->touched()) {
@@ -126,4 +138,5 @@ void GUIMsgBox::showOK(int x, int y, const char* caption, const char* message, c
         }
         sleep_ms(10);
     }
+    m_isRestored = m_saveUnder.restore(); // ダイアログの下を書き戻す
 }
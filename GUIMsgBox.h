@@ -4,10 +4,12 @@
  * @details
  * - ILI9341 TFTディスプレイとXPT2046タッチパネルを用いたOK/Cancel, OKのみのダイアログ表示を提供。
  * - マルチライン・左寄せメッセージ、ボタン色・位置カスタマイズ、タッチ判定等をサポート。
+ * - ダイアログの下になる矩形は表示前に保存し、閉じるときに書き戻す（GUISaveUnder）。
  */
 #pragma once
 #include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
 #include "lib-9341/XPT2046_Touchscreen/XPT2046_Touchscreen.h"
+#include "GUISaveUnder.h"
 
 using namespace ardPort;
 using namespace ardPort::spi;
@@ -26,7 +28,7 @@ public:
      * @param tft ILI9341 TFTディスプレイへのポインタ
      * @param ts  XPT2046タッチパネルへのポインタ
      */
-    GUIMsgBox(Adafruit_ILI9341* tft, XPT2046_Touchscreen* ts); ///< コンストラクタ
+    GUIMsgBox(Adafruit_GFX* tft, XPT2046_Touchscreen* ts); ///< コンストラクタ
 
     /**
      * @brief OK/Cancelダイアログを表示し、ユーザーの選択を返す
@@ -58,7 +60,18 @@ public:
      */
     void showOK(int x, int y, const char* caption, const char* message, const char* okMsg);
 
+    /**
+     * @brief 閉じたときにダイアログの下を書き戻したか
+     * @details
+     * falseのとき（メモリが足りない・液晶から読み出せない）は、ダイアログが画面に残っているので呼び出し側で描き直すこと。
+     * @retval true 書き戻した
+     * @retval false 書き戻していない
+     */
+    bool isRestored() const { return m_isRestored; }
+
 private:
-    Adafruit_ILI9341* m_tft; ///< TFTディスプレイへのポインタ
+    Adafruit_GFX* m_tft; ///< TFTディスプレイへのポインタ
     XPT2046_Touchscreen* m_ts; ///< タッチパネルへのポインタ
+    GUISaveUnder m_saveUnder; ///< ダイアログの下になる矩形の保存先
+    bool m_isRestored = false; ///< 閉じたときにダイアログの下を書き戻したか
 };
@@ -0,0 +1,71 @@
+/**
+ * @file GUISaveUnder.cpp
+ * @brief ポップアップの下になる画面を保存・復元するクラスの実装
+ */
+#include "GUISaveUnder.h"
+#include <stdlib.h>
+#include "Settings.h"
+#include "printfDebug.h"
+
+GUISaveUnder::GUISaveUnder(Adafruit_GFX* a_ptft)
+	: m_ptft(a_ptft) {}
+
+GUISaveUnder::~GUISaveUnder()
+{
+	discard();
+}
+
+/**
+ * @brief 矩形の中を保存する
+ * @details
+ * 矩形は画面に収まっていること（ダイアログやキーボードは画面の中に描くので、はみ出すものは保存しない）。
+ * 前に保存した内容は捨てる。
+ * @param a_x 左上X座標
+ * @param a_y 左上Y座標
+ * @param a_w 幅
+ * @param a_h 高さ
+ * @retval true 保存した
+ * @retval false メモリが足りない・表示器から読み出せない（呼び出し側で画面を描き直すこと）
+ */
+bool GUISaveUnder::save(int16_t a_x, int16_t a_y, int16_t a_w, int16_t a_h)
+{
+	discard();
+	if (a_w <= 0 || a_h <= 0) return false;
+	m_pBuf = (uint16_t*)malloc((size_t)a_w * a_h * sizeof(uint16_t));
+	if (m_pBuf == nullptr) {
+		dbgprintf("save-under: no memory for %dx%d\n", a_w, a_h);
+		return false;
+	}
+	if (!m_ptft->readRect(a_x, a_y, a_w, a_h, m_pBuf)) {
+		discard();
+		return false;
+	}
+	m_x = a_x;
+	m_y = a_y;
+	m_w = a_w;
+	m_h = a_h;
+	return true;
+}
+
+/**
+ * @brief 保存した矩形を書き戻し、バッファを解放する
+ * @retval true 書き戻した
+ * @retval false 保存していない（呼び出し側で画面を描き直すこと）
+ */
+bool GUISaveUnder::restore()
+{
+	if (m_pBuf == nullptr) return false;
+	// 直後にバッファを解放するので、DMAの完了を待って戻るdrawGlyph565()で送る（完了を待たないdrawRGBBitmap()にしてはいけない）
+	m_ptft->drawGlyph565(m_x, m_y, m_w, m_h, m_pBuf); // 565のピクセルの矩形を１つのウインドウで送る
+	discard();
+	return true;
+}
+
+/**
+ * @brief 書き戻さずにバッファを解放する
+ */
+void GUISaveUnder::discard()
+{
+	free(m_pBuf);
+	m_pBuf = nullptr;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file GUISaveUnder.h
+ * @brief ポップアップの下になる画面を保存・復元するクラス定義
+ * @details
+ * - ポップアップを描く前に、隠れる矩形を表示器から読み出してRAMに保存する（液晶はGRAMをRAMRDで読み戻し、キャンバスはバッファから取り出す）。
+ * - 閉じるときはその矩形だけを書き戻すので、画面全体を描き直さずに済む。
+ * - メモリが足りない・表示器が読み出せない場合はsave()がfalseを返す。そのときは呼び出し側が従来どおり画面を描き直す。
+ */
+#pragma once
+#include <stdint.h>
+#include "lib-9341/Adafruit_GFX_Library/Adafruit_GFX.h"
+
+using namespace ardPort;
+
+/**
+ * @brief ポップアップの下になる矩形を保存し、閉じるときに書き戻すクラス
+ * @details
+ * 保存用のバッファはsave()で確保し、restore()・discard()・デストラクタで解放する。
+ * 大きなバッファを持ち続けないよう、ポップアップを表示している間だけ使う。
+ */
+class GUISaveUnder {
+public:
+	/**
+	 * @brief コンストラクタ
+	 * @param a_ptft 保存・復元する表示器
+	 */
+	GUISaveUnder(Adafruit_GFX* a_ptft);
+	~GUISaveUnder();
+
+	bool save(int16_t a_x, int16_t a_y, int16_t a_w, int16_t a_h);
+	bool restore();
+	void discard();
+	/// @brief 保存した内容を持っているか
+	bool isSaved() const { return m_pBuf != nullptr; }
+
+private:
+	Adafruit_GFX* m_ptft;       ///< 表示器
+	uint16_t* m_pBuf = nullptr; ///< 保存したピクセル（左上から行の順）
+	int16_t m_x = 0;            ///< 保存した矩形の左上X座標
+	int16_t m_y = 0;            ///< 保存した矩形の左上Y座標
+	int16_t m_w = 0;            ///< 保存した矩形の幅
+	int16_t m_h = 0;            ///< 保存した矩形の高さ
+};
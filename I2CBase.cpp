@@ -6,8 +6,16 @@
  * - 派生クラスでI2Cデバイス制御を拡張可能。
  */
 #include "I2CBase.h"
-#include "hardware/i2c.h"
-#include "hardware/gpio.h"
+#include <stdio.h>
+
+#if defined(I2C_HOST_BUILD)
+#define dbgprintf(...) ((void)0) ///< ホストビルドではデバッグ出力しない
+#else
+#include "Settings.h"
+#include "printfDebug.h"
+
+extern Settings settings;
+#endif
 
 /**
  * @brief I2CBaseクラスのデフォルトコンストラクタ
@@ -19,8 +27,25 @@
 I2CBase::I2CBase() :
 	m_u8I2cPort(0), ///< I2Cポート番号初期化
 	m_u8SdaPin(0),  ///< SDAピン初期化
-	m_u8SclPin(0)   ///< SCLピン初期化
+	m_u8SclPin(0),  ///< SCLピン初期化
+	m_u8I2CAddress(0),
+#if defined(I2C_HOST_BUILD)
+	m_pTransport(nullptr),
+#else
+	m_pTransport(&m_defaultTransport),
+#endif
+	m_u32NackCount(0),
+	m_u32TimeoutCount(0),
+	m_u32RecoveryCount(0),
+	m_u32RecoveryFailCount(0),
+	m_u8ConsecutiveErrors(0),
+	m_u32BackoffMs(I2C_RECOVERY_BACKOFF_MIN_MS),
+	m_u64NextRecoveryUs(0),
+	m_isTraceEnabled(true),
+	m_u8LastReg(0),
+	m_u32TraceSeq(0)
 {
+	clearTrace();
 
 }
 
@@ -44,18 +69,28 @@ bool I2CBase::InitI2C(uint8_t a_u8I2CAddress , uint8_t a_u8I2cPort, uint8_t a_u8
 	m_u8SdaPin = a_u8SdaPin;   ///< SDAピン保存
 	m_u8SclPin = a_u8SclPin;   ///< SCLピン保存
 	m_u8I2CAddress = a_u8I2CAddress; ///< I2Cアドレス保存
-	if (m_u8I2cPort != 0 && m_u8I2cPort != 1) {
-		return false; // 無効なポート番号
-	}
-	if (m_u8SdaPin > 29 || m_u8SclPin > 29) {
-		return false; // 無効なピン番号
+	if (m_pTransport == nullptr) {
+		return false; // トランスポート未設定
 	}
-	i2c_init((m_u8I2cPort == 0) ? i2c0 : i2c1, 400 * 1000); ///< 400kHzでI2C初期化
-	gpio_set_function(m_u8SdaPin, GPIO_FUNC_I2C); ///< SDAピンをI2C機能に設定
-	gpio_set_function(m_u8SclPin, GPIO_FUNC_I2C); ///< SCLピンをI2C機能に設定
-	gpio_pull_up(m_u8SdaPin); ///< SDAピンをプルアップ
-	gpio_pull_up(m_u8SclPin); ///< SCLピンをプルアップ
-	return true;
+	return m_pTransport->init(m_u8I2cPort, m_u8SdaPin, m_u8SclPin, 400 * 1000); ///< 400kHzでI2C初期化
+}
+
+/**
+ * @brief 使用するI2Cトランスポートを差し替える
+ * @details
+ * InitI2C()より前に呼び出してください。nullptrを指定した場合は既定のトランスポートに戻します
+ * （ホストビルドでは既定のトランスポートは無いので未設定になります）。
+ *
+ * @param a_pTransport 使用するトランスポート
+ * @retval なし
+ */
+void I2CBase::setTransport(I2CTransport* a_pTransport)
+{
+#if defined(I2C_HOST_BUILD)
+	m_pTransport = a_pTransport;
+#else
+	m_pTransport = (a_pTransport != nullptr) ? a_pTransport : &m_defaultTransport;
+#endif
 }
 
 /**
@@ -89,10 +124,143 @@ int I2CBase::writeWord(uint16_t cmddata)
  */
 int I2CBase::writeBlocking(const uint8_t* src, size_t len, bool nostop)
 {
-    int iRet = i2c_write_blocking((m_u8I2cPort == 0) ? i2c0 : i2c1, m_u8I2CAddress, src, len, nostop); ///< I2Cバス書き込み
+	uint32_t timeout = I2C_TIMEOUT_BASE_US + I2C_TIMEOUT_PER_BYTE_US * len; ///< バスが固まっても戻れるようにタイムアウト付きで送信
+	uint32_t startUs = (uint32_t)m_pTransport->timeUs();
+	int iRet = m_pTransport->write(m_u8I2CAddress, src, len, nostop, timeout); ///< I2Cバス書き込み
+	if (len > 0) m_u8LastReg = src[0];
+	traceTransaction(I2C_OP_WRITE, m_u8LastReg, len, startUs, iRet);
+	updateBusHealth(iRet);
 	return iRet;
 }
 
+/**
+ * @brief I2Cバスからデータを読み出す
+ * @details
+ * 指定バイト数をI2Cバスから受信します。
+ * バスが固まった場合でも戻れるよう、バイト数に応じたタイムアウトを設定します。
+ *
+ * @param dst 受信データの格納先
+ * @param len 受信データ長
+ * @param nostop ストップコンディションを送信しない場合true
+ * @retval int 読み出したバイト数（負値はエラー）
+ */
+int I2CBase::readBlocking(uint8_t* dst, size_t len, bool nostop)
+{
+	uint32_t timeout = I2C_TIMEOUT_BASE_US + I2C_TIMEOUT_PER_BYTE_US * len;
+	uint32_t startUs = (uint32_t)m_pTransport->timeUs();
+	int iRet = m_pTransport->read(m_u8I2CAddress, dst, len, nostop, timeout); ///< I2Cバス読み出し
+	traceTransaction(I2C_OP_READ, m_u8LastReg, len, startUs, iRet);
+	updateBusHealth(iRet);
+	return iRet;
+}
+
+/**
+ * @brief 指定レジスタから連続して読み出す
+ * @details
+ * レジスタアドレスを送信（リピートスタート）した後、指定バイト数を受信します。
+ * アドレス送信に失敗した場合は受信を行わずにエラーを返します。
+ *
+ * @param reg 先頭レジスタアドレス
+ * @param dst 受信データの格納先
+ * @param len 受信データ長
+ * @retval int 読み出したバイト数（負値はエラー）
+ */
+int I2CBase::readRegs(uint8_t reg, uint8_t* dst, size_t len)
+{
+	int iRet = writeBlocking(&reg, 1, true); ///< レジスタアドレス送信（リピートスタート）
+	if (iRet < 0) return iRet;
+	return readBlocking(dst, len, false);
+}
+
+/**
+ * @brief トランザクション結果をバス健全性カウンタに反映する
+ * @details
+ * 成功時は連続エラー回数を0に戻します。
+ * 失敗時はI2C_ERR_TIMEOUTならタイムアウト、それ以外はNACKとして計数します。
+ *
+ * @param iRet トランスポートの戻り値
+ * @retval なし
+ */
+void I2CBase::updateBusHealth(int iRet)
+{
+	if (iRet >= 0) {
+		m_u8ConsecutiveErrors = 0;
+		return;
+	}
+	if (iRet == I2C_ERR_TIMEOUT) {
+		m_u32TimeoutCount++;
+	} else {
+		m_u32NackCount++;
+	}
+	if (m_u8ConsecutiveErrors < 0xFF) m_u8ConsecutiveErrors++;
+}
+
+/**
+ * @brief I2Cバスを復旧する
+ * @details
+ * トランスポートのrecoverBus()でSCL 9クロック＋STOPによるバス解放とコントローラの再初期化を行います。
+ * SDAが解放された場合のみonBusRecovered()を呼び出してデバイス設定を再適用します。
+ *
+ * @retval true  復旧成功
+ * @retval false 復旧失敗（SDAがLowのまま、または再設定に失敗）
+ */
+bool I2CBase::recoverBus()
+{
+	bool isSdaReleased = m_pTransport->recoverBus();
+	dbgprintf("I2CBase::recoverBus: SDA %s\n", isSdaReleased ? "released" : "stuck low");
+	if (!isSdaReleased) return false;
+	m_u8ConsecutiveErrors = 0;
+	if (onBusRecovered() == false) return false;
+	return m_u8ConsecutiveErrors == 0; ///< 再設定中にエラーが起きていないこと
+}
+
+/**
+ * @brief バスの健全性を確認し、必要なら復旧を行う
+ * @details
+ * 連続エラー回数がI2C_RECOVERY_THRESHOLD未満なら何もせずtrueを返します。
+ * 閾値以上で、かつバックオフ期間が過ぎていればrecoverBus()を実行します。
+ * 復旧に失敗するたびに待ち時間を2倍にし、I2C_RECOVERY_BACKOFF_MAX_MSで頭打ちにします。
+ * 復旧に成功すると待ち時間は初期値に戻ります。
+ *
+ * @retval true  バスは正常（または復旧に成功した）
+ * @retval false バス異常
+ */
+bool I2CBase::checkBusHealth()
+{
+	if (m_u8ConsecutiveErrors < I2C_RECOVERY_THRESHOLD) return true;
+	uint64_t now = m_pTransport->timeUs();
+	if (now < m_u64NextRecoveryUs) return false; ///< バックオフ中
+	if (recoverBus()) {
+		m_u32RecoveryCount++;
+		m_u32BackoffMs = I2C_RECOVERY_BACKOFF_MIN_MS;
+		m_u64NextRecoveryUs = 0;
+		dbgprintf("I2CBase::checkBusHealth: recovered (NACK:%lu TIMEOUT:%lu)\n", m_u32NackCount, m_u32TimeoutCount);
+		return true;
+	}
+	m_u32RecoveryFailCount++;
+	m_u64NextRecoveryUs = now + (uint64_t)m_u32BackoffMs * 1000;
+	dbgprintf("I2CBase::checkBusHealth: recovery failed, retry in %lums\n", m_u32BackoffMs);
+	m_u32BackoffMs = (m_u32BackoffMs * 2 > I2C_RECOVERY_BACKOFF_MAX_MS) ? I2C_RECOVERY_BACKOFF_MAX_MS : m_u32BackoffMs * 2;
+	return false;
+}
+
+/**
+ * @brief バス健全性カウンタをクリアする
+ * @details
+ * NACK/タイムアウト/復旧回数を0に戻し、バックオフを初期値に戻します。
+ * @retval なし
+ */
+void I2CBase::clearBusCounters()
+{
+	m_u32NackCount = 0;
+	m_u32TimeoutCount = 0;
+	m_u32RecoveryCount = 0;
+	m_u32RecoveryFailCount = 0;
+	m_u8ConsecutiveErrors = 0;
+	m_u32BackoffMs = I2C_RECOVERY_BACKOFF_MIN_MS;
+	m_u64NextRecoveryUs = 0;
+}
+
 /**
  * @brief 指定レジスタに1バイト書き込む
  * @details
@@ -108,4 +276,91 @@ int I2CBase::writeRegAndData_1(uint8_t reg, uint8_t dataByte)
 	uint8_t data[2] = { reg, dataByte }; ///< レジスタ＋データ配列
     int iRet = writeBlocking(data, sizeof(data), false);
 	return iRet;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief トランザクションをトレースとヒストグラムに記録する
+ * @details
+ * 終了時刻を取得してリングバッファに1エントリ書き込み、所要時間のlog2バケットを加算します。
+ * 出力は行わないので、記録コストは数十サイクル程度です。
+ *
+ * @param op トランザクション種別
+ * @param reg 対象レジスタ
+ * @param len 要求バイト数
+ * @param startUs 開始時刻（us）
+ * @param iRet SDKの戻り値
+ * @retval なし
+ */
+void I2CBase::traceTransaction(I2C_OP op, uint8_t reg, size_t len, uint32_t startUs, int iRet)
+{
+	if (m_isTraceEnabled == false) return;
+	uint32_t endUs = (uint32_t)m_pTransport->timeUs();
+	I2CTraceEntry& e = m_trace[m_u32TraceSeq & (I2C_TRACE_SIZE - 1)];
+	e.startUs = startUs;
+	e.endUs = endUs;
+	e.len = (uint16_t)len;
+	e.reg = reg;
+	e.op = (uint8_t)op;
+	e.result = (int16_t)iRet;
+	m_u32TraceSeq++;
+
+	uint32_t elapsed = endUs - startUs;
+	int bucket = (elapsed == 0) ? 0 : 32 - __builtin_clz(elapsed); ///< log2(us)+1
+	if (bucket >= I2C_HIST_BUCKETS) bucket = I2C_HIST_BUCKETS - 1;
+	m_u32Hist[op][bucket]++;
+}
+
+/**
+ * @brief 新しい順にidx番目のトレースを取得する
+ * @param idx 新しい順のインデックス（0が最新）
+ * @param[out] a_entry 格納先
+ * @retval true  取得成功
+ * @retval false idxが範囲外
+ */
+bool I2CBase::getTrace(int idx, I2CTraceEntry& a_entry) const
+{
+	if (idx < 0 || idx >= getTraceCount()) return false;
+	a_entry = m_trace[(m_u32TraceSeq - 1 - idx) & (I2C_TRACE_SIZE - 1)];
+	return true;
+}
+
+/**
+ * @brief トレースとヒストグラムをクリアする
+ * @retval なし
+ */
+void I2CBase::clearTrace()
+{
+	m_u32TraceSeq = 0;
+	for (int op = 0; op < I2C_OP_COUNT; op++) {
+		for (int b = 0; b < I2C_HIST_BUCKETS; b++) {
+			m_u32Hist[op][b] = 0;
+		}
+	}
+}
+
+/**
+ * @brief トレースとヒストグラムをシリアルに出力する
+ * @details
+ * 古い順にトレースを出力した後、種別毎のヒストグラムを出力します。
+ * USB経由の出力は時間がかかるので、必要なときだけ呼び出してください。
+ * @retval なし
+ */
+void I2CBase::dumpTrace() const
+{
+	static const char* opNames[I2C_OP_COUNT] = {"WR", "RD"};
+	int count = getTraceCount();
+	printf("I2C trace: %d entries (total %lu)\n", count, (unsigned long)m_u32TraceSeq);
+	for (int i = count - 1; i >= 0; i--) {
+		I2CTraceEntry e;
+		getTrace(i, e);
+		printf("%10lu %s reg:%02X len:%3u ret:%4d %5luus\n", (unsigned long)e.startUs, opNames[e.op], e.reg, e.len, e.result, (unsigned long)(e.endUs - e.startUs));
+	}
+	for (int op = 0; op < I2C_OP_COUNT; op++) {
+		printf("I2C %s latency:", opNames[op]);
+		for (int b = 0; b < I2C_HIST_BUCKETS; b++) {
+			printf(" <%lu:%lu", (1UL << b), (unsigned long)m_u32Hist[op][b]);
+		}
+		printf("\n");
+	}
+	printf("I2C NACK:%lu TIMEOUT:%lu RECOVER:%lu FAIL:%lu\n", (unsigned long)m_u32NackCount, (unsigned long)m_u32TimeoutCount, (unsigned long)m_u32RecoveryCount, (unsigned long)m_u32RecoveryFailCount);
+}
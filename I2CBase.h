@@ -5,10 +5,48 @@
  * - I2C通信を行うデバイス向けの共通基底クラス。
  * - I2Cポート番号、SDA/SCLピン番号、I2Cアドレスなどの共通メンバを持つ。
  * - I2C初期化やレジスタ書き込みなどの基本操作を提供し、派生クラスで拡張可能。
+ * - ハードウェアへのアクセスはI2CTransport経由で行う。I2C_HOST_BUILDを定義した場合は
+ *   既定のRP2040トランスポートを持たず、setTransport()で指定したもの（AS3935Sim等）を使う。
  */
 #pragma once
 #include <stdint.h>
 #include <cstddef>
+#include "I2CTransport.h"
+#if !defined(I2C_HOST_BUILD)
+#include "I2CTransportRP2040.h"
+#endif
+
+#define I2C_TIMEOUT_BASE_US 1000        ///< 1トランザクションあたりの基本タイムアウト（us）
+#define I2C_TIMEOUT_PER_BYTE_US 100     ///< 1バイトあたりに加算するタイムアウト（us）
+#define I2C_RECOVERY_THRESHOLD 3        ///< バス復旧を試みるまでの連続エラー回数
+#define I2C_RECOVERY_BACKOFF_MIN_MS 500 ///< バス復旧失敗時のバックオフ初期値（ms）
+#define I2C_RECOVERY_BACKOFF_MAX_MS 60000 ///< バス復旧失敗時のバックオフ上限（ms）
+
+#define I2C_TRACE_SIZE 64      ///< トランザクショントレースのリングバッファ長（2のべき乗）
+#define I2C_HIST_BUCKETS 16    ///< レイテンシヒストグラムのバケット数（log2(us)毎）
+
+/**
+ * @brief I2Cトランザクションの種別
+ */
+enum I2C_OP {
+	I2C_OP_WRITE = 0, ///< 書き込み
+	I2C_OP_READ = 1,  ///< 読み出し
+	I2C_OP_COUNT      ///< 種別数
+};
+
+/**
+ * @brief I2Cトランザクショントレースの1エントリ
+ * @details
+ * 記録時のコストを抑えるため、時刻はトランスポートの時刻（us）の下位32ビット、結果はSDKの戻り値をそのまま保持する。
+ */
+struct I2CTraceEntry {
+	uint32_t startUs; ///< 開始時刻（us）
+	uint32_t endUs;   ///< 終了時刻（us）
+	uint16_t len;     ///< 要求バイト数
+	uint8_t reg;      ///< 対象レジスタ（書き込みは先頭バイト、読み出しは直前に指定したレジスタ）
+	uint8_t op;       ///< トランザクション種別（I2C_OP）
+	int16_t result;   ///< SDKの戻り値（転送バイト数、負値はエラー）
+};
 
 /**
  * @brief I2Cデバイス用の基底抽象クラス
@@ -22,6 +60,53 @@ protected:
     uint8_t m_u8SdaPin;     ///< SDAピン番号
     uint8_t m_u8SclPin;     ///< SCLピン番号
 	uint8_t m_u8I2CAddress;  ///< I2Cアドレス
+	I2CTransport* m_pTransport; ///< 使用中のI2Cトランスポート
+#if !defined(I2C_HOST_BUILD)
+	I2CTransportRP2040 m_defaultTransport; ///< 既定のRP2040トランスポート
+#endif
+
+	uint32_t m_u32NackCount;         ///< NACK（アドレス/データ無応答）発生回数
+	uint32_t m_u32TimeoutCount;      ///< タイムアウト発生回数
+	uint32_t m_u32RecoveryCount;     ///< バス復旧に成功した回数
+	uint32_t m_u32RecoveryFailCount; ///< バス復旧に失敗した回数
+	uint8_t m_u8ConsecutiveErrors;   ///< 連続エラー回数（成功で0に戻る）
+	uint32_t m_u32BackoffMs;         ///< 次回の復旧試行までの待ち時間（ms）
+	uint64_t m_u64NextRecoveryUs;    ///< 次回復旧を試みてよい時刻（トランスポートの時刻基準, us）
+
+	bool m_isTraceEnabled;                          ///< トランザクショントレースの有効/無効
+	uint8_t m_u8LastReg;                            ///< 最後に指定したレジスタアドレス（読み出しトレース用）
+	uint32_t m_u32TraceSeq;                         ///< 記録したトランザクションの通し番号
+	I2CTraceEntry m_trace[I2C_TRACE_SIZE];          ///< トランザクショントレースのリングバッファ
+	uint32_t m_u32Hist[I2C_OP_COUNT][I2C_HIST_BUCKETS]; ///< 種別毎のレイテンシヒストグラム（log2(us)バケット）
+
+	/**
+	 * @brief トランザクションをトレースとヒストグラムに記録する
+	 * @param op トランザクション種別
+	 * @param reg 対象レジスタ
+	 * @param len 要求バイト数
+	 * @param startUs 開始時刻（us）
+	 * @param iRet SDKの戻り値
+	 * @retval なし
+	 */
+	void traceTransaction(I2C_OP op, uint8_t reg, size_t len, uint32_t startUs, int iRet);
+
+	/**
+	 * @brief トランザクション結果をバス健全性カウンタに反映する
+	 * @details
+	 * 負値のうちI2C_ERR_TIMEOUTはタイムアウト、それ以外はNACKとして計数する。
+	 * @param iRet トランスポートの戻り値
+	 * @retval なし
+	 */
+	void updateBusHealth(int iRet);
+	/**
+	 * @brief バス復旧後の再設定フック
+	 * @details
+	 * recoverBus()でコントローラを再初期化した後に呼ばれる。
+	 * 派生クラスでデバイスの設定を既知の状態に戻すために上書きする。
+	 * @retval true 再設定成功
+	 * @retval false 再設定失敗
+	 */
+	virtual bool onBusRecovered() { return true; }
 
   public :
 	  /**
@@ -48,6 +133,19 @@ protected:
      * @retval false 初期化失敗
      */
 	  virtual bool InitI2C(uint8_t a_u8I2CAddress, uint8_t a_u8I2cPort, uint8_t a_u8SdaPin, uint8_t a_u8SclPin);
+    /**
+     * @brief I2Cトランスポートを差し替える
+     * @details
+     * InitI2C()より前に呼び出す。nullptrで既定のトランスポートに戻す。
+     * @param a_pTransport 使用するトランスポート
+     * @retval なし
+     */
+	  void setTransport(I2CTransport* a_pTransport);
+    /**
+     * @brief 使用中のI2Cトランスポートを取得する
+     * @retval トランスポートへのポインタ
+     */
+	  I2CTransport* getTransport() const { return m_pTransport; }
     /**
      * @brief I2Cバスにデータを書き込む
      * @details
@@ -75,4 +173,96 @@ protected:
      * @retval 書き込んだバイト数（負値はエラー）
      */
 	  int writeWord(uint16_t cmddata);
+    /**
+     * @brief I2Cバスからデータを読み出す
+     * @details
+     * 指定バイト数をI2Cバスから受信する。nostop=trueでストップコンディション無し。
+     * @param dst 受信データバッファ
+     * @param len 受信バイト数
+     * @param nostop ストップコンディション無しならtrue
+     * @retval 読み出したバイト数（負値はエラー）
+     */
+	  int readBlocking(uint8_t* dst, size_t len, bool nostop);
+    /**
+     * @brief 指定レジスタから連続して読み出す
+     * @details
+     * レジスタアドレスを送信（リピートスタート）後、lenバイトを受信する。
+     * @param reg 先頭レジスタアドレス
+     * @param dst 受信データバッファ
+     * @param len 受信バイト数
+     * @retval 読み出したバイト数（負値はエラー）
+     */
+	  int readRegs(uint8_t reg, uint8_t* dst, size_t len);
+    /**
+     * @brief I2Cバスを復旧する
+     * @details
+     * スレーブがSDAをLowに保持したまま固まった場合に備え、トランスポートでSCLを9クロック出力してから
+     * STOPコンディションを生成し、I2Cコントローラを再初期化する。
+     * 再初期化後はonBusRecovered()でデバイス設定を再適用する。
+     * @retval true 復旧成功（SDAが解放され、再設定も成功）
+     * @retval false 復旧失敗
+     */
+	  bool recoverBus();
+    /**
+     * @brief バスの健全性を確認し、必要なら復旧を行う
+     * @details
+     * 連続エラーがI2C_RECOVERY_THRESHOLD回以上の場合にrecoverBus()を実行する。
+     * 復旧に失敗した場合は待ち時間を倍々に延ばし（上限I2C_RECOVERY_BACKOFF_MAX_MS）、
+     * その間は復旧を試みない。メインループから定期的に呼び出す。
+     * @retval true バスは正常
+     * @retval false バス異常（復旧待ち、または復旧失敗）
+     */
+	  bool checkBusHealth();
+
+	  uint32_t getNackCount() const { return m_u32NackCount; }                 ///< NACK発生回数を取得
+	  uint32_t getTimeoutCount() const { return m_u32TimeoutCount; }           ///< タイムアウト発生回数を取得
+	  uint32_t getRecoveryCount() const { return m_u32RecoveryCount; }         ///< バス復旧成功回数を取得
+	  uint32_t getRecoveryFailCount() const { return m_u32RecoveryFailCount; } ///< バス復旧失敗回数を取得
+	  uint8_t getConsecutiveErrors() const { return m_u8ConsecutiveErrors; }   ///< 現在の連続エラー回数を取得
+	  /**
+	   * @brief バス健全性カウンタをクリアする
+	   * @retval なし
+	   */
+	  void clearBusCounters();
+
+	  /**
+	   * @brief トランザクショントレースの有効/無効を切り替える
+	   * @param a_isEnable trueで記録する
+	   * @retval なし
+	   */
+	  void setTraceEnable(bool a_isEnable) { m_isTraceEnabled = a_isEnable; }
+	  /**
+	   * @brief 保持しているトレースの件数を取得する
+	   * @retval 件数（最大I2C_TRACE_SIZE）
+	   */
+	  int getTraceCount() const { return (m_u32TraceSeq < I2C_TRACE_SIZE) ? (int)m_u32TraceSeq : I2C_TRACE_SIZE; }
+	  /**
+	   * @brief 新しい順にidx番目のトレースを取得する
+	   * @param idx 新しい順のインデックス（0が最新）
+	   * @param[out] a_entry 格納先
+	   * @retval true 取得成功
+	   * @retval false idxが範囲外
+	   */
+	  bool getTrace(int idx, I2CTraceEntry& a_entry) const;
+	  /**
+	   * @brief レイテンシヒストグラムの値を取得する
+	   * @details
+	   * バケットbには 2^(b-1) <= 所要時間(us) < 2^b のトランザクション数が入る（b=0は0us）。
+	   * @param op トランザクション種別
+	   * @param bucket バケット番号
+	   * @retval 件数
+	   */
+	  uint32_t getHistogram(I2C_OP op, int bucket) const { return m_u32Hist[op][bucket]; }
+	  /**
+	   * @brief トレースとヒストグラムをクリアする
+	   * @retval なし
+	   */
+	  void clearTrace();
+	  /**
+	   * @brief トレースとヒストグラムをシリアルに出力する
+	   * @details
+	   * 呼び出されたときだけ出力するので、通常動作中のI2C処理には影響しない。
+	   * @retval なし
+	   */
+	  void dumpTrace() const;
 };
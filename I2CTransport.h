@@ -0,0 +1,79 @@
+/**
+ * @file I2CTransport.h
+ * @brief I2C通信路（トランスポート）の抽象インターフェース定義
+ * @details
+ * - I2CBaseが使用するI2Cの送受信・バス復旧・時刻取得・IRQパルス計測を抽象化する。
+ * - 実機ではI2CTransportRP2040（pico-sdk）、PC上ではAS3935Sim（動作モデル）を差し替えて使用する。
+ * - 戻り値の規約はpico-sdkのi2c_xxx_timeout_usに合わせる（転送バイト数、負値はエラー）。
+ */
+#pragma once
+#include <stdint.h>
+#include <cstddef>
+
+#define I2C_ERR_GENERIC -1 ///< NACK等の一般エラー（PICO_ERROR_GENERICと同値）
+#define I2C_ERR_TIMEOUT -2 ///< タイムアウト（PICO_ERROR_TIMEOUTと同値）
+
+/**
+ * @brief I2C通信路の抽象基底クラス
+ * @details
+ * I2CBaseはこのインターフェースだけを通してハードウェアにアクセスする。
+ * 派生クラスで実機/シミュレーションそれぞれの実装を提供する。
+ */
+class I2CTransport {
+  public:
+	virtual ~I2CTransport() {}
+	/**
+	 * @brief 通信路を初期化する
+	 * @param a_u8I2cPort I2Cポート番号
+	 * @param a_u8SdaPin  SDAピン番号
+	 * @param a_u8SclPin  SCLピン番号
+	 * @param a_u32Baud   通信速度（Hz）
+	 * @retval true 初期化成功
+	 * @retval false 初期化失敗
+	 */
+	virtual bool init(uint8_t a_u8I2cPort, uint8_t a_u8SdaPin, uint8_t a_u8SclPin, uint32_t a_u32Baud) = 0;
+	/**
+	 * @brief データを送信する
+	 * @param addr 7ビットI2Cアドレス
+	 * @param src 送信データ
+	 * @param len 送信バイト数
+	 * @param nostop ストップコンディション無しならtrue
+	 * @param timeoutUs タイムアウト（us）
+	 * @retval 送信バイト数（負値はエラー）
+	 */
+	virtual int write(uint8_t addr, const uint8_t* src, size_t len, bool nostop, uint32_t timeoutUs) = 0;
+	/**
+	 * @brief データを受信する
+	 * @param addr 7ビットI2Cアドレス
+	 * @param dst 受信データ格納先
+	 * @param len 受信バイト数
+	 * @param nostop ストップコンディション無しならtrue
+	 * @param timeoutUs タイムアウト（us）
+	 * @retval 受信バイト数（負値はエラー）
+	 */
+	virtual int read(uint8_t addr, uint8_t* dst, size_t len, bool nostop, uint32_t timeoutUs) = 0;
+	/**
+	 * @brief 固まったバスを解放する（SCL 9クロック＋STOP）し、コントローラを再初期化する
+	 * @retval true SDA/SCLが解放された
+	 * @retval false SDAがLowのまま
+	 */
+	virtual bool recoverBus() = 0;
+	/**
+	 * @brief 単調増加する現在時刻を取得する
+	 * @retval 現在時刻（us）
+	 */
+	virtual uint64_t timeUs() = 0;
+	/**
+	 * @brief IRQピンを入力として初期化する
+	 * @param a_u8IrqPin IRQピン番号
+	 * @retval なし
+	 */
+	virtual void initIrqPin(uint8_t a_u8IrqPin) = 0;
+	/**
+	 * @brief IRQピンの立ち上がりエッジを指定時間カウントする（LCOキャリブレーション用）
+	 * @param a_u8IrqPin IRQピン番号
+	 * @param a_u16Ms 計測時間（ms）
+	 * @retval パルス数
+	 */
+	virtual uint32_t countIrqPulses(uint8_t a_u8IrqPin, uint16_t a_u16Ms) = 0;
+};
@@ -0,0 +1,152 @@
+/**
+ * @file I2CTransportRP2040.cpp
+ * @brief RP2040（pico-sdk）用I2Cトランスポートの実装
+ * @details
+ * - I2Cコントローラの初期化、タイムアウト付き送受信、SCL手動駆動によるバス復旧を実装。
+ * - LCOキャリブレーション用のIRQパルス計測はFreqCounterに委譲する。
+ */
+#include "I2CTransportRP2040.h"
+#include "FreqCounter.h"
+#include "hardware/i2c.h"
+#include "hardware/gpio.h"
+#include "pico/time.h"
+
+/**
+ * @brief I2Cコントローラを初期化する
+ * @details
+ * ポート番号・ピン番号を検査し、I2Cコントローラの初期化とピン機能設定、プルアップを行います。
+ *
+ * @param a_u8I2cPort I2Cポート番号（0または1）
+ * @param a_u8SdaPin  SDAピン番号
+ * @param a_u8SclPin  SCLピン番号
+ * @param a_u32Baud   通信速度（Hz）
+ * @retval true  初期化成功
+ * @retval false ポート番号またはピン番号が不正
+ */
+bool I2CTransportRP2040::init(uint8_t a_u8I2cPort, uint8_t a_u8SdaPin, uint8_t a_u8SclPin, uint32_t a_u32Baud)
+{
+	m_u8I2cPort = a_u8I2cPort;
+	m_u8SdaPin = a_u8SdaPin;
+	m_u8SclPin = a_u8SclPin;
+	m_u32Baud = a_u32Baud;
+	if (m_u8I2cPort != 0 && m_u8I2cPort != 1) {
+		return false; // 無効なポート番号
+	}
+	if (m_u8SdaPin > 29 || m_u8SclPin > 29) {
+		return false; // 無効なピン番号
+	}
+	i2c_init((m_u8I2cPort == 0) ? i2c0 : i2c1, m_u32Baud); ///< I2C初期化
+	gpio_set_function(m_u8SdaPin, GPIO_FUNC_I2C); ///< SDAピンをI2C機能に設定
+	gpio_set_function(m_u8SclPin, GPIO_FUNC_I2C); ///< SCLピンをI2C機能に設定
+	gpio_pull_up(m_u8SdaPin); ///< SDAピンをプルアップ
+	gpio_pull_up(m_u8SclPin); ///< SCLピンをプルアップ
+	return true;
+}
+
+/**
+ * @brief タイムアウト付きでデータを送信する
+ * @param addr 7ビットI2Cアドレス
+ * @param src 送信データ
+ * @param len 送信バイト数
+ * @param nostop ストップコンディション無しならtrue
+ * @param timeoutUs タイムアウト（us）
+ * @retval int 送信バイト数（負値はエラー）
+ */
+int I2CTransportRP2040::write(uint8_t addr, const uint8_t* src, size_t len, bool nostop, uint32_t timeoutUs)
+{
+	return i2c_write_timeout_us((m_u8I2cPort == 0) ? i2c0 : i2c1, addr, src, len, nostop, timeoutUs);
+}
+
+/**
+ * @brief タイムアウト付きでデータを受信する
+ * @param addr 7ビットI2Cアドレス
+ * @param dst 受信データ格納先
+ * @param len 受信バイト数
+ * @param nostop ストップコンディション無しならtrue
+ * @param timeoutUs タイムアウト（us）
+ * @retval int 受信バイト数（負値はエラー）
+ */
+int I2CTransportRP2040::read(uint8_t addr, uint8_t* dst, size_t len, bool nostop, uint32_t timeoutUs)
+{
+	return i2c_read_timeout_us((m_u8I2cPort == 0) ? i2c0 : i2c1, addr, dst, len, nostop, timeoutUs);
+}
+
+/**
+ * @brief SCLを手動で駆動してI2Cバスを解放する
+ * @details
+ * I2Cコントローラを解放してSDA/SCLをGPIOに切り替え、SDAが解放されるまで最大9回SCLをクロックします。
+ * その後STOPコンディション（SCL High中にSDAをLow→High）を生成し、コントローラを再初期化します。
+ * ピンはLow駆動/入力（プルアップ）の切り替えでオープンドレインを模擬します。
+ *
+ * @retval true  SDA/SCLが解放された
+ * @retval false SDAまたはSCLがLowのまま
+ */
+bool I2CTransportRP2040::recoverBus()
+{
+	i2c_inst_t* i2c = (m_u8I2cPort == 0) ? i2c0 : i2c1;
+	i2c_deinit(i2c);
+
+	gpio_init(m_u8SdaPin); ///< SIO入力に切り替え（Lowは出力方向で駆動する）
+	gpio_init(m_u8SclPin);
+	gpio_pull_up(m_u8SdaPin);
+	gpio_pull_up(m_u8SclPin);
+	gpio_put(m_u8SdaPin, 0);
+	gpio_put(m_u8SclPin, 0);
+	sleep_us(5);
+
+	// SDAが解放されるまでSCLを最大9クロック出力する
+	for (int i = 0; i < 9 && !gpio_get(m_u8SdaPin); i++) {
+		gpio_set_dir(m_u8SclPin, GPIO_OUT); ///< SCL Low
+		sleep_us(5);
+		gpio_set_dir(m_u8SclPin, GPIO_IN); ///< SCL 解放
+		for (int w = 0; w < 100 && !gpio_get(m_u8SclPin); w++) {
+			sleep_us(10); ///< クロックストレッチ待ち
+		}
+		sleep_us(5);
+	}
+	// STOPコンディションを生成する
+	gpio_set_dir(m_u8SclPin, GPIO_OUT); ///< SCL Low
+	sleep_us(5);
+	gpio_set_dir(m_u8SdaPin, GPIO_OUT); ///< SDA Low
+	sleep_us(5);
+	gpio_set_dir(m_u8SclPin, GPIO_IN); ///< SCL High
+	sleep_us(5);
+	gpio_set_dir(m_u8SdaPin, GPIO_IN); ///< SDA High（STOP）
+	sleep_us(5);
+	bool isReleased = gpio_get(m_u8SdaPin) && gpio_get(m_u8SclPin);
+
+	// コントローラを再初期化する
+	init(m_u8I2cPort, m_u8SdaPin, m_u8SclPin, m_u32Baud);
+	return isReleased;
+}
+
+/**
+ * @brief 現在時刻を取得する
+ * @retval uint64_t 起動からの経過時間（us）
+ */
+uint64_t I2CTransportRP2040::timeUs()
+{
+	return time_us_64();
+}
+
+/**
+ * @brief IRQピンを入力として初期化する
+ * @param a_u8IrqPin IRQピン番号
+ * @retval なし
+ */
+void I2CTransportRP2040::initIrqPin(uint8_t a_u8IrqPin)
+{
+	gpio_init(a_u8IrqPin);
+	gpio_set_dir(a_u8IrqPin, GPIO_IN);
+}
+
+/**
+ * @brief IRQピンの立ち上がりエッジを指定時間カウントする
+ * @param a_u8IrqPin IRQピン番号
+ * @param a_u16Ms 計測時間（ms）
+ * @retval uint32_t パルス数
+ */
+uint32_t I2CTransportRP2040::countIrqPulses(uint8_t a_u8IrqPin, uint16_t a_u16Ms)
+{
+	return FreqCounter::start(a_u8IrqPin, a_u16Ms);
+}
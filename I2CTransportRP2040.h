@@ -0,0 +1,30 @@
+/**
+ * @file I2CTransportRP2040.h
+ * @brief RP2040（pico-sdk）用I2Cトランスポート定義
+ * @details
+ * - pico-sdkのi2c_xxx_timeout_us、GPIO、タイマーを使ってI2CTransportを実装する。
+ * - I2CBaseの既定のトランスポートとして使用される。
+ */
+#pragma once
+#include "I2CTransport.h"
+
+/**
+ * @brief RP2040のI2Cコントローラを使うトランスポート
+ */
+class I2CTransportRP2040 : public I2CTransport {
+  private:
+	uint8_t m_u8I2cPort; ///< I2Cポート番号
+	uint8_t m_u8SdaPin;  ///< SDAピン番号
+	uint8_t m_u8SclPin;  ///< SCLピン番号
+	uint32_t m_u32Baud;  ///< 通信速度（Hz）
+
+  public:
+	I2CTransportRP2040() : m_u8I2cPort(0), m_u8SdaPin(0), m_u8SclPin(0), m_u32Baud(400 * 1000) {}
+	bool init(uint8_t a_u8I2cPort, uint8_t a_u8SdaPin, uint8_t a_u8SclPin, uint32_t a_u32Baud) override;
+	int write(uint8_t addr, const uint8_t* src, size_t len, bool nostop, uint32_t timeoutUs) override;
+	int read(uint8_t addr, uint8_t* dst, size_t len, bool nostop, uint32_t timeoutUs) override;
+	bool recoverBus() override;
+	uint64_t timeUs() override;
+	void initIrqPin(uint8_t a_u8IrqPin) override;
+	uint32_t countIrqPulses(uint8_t a_u8IrqPin, uint16_t a_u16Ms) override;
+};
@@ -0,0 +1,207 @@
+/**
+ * @file MainScreen.cpp
+ * @brief 雷センサーのメイン画面の描画
+ * @details
+ * - 画面の状態（行キャンバスのタイル、イベント履歴のスクロール、先頭に描いたイベント）はこのファイルで持つ。
+ * - 画面全体を消すときはclearScreen()を使い、タイルの差分とイベント履歴の先頭を捨てる。
+ */
+#include "MainScreen.h"
+#include <ctime>
+#include "pico/stdlib.h"
+#include "pictPacked.h" // 画像データ（アイコンは透過しない区間で表したスプライト）
+#include "Settings.h"
+#include "DispClock.h"
+#include "Kanji/GlyphCache.h"
+#include "printfDebug.h"
+
+volatile uint64_t irqTimeUs = 0; // IRQが発生した時刻（us）。トレース記録用
+TileCompositor compositor;       // メイン画面の最新情報・イベント行の差分描画
+ScrollList eventList;            // イベント履歴（ハードウェア縦スクロール）
+TftDisplayList frameList;        // メイン画面の時計と最新情報・イベント行の描画命令（mainDisplayごとに１回で送る）
+bool mustRedraw = false;         // 次のmainDisplay()で画面全体を描き直す
+static uint32_t u32TopEventKey = 0; // イベント履歴の先頭に描いたイベントの識別値（0は未描画）
+
+/**
+ * @brief メイン画面の描画先を設定する
+ * @param tft TFTディスプレイ
+ * @param a_pFont 漢字フォント
+ * @param a_pBitmap 漢字フォントのビットマップ
+ * @retval なし
+ */
+void mainScreenInit(Adafruit_ILI9341& tft, const KanjiData* a_pFont, const uint8_t* a_pBitmap)
+{
+	compositor.init(&tft);                                              ///< メイン画面の差分描画先
+	compositor.setList(&frameList);                                     ///< 変わったタイルは描画命令リストに記録する
+	DispClock::setList(&frameList, &tft);                               ///< 時計も同じリストに記録し、mainDisplayの最後に１回で送る
+	eventList.init(&tft, &compositor, EVENT_LIST_TOP, EVENT_LIST_ROWS); ///< イベント履歴のスクロール領域（上はバナーと時計、下は信号マーク）
+	compositor.getCanvas()->setFont(a_pFont, a_pBitmap);                ///< 行キャンバスにも日本語フォントを設定
+}
+
+/**
+ * @brief イベント履歴の１件を識別する値を求める
+ * @details 同じ秒に同じ距離・強さのイベントが続いた場合は区別できないが、その場合は行の内容も同じになる。
+ * @param a_u8Summary サマリ
+ * @param a_u8Dist 距離
+ * @param a_lEnergy 強さ
+ * @param a_time 時刻
+ * @return 識別値（0にはならない）
+ */
+static uint32_t eventKey(uint8_t a_u8Summary, uint8_t a_u8Dist, long a_lEnergy, time_t a_time)
+{
+	uint32_t key = (uint32_t)a_time * 2654435761u;
+	key ^= ((uint32_t)a_u8Summary << 24) | ((uint32_t)a_u8Dist << 16);
+	key ^= (uint32_t)a_lEnergy * 40503u;
+	return (key == 0) ? 1 : key;
+}
+
+void clearScreen(Adafruit_ILI9341& tft, uint16_t a_color)
+{
+	tft.fillScreen(a_color);
+	compositor.invalidate();
+	u32TopEventKey = 0;
+}
+
+// 雷センサーの画面表示
+void mainDisplay(Adafruit_ILI9341& tft, AS3935& as3935, bool isSignal, bool isBanner, bool isClock, bool isBody)
+{
+	if (mustRedraw) {
+		isBanner = true;
+		isClock = true;
+		isBody = true;
+		isSignal = false;   // 強制再描画の場合、信号検出は行わない。IRQがトリガーされていないのにvalidateSignalを呼びだしてレジスタアクセスしないようにするため。
+		mustRedraw = false; // 再描画フラグをリセット
+	}
+	frameList.clear(); // 前回の送信が残っていれば、終わるのを待ってから記録を始める
+	if (isBanner) {
+		TftProfileScope profileScope(tft, "banner"); // TFT_PROFILE=1でビルドしたときだけ数える
+		eventList.reset();                       // スクロールを戻してから画面全体を描き直す
+		clearScreen(tft, STDCOLOR.SUPERDARK_GRAY); // 画面を暗い灰色で塗りつぶす（タイルの差分とイベント履歴も捨てる）
+		tft.setCursor(0, 2);
+		tft.fillRoundRect(0, 0, 240, 20, 4, STDCOLOR.DARK_GRAY, STDCOLOR.SUPERDARK_GRAY); // 画面の上部に帯を描画（角の外側は背景色で、１つのウインドウで送る）
+		tft.setTextColor(STDCOLOR.WHITE, STDCOLOR.WHITE);
+		tft.printf("Lightning Sensor\n");
+		tft.setCursor(0, 22);
+		if (settings.getIsEnableWifi()) {
+			tft.drawSpanSprite(240 - 16, 2, wifiIcon_OK_sprite);
+		} else {
+			tft.drawSpanSprite(240 - 16, 2, wifiIcon_NG_sprite);
+		}
+	}
+	if (isBody) {
+		TftProfileScope profileScope(tft, "event list");
+		uint8_t u8Summary;
+		uint8_t u8Distance;
+		long lEnergy;
+		time_t eventtime;
+		GFXcanvas16* pStrip;
+
+		// 雷信号の検証
+		AS3935_SIGNAL sigValid;
+		time_t tmLatest;
+		if (isSignal) {
+			sleep_ms(2); // 300ミリ秒待機してから信号を検証
+			sigValid = as3935.validateSignal(irqTimeUs);
+			tmLatest = time(NULL);
+			// 　こちらは信号を検出したことに伴うもの
+			if (sigValid == AS3935_SIGNAL::VALID) {
+				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.RED, STDCOLOR.SUPERDARK_GRAY); // 検出された場合は黄色の丸を表示
+			} else if (sigValid == AS3935_SIGNAL::INVALID) {
+				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.YELLOW, STDCOLOR.SUPERDARK_GRAY); // 無効な信号の場合は赤色の丸を表示
+			} else if (sigValid == AS3935_SIGNAL::STATCLEAR) {
+				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.GREEN, STDCOLOR.SUPERDARK_GRAY); // 信号がない場合は青色の丸を表示
+			} else {
+				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.DARK_BLUE, STDCOLOR.SUPERDARK_GRAY); // その他の場合は灰色の丸を表示
+			}
+			if (sigValid != AS3935_SIGNAL::VALID && sigValid != AS3935_SIGNAL::INVALID) {
+				tft.fillRoundRect(0, 320 - 20, 16, 16, 2, STDCOLOR.BLUE, STDCOLOR.SUPERDARK_GRAY);
+			}
+		} else {
+			// こちらは画面再描画に伴うもの
+			sigValid = as3935.getLatestSignalValid();
+			tmLatest = as3935.getLatestDateTime();
+		}
+
+		// 最新情報表示エリア。１行目が長いときは折り返すので、３行分の行キャンバスに同じ文章を上にずらして描く。変わったタイルだけが送られる
+		bool isLatest = (sigValid == AS3935_SIGNAL::VALID || sigValid == AS3935_SIGNAL::INVALID);
+		char szLatest[96] = "";
+		if (isLatest) { // 雷が検出された場合
+			struct tm* t = localtime(&tmLatest);
+			snprintf(szLatest, sizeof(szLatest), "%02d/%02d %02d:%02d:%02d %s %s\n距離:%3d km 強さ:%d", t->tm_mon, t->tm_mday, t->tm_hour, t->tm_min, t->tm_sec, (sigValid == AS3935_SIGNAL::VALID) ? "検出" : "ーー", as3935.getLatestSummaryStr(), as3935.getLatestDist(), as3935.getLatestEnergy());
+		}
+		for (int i = 0; i < LATEST_ROWS; i++) {
+			pStrip = compositor.beginStrip(LATEST_TOP + i * TILE_SIZE, STDCOLOR.SUPERDARK_GRAY);
+			pStrip->setTextWrap(true); // 元の画面と同じく、はみ出した文字は次の行に折り返す
+			pStrip->setCursor(0, -i * TILE_SIZE);
+			pStrip->setTextColor(STDCOLOR.WHITE, STDCOLOR.SUPERDARK_GRAY);
+			pStrip->print(szLatest);
+			pStrip->setTextWrap(false);
+			compositor.flushStrip();
+		}
+
+		// 最新から8個のアラームをアイコンで表示する。
+		// 前回先頭に描いたイベントが何番目に下がったかを調べ、その行数だけハードウェアスクロールで下にずらして、新しい行だけを描く。
+		// 見つからない（初回、描き直し、一度に8個以上増えた）ときは、全行を描き直す。イベントが無い行は背景色で消す
+		uint8_t u8NewRows = EVENT_LIST_ROWS;
+		if (u32TopEventKey != 0) {
+			for (uint8_t i = 0; i < EVENT_LIST_ROWS; i++) {
+				if (as3935.GetLatestEvent(i, u8Summary, u8Distance, lEnergy, eventtime) == false) break;
+				if (eventKey(u8Summary, u8Distance, lEnergy, eventtime) == u32TopEventKey) {
+					u8NewRows = i;
+					break;
+				}
+			}
+		}
+		if (u8NewRows > 0 && eventList.scroll(u8NewRows) == false) {
+			u8NewRows = EVENT_LIST_ROWS;
+		}
+		for (uint8_t i = 0; i < u8NewRows; i++) {
+			pStrip = eventList.beginRow(i, STDCOLOR.SUPERDARK_GRAY);
+			bool bRet = as3935.GetLatestEvent(i, u8Summary, u8Distance, lEnergy, eventtime);
+			if (bRet) {
+				struct tm* t = localtime(&eventtime);
+				int hour = t->tm_hour;
+				int min = t->tm_min;
+				pStrip->setTextColor(STDCOLOR.WHITE, STDCOLOR.SUPERDARK_GRAY);
+				if (u8Summary == as3935.SUMM_THUNDER) {
+					pStrip->drawSpanSprite(0, 0, picThndr_sprite);
+					pStrip->setCursor(24, 0);
+					pStrip->printf("%02d:%02d  %3d km 強さ %d", hour, min, u8Distance, lEnergy);
+				} else {
+					pStrip->drawSpanSprite(0, 0, picFalse_sprite);
+					pStrip->setCursor(24, 0);
+					pStrip->printf("%02d:%02d  --- km", hour, min, u8Distance);
+				}
+			}
+			eventList.flushRow();
+		}
+		eventList.flushScroll(); // 新しい行を送った後に画面を動かす（描画命令リストの行の後に記録される）
+		if (as3935.GetLatestEvent(0, u8Summary, u8Distance, lEnergy, eventtime)) {
+			u32TopEventKey = eventKey(u8Summary, u8Distance, lEnergy, eventtime);
+		}
+		// マークを消して、元の状態に戻す
+		tft.fillRect(0, 320 - 20, 16, 16, STDCOLOR.SUPERDARK_GRAY);
+		if (settings.isSerialDebug()) {
+			dbgprintf("body tiles sent %lu skipped %lu bytes %lu\n", compositor.getTilesSent(), compositor.getTilesSkipped(), compositor.getBytesSent());
+			dbgprintf("event rows drawn %u (hw scroll %s, scrolled %lu)\n", u8NewRows, eventList.isHwScroll() ? "on" : "off", eventList.getScrollCount());
+			compositor.clearStats();
+			GlyphCache* pCache = tft.getGlyphCache();
+			if (pCache != nullptr) {
+				dbgprintf("glyph cache hit %u%% (hit %lu miss %lu evict %lu, %u slots)\n", pCache->getHitRate(), pCache->getHits(), pCache->getMisses(), pCache->getEvictions(), pCache->getSlots());
+			}
+		}
+	}
+
+	if (isClock) {
+		TftProfileScope profileScope(tft, "clock");
+		// それ以外の処理があればここに追加
+		DispClock::show(32, 30); // 時計の更新
+	}
+	// 記録した時計と行の描画をまとめて送る（PIOがあれば送信の完了を待たずに戻る）
+	if (frameList.isEmpty() == false) {
+		TftProfileScope profileScope(tft, "submit list");
+		if (settings.isSerialDebug()) {
+			dbgprintf("display list %u blocks %u words %lu px copied\n", frameList.getBlockCount(), frameList.getWordCount(), frameList.getArenaUsed());
+		}
+		tft.submitList(frameList);
+	}
+}
@@ -0,0 +1,57 @@
+/**
+ * @file MainScreen.h
+ * @brief 雷センサーのメイン画面（バナー・最新情報・イベント履歴・時計）の描画
+ * @details
+ * - 最新情報とイベント履歴はTileCompositorの行キャンバスに描き、変わったタイルだけを描画命令リストに記録する。
+ * - イベント履歴はScrollListのハードウェア縦スクロールで流し、新しい行だけを描く。
+ * - 時計と行の描画はmainDisplay()の最後にまとめて送る。
+ * - ホストのテスト（host/test/test_screens.cpp）からも同じ描画を呼べるように、アプリケーション本体から分けている。
+ */
+#pragma once
+#include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
+#include "AS3935.h"
+#include "TileCompositor.h"
+#include "ScrollList.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define LATEST_TOP 100     ///< 最新情報表示エリアの上端
+#define LATEST_ROWS 3      ///< 最新情報表示エリアの行数（１行目の折り返しを含む）
+#define EVENT_LIST_TOP 150 ///< イベント履歴の上端
+#define EVENT_LIST_ROWS 8  ///< イベント履歴の行数
+
+extern TileCompositor compositor;   ///< メイン画面の最新情報・イベント行の差分描画
+extern ScrollList eventList;        ///< イベント履歴（ハードウェア縦スクロール）
+extern TftDisplayList frameList;    ///< メイン画面の時計と最新情報・イベント行の描画命令
+extern bool mustRedraw;             ///< 次のmainDisplay()で画面全体を描き直す
+extern volatile uint64_t irqTimeUs; ///< IRQが発生した時刻（us）。トレース記録用
+
+/**
+ * @brief メイン画面の描画先を設定する
+ * @details 行キャンバス・描画命令リスト・時計・イベント履歴を液晶につなぎ、行キャンバスにも文字のフォントを設定する。
+ * @param tft TFTディスプレイ
+ * @param a_pFont 漢字フォント
+ * @param a_pBitmap 漢字フォントのビットマップ
+ * @retval なし
+ */
+void mainScreenInit(Adafruit_ILI9341& tft, const KanjiData* a_pFont, const uint8_t* a_pBitmap);
+/**
+ * @brief 画面全体を塗りつぶす
+ * @details コンポジタを通さずに画面全体を描き直すので、覚えているタイルとイベント履歴の先頭を捨てる。画面を消すときは必ずこれを使う。
+ * @param tft TFTディスプレイ
+ * @param a_color 塗りつぶす色
+ * @retval なし
+ */
+void clearScreen(Adafruit_ILI9341& tft, uint16_t a_color);
+/**
+ * @brief 雷センサーの画面を表示する
+ * @param tft TFTディスプレイ
+ * @param as3935 AS3935インスタンス
+ * @param isSignal trueでIRQの信号を読んで判定する
+ * @param isBanner trueで画面を消してバナーを描く
+ * @param isClock trueで時計を更新する
+ * @param isBody trueで最新情報とイベント履歴を更新する
+ * @retval なし
+ */
+void mainDisplay(Adafruit_ILI9341& tft, AS3935& as3935, bool isSignal, bool isBanner, bool isClock, bool isBody);
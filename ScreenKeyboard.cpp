@@ -7,7 +7,7 @@
  * - キーボード種別切替、キーコードテーブル、タッチ判定、再描画などを実装。
  */
 #include "ScreenKeyboard.h"
-#include "pictData.h"
+#include "pictPacked.h"
 using namespace ardPort;
 using namespace ardPort::spi;
 
@@ -50,7 +50,7 @@ const uint8_t ScreenKeyboard::npCodes[ScreenKeyboard::NP_COUNT] = {
  * @param ts タッチスクリーン制御用ポインタ
  * @retval なし
  */
-ScreenKeyboard::ScreenKeyboard(Adafruit_ILI9341* tft, XPT2046_Touchscreen* ts)
+ScreenKeyboard::ScreenKeyboard(Adafruit_GFX* tft, XPT2046_Touchscreen* ts)
     : m_tft(tft), m_ts(ts), m_kbType(KB1) {}
 
 /**
@@ -61,16 +61,16 @@ ScreenKeyboard::ScreenKeyboard(Adafruit_ILI9341* tft, XPT2046_Touchscreen* ts)
  * @retval なし
  */
 void ScreenKeyboard::show(int y) {
-    const uint16_t* bmp = nullptr; ///< 描画用ビットマップ
+    const PackedImage* bmp = nullptr; ///< 描画用ビットマップ
 	keyboardY = y; ///< キーボード表示Y座標
     m_kbMode = KM_QWERTY_1; ///< デフォルトはQWERTYキーボード
 	switch (m_kbType) {
-        case KB0: bmp = picKB0; break; ///< 小文字
-        case KB1: bmp = picKB1; break; ///< 大文字
-        case KB2: bmp = picKB2; break; ///< 記号
+        case KB0: bmp = &picKB0_packed; break; ///< 小文字
+        case KB1: bmp = &picKB1_packed; break; ///< 大文字
+        case KB2: bmp = &picKB2_packed; break; ///< 記号
     }
     if (bmp) {
-        m_tft->drawRGBBitmap(0, y, bmp, KB_WIDTH, KB_HEIGHT); ///< キーボード描画
+        m_tft->drawPackedImage(0, y, *bmp); ///< キーボード描画
     }
     currWidth = KB_WIDTH;   ///< 現在のキーボード幅
     currHeight = KB_HEIGHT; ///< 現在のキーボード高さ
@@ -87,7 +87,7 @@ void ScreenKeyboard::show(int y) {
  * @retval なし
  */
 void ScreenKeyboard::showNumPad(int y) {
-	m_tft->drawRGBBitmap(0, y, picKBNum, NP_WIDTH, NP_HEIGHT); ///< テンキー描画
+	m_tft->drawPackedImage(0, y, picKBNum_packed); ///< テンキー描画（画像は96×95）
 	keyboardY = y; ///< テンキー表示Y座標
     m_kbMode = KM_NUMPAD_1; ///< 数字キーボードモード
     currWidth = NP_WIDTH;   ///< 現在のテンキー幅
@@ -9,7 +9,6 @@
 #pragma once
 #include <stdint.h>
 
-#include "pictData.h"
 #include "Adafruit_ILI9341.h"
 #include "XPT2046_Touchscreen/XPT2046_Touchscreen.h"
 using namespace ardPort;
@@ -37,7 +36,7 @@ public:
      * @param tft ディスプレイ制御用ポインタ
      * @param ts タッチスクリーン制御用ポインタ
      */
-	ScreenKeyboard(Adafruit_ILI9341* tft, XPT2046_Touchscreen* ts);
+	ScreenKeyboard(Adafruit_GFX* tft, XPT2046_Touchscreen* ts);
     /**
      * @brief QWERTYキーボードを表示
      * @param y キーボード表示Y座標
@@ -90,7 +89,7 @@ public:
   int currRows;    ///< 現在の行数
 
 private:
-  Adafruit_ILI9341* m_tft; ///< ディスプレイ制御用
+  Adafruit_GFX* m_tft; ///< ディスプレイ制御用
   XPT2046_Touchscreen* m_ts; ///< タッチスクリーン制御用
   KBType m_kbType; ///< 現在のキーボード種別
   KeyMode m_kbMode; ///< 現在のキーモード
@@ -0,0 +1,121 @@
+/**
+ * @file ScrollList.cpp
+ * @brief ILI9341のハードウェア縦スクロールを使った、行リストの表示クラスの実装
+ * @details
+ * - スクロール領域の論理行 L は、液晶のメモリの m_top + (m_offset + L) % m_height 行目に表示される（VSCRSADD = m_top + m_offset）。
+ * - 行を下にずらすときは m_offset を行の高さ分減らすだけで、メモリ上のピクセルは１ドットも送らない。
+ *   先頭に来るのは一番古い行が入っていたメモリなので、そこに新しい行を描く。
+ */
+#include "ScrollList.h"
+
+/**
+ * @brief コンストラクタ
+ */
+ScrollList::ScrollList() :
+	m_pTft(nullptr),
+	m_pCompositor(nullptr),
+	m_top(0),
+	m_u8Rows(0),
+	m_height(0),
+	m_offset(0),
+	m_isHwScroll(false),
+	m_isScrollPending(false),
+	m_u32Scrolls(0)
+{
+}
+
+/**
+ * @brief 描画先とリストの位置を指定する
+ * @param a_pTft 描画先の液晶
+ * @param a_pCompositor 行の描画に使うコンポジタ
+ * @param a_top リストの上端の画面Y座標（これより上は固定領域）
+ * @param a_u8Rows 行数（これより下は固定領域）
+ * @retval なし
+ */
+void ScrollList::init(Adafruit_ILI9341* a_pTft, TileCompositor* a_pCompositor, int16_t a_top, uint8_t a_u8Rows)
+{
+	m_pTft = a_pTft;
+	m_pCompositor = a_pCompositor;
+	m_top = a_top;
+	m_u8Rows = a_u8Rows;
+	m_height = a_u8Rows * SCROLL_LIST_ROW_HEIGHT;
+	m_offset = 0;
+}
+
+/**
+ * @brief スクロールを元に戻す（論理行とメモリの位置を一致させる）
+ * @details
+ * 固定領域とスクロール領域を設定し直し、スクロール開始位置をスクロール領域の先頭にする。
+ * 液晶のメモリの内容は変えないので、呼んだ後に全行を描き直すこと。
+ * @retval なし
+ */
+void ScrollList::reset()
+{
+	if (m_pTft == nullptr) return;
+	m_offset = 0;
+	m_isScrollPending = false;
+	m_isHwScroll = (m_pTft->getRotation() == 0);
+	m_pTft->setScrollMargins(m_top, ILI9341_TFTHEIGHT - m_top - m_height);
+	m_pTft->scrollTo(m_top);
+}
+
+/**
+ * @brief 既存の行を下にずらし、先頭に空きを作る
+ * @details 論理行の位置だけを変え、画面はflushScroll()まで動かさない。
+ * @param a_u8Count ずらす行数
+ * @retval true ずらした。先頭の a_u8Count 行（論理行）を描いてから、flushScroll()を呼ぶこと
+ * @retval false ハードウェアスクロールが使えない。全行を描き直すこと
+ */
+bool ScrollList::scroll(uint8_t a_u8Count)
+{
+	if (m_isHwScroll == false || a_u8Count >= m_u8Rows) return false;
+	m_offset = (m_offset + m_height - a_u8Count * SCROLL_LIST_ROW_HEIGHT) % m_height;
+	m_isScrollPending = true;
+	m_u32Scrolls += a_u8Count;
+	return true;
+}
+
+/**
+ * @brief scroll()でずらした位置に画面を動かす（VSCRSADD）
+ * @details
+ * 先頭に描いた行より先に画面が動くと、一番古い行の内容が先頭に一瞬見えるので、行を送った後に呼ぶ。
+ * コンポジタが描画命令リストに記録していれば、同じリストの行の後に記録する（リストを送るのは呼び出し側）。
+ * @retval なし
+ */
+void ScrollList::flushScroll()
+{
+	if (m_isScrollPending == false) return;
+	m_isScrollPending = false;
+	uint16_t y = m_top + m_offset;
+	TftDisplayList* pList = m_pCompositor->getList();
+	if (pList == nullptr) {
+		m_pTft->scrollTo(y);
+		return;
+	}
+	if (pList->scrollTo(y) == false) { // リストが一杯なので、ここまでを送ってから記録し直す
+		m_pTft->submitList(*pList);
+		pList->clear();
+		pList->scrollTo(y);
+	}
+}
+
+/**
+ * @brief 論理行を描くための行キャンバスを取得する
+ * @param a_u8Row 論理行（0が先頭）
+ * @param a_bgColor 行の背景色
+ * @return 行キャンバス（行内の座標で描く）
+ */
+GFXcanvas16* ScrollList::beginRow(uint8_t a_u8Row, uint16_t a_bgColor)
+{
+	return m_pCompositor->beginStrip(rowToY(a_u8Row), a_bgColor);
+}
+
+/**
+ * @brief 論理行の、液晶のメモリ上のY座標を求める
+ * @param a_u8Row 論理行
+ * @return メモリ上のY座標（setAddrWindowに渡す値）
+ */
+int16_t ScrollList::rowToY(uint8_t a_u8Row) const
+{
+	return m_top + (m_offset + a_u8Row * SCROLL_LIST_ROW_HEIGHT) % m_height;
+}
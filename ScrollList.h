@@ -0,0 +1,57 @@
+/**
+ * @file ScrollList.h
+ * @brief ILI9341のハードウェア縦スクロールを使った、行リストの表示クラス定義
+ * @details
+ * - リストの領域をスクロール領域（VSCRDEF）とし、その上（バナー・時計）と下（信号マーク）は固定領域にする。
+ * - 新しい行が来たら、スクロール開始位置（VSCRSADD）をずらして既存の行を１行分下げ、空いた先頭の１行だけを描く。
+ *   VSCRSADDは新しい行を送った後に送る（コンポジタが描画命令リストに記録していれば、同じリストの行の後に記録する）。
+ * - 行の描画はTileCompositorの行キャンバスを使うので、送るのは変わったタイルだけになる。
+ */
+#pragma once
+#include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
+#include "TileCompositor.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define SCROLL_LIST_ROW_HEIGHT TILE_SIZE ///< １行の高さ（行キャンバスの高さと同じ）
+
+/**
+ * @brief ハードウェア縦スクロールで行を流すリスト
+ * @details
+ * 論理行0が一番上（最新）。scroll()で既存の行を下にずらし、beginRow()/flushRow()で論理行を描き、最後にflushScroll()で画面を動かす。
+ * 液晶のメモリ上の位置は、スクロール量に応じて論理行ごとに変わるので、描画は必ずbeginRow()のキャンバスに行うこと。
+ * 画面全体を描き直すとき（fillScreenの前や、別の画面に切り替えるとき）は、reset()でスクロールを元に戻すこと。
+ * 画面の回転が0以外のときは、液晶のメモリの行と画面のY座標が一致しないので、ハードウェアスクロールは使わない。
+ */
+class ScrollList {
+  public:
+	ScrollList();
+	void init(Adafruit_ILI9341* a_pTft, TileCompositor* a_pCompositor, int16_t a_top, uint8_t a_u8Rows);
+	void reset();
+	bool scroll(uint8_t a_u8Count);
+	GFXcanvas16* beginRow(uint8_t a_u8Row, uint16_t a_bgColor);
+	/**
+	 * @brief beginRow()で描いた行を液晶に送る
+	 * @return 送ったタイルの数
+	 */
+	int flushRow() { return m_pCompositor->flushStrip(); }
+	void flushScroll();
+
+	uint8_t getRows() const { return m_u8Rows; }             ///< 行数
+	bool isHwScroll() const { return m_isHwScroll; }         ///< ハードウェアスクロールを使っているか
+	uint32_t getScrollCount() const { return m_u32Scrolls; } ///< scroll()でずらした行数の累計
+
+  private:
+	int16_t rowToY(uint8_t a_u8Row) const;
+
+	Adafruit_ILI9341* m_pTft;        ///< 描画先の液晶
+	TileCompositor* m_pCompositor;   ///< 行の描画に使うコンポジタ
+	int16_t m_top;                   ///< スクロール領域の上端（上の固定領域の高さ）
+	uint8_t m_u8Rows;                ///< 行数
+	int16_t m_height;                ///< スクロール領域の高さ（行数×行の高さ）
+	int16_t m_offset;                ///< スクロール量（論理行0のメモリ上の位置 - m_top）
+	bool m_isHwScroll;               ///< ハードウェアスクロールを使っているか
+	bool m_isScrollPending;          ///< scroll()でずらしたが、まだVSCRSADDを送っていないか
+	uint32_t m_u32Scrolls;           ///< scroll()でずらした行数の累計
+};
@@ -0,0 +1,113 @@
+/**
+ * @file SensorTrace.cpp
+ * @brief AS3935のIRQトレース記録クラスの実装
+ * @details
+ * - 記録はメモリ上のリングバッファへのコピーのみ。差分時刻への変換は書き出し時に行う。
+ * - 再生（SensorTraceReplay）はAS3935Simを使うので、SensorTraceReplay.cppに分けている。
+ */
+#include "SensorTrace.h"
+#include <cstdio>
+#include <cstring>
+#if !defined(I2C_HOST_BUILD)
+#include "FlashMem.h"
+#include "hardware/flash.h"
+#endif
+
+/**
+ * @brief 1回分のIRQを記録する
+ * @param a_u64IrqUs IRQ発生時刻（us）
+ * @param a_regs REG00～REG08の値（9バイト）
+ * @param a_u16RegMask 実際に読んだレジスタ（ビットnがREGn）
+ * @retval なし
+ */
+void SensorTraceRecorder::record(uint64_t a_u64IrqUs, const uint8_t* a_regs, uint16_t a_u16RegMask)
+{
+	if (m_isEnabled == false) return;
+	uint32_t idx = m_u32Seq % SENSOR_TRACE_CAPACITY;
+	m_u64Times[idx] = a_u64IrqUs;
+	m_records[idx].regMask = a_u16RegMask & SENSOR_TRACE_ALL_REGS;
+	memcpy(m_records[idx].regs, a_regs, SENSOR_TRACE_REGS);
+	m_u32Seq++;
+}
+
+/**
+ * @brief 古い順にバイナリ形式へ書き出す
+ * @details
+ * ヘッダに続けて、前レコードからの差分時刻を入れたレコードを並べる。
+ * 差分が32ビットを超える場合は0xFFFFFFFFで頭打ちにする。
+ * @param[out] a_pBuf 出力先
+ * @param a_size 出力先のサイズ
+ * @retval size_t 書き出したバイト数（0は出力先不足）
+ */
+size_t SensorTraceRecorder::serialize(uint8_t* a_pBuf, size_t a_size) const
+{
+	int count = getCount();
+	size_t total = sizeof(SensorTraceHeader) + sizeof(SensorTraceRecord) * count;
+	if (a_size < total) return 0;
+	uint32_t first = m_u32Seq - count; ///< 最古レコードの通し番号
+
+	SensorTraceHeader hdr;
+	hdr.magic = SENSOR_TRACE_MAGIC;
+	hdr.version = SENSOR_TRACE_VERSION;
+	hdr.recordSize = sizeof(SensorTraceRecord);
+	hdr.count = (uint16_t)count;
+	hdr.baseUs = (count > 0) ? m_u64Times[first % SENSOR_TRACE_CAPACITY] : 0;
+	memcpy(a_pBuf, &hdr, sizeof(hdr));
+
+	uint8_t* p = a_pBuf + sizeof(hdr);
+	uint64_t prevUs = hdr.baseUs;
+	for (int i = 0; i < count; i++) {
+		uint32_t idx = (first + i) % SENSOR_TRACE_CAPACITY;
+		SensorTraceRecord rec = m_records[idx];
+		uint64_t delta = m_u64Times[idx] - prevUs;
+		rec.deltaUs = (delta > 0xFFFFFFFFULL) ? 0xFFFFFFFF : (uint32_t)delta;
+		prevUs = m_u64Times[idx];
+		memcpy(p, &rec, sizeof(rec));
+		p += sizeof(rec);
+	}
+	return total;
+}
+
+/**
+ * @brief バイナリ形式を16進テキストでシリアルに出力する
+ * @details
+ * 1行あたり32バイト（64文字）で "AS3T:" に続けて出力し、最後に "AS3T:END" を出力する。
+ * @retval なし
+ */
+void SensorTraceRecorder::dump() const
+{
+	static uint8_t buf[sizeof(SensorTraceHeader) + sizeof(SensorTraceRecord) * SENSOR_TRACE_CAPACITY];
+	size_t len = serialize(buf, sizeof(buf));
+	for (size_t i = 0; i < len; i += 32) {
+		printf("AS3T:");
+		for (size_t j = i; j < len && j < i + 32; j++) {
+			printf("%02X", buf[j]);
+		}
+		printf("\n");
+	}
+	printf("AS3T:END\n");
+}
+
+#if !defined(I2C_HOST_BUILD)
+/**
+ * @brief バイナリ形式をフラッシュに保存する
+ * @details
+ * フラッシュの書き込み単位（FLASH_PAGE_SIZE）に合わせて0xFFで埋めてから書き込む。
+ * 保存できたら、そのときの通し番号を覚えておく（hasUnsaved()の判定用）。
+ * @retval true  保存成功
+ * @retval false 保存失敗
+ */
+bool SensorTraceRecorder::saveToFlash()
+{
+	static const size_t maxLen = sizeof(SensorTraceHeader) + sizeof(SensorTraceRecord) * SENSOR_TRACE_CAPACITY;
+	static uint8_t buf[(maxLen + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE];
+	memset(buf, 0xFF, sizeof(buf));
+	size_t len = serialize(buf, sizeof(buf));
+	if (len == 0) return false;
+	len = (len + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE;
+	FlashMem flash(SENSOR_TRACE_FLASH_BLOCK, 1);
+	if (flash.write(0, buf, len) == false) return false;
+	m_u32SavedSeq = m_u32Seq;
+	return true;
+}
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @file SensorTrace.h
+ * @brief AS3935のIRQトレース記録・再生クラス定義
+ * @details
+ * - SensorTraceRecorder: IRQ毎の発生時刻（us）とREG00～REG08の生データを固定長リングに記録し、
+ *   シリアル（16進テキスト）やフラッシュへ書き出す。読まなかったレジスタは、レコードの有効ビットで区別する。
+ * - SensorTraceReplay: 記録したトレースをAS3935Simに流し込み、validateSignal～表示までの処理を
+ *   実時間（1倍速）または最速で再実行して、処理時間を集計する。
+ * - バイナリ形式はSensorTraceHeaderに続いてSensorTraceRecordが並ぶ。時刻は前レコードからの差分で持つ。
+ */
+#pragma once
+#include <stdint.h>
+#include <cstddef>
+
+class AS3935Sim;
+
+#define SENSOR_TRACE_MAGIC 0x54335341 ///< トレース識別子（"AS3T"）
+#define SENSOR_TRACE_VERSION 2        ///< トレース形式のバージョン（2でレジスタの有効ビットを追加）
+#define SENSOR_TRACE_REGS 9           ///< 1レコードに保存するレジスタ数（REG00～REG08）
+#define SENSOR_TRACE_ALL_REGS 0x01FF  ///< 全レジスタ（REG00～REG08）を読んだときの有効ビット
+#define SENSOR_TRACE_CAPACITY 512     ///< 記録できる最大レコード数
+#define SENSOR_TRACE_FLASH_BLOCK 30   ///< トレース保存先のフラッシュブロック（31は設定値が使用）
+
+/**
+ * @brief トレースのヘッダ
+ */
+struct __attribute__((packed)) SensorTraceHeader {
+	uint32_t magic;      ///< SENSOR_TRACE_MAGIC
+	uint8_t version;     ///< SENSOR_TRACE_VERSION
+	uint8_t recordSize;  ///< sizeof(SensorTraceRecord)
+	uint16_t count;      ///< レコード数
+	uint64_t baseUs;     ///< 最初のレコードの時刻（us）
+};
+
+/**
+ * @brief トレースの1レコード（15バイト）
+ */
+struct __attribute__((packed)) SensorTraceRecord {
+	uint32_t deltaUs;                 ///< 前レコードからの経過時間（us、先頭はbaseUsからの差分で0）
+	uint16_t regMask;                 ///< 読んだレジスタ（ビットnがREGn。0のレジスタの値は0で、再生では使わない）
+	uint8_t regs[SENSOR_TRACE_REGS];  ///< REG00～REG08の生データ
+};
+
+/**
+ * @brief IRQトレースの記録クラス
+ * @details
+ * record()はメモリへのコピーのみなので、IRQ処理中に呼び出しても負荷は小さい。
+ * 容量を超えた場合は古いレコードから上書きする。
+ */
+class SensorTraceRecorder {
+  private:
+	SensorTraceRecord m_records[SENSOR_TRACE_CAPACITY]; ///< レコードのリングバッファ
+	uint64_t m_u64Times[SENSOR_TRACE_CAPACITY];         ///< 各レコードの絶対時刻（us）
+	uint32_t m_u32Seq;                                  ///< 記録した通し番号
+	uint32_t m_u32SavedSeq;                             ///< フラッシュに保存したときの通し番号
+	bool m_isEnabled;                                   ///< 記録の有効/無効
+
+  public:
+	SensorTraceRecorder() : m_u32Seq(0), m_u32SavedSeq(0), m_isEnabled(true) {}
+	/**
+	 * @brief 1回分のIRQを記録する
+	 * @param a_u64IrqUs IRQ発生時刻（us）
+	 * @param a_regs REG00～REG08の値（9バイト）
+	 * @param a_u16RegMask 実際に読んだレジスタ（ビットnがREGn）
+	 * @retval なし
+	 */
+	void record(uint64_t a_u64IrqUs, const uint8_t* a_regs, uint16_t a_u16RegMask = SENSOR_TRACE_ALL_REGS);
+	/**
+	 * @brief 記録の有効/無効を切り替える
+	 * @param a_isEnable trueで記録する
+	 * @retval なし
+	 */
+	void setEnable(bool a_isEnable) { m_isEnabled = a_isEnable; }
+	/**
+	 * @brief 保持しているレコード数を取得する
+	 * @retval レコード数（最大SENSOR_TRACE_CAPACITY）
+	 */
+	int getCount() const { return (m_u32Seq < SENSOR_TRACE_CAPACITY) ? (int)m_u32Seq : SENSOR_TRACE_CAPACITY; }
+	/**
+	 * @brief 記録をクリアする
+	 * @retval なし
+	 */
+	void clear() { m_u32Seq = m_u32SavedSeq = 0; }
+	/**
+	 * @brief 前回フラッシュに保存してから新しいレコードがあるか
+	 * @retval true 保存していないレコードがある
+	 */
+	bool hasUnsaved() const { return m_u32Seq != m_u32SavedSeq; }
+	/**
+	 * @brief 古い順にバイナリ形式へ書き出す
+	 * @param[out] a_pBuf 出力先
+	 * @param a_size 出力先のサイズ
+	 * @retval 書き出したバイト数（0は出力先不足）
+	 */
+	size_t serialize(uint8_t* a_pBuf, size_t a_size) const;
+	/**
+	 * @brief バイナリ形式を16進テキストでシリアルに出力する
+	 * @details
+	 * USB CDCの改行変換を避けるため、"AS3T:"で始まる16進文字列の行として出力する。
+	 * @retval なし
+	 */
+	void dump() const;
+#if !defined(I2C_HOST_BUILD)
+	/**
+	 * @brief バイナリ形式をフラッシュ（SENSOR_TRACE_FLASH_BLOCK）に保存する
+	 * @details
+	 * 書き込み中は割り込みが禁止されるので、IRQを止めてから呼び出すこと。
+	 * フラッシュの消耗を避けるため、呼び出し側はhasUnsaved()のときだけ呼ぶ。
+	 * @retval true 保存成功
+	 * @retval false 保存失敗
+	 */
+	bool saveToFlash();
+#endif
+};
+
+/**
+ * @brief 再生結果の集計
+ */
+struct SensorReplayStats {
+	uint32_t events;       ///< 再生したイベント数（パイプラインを呼んだ回数）
+	uint32_t irqs;         ///< 割り込み要因（INT）が0以外だったイベント数
+	uint64_t pipelineUs;   ///< パイプライン処理時間の合計（us）
+	uint32_t pipelineMaxUs; ///< パイプライン処理時間の最大値（us）
+	uint64_t elapsedUs;    ///< 再生全体に要した時間（us）
+};
+
+/**
+ * @brief IRQトレースの再生クラス
+ * @details
+ * 各レコードのレジスタ値をAS3935Simに読み込んでIRQを発生させ、コールバック（validateSignalや表示処理）を呼ぶ。
+ * レコードは実機でIRQが来て読んだときのものなので、INTが0（統計クリア）のレコードもコールバックを呼ぶ。
+ * 時刻源・待機関数を指定しない場合はシミュレータの仮想時刻で動作する。
+ */
+class SensorTraceReplay {
+  public:
+	typedef void (*PipelineFunc)(void* a_pCtx);  ///< 1イベント分の処理（validateSignal～表示）
+	typedef uint64_t (*NowFunc)();               ///< 現在時刻取得関数（us）
+	typedef void (*SleepFunc)(uint64_t a_u64Us); ///< 待機関数（us）
+
+  private:
+	AS3935Sim* m_pSim;                  ///< 再生先のシミュレータ
+	const SensorTraceRecord* m_pRecords; ///< 再生するレコード
+	uint16_t m_u16Count;                ///< レコード数
+	NowFunc m_pfnNow;                   ///< 時刻源（nullptrならシミュレータの仮想時刻）
+	SleepFunc m_pfnSleep;               ///< 1倍速再生時の待機関数（nullptrなら仮想時刻を進める）
+
+	uint64_t now();
+
+  public:
+	/**
+	 * @brief コンストラクタ
+	 * @param a_pSim 再生先のシミュレータ
+	 */
+	SensorTraceReplay(AS3935Sim* a_pSim) : m_pSim(a_pSim), m_pRecords(nullptr), m_u16Count(0), m_pfnNow(nullptr), m_pfnSleep(nullptr) {}
+	/**
+	 * @brief バイナリ形式のトレースを読み込む
+	 * @details
+	 * バッファはコピーしないので、再生が終わるまで保持しておくこと。
+	 * @param a_pBuf トレースデータ
+	 * @param a_size データサイズ
+	 * @retval true 読み込み成功
+	 * @retval false 形式不正
+	 */
+	bool load(const uint8_t* a_pBuf, size_t a_size);
+	/**
+	 * @brief 実時間で計測・待機するための関数を設定する
+	 * @param a_pfnNow 現在時刻取得関数
+	 * @param a_pfnSleep 待機関数
+	 * @retval なし
+	 */
+	void setClock(NowFunc a_pfnNow, SleepFunc a_pfnSleep)
+	{
+		m_pfnNow = a_pfnNow;
+		m_pfnSleep = a_pfnSleep;
+	}
+	/**
+	 * @brief トレースを再生する
+	 * @param a_isRealTime trueで記録時の間隔を再現（1倍速）、falseで最速
+	 * @param a_pfnPipeline 1イベント毎に呼ぶ処理
+	 * @param a_pCtx コールバックに渡す値
+	 * @param[out] a_stats 集計結果
+	 * @retval なし
+	 */
+	void run(bool a_isRealTime, PipelineFunc a_pfnPipeline, void* a_pCtx, SensorReplayStats& a_stats);
+};
@@ -70,6 +70,23 @@ void Settings::setDefault()
 	value.i2cReadMode = 0;                 // I2Cリードモード（0: Single Read, 1: Block Read）
 }
 
+/**
+ * @brief AS3935に書き込む設定値を取り出す
+ * @details AS3935クラスはSettingsに依存しないので、アプリケーションがこの値を AS3935::setConfig() で渡す。
+ * @return AS3935の設定値
+ */
+AS3935Config Settings::getAS3935Config() const
+{
+	AS3935Config config;
+	config.gainBoost = value.gainBoost;
+	config.noiseFloor = value.noiseFloor;
+	config.watchDogThreshold = value.watchDogThreshold;
+	config.spikeReject = value.spikeReject;
+	config.minimumEvent = value.minimumEvent;
+	config.isBlockRead = (value.i2cReadMode == 1);
+	return config;
+}
+
 /**
  * @brief 設定値をフラッシュメモリに保存
  */
@@ -228,7 +245,7 @@ const void Settings::drawMenu()
  * @param a_ptft ディスプレイ制御用
  * @param a_pts タッチスクリーン制御用
  */
-const void Settings::run(Adafruit_ILI9341* a_ptft, XPT2046_Touchscreen* a_pts)
+const void Settings::run(Adafruit_GFX* a_ptft, XPT2046_Touchscreen* a_pts)
 {
 	SettingValue valuePush;
 	valuePush = value; // 現在の設定値を保存
@@ -269,14 +286,14 @@ const void Settings::run(Adafruit_ILI9341* a_ptft, XPT2046_Touchscreen* a_pts)
 				if (bRet) {
 					isMustSave = true; // SSIDが変更された
 				}
-				drawMenu();
+				if (!editbox.isRestored()) drawMenu(); // キーボードの下を書き戻せなかったときだけ描き直す
 			} else if YRANGE (96) {
 				GUIEditBox editbox(ptft, pts, &sk);
 				bool bRet = editbox.show(10 + 9 * 8, 104, value.PASSWORD, 18, EditMode::MODE_TEXT);
 				if (bRet) {
 					isMustSave = true; // PASSWORDが変更された
 				}
-				drawMenu();
+				if (!editbox.isRestored()) drawMenu();
 			} else if YRANGE (128) {
 				value.isClock24Hour = !value.isClock24Hour; // 24時間表示の切り替え
 				drawMenu();
@@ -369,7 +386,7 @@ const void Settings::drawMenu2_root()
  * @param a_ptft ディスプレイ制御用
  * @param a_pts タッチスクリーン制御用
  */
-const bool Settings::run2(Adafruit_ILI9341* a_ptft, XPT2046_Touchscreen* a_pts)
+const bool Settings::run2(Adafruit_GFX* a_ptft, XPT2046_Touchscreen* a_pts)
 {
 	SettingValue valuePush;
 	valuePush = value; // 現在の設定値を保存
@@ -420,17 +437,17 @@ const bool Settings::run2(Adafruit_ILI9341* a_ptft, XPT2046_Touchscreen* a_pts)
 						save();             // 設定を保存
 						isMustSave = false; // 保存後はフラグをリセット
 					}
-					ptft->fillScreen(ILI9341_BLACK);
 					if (isMustReboot) {
-						// 再起動問い合わせ
+						// 再起動問い合わせ（メニューの上に出し、中断したらダイアログの下だけ書き戻す）
 						GUIMsgBox msgbox(ptft, pts);
 						bool bRet = msgbox.showOKCancel(30, 100, "確認", "設定を反映するには\n再起動が必要です", "再起動", " 中断 ");
 						if (bRet) {
 							watchdog_reboot(0, 0, 0);
-						} else {
+						} else if (!msgbox.isRestored()) {
 							drawMenu2_root();
 						}
 					} else {
+						ptft->fillScreen(ILI9341_BLACK);
 						return true;
 					}
 
@@ -516,7 +533,7 @@ const void Settings::run2_system()
 						settimeofday(&tv, NULL); ///< システム時刻を設定
 					}
 				}
-				drawMenu2_system();
+				if (!editbox.isRestored()) drawMenu2_system(); // 日時はループで描き直すので、キーボードの下だけ戻せばよい
 
 			} else if YRANGE (96) {
 				setSerialDebug(!isSerialDebug()); ///< シリアルデバッグ有効/無効切替
@@ -602,14 +619,14 @@ const void Settings::run2_wifi()
 				if (bRet) {
 					isMustSave = true; ///< SSIDが変更された
 				}
-				drawMenu2_wifi();
+				if (!editbox.isRestored()) drawMenu2_wifi();
 			} else if YRANGE (96) { // PASSWORD
 				GUIEditBox editbox(ptft, pts, &sk); ///< パスワード編集用エディットボックス
 				bool bRet = editbox.show(10 + 8 * 10, 104, value.PASSWORD, 18, EditMode::MODE_TEXT);
 				if (bRet) {
 					isMustSave = true; ///< PASSWORDが変更された
 				}
-				drawMenu2_wifi();
+				if (!editbox.isRestored()) drawMenu2_wifi();
 			} else if YRANGE (128) {
 			} else if YRANGE (160) {
 			} else if YRANGE (192) {
@@ -703,7 +720,7 @@ const void Settings::run2_as3935()
 					isMustSave = true;    // ゲインブーストが変更された
 				}
 				ptft->printlocf(0, 72, "GAINBOST: %02d", value.gainBoost);
-				drawMenuBottom();
+				if (!editbox.isRestored()) drawMenuBottom();
 
 			} else if YRANGE (96) { // ノイズフロア
 				if (p.x < 120) {
@@ -718,7 +735,7 @@ const void Settings::run2_as3935()
 						isMustSave = true;           // ノイズフロアが変更された
 					}
 					ptft->printlocf(0, 104, "NOISEFLR: %1d", value.noiseFloor);
-					drawMenuBottom();
+					if (!editbox.isRestored()) drawMenuBottom();
 				} else {
 					sprintf(edtBuf, "%02d", value.watchDogThreshold); // ウォッチドッグスレッショルド値を文字列に変換
 					GUIEditBox editbox(ptft, pts, &sk);
@@ -731,7 +748,7 @@ const void Settings::run2_as3935()
 					 isMustSave = true;                // ウォッチドッグスレッショルドが変更された
 					}
 					ptft->printlocf(104, 104, "WATCHDOG: %02d", value.watchDogThreshold);
-					drawMenuBottom();
+					if (!editbox.isRestored()) drawMenuBottom();
 				}
 			} else if YRANGE (128) { //
 				if (p.x < 120) {
@@ -16,6 +16,7 @@
 using namespace ardPort;
 using namespace ardPort::spi;
 class ScreenKeyboard; // 前方宣言
+struct AS3935Config;  // 前方宣言
 
 /**
  * @brief 設定値を格納する構造体
@@ -72,7 +73,7 @@ class Settings
 {
   private:
 	FlashMem flash;           ///< フラッシュメモリ管理用
-	Adafruit_ILI9341* ptft;   ///< ディスプレイ制御用
+	Adafruit_GFX* ptft;      ///< ディスプレイ制御用
 	XPT2046_Touchscreen* pts; ///< タッチスクリーン制御用
   public:
 	SettingValue value; ///< 現在の設定値
@@ -187,6 +188,7 @@ class Settings
 	 * @retval int 0: Single Read, 1: Block Read
 	 */
 	int geti2cReadMode() const { return value.i2cReadMode; } ///< I2Cリードモード取得（0: Single, 1: Block）
+	AS3935Config getAS3935Config() const;
 	/**
 	 * @brief シリアルデバッグモードか判定
 	 * @details
@@ -224,8 +226,8 @@ class Settings
 	const void drawMenu2_as3935();
   
 	public:
-	const void run(Adafruit_ILI9341* a_pTft, XPT2046_Touchscreen* a_pTs);
-	const bool run2(Adafruit_ILI9341* a_pTft, XPT2046_Touchscreen* a_pTs);
+	const void run(Adafruit_GFX* a_pTft, XPT2046_Touchscreen* a_pTs);
+	const bool run2(Adafruit_GFX* a_pTft, XPT2046_Touchscreen* a_pTs);
 	const void run2_system();
 	const void run2_wifi();
 	const void run2_as3935();
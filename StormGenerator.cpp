@@ -0,0 +1,194 @@
+/**
+ * @file StormGenerator.cpp
+ * @brief 疑似雷雨イベント発生器とイベント取りこぼしベンチマークの実装
+ * @details
+ * - 乱数はxorshift32、到着間隔は -ln(U)/λ で生成する。
+ * - ベンチマークはAS3935Simの仮想時刻を共通の時間軸として、イベント注入とIRQ処理を交互に進める。
+ * - AS3935Simを使うので、実機のビルドにはAS3935_STORM_BENCHを有効にしたときだけ入れる。ホストではhost/runner/storm_bench.cppで動かす。
+ */
+#include "StormGenerator.h"
+#include "AS3935Sim.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+/**
+ * @brief 既定の設定を取得する
+ * @details
+ * 平均1回/秒、ディスターバ20%、ノイズ5%、40kmから5kmまで10分かけて接近する雷雨。
+ * @retval StormConfig 既定の設定
+ */
+StormConfig StormGenerator::defaultConfig()
+{
+	StormConfig config;
+	config.eventsPerSec = 1.0;
+	config.disturberRatio = 0.2;
+	config.noiseRatio = 0.05;
+	config.startKm = 40;
+	config.endKm = 5;
+	config.jitterKm = 3;
+	config.energyMin = 1000;
+	config.energyMax = 300000;
+	config.durationSec = 600;
+	config.seed = 12345;
+	return config;
+}
+
+/**
+ * @brief コンストラクタ
+ * @param a_config 設定
+ */
+StormGenerator::StormGenerator(const StormConfig& a_config) :
+	m_config(a_config)
+{
+	reset();
+}
+
+/**
+ * @brief 生成を最初からやり直す
+ * @retval なし
+ */
+void StormGenerator::reset()
+{
+	m_u32Rand = (m_config.seed != 0) ? m_config.seed : 1;
+	m_u64NowUs = 0;
+}
+
+/**
+ * @brief xorshift32で次の乱数を得る
+ * @retval uint32_t 乱数
+ */
+uint32_t StormGenerator::nextRand()
+{
+	m_u32Rand ^= m_u32Rand << 13;
+	m_u32Rand ^= m_u32Rand >> 17;
+	m_u32Rand ^= m_u32Rand << 5;
+	return m_u32Rand;
+}
+
+/**
+ * @brief (0, 1]の一様乱数を得る
+ * @retval double 一様乱数
+ */
+double StormGenerator::nextUniform()
+{
+	return ((double)nextRand() + 1.0) / 4294967296.0;
+}
+
+/**
+ * @brief 次のイベントを生成する
+ * @details
+ * 到着間隔を指数分布で決め、種別をディスターバ/ノイズ/雷の割合で選ぶ。
+ * 雷の場合は経過時間に応じた距離とばらつき、エネルギーを一様乱数で決める。
+ * @param[out] a_event 生成したイベント
+ * @retval true  生成した
+ * @retval false 継続時間を過ぎた
+ */
+bool StormGenerator::next(StormEvent& a_event)
+{
+	if (m_config.eventsPerSec <= 0) return false;
+	double intervalUs = -std::log(nextUniform()) / m_config.eventsPerSec * 1000000.0;
+	m_u64NowUs += (uint64_t)intervalUs;
+	uint64_t durationUs = (uint64_t)m_config.durationSec * 1000000;
+	if (m_u64NowUs >= durationUs) return false;
+
+	a_event.timeUs = m_u64NowUs;
+	a_event.km = 0;
+	a_event.energy = 0;
+	double r = nextUniform();
+	if (r <= m_config.disturberRatio) {
+		a_event.type = STORM_DISTURBER;
+	} else if (r <= m_config.disturberRatio + m_config.noiseRatio) {
+		a_event.type = STORM_NOISE;
+	} else {
+		a_event.type = STORM_LIGHTNING;
+		double progress = (double)m_u64NowUs / (double)durationUs;
+		int km = m_config.startKm + (int)((m_config.endKm - m_config.startKm) * progress);
+		if (m_config.jitterKm > 0) {
+			km += (int)(nextRand() % (2 * m_config.jitterKm + 1)) - m_config.jitterKm;
+		}
+		a_event.km = (km < 1) ? 1 : km;
+		uint32_t span = (m_config.energyMax > m_config.energyMin) ? m_config.energyMax - m_config.energyMin : 0;
+		a_event.energy = m_config.energyMin + ((span > 0) ? nextRand() % (span + 1) : 0);
+	}
+	return true;
+}
+
+/**
+ * @brief 保持中のIRQを1件処理する
+ * @details
+ * パイプラインを呼び出し、実時間で計測した処理時間と固定の表示時間を仮想時刻に加算する。
+ * IRQ発生時刻から処理完了時刻までをレイテンシとして記録する。
+ * @param a_pfnPipeline 1イベント分の処理
+ * @param a_pCtx コールバックに渡す値
+ * @param a_u64IrqUs IRQ発生時刻（仮想時刻）
+ * @param[in,out] a_u64CpuUs CPU時間の累計
+ * @retval なし
+ */
+void StormBench::process(PipelineFunc a_pfnPipeline, void* a_pCtx, uint64_t a_u64IrqUs, uint64_t& a_u64CpuUs)
+{
+	uint64_t t0 = (m_pfnNow != nullptr) ? m_pfnNow() : 0;
+	if (a_pfnPipeline != nullptr) a_pfnPipeline(a_pCtx);
+	uint64_t cpuUs = (m_pfnNow != nullptr) ? m_pfnNow() - t0 : 0;
+	a_u64CpuUs += cpuUs;
+	m_pSim->advanceUs(cpuUs + m_u32DisplayCostUs);
+	uint64_t latency = m_pSim->timeUs() - a_u64IrqUs;
+	m_latencies.push_back((latency > 0xFFFFFFFFULL) ? 0xFFFFFFFF : (uint32_t)latency);
+}
+
+/**
+ * @brief ベンチマークを実行する
+ * @details
+ * イベント毎に、まず到着時刻までにCPUが空いていれば保持中のIRQを処理し、
+ * その後イベントをシミュレータに注入する。未読のIRQが残っている状態で注入した場合は取りこぼしとして数える。
+ * 最後に残ったIRQを処理してから、レイテンシのパーセンタイルを求める。
+ * @param a_generator イベント発生器
+ * @param a_pfnPipeline 1イベント毎に呼ぶ処理
+ * @param a_pCtx コールバックに渡す値
+ * @param[out] a_stats 集計結果
+ * @retval なし
+ */
+void StormBench::run(StormGenerator& a_generator, PipelineFunc a_pfnPipeline, void* a_pCtx, StormBenchStats& a_stats)
+{
+	memset(&a_stats, 0, sizeof(a_stats));
+	m_latencies.clear();
+	uint64_t baseUs = m_pSim->timeUs();
+	uint64_t pendingIrqUs = 0; ///< 保持中のIRQの発生時刻
+	uint64_t cpuUs = 0;
+	StormEvent e;
+	while (a_generator.next(e)) {
+		a_stats.generated++;
+		uint64_t t = baseUs + e.timeUs;
+		if (m_pSim->isIrqHigh() && m_pSim->timeUs() <= t) {
+			process(a_pfnPipeline, a_pCtx, pendingIrqUs, cpuUs); ///< 到着前にCPUが空いたので処理する
+		}
+		if (m_pSim->timeUs() < t) m_pSim->advanceUs(t - m_pSim->timeUs());
+		bool wasPending = m_pSim->isIrqHigh();
+		bool isRaised = false;
+		switch (e.type) {
+			case STORM_LIGHTNING: isRaised = m_pSim->injectLightning(e.km, e.energy); break;
+			case STORM_DISTURBER: isRaised = m_pSim->injectDisturber(); break;
+			case STORM_NOISE: isRaised = m_pSim->injectNoiseHigh(); break;
+		}
+		if (!isRaised) {
+			a_stats.filtered++;
+			continue;
+		}
+		if (wasPending) a_stats.dropped++; ///< 未読のイベントが上書きされた
+		pendingIrqUs = t;
+	}
+	if (m_pSim->isIrqHigh()) {
+		process(a_pfnPipeline, a_pCtx, pendingIrqUs, cpuUs);
+	}
+
+	a_stats.processed = (uint32_t)m_latencies.size();
+	if (a_stats.processed > 0) {
+		std::sort(m_latencies.begin(), m_latencies.end());
+		size_t n = m_latencies.size();
+		a_stats.latencyP50 = m_latencies[(n - 1) * 50 / 100];
+		a_stats.latencyP90 = m_latencies[(n - 1) * 90 / 100];
+		a_stats.latencyP99 = m_latencies[(n - 1) * 99 / 100];
+		a_stats.latencyMax = m_latencies[n - 1];
+		a_stats.cpuUsPerEvent = (uint32_t)(cpuUs / n);
+	}
+}
@@ -0,0 +1,158 @@
+/**
+ * @file StormGenerator.h
+ * @brief 疑似雷雨イベント発生器とイベント取りこぼしベンチマークの定義
+ * @details
+ * - StormGenerator: ポアソン到着の雷、接近する雷雨の距離プロファイル、ディスターバ/ノイズの混在を
+ *   設定に従って時系列イベントとして生成する。
+ * - StormBench: 生成したイベントをAS3935Simに注入し、IRQ処理（validateSignal～表示）を仮想時刻上で回して、
+ *   IRQから記録までのレイテンシ分布、取りこぼし数、1イベントあたりのCPU時間を集計する。
+ * - AS3935は割り込み要因を1つしか保持しないので、未読のうちに次のイベントが来ると前のイベントは失われる。
+ *   ベンチマークはこれを「取りこぼし」として数える。
+ */
+#pragma once
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+class AS3935Sim;
+
+/**
+ * @brief 疑似イベントの種別
+ */
+enum STORM_EVENT {
+	STORM_LIGHTNING = 0, ///< 雷
+	STORM_DISTURBER = 1, ///< ディスターバ（人工ノイズ）
+	STORM_NOISE = 2,     ///< ノイズレベル過大
+};
+
+/**
+ * @brief 疑似イベント1件
+ */
+struct StormEvent {
+	uint64_t timeUs;   ///< 発生時刻（us、生成開始からの経過）
+	STORM_EVENT type;  ///< 種別
+	int km;            ///< 距離（km、雷のみ）
+	uint32_t energy;   ///< エネルギー（雷のみ）
+};
+
+/**
+ * @brief 疑似雷雨の設定
+ */
+struct StormConfig {
+	double eventsPerSec;   ///< 平均イベント発生率（回/秒、ポアソン到着）
+	double disturberRatio; ///< ディスターバの割合（0～1）
+	double noiseRatio;     ///< ノイズレベル過大の割合（0～1）
+	int startKm;           ///< 開始時の雷雨までの距離（km）
+	int endKm;             ///< 終了時の雷雨までの距離（km）
+	int jitterKm;          ///< 距離のばらつき（±km）
+	uint32_t energyMin;    ///< エネルギーの最小値
+	uint32_t energyMax;    ///< エネルギーの最大値
+	uint32_t durationSec;  ///< 雷雨の継続時間（秒）
+	uint32_t seed;         ///< 乱数の種（0以外）
+};
+
+/**
+ * @brief 疑似雷雨イベント発生器
+ * @details
+ * 到着間隔は指数分布（ポアソン過程）、距離は開始～終了を継続時間で線形補間した値に±jitterKmの一様乱数を加える。
+ * 乱数はxorshift32なので、同じseedからは同じイベント列が得られる。
+ */
+class StormGenerator {
+  private:
+	StormConfig m_config; ///< 設定
+	uint32_t m_u32Rand;   ///< 乱数状態
+	uint64_t m_u64NowUs;  ///< 最後に生成したイベントの時刻
+
+	uint32_t nextRand();
+	double nextUniform();
+
+  public:
+	/**
+	 * @brief 既定の設定（1回/秒、40km→5km接近、10分間）を取得する
+	 * @retval StormConfig 既定の設定
+	 */
+	static StormConfig defaultConfig();
+	/**
+	 * @brief コンストラクタ
+	 * @param a_config 設定
+	 */
+	StormGenerator(const StormConfig& a_config);
+	/**
+	 * @brief 次のイベントを生成する
+	 * @param[out] a_event 生成したイベント
+	 * @retval true 生成した
+	 * @retval false 継続時間を過ぎたので終了
+	 */
+	bool next(StormEvent& a_event);
+	/**
+	 * @brief 生成を最初からやり直す
+	 * @retval なし
+	 */
+	void reset();
+};
+
+/**
+ * @brief ベンチマーク結果
+ */
+struct StormBenchStats {
+	uint32_t generated;   ///< 生成したイベント数
+	uint32_t filtered;    ///< センサーが割り込みを出さなかったイベント数（最小雷数・MASK_DIST等）
+	uint32_t dropped;     ///< 未読のうちに次のイベントで上書きされたイベント数
+	uint32_t processed;   ///< IRQ処理したイベント数
+	uint32_t latencyP50;  ///< IRQ～記録のレイテンシ 50パーセンタイル（us）
+	uint32_t latencyP90;  ///< 同 90パーセンタイル（us）
+	uint32_t latencyP99;  ///< 同 99パーセンタイル（us）
+	uint32_t latencyMax;  ///< 同 最大値（us）
+	uint32_t cpuUsPerEvent; ///< 1イベントあたりのCPU時間の平均（us）
+};
+
+/**
+ * @brief イベント取りこぼしベンチマーク
+ * @details
+ * 仮想時刻上で「センサーがイベントを保持→CPUが空いたらIRQ処理」を再現する。
+ * IRQ処理中（表示更新中）に届いたイベントは処理完了後に読まれ、その間に更に次が届けば取りこぼしになる。
+ * パイプラインの処理時間は時刻源で計測して仮想時刻に加算する（表示が無いホストではdisplayCostUsで代用できる）。
+ */
+class StormBench {
+  public:
+	typedef void (*PipelineFunc)(void* a_pCtx); ///< 1イベント分の処理（validateSignal～表示）
+	typedef uint64_t (*NowFunc)();              ///< 実時間の時刻取得関数（us）
+
+  private:
+	AS3935Sim* m_pSim;          ///< イベント注入先
+	NowFunc m_pfnNow;           ///< 実時間の時刻源（nullptrならCPU時間を計測しない）
+	uint32_t m_u32DisplayCostUs; ///< 1イベント毎に加算する固定の処理時間（us）
+	std::vector<uint32_t> m_latencies; ///< レイテンシの記録
+
+	void process(PipelineFunc a_pfnPipeline, void* a_pCtx, uint64_t a_u64IrqUs, uint64_t& a_u64CpuUs);
+
+  public:
+	/**
+	 * @brief コンストラクタ
+	 * @param a_pSim イベント注入先のシミュレータ
+	 */
+	StormBench(AS3935Sim* a_pSim) : m_pSim(a_pSim), m_pfnNow(nullptr), m_u32DisplayCostUs(0) {}
+	/**
+	 * @brief パイプラインのCPU時間を計測する時刻源を設定する
+	 * @param a_pfnNow 時刻取得関数（us）
+	 * @retval なし
+	 */
+	void setClock(NowFunc a_pfnNow) { m_pfnNow = a_pfnNow; }
+	/**
+	 * @brief 1イベント毎に加算する固定の処理時間を設定する
+	 * @details
+	 * ホストで表示処理を省略する場合に、実機で計測した表示時間を与える。
+	 * @param a_u32Us 処理時間（us）
+	 * @retval なし
+	 */
+	void setDisplayCost(uint32_t a_u32Us) { m_u32DisplayCostUs = a_u32Us; }
+	/**
+	 * @brief ベンチマークを実行する
+	 * @param a_generator イベント発生器
+	 * @param a_pfnPipeline 1イベント毎に呼ぶ処理
+	 * @param a_pCtx コールバックに渡す値
+	 * @param[out] a_stats 集計結果
+	 * @retval なし
+	 */
+	void run(StormGenerator& a_generator, PipelineFunc a_pfnPipeline, void* a_pCtx, StormBenchStats& a_stats);
+};
@@ -0,0 +1,165 @@
+/**
+ * @file TileCompositor.cpp
+ * @brief メイン画面の動的な行を、タイル単位の差分で描画するクラスの実装
+ * @details
+ * - 行キャンバスに描いた内容を16×16のタイルに分けてハッシュを取り、前回送ったときのハッシュと比べる。
+ * - 変わったタイルだけを、タイルごとに１回の setAddrWindow と 16行分の writePixels で送る。
+ *   描画命令リストが設定されていれば、タイルの写しをリストに記録し、時計などと一緒に１回で送る。
+ * - 液晶の内容そのものは覚えていないので、ハッシュが偶然一致した場合はそのタイルが更新されない。32ビットなので実用上は問題にならない。
+ */
+#include "TileCompositor.h"
+#include <string.h>
+
+/**
+ * @brief コンストラクタ
+ * @details 行キャンバスはメンバ配列をバッファとして使い、ヒープは使わない。
+ */
+TileCompositor::TileCompositor() :
+	m_pTft(nullptr),
+	m_pList(nullptr),
+	m_canvas(TILE_STRIP_WIDTH, TILE_SIZE, false),
+	m_u8NextVictim(0),
+	m_curY(0),
+	m_curStrip(-1)
+{
+	m_canvas.setBuffer(m_stripBuf);
+	m_canvas.setTextWrap(false); // 行からはみ出した文字は次の行に折り返さない
+	invalidate();
+	clearStats();
+}
+
+/**
+ * @brief 覚えているタイルのハッシュをすべて捨てる
+ * @retval なし
+ */
+void TileCompositor::invalidate()
+{
+	for (int i = 0; i < TILE_MAX_STRIPS; i++) {
+		m_stripY[i] = -1;
+	}
+	memset(m_isTileValid, 0, sizeof(m_isTileValid));
+	m_u8NextVictim = 0;
+}
+
+/**
+ * @brief 画面Y座標に対応する行の番号を探す
+ * @param a_y 行の上端の画面Y座標
+ * @return 行の番号
+ */
+int TileCompositor::findStrip(int16_t a_y)
+{
+	for (int i = 0; i < TILE_MAX_STRIPS; i++) {
+		if (m_stripY[i] == a_y) return i;
+	}
+	for (int i = 0; i < TILE_MAX_STRIPS; i++) {
+		if (m_stripY[i] < 0) {
+			m_stripY[i] = a_y;
+			return i;
+		}
+	}
+	// 空きが無いときは順番に使い回す。使い回した行は全タイルを送り直す
+	int idx = m_u8NextVictim;
+	m_u8NextVictim = (m_u8NextVictim + 1) % TILE_MAX_STRIPS;
+	m_stripY[idx] = a_y;
+	memset(m_isTileValid[idx], 0, sizeof(m_isTileValid[idx]));
+	return idx;
+}
+
+/**
+ * @brief 行キャンバスを取得する
+ * @param a_y 行の上端の画面Y座標
+ * @param a_bgColor 行の背景色
+ * @return 行キャンバス
+ */
+GFXcanvas16* TileCompositor::beginStrip(int16_t a_y, uint16_t a_bgColor)
+{
+	m_curY = a_y;
+	m_curStrip = findStrip(a_y);
+	m_canvas.fillScreen(a_bgColor);
+	m_canvas.setCursor(0, 0);
+	return &m_canvas;
+}
+
+/**
+ * @brief 行キャンバスの１タイルのハッシュ（FNV-1a）を求める
+ * @param a_col タイルの列番号
+ * @return ハッシュ値
+ */
+uint32_t TileCompositor::hashTile(int a_col) const
+{
+	uint32_t hash = 2166136261u;
+	const uint16_t* pRow = m_stripBuf + a_col * TILE_SIZE;
+	for (int y = 0; y < TILE_SIZE; y++) {
+		for (int x = 0; x < TILE_SIZE; x++) {
+			hash = (hash ^ pRow[x]) * 16777619u;
+		}
+		pRow += TILE_STRIP_WIDTH;
+	}
+	return hash;
+}
+
+/**
+ * @brief 行キャンバスのうち、前回から変わったタイルだけを液晶に送る
+ * @return 送ったタイルの数
+ */
+int TileCompositor::flushStrip()
+{
+	if (m_pTft == nullptr || m_curStrip < 0) return 0;
+
+	int sent = 0;
+	bool isWriting = false;
+	for (int col = 0; col < TILE_COLS; col++) {
+		uint32_t hash = hashTile(col);
+		if (m_isTileValid[m_curStrip][col] && m_tileHash[m_curStrip][col] == hash) {
+			m_u32TilesSkipped++;
+			continue;
+		}
+		m_tileHash[m_curStrip][col] = hash;
+		m_isTileValid[m_curStrip][col] = 1;
+
+		sent++;
+		if (m_pList != nullptr) {
+			recordTile(col);
+			continue;
+		}
+		if (!isWriting) {
+			m_pTft->startWrite();
+			isWriting = true;
+		}
+		m_pTft->setAddrWindow(col * TILE_SIZE, m_curY, TILE_SIZE, TILE_SIZE);
+		const uint16_t* pRow = m_stripBuf + col * TILE_SIZE;
+		for (int y = 0; y < TILE_SIZE; y++) {
+			m_pTft->writePixels((uint16_t*)pRow, TILE_SIZE); // タイルの１行はキャンバス上で連続している
+			pRow += TILE_STRIP_WIDTH;
+		}
+	}
+	if (isWriting) {
+		m_pTft->endWrite();
+	}
+	m_u32TilesSent += sent;
+	m_u32BytesSent += sent * (TILE_SIZE * TILE_SIZE * 2 + TILE_WINDOW_BYTES);
+	m_curStrip = -1;
+	return sent;
+}
+
+/**
+ * @brief 行キャンバスの１タイルを描画命令リストに写す
+ * @details 行キャンバスは次の行で描き直されるので、参照ではなくリスト内に写しを取る。
+ * @param a_col タイルの列番号
+ * @retval なし
+ */
+void TileCompositor::recordTile(int a_col)
+{
+	uint16_t* pDst = m_pList->copyRect(a_col * TILE_SIZE, m_curY, TILE_SIZE, TILE_SIZE);
+	if (pDst == nullptr) { // リストが一杯なので、ここまでを送ってから記録し直す
+		m_pTft->submitList(*m_pList);
+		m_pList->clear();
+		pDst = m_pList->copyRect(a_col * TILE_SIZE, m_curY, TILE_SIZE, TILE_SIZE);
+	}
+	const uint16_t* pRow = m_stripBuf + a_col * TILE_SIZE;
+	for (int y = 0; y < TILE_SIZE; y++) {
+		memcpy(pDst, pRow, TILE_SIZE * sizeof(uint16_t));
+		pDst += TILE_SIZE;
+		pRow += TILE_STRIP_WIDTH;
+	}
+}
@@ -0,0 +1,110 @@
+/**
+ * @file TileCompositor.h
+ * @brief メイン画面の動的な行を、タイル単位の差分で描画するクラス定義
+ * @details
+ * - 文字列やアイコンは、１行分（幅240×高さ16）のRAMキャンバスに描画する。
+ * - キャンバスを16×16のタイルに分け、前回送ったタイルのハッシュと比べて、変わったタイルだけを液晶に送る。
+ * - 液晶側の内容は持たず、タイルごとに32ビットのハッシュだけを覚えておくので、RAMの使用量は小さい。
+ */
+#pragma once
+#include "lib-9341/Adafruit_ILI9341/Adafruit_ILI9341.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define TILE_SIZE 16                           ///< タイルの一辺のドット数
+#define TILE_STRIP_WIDTH 240                   ///< 行キャンバスの幅（画面の幅）
+#define TILE_COLS (TILE_STRIP_WIDTH / TILE_SIZE) ///< １行のタイル数
+#define TILE_MAX_STRIPS 16                     ///< 差分を覚えておく行の数
+#define TILE_WINDOW_BYTES 11                   ///< setAddrWindowで送るバイト数（コマンド3＋データ8）
+
+/**
+ * @brief 行単位のキャンバスと、タイル単位の差分送信を行うクラス
+ * @details
+ * 使い方は、beginStrip()で行キャンバスを受け取り、そこに行内の座標（Y=0が行の上端）で描画し、
+ * flushStrip()で変わったタイルだけを送る。画面全体を別の方法で描き直したときは invalidate() を呼ぶこと。
+ */
+class TileCompositor {
+  public:
+	TileCompositor();
+	/**
+	 * @brief 描画先の液晶を指定する
+	 * @param a_pTft 描画先の液晶
+	 * @retval なし
+	 */
+	void init(Adafruit_SPITFT* a_pTft) { m_pTft = a_pTft; }
+
+	/**
+	 * @brief 変わったタイルを、液晶に直接送らずに描画命令リストに記録するようにする
+	 * @details リストが一杯になったときは、そこまでを送ってから記録し直す。リストを送るのは呼び出し側。
+	 * @param a_pList 記録先のリスト（nullptrで直接送る）
+	 * @retval なし
+	 */
+	void setList(TftDisplayList* a_pList) { m_pList = a_pList; }
+	TftDisplayList* getList() const { return m_pList; } ///< タイルの記録先（nullptrなら直接送る）
+
+	/**
+	 * @brief 行キャンバスを取得する
+	 * @details キャンバスは背景色で塗りつぶされ、カーソルは(0,0)に戻る。
+	 * @param a_y 行の上端の画面Y座標
+	 * @param a_bgColor 行の背景色
+	 * @return 行キャンバス
+	 */
+	GFXcanvas16* beginStrip(int16_t a_y, uint16_t a_bgColor);
+
+	/**
+	 * @brief 行キャンバスのうち、前回から変わったタイルだけを液晶に送る
+	 * @return 送ったタイルの数
+	 */
+	int flushStrip();
+
+	/**
+	 * @brief 覚えているタイルのハッシュをすべて捨てる
+	 * @details fillScreenなど、コンポジタを通さずに画面を描き直したときに呼ぶ。次のflushStripはすべてのタイルを送る。
+	 * @retval なし
+	 */
+	void invalidate();
+
+	GFXcanvas16* getCanvas() { return &m_canvas; } ///< 行キャンバス（フォントの設定用）
+
+	uint32_t getTilesSent() const { return m_u32TilesSent; }       ///< 送ったタイル数
+	uint32_t getTilesSkipped() const { return m_u32TilesSkipped; } ///< 変化がなく送らなかったタイル数
+	uint32_t getBytesSent() const { return m_u32BytesSent; }       ///< 送ったSPIバイト数（setAddrWindowを含む）
+	void clearStats() { m_u32TilesSent = m_u32TilesSkipped = m_u32BytesSent = 0; }
+
+  private:
+	/**
+	 * @brief 行キャンバスの１タイルのハッシュ（FNV-1a）を求める
+	 * @param a_col タイルの列番号
+	 * @return ハッシュ値
+	 */
+	uint32_t hashTile(int a_col) const;
+	/**
+	 * @brief 画面Y座標に対応する行の番号を探す。無ければ空いている行（無ければ最も古い行）を割り当てる
+	 * @param a_y 行の上端の画面Y座標
+	 * @return 行の番号
+	 */
+	int findStrip(int16_t a_y);
+
+	/**
+	 * @brief 行キャンバスの１タイルを描画命令リストに写す
+	 * @param a_col タイルの列番号
+	 * @retval なし
+	 */
+	void recordTile(int a_col);
+
+	Adafruit_SPITFT* m_pTft;                            ///< 描画先の液晶
+	TftDisplayList* m_pList;                            ///< タイルの記録先（nullptrなら直接送る）
+	GFXcanvas16 m_canvas;                               ///< 行キャンバス
+	uint16_t m_stripBuf[TILE_STRIP_WIDTH * TILE_SIZE];  ///< 行キャンバスのバッファ
+	int16_t m_stripY[TILE_MAX_STRIPS];                  ///< 行の上端の画面Y座標（-1は未使用）
+	uint32_t m_tileHash[TILE_MAX_STRIPS][TILE_COLS];    ///< 前回送ったタイルのハッシュ
+	uint8_t m_isTileValid[TILE_MAX_STRIPS][TILE_COLS];  ///< ハッシュが有効か
+	uint8_t m_u8NextVictim;                             ///< 行が足りないときに次に使い回す行
+	int16_t m_curY;                                     ///< beginStripで指定された画面Y座標
+	int m_curStrip;                                     ///< beginStripで選ばれた行の番号
+
+	uint32_t m_u32TilesSent;    ///< 送ったタイル数
+	uint32_t m_u32TilesSkipped; ///< 送らなかったタイル数
+	uint32_t m_u32BytesSent;    ///< 送ったSPIバイト数
+};
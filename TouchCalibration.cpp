@@ -22,7 +22,7 @@ using namespace ardPort::spi;
  * @param tft ディスプレイ制御用ポインタ
  * @param ts タッチスクリーン制御用ポインタ
  */
-TouchCalibration::TouchCalibration(Adafruit_ILI9341* tft, XPT2046_Touchscreen* ts) :
+TouchCalibration::TouchCalibration(Adafruit_GFX* tft, XPT2046_Touchscreen* ts) :
 	m_tft(tft),
 	m_ts(ts),
 	m_mode(MODE_SELECT) {}
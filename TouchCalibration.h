@@ -41,7 +41,7 @@ public:
      * @param tft ディスプレイ制御用ポインタ
      * @param ts タッチスクリーン制御用ポインタ
      */
-    TouchCalibration(Adafruit_ILI9341* tft, XPT2046_Touchscreen* ts);
+    TouchCalibration(Adafruit_GFX* tft, XPT2046_Touchscreen* ts);
 
     /**
      * @brief キャリブレーション・テスト・終了メニューを表示し、ユーザー操作を受け付ける
@@ -50,7 +50,7 @@ public:
     bool run();
 
 private:
-    Adafruit_ILI9341* m_tft; ///< ディスプレイ制御用
+    Adafruit_GFX* m_tft; ///< ディスプレイ制御用
     XPT2046_Touchscreen* m_ts; ///< タッチスクリーン制御用
     Mode m_mode; ///< 現在の動作モード
     bool isCalibDone = false; ///< キャリブレーション完了フラグ
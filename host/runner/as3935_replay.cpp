@@ -0,0 +1,121 @@
+/*!
+ * @file as3935_replay.cpp
+ *
+ * 実機でシリアルに出力したIRQトレース（SensorTraceRecorder::dump()の "AS3T:" の行）を、ホストでAS3935Simに流して再生する。
+ * 実機と同じAS3935::validateSignal()を通し、イベントごとの判定と、再生の集計を表示する。
+ *
+ * 使い方: as3935_replay <トレースのファイル>
+ *   ファイルは "AS3T:" で始まる行（シリアルの出力をそのまま保存したもの）か、serialize()のバイナリ。
+ *   それ以外の行は読み飛ばすので、ログの前後が混じっていてもよい。
+ */
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "AS3935.h"
+#include "AS3935Sim.h"
+#include "SensorTrace.h"
+
+#define REPLAY_ADDR 0x03 ///< モデルのI2Cアドレス（どれでもよい）
+
+/// @brief 16進の１文字の値（16進でなければ-1）
+static int hexValue(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	return -1;
+}
+
+/**
+ * @brief トレースのファイルを読む
+ * @param a_pPath ファイル名
+ * @param[out] a_buf バイナリ形式のトレース
+ * @retval true 読めた
+ */
+static bool loadTraceFile(const char* a_pPath, std::vector<uint8_t>& a_buf)
+{
+	FILE* fp = fopen(a_pPath, "rb");
+	if (fp == nullptr) return false;
+	a_buf.clear();
+	uint32_t magic = 0;
+	if (fread(&magic, 1, sizeof(magic), fp) == sizeof(magic) && magic == SENSOR_TRACE_MAGIC) {
+		// バイナリ形式
+		uint8_t chunk[4096];
+		size_t n;
+		a_buf.insert(a_buf.end(), (uint8_t*)&magic, (uint8_t*)&magic + sizeof(magic));
+		while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0) a_buf.insert(a_buf.end(), chunk, chunk + n);
+		fclose(fp);
+		return true;
+	}
+	// "AS3T:" の行を16進としてつなげる
+	rewind(fp);
+	char line[256];
+	while (fgets(line, sizeof(line), fp) != nullptr) {
+		const char* p = strstr(line, "AS3T:");
+		if (p == nullptr) continue;
+		p += 5;
+		if (strncmp(p, "END", 3) == 0) break;
+		for (; hexValue(p[0]) >= 0 && hexValue(p[1]) >= 0; p += 2) {
+			a_buf.push_back((uint8_t)((hexValue(p[0]) << 4) | hexValue(p[1])));
+		}
+	}
+	fclose(fp);
+	return a_buf.empty() == false;
+}
+
+/// @brief 再生中のセンサー
+struct ReplayCtx {
+	AS3935* pAs3935;
+	AS3935Sim* pSim;
+	uint32_t index;
+	uint32_t counts[4]; ///< 判定ごとの回数（AS3935_SIGNALの値ごと）
+};
+
+/// @brief １イベント分の処理（実機のmainDisplayと同じく、validateSignal()を呼ぶ）
+static void pipeline(void* a_pCtx)
+{
+	ReplayCtx* c = static_cast<ReplayCtx*>(a_pCtx);
+	static const char* names[] = {"NONE", "VALID", "INVALID", "STATCLEAR"};
+	AS3935_SIGNAL sig = c->pAs3935->validateSignal(c->pSim->timeUs());
+	c->counts[sig & 3]++;
+	printf("%4lu %-9s", (unsigned long)c->index++, names[sig & 3]);
+	if (sig == AS3935_SIGNAL::VALID || sig == AS3935_SIGNAL::INVALID) {
+		printf(" %s dist:%2d energy:%d", c->pAs3935->getLatestSummaryStr(), c->pAs3935->getLatestDist(), c->pAs3935->getLatestEnergy());
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <trace file>\n", argv[0]);
+		return 2;
+	}
+	std::vector<uint8_t> buf;
+	if (loadTraceFile(argv[1], buf) == false) {
+		fprintf(stderr, "%s: cannot read a trace\n", argv[1]);
+		return 1;
+	}
+	AS3935Sim sim(REPLAY_ADDR);
+	SensorTraceReplay replay(&sim);
+	if (replay.load(buf.data(), buf.size()) == false) {
+		fprintf(stderr, "%s: not a version %d trace\n", argv[1], SENSOR_TRACE_VERSION);
+		return 1;
+	}
+	AS3935 as3935;
+	AS3935Config config;
+	config.isBlockRead = true; // 記録に無いレジスタもモデルの値を読めるようにする
+	as3935.setConfig(config);
+	as3935.setTransport(&sim);
+	if (as3935.Init(REPLAY_ADDR, 0, 4, 5, 2) == false) return 1;
+
+	ReplayCtx ctx = {&as3935, &sim, 0, {0, 0, 0, 0}};
+	SensorReplayStats stats;
+	replay.run(false, pipeline, &ctx, stats);
+	printf("replay: events:%lu irqs:%lu valid:%lu invalid:%lu statclear:%lu none:%lu avg:%lluus max:%luus\n",
+	       (unsigned long)stats.events, (unsigned long)stats.irqs, (unsigned long)ctx.counts[AS3935_SIGNAL::VALID],
+	       (unsigned long)ctx.counts[AS3935_SIGNAL::INVALID], (unsigned long)ctx.counts[AS3935_SIGNAL::STATCLEAR],
+	       (unsigned long)ctx.counts[AS3935_SIGNAL::NONE], (unsigned long long)((stats.events > 0) ? stats.pipelineUs / stats.events : 0),
+	       (unsigned long)stats.pipelineMaxUs);
+	return 0;
+}
@@ -0,0 +1,11 @@
+/*!
+ * @file TftPioStream.pio.h
+ *
+ * ホスト用のTftPioStream.pioの代わり（pioasmを使わない）。PIOは無いので、TftPioStream::init()は失敗する。
+ */
+#pragma once
+#include "hardware/pio.h"
+
+static const pio_program_t tft_stream_program = {nullptr, 0, -1};
+
+static inline void tft_stream_program_init(PIO, uint, uint, uint, uint, uint, float) {}
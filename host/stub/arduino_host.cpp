@@ -0,0 +1,35 @@
+/*!
+ * @file arduino_host.cpp
+ *
+ * ホストのビルドで、Arduinoの移植部分（lib-9341/core）のうち割り込みやADCに関わる関数の代わり。
+ * wiring_private.cpp/wiring_analog.cppはFreeRTOSやADCのレジスタを使うのでホストではビルドしない。
+ */
+#include "misc/defines.h"
+#include "core/Common.h"
+#include "Print.h"
+#include "Printable.h"
+
+extern "C" void interrupts()
+{
+}
+
+extern "C" void noInterrupts()
+{
+}
+
+/// @brief ホストにADCは無いので何もしない（pinMode()から呼ばれる）
+void __clearADCPin(pin_size_t)
+{
+}
+
+namespace ardPort::core {
+	/*!
+	  @brief  Printableオブジェクトを出力する
+	  @param  x  出力するPrintableオブジェクト
+	  @return 書き込まれたバイト数
+	  @details ファームウェアではリンク時に捨てられて参照されないが、ホストではprintln(const Printable&)から参照される。
+	*/
+	size_t Print::print(const Printable &x) {
+		return x.printTo(*this);
+	}
+} // namespace ardPort::core
@@ -0,0 +1,2 @@
+#pragma once
+// Settings.cppが読み込むだけで、SNTPは使わない
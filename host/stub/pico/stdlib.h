@@ -0,0 +1,3 @@
+#pragma once
+#include "../pico_host.h"
+#include <sys/time.h> // settimeofday()（newlibではpico/stdlib.hから見える）
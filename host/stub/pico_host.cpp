@@ -0,0 +1,322 @@
+/*!
+ * @file pico_host.cpp
+ *
+ * ホスト用のpico-sdkの代わりの実装。
+ * GPIOはレベルを覚えるだけ。SPIとDMAに書かれたバイトは、DCとCSのレベルを見てTftHostSinkに渡す（TftHostBus.hを参照）。
+ */
+#include "pico_host.h"
+#include "TftHostBus.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+using namespace ardPort;
+
+iobank0_hw_t host_iobank0 = {};
+spi_hw_t host_spi_hw[2] = {};
+dma_hw_t host_dma_hw = {};
+pio_hw_t host_pio_hw[2] = {};
+uint8_t host_flash[PICO_FLASH_SIZE_BYTES];
+static struct HostFlashInit {
+	HostFlashInit() { memset(host_flash, 0xFF, sizeof(host_flash)); } ///< 消去済みの状態から始める
+} hostFlashInit;
+
+namespace {
+	/// DMAのチャネルの設定（SPIのデータレジスタに書くものだけを扱う）
+	struct HostDmaChannel {
+		bool isClaimed;        ///< 確保済みか
+		bool isPending;        ///< 開始して、まだ送っていないか
+		bool isToSpi;          ///< 書き込み先がSPIのデータレジスタか
+		uint32_t ctrl;         ///< 設定（読み出しアドレスを進めるか、転送の幅）
+		const uint8_t* pRead;  ///< 読み出しアドレス
+		uint32_t count;        ///< 転送回数
+	};
+
+	TftHostSink* pSink = nullptr; ///< バイトの受け取り先
+	int8_t dcPin = -1;            ///< DCのピン
+	int8_t csPin = -1;            ///< CSのピン（-1ならいつも選択されている）
+	uint64_t gpioLevels = 0;      ///< GPIOの出力レベル
+	uint32_t spiBaud[2];          ///< spi_init()で設定したボーレート
+	HostDmaChannel dmaChannels[NUM_DMA_CHANNELS];
+	uint64_t sleptUs = 0; ///< sleep_us()で進めた時間（実際には眠らない）
+
+	bool level(int8_t pin) { return pin >= 0 && (gpioLevels >> pin) & 1; }
+
+	/// 液晶にバイトを送る（CSがHなら届かない。DCのレベルでコマンドかデータかが決まる）
+	void emit(const uint8_t* p, uint32_t len)
+	{
+		if (pSink == nullptr || len == 0)
+			return;
+		if (csPin >= 0 && level(csPin))
+			return;
+		if (dcPin < 0 || level(dcPin)) {
+			pSink->data(p, len);
+		} else {
+			while (len--)
+				pSink->command(*p++);
+		}
+	}
+
+	/// 16ビットのフレームは上位バイトから出る
+	void emit16(uint16_t w)
+	{
+		uint8_t b[2] = {(uint8_t)(w >> 8), (uint8_t)w};
+		emit(b, 2);
+	}
+
+	/// 開始したDMAの転送を、いまのDC・CSのレベルで送る
+	void flushDma(uint ch)
+	{
+		HostDmaChannel& c = dmaChannels[ch];
+		if (!c.isPending)
+			return;
+		c.isPending = false;
+		if (!c.isToSpi)
+			return;
+		uint32_t size = 1u << ((c.ctrl & DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS) >> DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB);
+		bool increment = (c.ctrl & DMA_CH0_CTRL_TRIG_INCR_READ_BITS) != 0;
+		const uint8_t* p = c.pRead;
+		for (uint32_t i = 0; i < c.count; i++) {
+			if (size == 2) {
+				emit16(*(const uint16_t*)p);
+			} else {
+				emit(p, 1);
+			}
+			if (increment)
+				p += size;
+		}
+	}
+
+	void flushAllDma(void)
+	{
+		for (uint ch = 0; ch < NUM_DMA_CHANNELS; ch++)
+			flushDma(ch);
+	}
+} // namespace
+
+namespace ardPort {
+	/*!
+		@brief  液晶に送るバイトの受け取り先を設定する
+		@param  pSink   受け取り先（nullptrで外す）
+		@param  dcPin   DCのピン
+		@param  csPin   CSのピン（-1ならいつも選択されているとみなす）
+		@details 設定した時点でCS=H・DC=Hとする（Adafruit_SPITFT::begin()のあとの状態）。
+	*/
+	void tftHostBusAttach(TftHostSink* a_pSink, int8_t a_dcPin, int8_t a_csPin)
+	{
+		flushAllDma();
+		pSink = a_pSink;
+		dcPin = a_dcPin;
+		csPin = a_csPin;
+		if (dcPin >= 0)
+			gpioLevels |= 1ull << dcPin;
+		if (csPin >= 0)
+			gpioLevels |= 1ull << csPin;
+	}
+} // namespace ardPort
+
+extern "C" {
+
+// ---- pico.h
+void panic(const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	vfprintf(stderr, fmt, args);
+	va_end(args);
+	fputc('\n', stderr);
+	abort();
+}
+
+// ---- pico/time.h（眠る代わりに時計を進める）
+uint64_t time_us_64(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000 + sleptUs;
+}
+
+void sleep_us(uint64_t us)
+{
+	sleptUs += us;
+}
+
+void sleep_ms(uint32_t ms)
+{
+	sleptUs += (uint64_t)ms * 1000;
+}
+
+// ---- hardware/flash.h（消したところは0xFF、書くと0のビットだけが残る）
+void flash_range_erase(uint32_t flash_offs, size_t count)
+{
+	if (flash_offs % FLASH_SECTOR_SIZE != 0 || count % FLASH_SECTOR_SIZE != 0 || flash_offs + count > PICO_FLASH_SIZE_BYTES)
+		panic("flash_range_erase: bad range %lx+%lx", (unsigned long)flash_offs, (unsigned long)count);
+	memset(&host_flash[flash_offs], 0xFF, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t* data, size_t count)
+{
+	if (flash_offs % FLASH_PAGE_SIZE != 0 || flash_offs + count > PICO_FLASH_SIZE_BYTES)
+		panic("flash_range_program: bad range %lx+%lx", (unsigned long)flash_offs, (unsigned long)count);
+	for (size_t i = 0; i < count; i++)
+		host_flash[flash_offs + i] &= data[i];
+}
+
+// ---- hardware/watchdog.h
+void watchdog_reboot(uint32_t, uint32_t, uint32_t)
+{
+	panic("watchdog_reboot");
+}
+
+// ---- hardware/gpio.h
+void gpio_put(uint gpio, bool value)
+{
+	bool old = level(gpio);
+	if (value) {
+		gpioLevels |= 1ull << gpio;
+	} else {
+		gpioLevels &= ~(1ull << gpio);
+	}
+	if ((int)gpio == csPin && value && !old && pSink != nullptr)
+		pSink->endTransaction();
+}
+
+bool gpio_get(uint gpio)
+{
+	return level(gpio);
+}
+
+// ---- hardware/spi.h
+uint spi_init(spi_inst_t* spi, uint baudrate)
+{
+	spi_set_format(spi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+	return spi_set_baudrate(spi, baudrate);
+}
+
+uint spi_set_baudrate(spi_inst_t* spi, uint baudrate)
+{
+	spiBaud[spi_get_index(spi)] = baudrate;
+	return baudrate;
+}
+
+uint spi_get_baudrate(const spi_inst_t* spi)
+{
+	return spiBaud[spi_get_index(spi)];
+}
+
+int spi_write_blocking(spi_inst_t*, const uint8_t* src, size_t len)
+{
+	flushAllDma();
+	emit(src, len);
+	return (int)len;
+}
+
+int spi_write16_blocking(spi_inst_t*, const uint16_t* src, size_t len)
+{
+	flushAllDma();
+	for (size_t i = 0; i < len; i++)
+		emit16(src[i]);
+	return (int)len;
+}
+
+int spi_read_blocking(spi_inst_t*, uint8_t, uint8_t* dst, size_t len)
+{
+	flushAllDma();
+	for (size_t i = 0; i < len; i++)
+		dst[i] = (pSink != nullptr && !(csPin >= 0 && level(csPin))) ? pSink->read() : 0;
+	return (int)len;
+}
+
+int spi_read16_blocking(spi_inst_t* spi, uint16_t, uint16_t* dst, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		uint8_t b[2];
+		spi_read_blocking(spi, 0, b, 2);
+		dst[i] = (uint16_t)((b[0] << 8) | b[1]);
+	}
+	return (int)len;
+}
+
+int spi_write_read_blocking(spi_inst_t* spi, const uint8_t* src, uint8_t* dst, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		spi_write_blocking(spi, src + i, 1);
+		spi_read_blocking(spi, 0, dst + i, 1);
+	}
+	return (int)len;
+}
+
+int spi_write16_read16_blocking(spi_inst_t* spi, const uint16_t* src, uint16_t* dst, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		spi_write16_blocking(spi, src + i, 1);
+		spi_read16_blocking(spi, 0, dst + i, 1);
+	}
+	return (int)len;
+}
+
+// ---- hardware/dma.h
+int dma_claim_unused_channel(bool required)
+{
+	for (uint ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+		if (!dmaChannels[ch].isClaimed) {
+			dmaChannels[ch].isClaimed = true;
+			return (int)ch;
+		}
+	}
+	if (required)
+		panic("No DMA channels are available");
+	return -1;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+	dmaChannels[channel].isClaimed = false;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+	dma_channel_config c = {0};
+	channel_config_set_read_increment(&c, true);
+	channel_config_set_write_increment(&c, false);
+	channel_config_set_dreq(&c, 0x3f);
+	channel_config_set_chain_to(&c, channel);
+	channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+	return c;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr, const volatile void* read_addr, uint transfer_count, bool trigger)
+{
+	HostDmaChannel& c = dmaChannels[channel];
+	flushDma(channel);
+	c.ctrl = config->ctrl;
+	c.pRead = (const uint8_t*)read_addr;
+	c.count = transfer_count;
+	c.isToSpi = (write_addr == &host_spi_hw[0].dr || write_addr == &host_spi_hw[1].dr);
+	c.isPending = trigger;
+}
+
+void dma_channel_start(uint channel)
+{
+	dmaChannels[channel].isPending = true;
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+	flushDma(channel);
+	return false;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel)
+{
+	flushDma(channel);
+}
+
+void dma_channel_abort(uint channel)
+{
+	dmaChannels[channel].isPending = false;
+}
+
+} // extern "C"
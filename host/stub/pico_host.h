@@ -0,0 +1,250 @@
+/*!
+ * @file pico_host.h
+ *
+ * ホストのLinuxでライブラリをビルドするための、pico-sdkの代わりの宣言。
+ * hardware/〜.h、pico/〜.h の各ヘッダはこれを読み込むだけ。
+ * SPIとDMAに書かれたバイトは、DCとCSのピンの状態と一緒にTftHostBusに渡す（pico_host.cpp）。
+ * それ以外（割り込み・PIO・クロックなど）は何もしないか、「使えない」と答える。
+ */
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+typedef volatile uint32_t io_rw_32;
+typedef const volatile uint32_t io_ro_32;
+typedef volatile uint32_t io_wo_32;
+typedef uint64_t absolute_time_t;
+
+#define __not_in_flash_func(func) func
+#define __time_critical_func(func) func
+#define __force_inline inline
+#ifndef count_of
+	#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- pico.h / hardware/sync.h
+static inline uint get_core_num(void) { return 0; }
+static inline void tight_loop_contents(void) {}
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(uint32_t) {}
+static inline void __dmb(void) {}
+void panic(const char* fmt, ...);
+static inline void hw_write_masked(io_rw_32* addr, uint32_t values, uint32_t write_mask) { *addr = (*addr & ~write_mask) | (values & write_mask); }
+static inline void hw_set_bits(io_rw_32* addr, uint32_t mask) { *addr |= mask; }
+static inline void hw_clear_bits(io_rw_32* addr, uint32_t mask) { *addr &= ~mask; }
+
+// ---- pico/time.h / hardware/timer.h（ホストの単調時計）
+uint64_t time_us_64(void);
+static inline uint32_t time_us_32(void) { return (uint32_t)time_us_64(); }
+static inline absolute_time_t get_absolute_time(void) { return time_us_64(); }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+static inline void busy_wait_us(uint64_t us) { sleep_us(us); }
+static inline void busy_wait_us_32(uint32_t us) { sleep_us(us); }
+
+// ---- hardware/gpio.h
+enum gpio_function { GPIO_FUNC_XIP = 0, GPIO_FUNC_SPI = 1, GPIO_FUNC_UART = 2, GPIO_FUNC_I2C = 3, GPIO_FUNC_PWM = 4, GPIO_FUNC_SIO = 5, GPIO_FUNC_PIO0 = 6, GPIO_FUNC_PIO1 = 7, GPIO_FUNC_GPCK = 8, GPIO_FUNC_USB = 9, GPIO_FUNC_NULL = 0x1f };
+enum gpio_drive_strength { GPIO_DRIVE_STRENGTH_2MA = 0, GPIO_DRIVE_STRENGTH_4MA = 1, GPIO_DRIVE_STRENGTH_8MA = 2, GPIO_DRIVE_STRENGTH_12MA = 3 };
+enum gpio_irq_level { GPIO_IRQ_LEVEL_LOW = 1, GPIO_IRQ_LEVEL_HIGH = 2, GPIO_IRQ_EDGE_FALL = 4, GPIO_IRQ_EDGE_RISE = 8 };
+#define GPIO_OUT 1
+#define GPIO_IN 0
+#define NUM_BANK0_GPIOS 30
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+static inline void gpio_init(uint) {}
+static inline void gpio_deinit(uint) {}
+static inline void gpio_set_dir(uint, bool) {}
+static inline void gpio_set_function(uint, enum gpio_function) {}
+static inline void gpio_pull_up(uint) {}
+static inline void gpio_pull_down(uint) {}
+static inline void gpio_disable_pulls(uint) {}
+static inline void gpio_set_drive_strength(uint, enum gpio_drive_strength) {}
+static inline void gpio_set_irq_enabled(uint, uint32_t, bool) {}
+static inline void gpio_set_irq_enabled_with_callback(uint, uint32_t, bool, gpio_irq_callback_t) {}
+
+// ---- hardware/structs/iobank0.h
+typedef struct {
+	io_rw_32 inte[6];
+	io_rw_32 intf[6];
+	io_ro_32 ints[6];
+} io_bank0_irq_ctrl_hw_t;
+typedef struct {
+	io_bank0_irq_ctrl_hw_t proc0_irq_ctrl;
+	io_bank0_irq_ctrl_hw_t proc1_irq_ctrl;
+} iobank0_hw_t;
+extern iobank0_hw_t host_iobank0;
+#define iobank0_hw (&host_iobank0)
+
+// ---- hardware/flash.h / hardware/regs/addressmap.h（フラッシュはメモリ上の配列。XIP_BASEから読める）
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+#define FLASH_BLOCK_SIZE (1u << 16)
+#define PICO_FLASH_SIZE_BYTES (2u * 1024 * 1024)
+extern uint8_t host_flash[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE ((uintptr_t)host_flash)
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t* data, size_t count);
+
+// ---- hardware/watchdog.h（再起動はできないので、テストを止める）
+void watchdog_reboot(uint32_t pc, uint32_t sp, uint32_t delay_ms);
+
+// ---- hardware/irq.h
+static inline void irq_set_enabled(uint, bool) {}
+
+// ---- hardware/clocks.h
+enum clock_index { clk_gpout0 = 0, clk_ref = 4, clk_sys = 5, clk_peri = 6, clk_usb = 7, clk_adc = 8 };
+static inline uint32_t clock_get_hz(enum clock_index) { return 125000000; }
+
+// ---- hardware/spi.h
+typedef struct {
+	io_rw_32 cr0;
+	io_rw_32 cr1;
+	io_rw_32 dr;
+	io_ro_32 sr;
+	io_rw_32 cpsr;
+	io_rw_32 imsc;
+	io_ro_32 ris;
+	io_ro_32 mis;
+	io_wo_32 icr;
+	io_rw_32 dmacr;
+} spi_hw_t;
+typedef struct spi_inst spi_inst_t;
+extern spi_hw_t host_spi_hw[2];
+#define spi0 ((spi_inst_t*)&host_spi_hw[0])
+#define spi1 ((spi_inst_t*)&host_spi_hw[1])
+typedef enum { SPI_CPHA_0 = 0, SPI_CPHA_1 = 1 } spi_cpha_t;
+typedef enum { SPI_CPOL_0 = 0, SPI_CPOL_1 = 1 } spi_cpol_t;
+typedef enum { SPI_LSB_FIRST = 0, SPI_MSB_FIRST = 1 } spi_order_t;
+#define SPI_SSPCR0_DSS_LSB 0
+#define SPI_SSPCR0_DSS_BITS 0x0000000f
+#define SPI_SSPSR_BSY_BITS 0x00000010
+#define SPI_SSPICR_RORIC_BITS 0x00000001
+#define SPI_SSPDMACR_TXDMAE_BITS 0x00000002
+#define SPI_SSPDMACR_RXDMAE_BITS 0x00000001
+static inline spi_hw_t* spi_get_hw(spi_inst_t* spi) { return (spi_hw_t*)spi; }
+static inline const spi_hw_t* spi_get_const_hw(const spi_inst_t* spi) { return (const spi_hw_t*)spi; }
+static inline uint spi_get_index(const spi_inst_t* spi) { return spi == spi1 ? 1u : 0u; }
+static inline uint spi_get_dreq(spi_inst_t* spi, bool is_tx) { return spi_get_index(spi) * 2 + (is_tx ? 16 : 17); }
+uint spi_init(spi_inst_t* spi, uint baudrate);
+static inline void spi_deinit(spi_inst_t*) {}
+uint spi_set_baudrate(spi_inst_t* spi, uint baudrate);
+uint spi_get_baudrate(const spi_inst_t* spi);
+static inline void spi_set_format(spi_inst_t* spi, uint data_bits, spi_cpol_t, spi_cpha_t, spi_order_t) { hw_write_masked(&spi_get_hw(spi)->cr0, (data_bits - 1) << SPI_SSPCR0_DSS_LSB, SPI_SSPCR0_DSS_BITS); }
+static inline bool spi_is_busy(const spi_inst_t*) { return false; }
+static inline bool spi_is_readable(const spi_inst_t*) { return false; }
+static inline bool spi_is_writable(const spi_inst_t*) { return true; }
+int spi_write_blocking(spi_inst_t* spi, const uint8_t* src, size_t len);
+int spi_write16_blocking(spi_inst_t* spi, const uint16_t* src, size_t len);
+int spi_read_blocking(spi_inst_t* spi, uint8_t repeated_tx_data, uint8_t* dst, size_t len);
+int spi_read16_blocking(spi_inst_t* spi, uint16_t repeated_tx_data, uint16_t* dst, size_t len);
+int spi_write_read_blocking(spi_inst_t* spi, const uint8_t* src, uint8_t* dst, size_t len);
+int spi_write16_read16_blocking(spi_inst_t* spi, const uint16_t* src, uint16_t* dst, size_t len);
+
+// ---- hardware/dma.h
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+typedef struct {
+	uint32_t ctrl;
+} dma_channel_config;
+#define NUM_DMA_CHANNELS 12
+#define DMA_CH0_CTRL_TRIG_EN_BITS 0x00000001
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB 2
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS 0x0000000c
+#define DMA_CH0_CTRL_TRIG_INCR_READ_BITS 0x00000010
+#define DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS 0x00000020
+#define DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB 11
+#define DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS 0x00007800
+#define DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB 15
+#define DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS 0x001f8000
+#define DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS 0x00200000
+#define DMA_CH0_CTRL_TRIG_BSWAP_BITS 0x00400000
+typedef struct {
+	io_rw_32 read_addr;
+	io_rw_32 write_addr;
+	io_rw_32 transfer_count;
+	io_rw_32 ctrl_trig;
+	io_rw_32 al1_ctrl;
+	io_rw_32 al1_read_addr;
+	io_rw_32 al1_write_addr;
+	io_rw_32 al1_transfer_count_trig;
+	io_rw_32 al2_ctrl;
+	io_rw_32 al2_transfer_count;
+	io_rw_32 al2_read_addr;
+	io_rw_32 al2_write_addr_trig;
+	io_rw_32 al3_ctrl;
+	io_rw_32 al3_write_addr;
+	io_rw_32 al3_transfer_count;
+	io_rw_32 al3_read_addr_trig;
+} dma_channel_hw_t;
+int dma_claim_unused_channel(bool required);
+void dma_channel_unclaim(uint channel);
+dma_channel_config dma_channel_get_default_config(uint channel);
+static inline void channel_config_set_transfer_data_size(dma_channel_config* c, enum dma_channel_transfer_size size) { c->ctrl = (c->ctrl & ~DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS) | ((uint32_t)size << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB); }
+static inline void channel_config_set_read_increment(dma_channel_config* c, bool incr) { c->ctrl = incr ? (c->ctrl | DMA_CH0_CTRL_TRIG_INCR_READ_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_INCR_READ_BITS); }
+static inline void channel_config_set_write_increment(dma_channel_config* c, bool incr) { c->ctrl = incr ? (c->ctrl | DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS); }
+static inline void channel_config_set_dreq(dma_channel_config* c, uint dreq) { c->ctrl = (c->ctrl & ~DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS) | (dreq << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB); }
+static inline void channel_config_set_chain_to(dma_channel_config* c, uint chain_to) { c->ctrl = (c->ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) | (chain_to << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB); }
+static inline void channel_config_set_irq_quiet(dma_channel_config* c, bool quiet) { c->ctrl = quiet ? (c->ctrl | DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS); }
+static inline void channel_config_set_bswap(dma_channel_config* c, bool bswap) { c->ctrl = bswap ? (c->ctrl | DMA_CH0_CTRL_TRIG_BSWAP_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_BSWAP_BITS); }
+static inline void channel_config_set_ring(dma_channel_config*, bool, uint) {}
+static inline uint32_t channel_config_get_ctrl_value(const dma_channel_config* c) { return c->ctrl; }
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr, const volatile void* read_addr, uint transfer_count, bool trigger);
+void dma_channel_start(uint channel);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_wait_for_finish_blocking(uint channel);
+void dma_channel_abort(uint channel);
+static inline void dma_channel_cleanup(uint) {}
+static inline void dma_channel_set_irq0_enabled(uint, bool) {}
+typedef struct {
+	dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+} dma_hw_t;
+extern dma_hw_t host_dma_hw;
+#define dma_hw (&host_dma_hw)
+static inline dma_channel_hw_t* dma_channel_hw_addr(uint channel) { return &dma_hw->ch[channel]; }
+
+// ---- hardware/pio.h（ステートマシンは無いので、TftPioStreamの初期化は失敗してSPIで送る）
+typedef struct {
+	io_rw_32 ctrl;
+	io_ro_32 fstat;
+	io_rw_32 fdebug;
+	io_ro_32 flevel;
+	io_wo_32 txf[4];
+	io_ro_32 rxf[4];
+} pio_hw_t;
+typedef pio_hw_t* PIO;
+extern pio_hw_t host_pio_hw[2];
+#define pio0 (&host_pio_hw[0])
+#define pio1 (&host_pio_hw[1])
+typedef struct {
+	const uint16_t* instructions;
+	uint8_t length;
+	int8_t origin;
+} pio_program_t;
+typedef struct {
+	uint32_t clkdiv;
+	uint32_t execctrl;
+	uint32_t shiftctrl;
+	uint32_t pinctrl;
+} pio_sm_config;
+static inline bool pio_can_add_program(PIO, const pio_program_t*) { return false; }
+static inline uint pio_add_program(PIO, const pio_program_t*) { return 0; }
+static inline void pio_remove_program(PIO, const pio_program_t*, uint) {}
+static inline int pio_claim_unused_sm(PIO, bool) { return -1; }
+static inline void pio_sm_unclaim(PIO, uint) {}
+static inline uint pio_get_dreq(PIO, uint, bool) { return 0; }
+static inline bool pio_sm_is_tx_fifo_empty(PIO, uint) { return true; }
+static inline void pio_sm_set_enabled(PIO, uint, bool) {}
+static inline void pio_sm_put_blocking(PIO, uint, uint32_t) {}
+static inline void pio_gpio_init(PIO, uint) {}
+
+#ifdef __cplusplus
+}
+#endif
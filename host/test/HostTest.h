@@ -0,0 +1,64 @@
+/*!
+ * @file HostTest.h
+ *
+ * ホストのテストで使う小さな道具（失敗した条件の表示と、終了コード）。
+ * テストはそれぞれ１つの実行ファイルで、失敗があればmain()が0以外を返す（ctestがそれを見る）。
+ */
+#pragma once
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/// 失敗した条件の数
+static int hostTestFailures = 0;
+
+/// @brief 条件を確かめる。偽ならファイル名・行・式を表示して数える（テストは続ける）
+#define HOST_CHECK(cond)                                                            \
+	do {                                                                            \
+		if (!(cond)) {                                                              \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			hostTestFailures++;                                                     \
+		}                                                                           \
+	} while (0)
+
+/// @brief dumpStats()などに渡すprintf
+static inline void hostPrintf(const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	vprintf(format, args);
+	va_end(args);
+}
+
+/*!
+	@brief  ２つの画面（RGB565）を比べる
+	@return 一致すればtrue。違えば最初に違う位置と、違うピクセルの数を表示する
+*/
+static inline bool hostComparePixels(const uint16_t* pActual, const uint16_t* pExpected, int16_t w, int16_t h)
+{
+	int32_t diff = 0;
+	int32_t first = -1;
+	for (int32_t i = 0; i < (int32_t)w * h; i++) {
+		if (pActual[i] != pExpected[i]) {
+			if (first < 0)
+				first = i;
+			diff++;
+		}
+	}
+	if (diff == 0)
+		return true;
+	fprintf(stderr, "  %ld pixels differ, first at (%ld, %ld): 0x%04X != 0x%04X\n", (long)diff, (long)(first % w), (long)(first / w), pActual[first], pExpected[first]);
+	return false;
+}
+
+/// @brief 結果を表示して、main()が返す値を得る
+static inline int hostTestResult(const char* name)
+{
+	if (hostTestFailures == 0) {
+		printf("%s: OK\n", name);
+		return 0;
+	}
+	printf("%s: %d check(s) failed\n", name, hostTestFailures);
+	return 1;
+}
@@ -0,0 +1,58 @@
+/*!
+ * @file ScriptedTouch.cpp
+ *
+ * 決めておいたタップを返すタッチパネルの実装。
+ */
+#include "ScriptedTouch.h"
+
+/// タップの状態
+enum ScriptedTouchState {
+	TOUCH_IDLE,     ///< 押されていない（次の touched() でフックを呼ぶ）
+	TOUCH_PRESSED,  ///< 押されている
+	TOUCH_RELEASED, ///< 読まれた（次の touched() で離れる）
+};
+
+static ScriptedTouchHook pHook = nullptr;
+static ScriptedTouchState state = TOUCH_IDLE;
+static TS_Point tap;
+
+/*!
+	@brief  タッチを待っている画面で呼ぶフックを設定する
+*/
+void scriptedTouchSetHook(ScriptedTouchHook a_pHook)
+{
+	pHook = a_pHook;
+	state = TOUCH_IDLE;
+}
+
+namespace ardPort {
+
+	bool XPT2046_Touchscreen::touched()
+	{
+		if (state == TOUCH_PRESSED)
+			return true;
+		if (state == TOUCH_RELEASED) {
+			state = TOUCH_IDLE;
+			return false;
+		}
+		if (pHook != nullptr && pHook(tap)) {
+			state = TOUCH_PRESSED;
+			return true;
+		}
+		return false;
+	}
+
+	/// @brief 生の値（キャリブレーションの値で画面の座標から戻したもの）
+	TS_Point XPT2046_Touchscreen::getPoint()
+	{
+		int16_t x = minX + (int32_t)tap.x * (maxX - minX) / screenWidth;
+		int16_t y = minY + (int32_t)tap.y * (maxY - minY) / screenHeight;
+		return TS_Point(x, y, 1000);
+	}
+
+	TS_Point XPT2046_Touchscreen::getPointOnScreen()
+	{
+		state = TOUCH_RELEASED;
+		return TS_Point(tap.x, tap.y, 1000);
+	}
+} // namespace ardPort
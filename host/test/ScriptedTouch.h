@@ -0,0 +1,19 @@
+/*!
+ * @file ScriptedTouch.h
+ *
+ * XPT2046_Touchscreenの代わりに、決めておいたタップを返すタッチパネル（ホストのテスト用）。
+ * XPT2046_Touchscreen.cppの代わりにリンクする。
+ *
+ * 画面がタッチを待って touched() を呼んだとき、押されていなければフックを呼ぶ。
+ * フックはそのときの画面を確かめてから、次のタップの位置を返す（返さなければ押されていない）。
+ * タップは getPointOnScreen() で読まれるまで押されたままで、読まれた後の touched() で１回だけ離れる（フックは呼ばない）。
+ */
+#pragma once
+#include "XPT2046_Touchscreen.h"
+
+using namespace ardPort;
+
+/// @brief タッチを待っている画面で呼ぶフック。タップするならa_tapに画面の座標を入れてtrueを返す
+typedef bool (*ScriptedTouchHook)(TS_Point& a_tap);
+
+void scriptedTouchSetHook(ScriptedTouchHook a_pHook);
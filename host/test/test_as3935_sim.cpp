@@ -0,0 +1,94 @@
+/*!
+ * @file test_as3935_sim.cpp
+ *
+ * AS3935クラスのセンサー処理（キャリブレーションとvalidateSignal()）を、実機の代わりにAS3935Simにつないで確かめる。
+ * 雷・遠すぎる雷・ディスターバ・ノイズ過大を起こし、判定とイベント履歴、トレースの記録を、ブロックリードと１バイトずつの読み出しの両方で見る。
+ */
+#include "HostTest.h"
+#include "AS3935.h"
+#include "AS3935Sim.h"
+#include "SensorTrace.h"
+
+#define SIM_ADDR 0x03
+
+/// @brief 雷を起こしてvalidateSignal()で読み、距離とエネルギーが届くか
+static void checkLightning(AS3935& as3935, AS3935Sim& sim, int km, uint32_t energy, AS3935_SIGNAL want, uint8_t wantSummary)
+{
+	HOST_CHECK(sim.injectLightning(km, energy));
+	uint8_t dist = sim.peekReg(0x07) & 0x3F;
+	HOST_CHECK(as3935.validateSignal(sim.timeUs()) == want);
+	HOST_CHECK(sim.isIrqHigh() == false); // 割り込み要因は読み出しでクリアされる
+	uint8_t summary, eventDist;
+	long lEnergy;
+	time_t t;
+	HOST_CHECK(as3935.GetLatestEvent(0, summary, eventDist, lEnergy, t));
+	HOST_CHECK(summary == wantSummary);
+	HOST_CHECK(eventDist == dist);
+	HOST_CHECK(lEnergy == (long)energy);
+}
+
+/// @brief 読み出し方ごとに、各イベントの判定を確かめる
+static void testValidateSignal(bool isBlockRead)
+{
+	AS3935Sim sim(SIM_ADDR);
+	SensorTraceRecorder recorder;
+	AS3935 as3935;
+	AS3935Config config;
+	config.isBlockRead = isBlockRead;
+	as3935.setConfig(config);
+	as3935.setTransport(&sim);
+	as3935.setRecorder(&recorder);
+	HOST_CHECK(as3935.Init(SIM_ADDR, 0, 4, 5, 2));
+	as3935.StartCalibration(100);
+	HOST_CHECK(sim.peekReg(0x08) == as3935.getCalibratedCap()); // キャリブレーションで選んだキャパシタが書かれている（LCO出力はOFF）
+	HOST_CHECK(as3935.getFreqCalibration() > 490000 && as3935.getFreqCalibration() < 510000);
+
+	checkLightning(as3935, sim, 12, 0x12345, AS3935_SIGNAL::VALID, as3935.SUMM_THUNDER);
+	HOST_CHECK(as3935.getLatestSignalValid() == AS3935_SIGNAL::VALID);
+	checkLightning(as3935, sim, 80, 0x00321, AS3935_SIGNAL::INVALID, as3935.SUMM_TOOFAR);
+
+	uint8_t summary, dist;
+	long lEnergy;
+	time_t t;
+	HOST_CHECK(sim.injectDisturber());
+	HOST_CHECK(as3935.validateSignal() == AS3935_SIGNAL::INVALID);
+	HOST_CHECK(as3935.GetLatestEvent(0, summary, dist, lEnergy, t) && summary == as3935.SUMM_DISTERBER);
+	HOST_CHECK(sim.injectNoiseHigh());
+	HOST_CHECK(as3935.validateSignal() == AS3935_SIGNAL::INVALID);
+	HOST_CHECK(as3935.GetLatestEvent(0, summary, dist, lEnergy, t) && summary == as3935.SUMM_NOISEHIGH);
+
+	// 割り込み要因が無いまま読むと、統計クリアとして扱い、履歴は増やさない
+	HOST_CHECK(as3935.validateSignal() == AS3935_SIGNAL::STATCLEAR);
+	HOST_CHECK(as3935.GetLatestAlarm(1, summary, dist, lEnergy, t) == false);
+	HOST_CHECK(as3935.GetLatestFalseAlarm(2, summary, dist, lEnergy, t) && summary == as3935.SUMM_TOOFAR);
+
+	HOST_CHECK(recorder.getCount() == 5); // validateSignal()ごとに１レコード
+}
+
+/// @brief 設定値がReset()でレジスタに書かれるか
+static void testConfig(void)
+{
+	AS3935Sim sim(SIM_ADDR);
+	AS3935 as3935;
+	AS3935Config config;
+	config.gainBoost = AFE_GB_OUTDOOR;
+	config.noiseFloor = NFLEV_5;
+	config.watchDogThreshold = 3;
+	config.minimumEvent = 2;
+	config.spikeReject = 4;
+	as3935.setConfig(config);
+	as3935.setTransport(&sim);
+	HOST_CHECK(as3935.Init(SIM_ADDR, 0, 4, 5, 2));
+	as3935.StartCalibration(100);
+	HOST_CHECK(sim.peekReg(0x00) == (AFE_GB_OUTDOOR << 1));
+	HOST_CHECK(sim.peekReg(0x01) == ((NFLEV_5 << 4) | 3));
+	HOST_CHECK((sim.peekReg(0x02) & 0x3F) == ((2 << 4) | 4));
+}
+
+int main()
+{
+	testValidateSignal(true);
+	testValidateSignal(false);
+	testConfig();
+	return hostTestResult("as3935_sim");
+}
@@ -0,0 +1,87 @@
+/*!
+ * @file test_clip.cpp
+ *
+ * クリップ矩形（pushClipRect()）で一部だけ見える圧縮画像と背景つきの塗りつぶし図形を、液晶とキャンバスで描き比べる。
+ * 液晶では見える範囲を１つのウインドウで送る（１ドットずつ描く基底クラスの経路に落ちない）ことも、送ったピクセル数で確かめる。
+ */
+#include "HostTest.h"
+#include "Adafruit_ILI9341.h"
+#include "Ili9341Emulator.h"
+#include "pictPacked.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+static Ili9341Emulator emu;
+static Adafruit_ILI9341 tft(&SPI, 20, 22, 21);
+static GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+static uint16_t panel[ILI9341_EMU_WIDTH * ILI9341_EMU_HEIGHT];
+
+struct ClipCase {
+	int16_t x, y, w, h; ///< クリップ矩形
+};
+
+/// 画像と図形の端を横切るクリップ矩形
+static const ClipCase clips[] = {
+	{0, 0, 240, 320},   // 画面全体（切らない）
+	{45, 30, 20, 30},   // 画像の真ん中だけ
+	{20, 20, 30, 300},  // 左端の列を切る
+	{50, 0, 190, 55},   // 右と下を切る
+	{38, 47, 3, 2},     // 数ドットだけ
+	{100, 100, 60, 60}, // 画像に重ならない
+};
+
+/// @brief 圧縮画像
+static void testPackedImage(void)
+{
+	for (const ClipCase& c : clips) {
+		tft.fillScreen(ILI9341_BLACK);
+		ref.fillScreen(ILI9341_BLACK);
+		emu.clearStats();
+		Adafruit_GFX* targets[2] = {&tft, &ref};
+		for (Adafruit_GFX* g : targets) {
+			HOST_CHECK(g->pushClipRect(c.x, c.y, c.w, c.h));
+			g->drawPackedImage(30, 20, num_8_packed);
+			g->drawPackedImage(-10, 250, num_3_packed); // 画面からもはみ出す
+			g->popClipRect();
+		}
+		emu.getPanel(panel);
+		HOST_CHECK(hostComparePixels(panel, ref.getBuffer(), ILI9341_EMU_WIDTH, ILI9341_EMU_HEIGHT));
+		// 送ったのは見える範囲だけ（ウインドウは画像ごとに１回）
+		const Ili9341EmuStats& st = emu.getStats();
+		HOST_CHECK(st.wrappedPixels == 0);
+		HOST_CHECK(st.commandCount[ILI9341_RAMWR] <= 2);
+		HOST_CHECK(st.pixels <= (uint32_t)c.w * c.h);
+	}
+}
+
+/// @brief 背景つきの角丸矩形と円
+static void testFillSpansOpaque(void)
+{
+	for (const ClipCase& c : clips) {
+		tft.fillScreen(ILI9341_BLACK);
+		ref.fillScreen(ILI9341_BLACK);
+		emu.clearStats();
+		Adafruit_GFX* targets[2] = {&tft, &ref};
+		for (Adafruit_GFX* g : targets) {
+			HOST_CHECK(g->pushClipRect(c.x, c.y, c.w, c.h));
+			g->fillRoundRect(25, 15, 60, 50, 12, ILI9341_YELLOW, ILI9341_NAVY);
+			g->fillCircle(40, 60, 20, ILI9341_RED, ILI9341_DARKGREEN);
+			g->popClipRect();
+		}
+		emu.getPanel(panel);
+		HOST_CHECK(hostComparePixels(panel, ref.getBuffer(), ILI9341_EMU_WIDTH, ILI9341_EMU_HEIGHT));
+		const Ili9341EmuStats& st = emu.getStats();
+		HOST_CHECK(st.commandCount[ILI9341_RAMWR] <= 2);
+		HOST_CHECK(st.pixels <= 2u * c.w * c.h);
+	}
+}
+
+int main()
+{
+	tft.attachHostSink(&emu);
+	tft.begin();
+	testPackedImage();
+	testFillSpansOpaque();
+	return hostTestResult("clip");
+}
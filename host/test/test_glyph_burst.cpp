@@ -0,0 +1,73 @@
+/*!
+ * @file test_glyph_burst.cpp
+ *
+ * 階調つき（2/4bpp）の漢字フォントを背景ありで描くと、拡大率にかかわらず前景色と背景色を混ぜた色になるかを確かめる。
+ * 拡大した１行がCHAR_BURST_BUF_PIXELSに入らない大きさでも、しきい値で白黒にしてはいけない。
+ */
+#include "HostTest.h"
+#include "Adafruit_GFX.h"
+#include "Adafruit_ILI9341.h"
+#include "Ili9341Emulator.h"
+#include "KanjiHelper.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define GLYPH_W 16
+#define GLYPH_H 16
+#define FG 0xFFFF
+#define BG 0x0000
+
+/// 2bppで、左半分が階調1（薄い）、右半分が階調3（前景色）の文字
+static uint8_t glyph[GLYPH_H * GLYPH_W * 2 / 8];
+
+/// @brief 拡大率ごとに、文字の各ドットが拡大率1のときと同じ色で、右の余白が背景色か
+static void checkScaled(Adafruit_GFX& g, uint16_t (*pixelAt)(int16_t, int16_t), uint8_t size)
+{
+	g.fillScreen(0xF800);
+	g.drawChar(0, 0, GLYPH_W, GLYPH_H, glyph, FG, BG, 1, 1);
+	uint16_t light = pixelAt(0, 0);
+	uint16_t solid = pixelAt(GLYPH_W - 1, 0);
+	HOST_CHECK(light != FG && light != BG); // 混ぜた色
+	HOST_CHECK(solid == FG);
+
+	g.fillScreen(0xF800);
+	g.drawChar(0, 0, GLYPH_W, GLYPH_H, glyph, FG, BG, size, size);
+	int32_t bad = 0;
+	for (int16_t yy = 0; yy < GLYPH_H * size; yy++) {
+		for (int16_t xx = 0; xx < (GLYPH_W + 1) * size; xx++) {
+			uint16_t want = (xx >= GLYPH_W * size) ? BG : (xx < GLYPH_W * size / 2) ? light : solid;
+			if (pixelAt(xx, yy) != want)
+				bad++;
+		}
+	}
+	if (bad)
+		fprintf(stderr, "  size %d: %ld pixels differ\n", size, (long)bad);
+	HOST_CHECK(bad == 0);
+}
+
+static GFXcanvas16 canvas(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+static uint16_t canvasPixel(int16_t x, int16_t y) { return canvas.getPixel(x, y); }
+
+static Ili9341Emulator emu;
+static uint16_t tftPixel(int16_t x, int16_t y) { return emu.getGram(x, y); }
+
+int main()
+{
+	for (int16_t yy = 0; yy < GLYPH_H; yy++) {
+		for (int16_t b = 0; b < GLYPH_W * 2 / 8; b++)
+			glyph[yy * (GLYPH_W * 2 / 8) + b] = (b < GLYPH_W / 8) ? 0x55 : 0xFF;
+	}
+	static const KanjiData font[] = {{0x4E00, 0x88EA, 0x306C, GLYPH_W, GLYPH_H, 0}, {0, 0, 0, 0, 0, 0}};
+	KanjiHelper::SetKanjiFont(font, glyph, 2);
+
+	static Adafruit_ILI9341 tft(&SPI, 20, 22, 21);
+	tft.attachHostSink(&emu);
+	tft.begin();
+	static const uint8_t sizes[] = {1, 2, 3, 4, 7, 8, 13};
+	for (uint8_t size : sizes) {
+		checkScaled(canvas, canvasPixel, size);
+		checkScaled(tft, tftPixel, size);
+	}
+	return hostTestResult("glyph_burst");
+}
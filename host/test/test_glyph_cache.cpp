@@ -0,0 +1,160 @@
+/*!
+ * @file test_glyph_cache.cpp
+ *
+ * GlyphCacheのLRU（最も古いスロットを再利用する）、同じバケットに複数のキーがあるときの追い出し、
+ * スロットに入らない文字とinit(0)の扱い、ヒット・ミス・追い出しの回数を確かめる。
+ */
+#include "HostTest.h"
+#include "GlyphCache.h"
+#include <list>
+
+/// フォントは比べるだけで読まないので、区別できるアドレスであればよい
+static const KanjiData* const FONT_A = reinterpret_cast<const KanjiData*>(0x1000);
+static const KanjiData* const FONT_B = reinterpret_cast<const KanjiData*>(0x2000);
+
+/// @brief スロットn個分の予算
+static size_t slotBudget(size_t n)
+{
+	return n * (GLYPH_CACHE_SLOT_PIXELS * sizeof(uint16_t) + sizeof(GlyphCacheEntry));
+}
+
+/// @brief いっぱいになったら最も長く使われていないスロットを再利用し、追い出したキーは見つからなくなるか
+static void testLru(void)
+{
+	GlyphCache cache;
+	HOST_CHECK(cache.init(slotBudget(3)));
+	HOST_CHECK(cache.getSlots() == 3);
+
+	uint16_t* pA = cache.insert('A', FONT_A, 0xFFFF, 0x0000, 8, 16);
+	uint16_t* pB = cache.insert('B', FONT_A, 0xFFFF, 0x0000, 8, 16);
+	uint16_t* pC = cache.insert('C', FONT_A, 0xFFFF, 0x0000, 8, 16);
+	HOST_CHECK(pA != nullptr && pB != nullptr && pC != nullptr);
+
+	const GlyphCacheEntry* pEntry = cache.find('A', FONT_A, 0xFFFF, 0x0000); // Aが最も新しくなり、Bが最も古くなる
+	HOST_CHECK(pEntry != nullptr && pEntry->code == 'A' && pEntry->w == 8 && pEntry->h == 16);
+	HOST_CHECK(cache.getPixels(pEntry) == pA);
+
+	uint16_t* pD = cache.insert('D', FONT_A, 0xFFFF, 0x0000, 8, 16);
+	HOST_CHECK(pD == pB); // Bのスロットを再利用する
+	HOST_CHECK(cache.getEvictions() == 1);
+	HOST_CHECK(cache.find('B', FONT_A, 0xFFFF, 0x0000) == nullptr);
+	HOST_CHECK(cache.find('A', FONT_A, 0xFFFF, 0x0000) != nullptr);
+	HOST_CHECK(cache.find('C', FONT_A, 0xFFFF, 0x0000) != nullptr);
+	HOST_CHECK(cache.find('D', FONT_A, 0xFFFF, 0x0000) != nullptr);
+
+	// フォントと色もキーの一部
+	HOST_CHECK(cache.find('A', FONT_B, 0xFFFF, 0x0000) == nullptr);
+	HOST_CHECK(cache.find('A', FONT_A, 0xF800, 0x0000) == nullptr);
+	HOST_CHECK(cache.find('A', FONT_A, 0xFFFF, 0x001F) == nullptr);
+
+	// A→C→Dの順に使ったので、次はAが追い出される
+	HOST_CHECK(cache.insert('E', FONT_A, 0xFFFF, 0x0000, 8, 16) == pA);
+	HOST_CHECK(cache.find('A', FONT_A, 0xFFFF, 0x0000) == nullptr);
+
+	HOST_CHECK(cache.getHits() == 4);
+	HOST_CHECK(cache.getMisses() == 5);
+	HOST_CHECK(cache.getEvictions() == 2);
+	HOST_CHECK(cache.getHitRate() == 44);
+	cache.clearStats();
+	HOST_CHECK(cache.getHits() == 0 && cache.getMisses() == 0 && cache.getEvictions() == 0 && cache.getHitRate() == 0);
+
+	cache.clear(); // 内容を捨てても、スロットは残る
+	HOST_CHECK(cache.find('C', FONT_A, 0xFFFF, 0x0000) == nullptr);
+	HOST_CHECK(cache.getSlots() == 3);
+	HOST_CHECK(cache.insert('C', FONT_A, 0xFFFF, 0x0000, 8, 16) != nullptr);
+}
+
+/*!
+	@brief  バケットより多いスロットで、ランダムな文字を使い続けても、LRUのモデルと同じものが見つかるか
+	@details
+		スロットがバケットより多いので、どこかのバケットには必ず複数のキーが並ぶ。
+		追い出したエントリをチェーンから正しく外さないと、残っているキーが見つからなくなるか、追い出したキーが見つかる。
+*/
+static void testSharedBuckets(void)
+{
+	const uint16_t u16Slots = GLYPH_CACHE_BUCKETS + GLYPH_CACHE_BUCKETS / 2;
+	GlyphCache cache;
+	HOST_CHECK(cache.init(slotBudget(u16Slots)));
+	HOST_CHECK(cache.getSlots() == u16Slots);
+
+	std::list<uint32_t> model; // 先頭が最も新しい
+	uint32_t u32Seed = 12345;
+	uint32_t u32Hits = 0, u32Misses = 0, u32Evictions = 0;
+	for (int i = 0; i < 20000; i++) {
+		u32Seed = u32Seed * 1103515245u + 12345u;
+		uint32_t code = 0x3000 + (u32Seed >> 16) % (u16Slots * 3);
+		bool isInModel = false;
+		for (auto it = model.begin(); it != model.end(); ++it) {
+			if (*it == code) {
+				model.erase(it);
+				isInModel = true;
+				break;
+			}
+		}
+		const GlyphCacheEntry* pEntry = cache.find(code, FONT_A, 0xFFFF, 0x0000);
+		HOST_CHECK((pEntry != nullptr) == isInModel);
+		if (pEntry != nullptr) {
+			HOST_CHECK(pEntry->code == code);
+			HOST_CHECK(cache.getPixels(pEntry)[0] == (uint16_t)code); // 他のキーにスロットを取られていない
+			u32Hits++;
+		} else {
+			u32Misses++;
+			if (model.size() == u16Slots) {
+				model.pop_back();
+				u32Evictions++;
+			}
+			uint16_t* pPixels = cache.insert(code, FONT_A, 0xFFFF, 0x0000, 16, 16);
+			HOST_CHECK(pPixels != nullptr);
+			if (pPixels != nullptr)
+				pPixels[0] = (uint16_t)code;
+		}
+		model.push_front(code);
+	}
+	HOST_CHECK(u32Evictions > 0);
+	HOST_CHECK(cache.getHits() == u32Hits);
+	HOST_CHECK(cache.getMisses() == u32Misses);
+	HOST_CHECK(cache.getEvictions() == u32Evictions);
+	for (uint32_t code : model) {
+		HOST_CHECK(cache.find(code, FONT_A, 0xFFFF, 0x0000) != nullptr);
+	}
+}
+
+/// @brief スロットに入らない文字はキャッシュせず、他のエントリも追い出さないか
+static void testOversize(void)
+{
+	GlyphCache cache;
+	HOST_CHECK(cache.init(slotBudget(1)));
+	HOST_CHECK(cache.insert('A', FONT_A, 0xFFFF, 0x0000, 16, 16) != nullptr); // ちょうどGLYPH_CACHE_SLOT_PIXELS
+	HOST_CHECK(cache.insert('B', FONT_A, 0xFFFF, 0x0000, 17, 16) == nullptr);
+	HOST_CHECK(cache.insert('C', FONT_A, 0xFFFF, 0x0000, 24, 24) == nullptr);
+	HOST_CHECK(cache.getEvictions() == 0);
+	HOST_CHECK(cache.find('A', FONT_A, 0xFFFF, 0x0000) != nullptr);
+	HOST_CHECK(cache.find('B', FONT_A, 0xFFFF, 0x0000) == nullptr);
+}
+
+/// @brief init(0)ではキャッシュを無効にし（成功扱い）、１スロットに満たない予算は失敗にするか
+static void testInitZero(void)
+{
+	GlyphCache cache;
+	HOST_CHECK(cache.init(slotBudget(2)));
+	HOST_CHECK(cache.insert('A', FONT_A, 0xFFFF, 0x0000, 8, 16) != nullptr);
+
+	HOST_CHECK(cache.init(0));
+	HOST_CHECK(cache.getSlots() == 0);
+	HOST_CHECK(cache.find('A', FONT_A, 0xFFFF, 0x0000) == nullptr); // 前の内容は捨てられる
+	HOST_CHECK(cache.insert('A', FONT_A, 0xFFFF, 0x0000, 8, 16) == nullptr);
+	HOST_CHECK(cache.getMisses() == 0); // 無効の間は数えない
+
+	HOST_CHECK(cache.init(slotBudget(1) - 1) == false);
+	HOST_CHECK(cache.getSlots() == 0);
+	HOST_CHECK(cache.insert('A', FONT_A, 0xFFFF, 0x0000, 8, 16) == nullptr);
+}
+
+int main()
+{
+	testLru();
+	testSharedBuckets();
+	testOversize();
+	testInitZero();
+	return hostTestResult("glyph_cache");
+}
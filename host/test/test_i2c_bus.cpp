@@ -0,0 +1,208 @@
+/*!
+ * @file test_i2c_bus.cpp
+ *
+ * I2CBaseのバス健全性（連続エラーの計数、バス復旧、失敗したときのバックオフ）を、AS3935SimでNACKとバスの固着を起こして確かめる。
+ * 復旧できたら、AS3935::onBusRecovered()で設定レジスタが書き直されることも見る。
+ * トランザクションのトレース（リングバッファの順序と件数）と、レイテンシのヒストグラムのバケットも確かめる。
+ */
+#include "HostTest.h"
+#include "AS3935.h"
+#include "AS3935Sim.h"
+
+#define SIM_ADDR 0x03
+
+/// @brief 決めた時間だけ時刻を進めて成功を返すバス（トレースのレイテンシを決めるため）
+class FixedLatencyBus : public I2CTransport {
+  public:
+	uint32_t latencyUs = 0; ///< 次のトランザクションにかかる時間（us）
+	uint64_t nowUs = 0;     ///< 時刻（us）
+
+	bool init(uint8_t, uint8_t, uint8_t, uint32_t) override { return true; }
+	int write(uint8_t, const uint8_t*, size_t len, bool, uint32_t) override
+	{
+		nowUs += latencyUs;
+		return (int)len;
+	}
+	int read(uint8_t, uint8_t*, size_t len, bool, uint32_t) override
+	{
+		nowUs += latencyUs;
+		return (int)len;
+	}
+	bool recoverBus() override { return true; }
+	uint64_t timeUs() override { return nowUs; }
+	void initIrqPin(uint8_t) override {}
+	uint32_t countIrqPulses(uint8_t, uint16_t) override { return 0; }
+};
+
+/// @brief １バイト読んで、トランザクションを１回起こす
+static int readOne(AS3935& as3935, uint8_t reg)
+{
+	uint8_t u8Val;
+	return as3935.readRegs(reg, &u8Val, 1);
+}
+
+/// @brief NACKを数え、閾値に届くまではバスを正常とみなし、届いたら復旧するか
+static void testNack(AS3935& as3935, AS3935Sim& sim)
+{
+	sim.injectNack(I2C_RECOVERY_THRESHOLD - 1);
+	for (int i = 0; i < I2C_RECOVERY_THRESHOLD - 1; i++) {
+		HOST_CHECK(readOne(as3935, 0x00) == I2C_ERR_GENERIC);
+	}
+	HOST_CHECK(as3935.getNackCount() == I2C_RECOVERY_THRESHOLD - 1);
+	HOST_CHECK(as3935.getConsecutiveErrors() == I2C_RECOVERY_THRESHOLD - 1);
+	HOST_CHECK(as3935.checkBusHealth()); // 閾値未満なら復旧しない
+	HOST_CHECK(as3935.getRecoveryCount() == 0);
+	HOST_CHECK(readOne(as3935, 0x00) == 1);
+	HOST_CHECK(as3935.getConsecutiveErrors() == 0); // 成功で連続エラーは0に戻る
+
+	sim.injectNack(I2C_RECOVERY_THRESHOLD);
+	for (int i = 0; i < I2C_RECOVERY_THRESHOLD; i++) {
+		readOne(as3935, 0x00);
+	}
+	HOST_CHECK(as3935.checkBusHealth());
+	HOST_CHECK(as3935.getRecoveryCount() == 1);
+	HOST_CHECK(as3935.getConsecutiveErrors() == 0);
+}
+
+/// @brief SDAが離れない間はバックオフを倍々に延ばし（上限あり）、離れたら設定を書き直して戻るか
+static void testStuck(AS3935& as3935, AS3935Sim& sim)
+{
+	const uint8_t u8Reg00 = sim.peekReg(0x00);
+	const uint8_t u8Reg01 = sim.peekReg(0x01);
+	const uint8_t u8Reg02 = sim.peekReg(0x02);
+
+	sim.setBusStuck(true);
+	sim.holdSdaLow(true);
+	for (int i = 0; i < I2C_RECOVERY_THRESHOLD; i++) {
+		HOST_CHECK(readOne(as3935, 0x00) == I2C_ERR_TIMEOUT);
+	}
+	HOST_CHECK(as3935.getTimeoutCount() == I2C_RECOVERY_THRESHOLD);
+
+	uint32_t u32WantBackoffMs = I2C_RECOVERY_BACKOFF_MIN_MS;
+	for (uint32_t u32Fail = 1; u32Fail <= 10; u32Fail++) {
+		uint64_t u64TryUs = sim.timeUs();
+		HOST_CHECK(as3935.checkBusHealth() == false);
+		HOST_CHECK(as3935.getRecoveryFailCount() == u32Fail);
+		// 待ち時間の直前までは、復旧を試みずにfalseを返す
+		sim.advanceUs(u64TryUs + (uint64_t)u32WantBackoffMs * 1000 - 1 - sim.timeUs());
+		HOST_CHECK(as3935.checkBusHealth() == false);
+		HOST_CHECK(as3935.getRecoveryFailCount() == u32Fail);
+		sim.advanceUs(1);
+		u32WantBackoffMs = (u32WantBackoffMs * 2 > I2C_RECOVERY_BACKOFF_MAX_MS) ? I2C_RECOVERY_BACKOFF_MAX_MS : u32WantBackoffMs * 2;
+	}
+	HOST_CHECK(u32WantBackoffMs == I2C_RECOVERY_BACKOFF_MAX_MS); // 上限まで届いている
+
+	// 固まっている間に電源が瞬断して、設定レジスタが初期値に戻ったとする
+	const uint8_t defaults[3] = { 0x24, 0x22, 0xC2 };
+	sim.loadRegisters(defaults, 0x0007);
+	sim.holdSdaLow(false);
+	HOST_CHECK(as3935.checkBusHealth());
+	HOST_CHECK(as3935.getRecoveryCount() == 2);
+	HOST_CHECK(sim.peekReg(0x00) == u8Reg00);
+	HOST_CHECK(sim.peekReg(0x01) == u8Reg01);
+	HOST_CHECK(sim.peekReg(0x02) == u8Reg02);
+
+	// 復旧に成功したので、次の失敗の待ち時間は初期値から
+	sim.setBusStuck(true);
+	sim.holdSdaLow(true);
+	for (int i = 0; i < I2C_RECOVERY_THRESHOLD; i++) {
+		readOne(as3935, 0x00);
+	}
+	uint64_t u64TryUs = sim.timeUs();
+	HOST_CHECK(as3935.checkBusHealth() == false);
+	sim.holdSdaLow(false);
+	sim.advanceUs(u64TryUs + (uint64_t)I2C_RECOVERY_BACKOFF_MIN_MS * 1000 - sim.timeUs());
+	HOST_CHECK(as3935.checkBusHealth());
+	HOST_CHECK(as3935.getRecoveryCount() == 3);
+}
+
+/// @brief リングバッファが一周しても、件数はI2C_TRACE_SIZEで止まり、新しい順に読めるか
+static void testTraceWrap(void)
+{
+	FixedLatencyBus bus;
+	I2CBase i2c;
+	i2c.setTransport(&bus);
+	HOST_CHECK(i2c.InitI2C(SIM_ADDR, 0, 4, 5));
+	I2CTraceEntry e;
+
+	i2c.setTraceEnable(false);
+	i2c.writeRegAndData_1(0x00, 0); // 無効の間は記録しない
+	HOST_CHECK(i2c.getTraceCount() == 0);
+	HOST_CHECK(i2c.getTrace(0, e) == false);
+
+	i2c.setTraceEnable(true);
+	const int total = I2C_TRACE_SIZE + 5;
+	for (int i = 0; i < total; i++) {
+		bus.latencyUs = (uint32_t)i;
+		i2c.writeRegAndData_1((uint8_t)i, 0);
+		if (i == I2C_TRACE_SIZE / 2 - 1) {
+			HOST_CHECK(i2c.getTraceCount() == I2C_TRACE_SIZE / 2); // 一周するまでは記録した数
+		}
+	}
+	HOST_CHECK(i2c.getTraceCount() == I2C_TRACE_SIZE);
+	for (int idx = 0; idx < I2C_TRACE_SIZE; idx++) {
+		HOST_CHECK(i2c.getTrace(idx, e));
+		int i = total - 1 - idx; // 0が最新
+		HOST_CHECK(e.reg == (uint8_t)i);
+		HOST_CHECK(e.op == I2C_OP_WRITE);
+		HOST_CHECK(e.len == 2);
+		HOST_CHECK(e.result == 2);
+		HOST_CHECK(e.endUs - e.startUs == (uint32_t)i);
+	}
+	HOST_CHECK(i2c.getTrace(I2C_TRACE_SIZE, e) == false);
+	HOST_CHECK(i2c.getTrace(-1, e) == false);
+
+	i2c.clearTrace();
+	HOST_CHECK(i2c.getTraceCount() == 0);
+	HOST_CHECK(i2c.getHistogram(I2C_OP_WRITE, 0) == 0);
+}
+
+/// @brief 所要時間が 2^(b-1) <= us < 2^b のバケットbに入るか（0usはバケット0、大きすぎるものは最後のバケット）
+static void testHistogram(void)
+{
+	FixedLatencyBus bus;
+	I2CBase i2c;
+	i2c.setTransport(&bus);
+	HOST_CHECK(i2c.InitI2C(SIM_ADDR, 0, 4, 5));
+
+	static const struct {
+		uint32_t us;
+		int bucket;
+	} cases[] = {
+		{ 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 2 }, { 4, 3 }, { 7, 3 }, { 8, 4 }, { 1000, 10 }, { 1023, 10 }, { 1024, 11 },
+		{ 1u << (I2C_HIST_BUCKETS - 2), I2C_HIST_BUCKETS - 1 }, { 1u << 20, I2C_HIST_BUCKETS - 1 },
+	};
+	for (const auto& c : cases) {
+		i2c.clearTrace();
+		bus.latencyUs = c.us;
+		uint8_t u8Val;
+		i2c.readBlocking(&u8Val, 1, false);
+		for (int b = 0; b < I2C_HIST_BUCKETS; b++) {
+			HOST_CHECK(i2c.getHistogram(I2C_OP_READ, b) == ((b == c.bucket) ? 1u : 0u));
+			HOST_CHECK(i2c.getHistogram(I2C_OP_WRITE, b) == 0); // 種別ごとに分けて数える
+		}
+	}
+}
+
+int main()
+{
+	AS3935Sim sim(SIM_ADDR);
+	AS3935 as3935;
+	AS3935Config config;
+	config.gainBoost = AFE_GB_OUTDOOR;
+	config.noiseFloor = NFLEV_5;
+	config.watchDogThreshold = 3;
+	config.minimumEvent = 2;
+	config.spikeReject = 4;
+	as3935.setConfig(config);
+	as3935.setTransport(&sim);
+	HOST_CHECK(as3935.Init(SIM_ADDR, 0, 4, 5, 2));
+	as3935.StartCalibration(100);
+	as3935.clearBusCounters();
+
+	testNack(as3935, sim);
+	testStuck(as3935, sim);
+	testTraceWrap();
+	testHistogram();
+	return hostTestResult("i2c_bus");
+}
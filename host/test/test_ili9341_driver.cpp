@@ -0,0 +1,300 @@
+/*!
+ * @file test_ili9341_driver.cpp
+ *
+ * 実際のAdafruit_ILI9341/Adafruit_SPITFTを、ホストのバス（host/stub）でIli9341Emulatorにつないで描き、
+ * 液晶の画面がGFXcanvas16に同じ描画をしたものと一致するか、無駄な送信が無いかを確かめる。
+ */
+#include "HostTest.h"
+#include "Adafruit_ILI9341.h"
+#include "Ili9341Emulator.h"
+#include "TftDisplayList.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define TFT_DC 20  ///< AS3935APPと同じピン
+#define TFT_RST 21
+#define TFT_CS 22
+
+static Ili9341Emulator emu;
+static uint16_t panel[ILI9341_EMU_WIDTH * ILI9341_EMU_HEIGHT];
+
+/// @brief 液晶の画面とキャンバスのバッファ（回転前の並び）が一致するか
+static bool samePanel(GFXcanvas16& ref)
+{
+	emu.getPanel(panel);
+	return hostComparePixels(panel, ref.getBuffer(), ILI9341_EMU_WIDTH, ILI9341_EMU_HEIGHT);
+}
+
+/// @brief 初期化のコマンドが届き、MADCTLが回転0の値になっている（RSTのピンがあるのでSWRESETは送らない）
+static void testBegin(Adafruit_ILI9341& tft)
+{
+	const Ili9341EmuStats& st = emu.getStats();
+	HOST_CHECK(st.commandCount[ILI9341_SLPOUT] == 1);
+	HOST_CHECK(st.commandCount[ILI9341_DISPON] == 1);
+	HOST_CHECK(st.commandCount[ILI9341_MADCTL] >= 1);
+	HOST_CHECK(tft.readcommand8(ILI9341_RDMADCTL) == 0x48);
+}
+
+/// @brief 基本の描画が、キャンバスと同じ画面になる（回転ごと）
+static void testPrimitives(Adafruit_ILI9341& tft)
+{
+	static uint16_t bitmap[40 * 30];
+	for (int i = 0; i < 40 * 30; i++) bitmap[i] = (uint16_t)(i * 37);
+	for (uint8_t r = 0; r < 4; r++) {
+		GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+		Adafruit_GFX* targets[2] = {&tft, &ref};
+		for (Adafruit_GFX* g : targets) {
+			g->setRotation(r);
+			g->fillScreen(0x18E3);
+			g->fillRect(10, 12, 100, 50, ILI9341_RED);
+			g->drawFastHLine(0, 100, 300, ILI9341_GREEN);
+			g->drawFastVLine(5, 0, 400, ILI9341_BLUE);
+			g->drawPixel(200, 30, ILI9341_WHITE);
+			g->drawLine(0, 0, 150, 180, ILI9341_YELLOW);
+			g->fillCircle(120, 150, 40, ILI9341_CYAN);
+			g->fillRoundRect(30, 200, 120, 60, 12, ILI9341_MAGENTA);
+			g->fillTriangle(160, 10, 230, 90, 140, 120, ILI9341_ORANGE);
+			g->drawRGBBitmap(60, 120, bitmap, 40, 30); // DMAで送る大きさ
+			g->drawRGBBitmap(-10, 240, bitmap, 40, 30);
+			g->setCursor(4, 70);
+			g->setTextColor(ILI9341_WHITE, ILI9341_BLACK);
+			g->setTextSize(2);
+			g->print("ILI9341 host");
+		}
+		HOST_CHECK(samePanel(ref));
+	}
+	tft.setRotation(0);
+}
+
+/// @brief 区間で表したスプライトを、DMAで送る長さの区間を含めて描く
+static void testSpanSprite(Adafruit_ILI9341& tft)
+{
+	static const SpriteSpan spans[] = {{0, 0, 40}, {1, 2, 36}, {1, 50, 10}, {2, 0, 60}, {3, 20, 3}};
+	static uint16_t pixels[40 + 36 + 10 + 60 + 3];
+	for (unsigned i = 0; i < sizeof(pixels) / sizeof(pixels[0]); i++) pixels[i] = (uint16_t)(0x1234 + i * 91);
+	static const SpanSprite sprite = {60, 4, 5, spans, pixels};
+	GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	Adafruit_GFX* targets[2] = {&tft, &ref};
+	for (Adafruit_GFX* g : targets) {
+		g->fillScreen(ILI9341_BLACK);
+		g->drawSpanSprite(30, 40, sprite);
+		g->drawSpanSprite(-25, 100, sprite); // 左で切れる
+		g->drawSpanSprite(200, 318, sprite); // 右と下で切れる
+	}
+	HOST_CHECK(samePanel(ref));
+}
+
+/// @brief 画面全体の塗りつぶしは１つのウインドウで、無駄なバイトが無い
+static void testFillCost(Adafruit_ILI9341& tft)
+{
+	tft.fillScreen(ILI9341_BLACK);
+	emu.clearStats();
+	tft.fillScreen(ILI9341_NAVY);
+	const Ili9341EmuStats& st = emu.getStats();
+	HOST_CHECK(st.pixels == ILI9341_TFTWIDTH * ILI9341_TFTHEIGHT);
+	HOST_CHECK(st.pixelBytes == st.pixels * 2);
+	HOST_CHECK(st.commandCount[ILI9341_RAMWR] == 1);
+	HOST_CHECK(st.wrappedPixels == 0);
+	HOST_CHECK(st.wastedBytes == 0);
+
+	// 同じ列の範囲が続くときはCASETを送り直さない
+	emu.clearStats();
+	tft.fillRect(20, 20, 50, 10, ILI9341_RED);
+	tft.fillRect(20, 40, 50, 10, ILI9341_RED);
+	HOST_CHECK(st.redundantCaset == 0);
+	HOST_CHECK(st.redundantPaset == 0);
+	HOST_CHECK(st.emptyRamwr == 0);
+	HOST_CHECK(st.oddBytes == 0);
+}
+
+/// @brief 描画命令リストは、PIOが無ければSPIで同じ画面を描く。リストのブロックをそのままstream()に渡しても同じになる
+static void testDisplayList(Adafruit_ILI9341& tft)
+{
+	static uint16_t pixels[32 * 8];
+	for (int i = 0; i < 32 * 8; i++) pixels[i] = (uint16_t)(0xF800 | i);
+	static TftDisplayList list;
+	list.clear();
+	HOST_CHECK(list.fillRect(10, 10, 100, 40, ILI9341_DARKGREEN)); // 読み出しアドレスを進めないブロック
+	HOST_CHECK(list.bitmap(40, 60, 32, 8, pixels));
+	HOST_CHECK(list.fillRect(0, 300, 240, 20, ILI9341_PURPLE));
+
+	tft.fillScreen(ILI9341_BLACK);
+	tft.submitList(list);
+	emu.getPanel(panel);
+	static uint16_t viaSpi[ILI9341_EMU_WIDTH * ILI9341_EMU_HEIGHT];
+	memcpy(viaSpi, panel, sizeof(viaSpi));
+
+	GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	ref.fillScreen(ILI9341_BLACK);
+	ref.fillRect(10, 10, 100, 40, ILI9341_DARKGREEN);
+	ref.drawRGBBitmap(40, 60, pixels, 32, 8);
+	ref.fillRect(0, 300, 240, 20, ILI9341_PURPLE);
+	HOST_CHECK(hostComparePixels(viaSpi, ref.getBuffer(), ILI9341_EMU_WIDTH, ILI9341_EMU_HEIGHT));
+
+	static Ili9341Emulator streamEmu; // GRAMは0（黒）から
+	streamEmu.command(ILI9341_MADCTL);
+	uint8_t madctl = 0x48;
+	streamEmu.data(&madctl, 1);
+	const TftListBlock* pBlocks = list.getBlocks();
+	for (uint16_t i = 0; i < list.getBlockCount(); i++) {
+		streamEmu.stream((const uint16_t*)pBlocks[i].readAddr, pBlocks[i].count, TftDisplayList::isIncrement(pBlocks[i]));
+	}
+	streamEmu.getPanel(panel);
+	HOST_CHECK(hostComparePixels(panel, ref.getBuffer(), ILI9341_EMU_WIDTH, ILI9341_EMU_HEIGHT));
+}
+
+/*!
+	@brief  パレットのビットマップ（1/2/4/8bpp）とRGB332の画像を、左右と上で切れる位置を含めて描き、
+			１ピクセルずつ描くAdafruit_GFXの版と同じ画面になるか
+	@details
+		幅はバイトの区切りに揃えないので、左で切れるとバイトの途中から、右で切れるとバイトの途中までを展開する。
+*/
+static void testIndexedBitmap(Adafruit_ILI9341& tft)
+{
+	static const int16_t W = 37;
+	static const int16_t H = 5;
+	static const int16_t xs[] = {13, -5, -1, ILI9341_TFTWIDTH - 30, -3};
+	static const int16_t ys[] = {7, 40, 80, 120, -2};
+	static uint8_t bitmap[W * H]; // 8bppでも足りる大きさ
+	static uint16_t palette[256];
+	uint32_t u32Seed = 1;
+	for (unsigned i = 0; i < sizeof(bitmap); i++) {
+		u32Seed = u32Seed * 1103515245u + 12345u;
+		bitmap[i] = (uint8_t)(u32Seed >> 16);
+	}
+	for (int i = 0; i < 256; i++)
+		palette[i] = (uint16_t)(i * 0x0123 + 0x0841);
+
+	static const uint8_t bpps[] = {1, 2, 4, 8};
+	for (uint8_t bpp : bpps) {
+		GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+		Adafruit_GFX* targets[2] = {&tft, &ref};
+		for (Adafruit_GFX* g : targets) {
+			g->fillScreen(ILI9341_BLACK);
+			for (unsigned k = 0; k < sizeof(xs) / sizeof(xs[0]); k++) {
+				g->drawIndexedBitmap(xs[k], ys[k], bitmap, palette, bpp, W, H);
+			}
+			g->drawIndexedBitmap(-2, 200, bitmap, palette, bpp, 6, 2); // 切った残りが１バイトの中に収まる
+		}
+		bool isSame = samePanel(ref);
+		HOST_CHECK(isSame);
+		if (isSame == false)
+			fprintf(stderr, "  indexed bitmap %dbpp\n", bpp);
+	}
+
+	// drawRGBBitmap(uint8_t*)はAdafruit_GFXでは仮想関数ではないので、それぞれの型で呼ぶ
+	GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	tft.fillScreen(ILI9341_BLACK);
+	ref.fillScreen(ILI9341_BLACK);
+	for (unsigned k = 0; k < sizeof(xs) / sizeof(xs[0]); k++) {
+		tft.drawRGBBitmap(xs[k], ys[k], bitmap, W, H);
+		ref.drawRGBBitmap(xs[k], ys[k], bitmap, W, H);
+	}
+	HOST_CHECK(samePanel(ref));
+}
+
+/// @brief 完了を待たないDMAのすぐあとにコマンドを送っても、ピクセルはDCを下げる前に送り終わり、トランザクションも閉じない
+static void testDmaBeforeCommand(Adafruit_ILI9341& tft)
+{
+	static uint16_t pixels[64];
+	for (int i = 0; i < 64; i++) pixels[i] = (uint16_t)(0x0841 * (i & 31));
+	tft.fillScreen(ILI9341_BLACK);
+	emu.clearStats();
+	tft.startWrite();
+	tft.setAddrWindow(0, 0, 64, 1);
+	tft.writePixels(pixels, 64, false); // DMAで送り始めて戻る
+	tft.setAddrWindow(8, 10, 64, 1);     // CASETのDCが、送信中のピクセルより先に下がってはいけない
+	tft.writePixels(pixels, 64, true);
+	tft.endWrite();
+	const Ili9341EmuStats& st = emu.getStats();
+	HOST_CHECK(st.transactions == 1);
+	HOST_CHECK(st.commandCount[ILI9341_CASET] == 2);
+	HOST_CHECK(st.pixels == 128);
+	GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	ref.drawRGBBitmap(0, 0, pixels, 64, 1);
+	ref.drawRGBBitmap(8, 10, pixels, 64, 1);
+	HOST_CHECK(samePanel(ref));
+
+	// drawRGBBitmap()が非同期で開けたままのトランザクションの中でコマンドを送っても、CSは上がらない
+	static uint16_t image[32 * 4];
+	memset(image, 0xFF, sizeof(image));
+	emu.clearStats();
+	tft.drawRGBBitmap(100, 100, image, 32, 4);
+	tft.writeCommand(ILI9341_NOP);
+	tft.endWrite();
+	HOST_CHECK(st.commandCount[ILI9341_NOP] == 1);
+	HOST_CHECK(st.transactions == 1);
+
+	// drawDMABitmap()の画面全体のDMAも同じ。完了を待たずにコマンドを送っても、画面は１回のRAMWRで描き終わっている
+	static uint16_t frame[ILI9341_TFTWIDTH * ILI9341_TFTHEIGHT];
+	for (int i = 0; i < ILI9341_TFTWIDTH * ILI9341_TFTHEIGHT; i++) frame[i] = (uint16_t)(i * 7 + (i >> 8));
+	tft.fillScreen(ILI9341_BLACK);
+	emu.clearStats();
+	tft.drawDMABitmap(frame);
+	tft.writeCommand(ILI9341_NOP);
+	tft.endWrite();
+	HOST_CHECK(st.commandCount[ILI9341_RAMWR] == 1);
+	HOST_CHECK(st.commandCount[ILI9341_NOP] == 1);
+	HOST_CHECK(st.pixels == ILI9341_TFTWIDTH * ILI9341_TFTHEIGHT);
+	HOST_CHECK(st.wrappedPixels == 0);
+	HOST_CHECK(st.transactions == 1);
+	GFXcanvas16 frameRef(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	frameRef.drawRGBBitmap(0, 0, frame, ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	HOST_CHECK(samePanel(frameRef));
+}
+
+/// @brief reset()で、前の書き込みの「先頭に戻った」状態が残らない
+static void testReset(void)
+{
+	static Ili9341Emulator e;
+	uint8_t win[4] = {0, 0, 0, 1};
+	e.command(ILI9341_CASET);
+	e.data(win, 4);
+	e.command(ILI9341_PASET);
+	e.data(win, 4);
+	e.command(ILI9341_RAMWR);
+	uint8_t px[2 * 5] = {0};
+	e.data(px, sizeof(px)); // 4ピクセルのウインドウに５ピクセル
+	HOST_CHECK(e.getStats().wrappedPixels == 1);
+	e.reset();
+	e.command(0x3C); // RAMWRC：前の書き込みの続き。reset()で先頭に戻った印が消えていなければ上書きとして数える
+	e.data(px, 2);
+	HOST_CHECK(e.getStats().pixels == 1);
+	HOST_CHECK(e.getStats().wrappedPixels == 0);
+}
+
+/// @brief GRAMの読み出し（RAMRD）で、描いた矩形が読み戻せる
+static void testReadRect(Adafruit_ILI9341& tft)
+{
+	for (uint8_t r = 0; r < 4; r++) {
+		tft.setRotation(r);
+		tft.fillScreen(ILI9341_BLACK);
+		tft.fillRect(10, 20, 30, 12, ILI9341_ORANGE);
+		tft.drawPixel(11, 21, ILI9341_WHITE);
+		static uint16_t buf[30 * 12];
+		HOST_CHECK(tft.readRect(10, 20, 30, 12, buf));
+		HOST_CHECK(buf[0] == ILI9341_ORANGE);
+		HOST_CHECK(buf[1 + 30] == ILI9341_WHITE);
+		HOST_CHECK(buf[30 * 12 - 1] == ILI9341_ORANGE);
+	}
+	tft.setRotation(0);
+}
+
+int main()
+{
+	static Adafruit_ILI9341 tft(&SPI, TFT_DC, TFT_CS, TFT_RST);
+	tft.attachHostSink(&emu);
+	tft.begin();
+	testBegin(tft);
+	testPrimitives(tft);
+	testSpanSprite(tft);
+	testFillCost(tft);
+	testDisplayList(tft);
+	testIndexedBitmap(tft);
+	testDmaBeforeCommand(tft);
+	testReset();
+	testReadRect(tft);
+	emu.dumpStats(hostPrintf);
+	return hostTestResult("ili9341_driver");
+}
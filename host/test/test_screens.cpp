@@ -0,0 +1,335 @@
+/*!
+ * @file test_screens.cpp
+ *
+ * 時計・画面キーボード・ダイアログ・設定メニュー・メイン画面を描き、保存したPNG（host/data/golden/）と同じかを確かめる。
+ * あわせて、画面ごとに液晶に送るバイト数（コマンドと引数とピクセル）が上限を超えないかを確かめる。
+ * 保存したPNGのディレクトリはHOST_GOLDEN_DIR（CMakeで渡す）。
+ * メイン画面以外はTftFramebufferに描き、送るバイト数はTftFramebufferの見積もりを使う。
+ * メイン画面はハードウェアスクロールと描画命令リストを使うので、実際のドライバをIli9341Emulatorにつないで描く。
+ *
+ * タッチを待つ画面は、ScriptedTouchのフックで画面を確かめてから、次のタップを返す。
+ * 画面が違うときは <名前>.actual.png をカレントディレクトリに書き出す。
+ * HOST_UPDATE_GOLDEN=1 で実行すると、比べる代わりに保存したPNGを描き直す（上限は確かめる）。
+ */
+#include <stdlib.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include "HostTest.h"
+#include "Settings.h"
+#include "TftFramebuffer.h"
+#include "Adafruit_ILI9341.h"
+#include "Ili9341Emulator.h"
+#include "DispClock.h"
+#include "ScreenKeyboard.h"
+#include "GUIMsgBox.h"
+#include "MainScreen.h"
+#include "AS3935Sim.h"
+#include "ScriptedTouch.h"
+#include "KanjiHelper.h"
+#include "Kanji/Fonts/JF-Dot-Shinonome16_16x16_LEVEL1.inc"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define START_TIME 1751809512 ///< 2025/07/06 13:45:12（UTC）
+#define KB_TOP (ILI9341_TFTHEIGHT - ScreenKeyboard::KB_HEIGHT) ///< キーボードの上端
+#define NO_TAP -1 ///< タップしない
+
+Settings settings; // メイン画面とダイアログのdbgprintfが参照する
+
+static time_t fakeNow = START_TIME;
+static bool isUpdate = false;
+static TftFramebuffer fb;
+static XPT2046_Touchscreen ts(17); // AS3935APPと同じCSピン（ScriptedTouchは使わない）
+
+/// @brief 画面の時計とイベントの時刻（-Wl,--wrap=time）
+extern "C" time_t __wrap_time(time_t* t)
+{
+	if (t != nullptr) *t = fakeNow;
+	return fakeNow;
+}
+
+/*!
+	@brief  画面を保存したPNGと比べ、送ったバイト数を上限と比べる
+	@param  a_screen  比べる画面
+	@param  a_pName  PNGの名前（nullptrなら画面は比べない）
+	@param  a_u32Bytes  送ったバイト数
+	@param  a_u32Budget  バイト数の上限
+	@return 同じ画面で、上限を超えていなければtrue
+*/
+static bool checkScreen(const TftFramebuffer& a_screen, const char* a_pName, uint32_t a_u32Bytes, uint32_t a_u32Budget)
+{
+	const char* pName = (a_pName != nullptr) ? a_pName : "(unchecked)";
+	printf("  %-24s %7lu bytes (budget %lu)\n", pName, (unsigned long)a_u32Bytes, (unsigned long)a_u32Budget);
+	bool bRet = true;
+	if (a_u32Bytes > a_u32Budget) {
+		fprintf(stderr, "  %s: %lu bytes over the budget %lu\n", pName, (unsigned long)a_u32Bytes, (unsigned long)a_u32Budget);
+		bRet = false;
+	}
+	if (a_pName == nullptr) return bRet;
+
+	std::vector<uint8_t> png;
+	if (a_screen.encodePNG(png) == false) return false;
+	std::string path = std::string(HOST_GOLDEN_DIR) + "/" + a_pName + ".png";
+	if (isUpdate) {
+		return a_screen.savePNG(path.c_str()) && bRet;
+	}
+	std::vector<uint8_t> golden;
+	FILE* fp = fopen(path.c_str(), "rb");
+	if (fp != nullptr) {
+		uint8_t buf[4096];
+		size_t n;
+		while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) golden.insert(golden.end(), buf, buf + n);
+		fclose(fp);
+	}
+	if (golden != png) {
+		std::string actual = std::string(a_pName) + ".actual.png";
+		a_screen.savePNG(actual.c_str());
+		fprintf(stderr, "  %s: screen differs from %s (wrote %s)\n", a_pName, path.c_str(), actual.c_str());
+		bRet = false;
+	}
+	return bRet;
+}
+
+/// @brief TftFramebufferに描いた画面を確かめ、見積もりを消す
+static bool checkFramebuffer(const char* a_pName, uint32_t a_u32Budget)
+{
+	TftProfileCounters cost;
+	fb.getCost(cost);
+	fb.resetCost();
+	return checkScreen(fb, a_pName, cost.commandBytes + cost.pixelBytes, a_u32Budget);
+}
+
+/// タッチを待つ画面の１手
+struct ScreenStep {
+	const char* pName; ///< 確かめるPNGの名前（nullptrなら画面は比べない）
+	uint32_t budget;   ///< 前の手からここまでに送るバイト数の上限
+	int16_t tapX;      ///< 次にタップする位置（NO_TAPならタップしない）
+	int16_t tapY;
+};
+
+static const ScreenStep* pSteps = nullptr;
+static size_t stepCount = 0;
+static size_t stepIndex = 0;
+
+/// @brief タッチを待っている画面を確かめて、次のタップを返す
+static bool stepHook(TS_Point& a_tap)
+{
+	if (stepIndex >= stepCount) {
+		panic("screen script ended while the screen waits for a touch");
+	}
+	const ScreenStep& s = pSteps[stepIndex++];
+	HOST_CHECK(checkFramebuffer(s.pName, s.budget));
+	if (s.tapX == NO_TAP) return false;
+	a_tap = TS_Point(s.tapX, s.tapY, 0);
+	return true;
+}
+
+/// @brief タッチを待つ画面の手順を始める
+template <size_t N>
+static void beginSteps(const ScreenStep (&a_steps)[N])
+{
+	pSteps = a_steps;
+	stepCount = N;
+	stepIndex = 0;
+	fb.resetCost();
+	scriptedTouchSetHook(stepHook);
+}
+
+/// @brief 手順を最後まで使ったか
+static void endSteps(void)
+{
+	HOST_CHECK(stepIndex == stepCount);
+	scriptedTouchSetHook(nullptr);
+}
+
+/// @brief 時計（24時間表示の全体と秒だけの更新、12時間表示）
+static void testClock(void)
+{
+	DispClock::setList(nullptr, nullptr);
+	fb.fillScreen(STDCOLOR.SUPERDARK_GRAY);
+	DispClock::init(&fb, true);
+	DispClock::setRedrawFlag();
+	fb.resetCost();
+	DispClock::show(32, 30);
+	HOST_CHECK(checkFramebuffer("clock_24h", 14944));
+	fakeNow++;
+	DispClock::show(32, 30); // 秒だけ描き直す
+	HOST_CHECK(checkFramebuffer("clock_24h_tick", 1856));
+
+	fakeNow = START_TIME;
+	fb.fillScreen(STDCOLOR.SUPERDARK_GRAY);
+	DispClock::init(&fb, false);
+	DispClock::setRedrawFlag();
+	fb.resetCost();
+	DispClock::show(32, 30);
+	HOST_CHECK(checkFramebuffer("clock_12h", 13488));
+}
+
+/// @brief 画面キーボード（３種類とテンキー）
+static void testKeyboard(void)
+{
+	static const struct {
+		ScreenKeyboard::KBType type;
+		const char* pName;
+	} kbs[] = {
+		{ScreenKeyboard::KB0, "keyboard_kb0"},
+		{ScreenKeyboard::KB1, "keyboard_kb1"},
+		{ScreenKeyboard::KB2, "keyboard_kb2"},
+	};
+	ScreenKeyboard sk(&fb, &ts);
+	for (const auto& kb : kbs) {
+		fb.fillScreen(STDCOLOR.BLACK);
+		fb.resetCost();
+		sk.setKBType(kb.type);
+		sk.show(KB_TOP);
+		HOST_CHECK(checkFramebuffer(kb.pName, 45616));
+	}
+	fb.fillScreen(STDCOLOR.BLACK);
+	fb.resetCost();
+	sk.showNumPad(KB_TOP);
+	HOST_CHECK(checkFramebuffer("keyboard_numpad", 18256));
+}
+
+/// @brief ダイアログを描いて閉じたとき、下の画面が元に戻り、ダイアログの矩形だけを送ったか
+static void checkDialogClosed(const GUIMsgBox& a_box, const std::vector<uint16_t>& a_under)
+{
+	HOST_CHECK(a_box.isRestored());
+	HOST_CHECK(hostComparePixels(fb.getBuffer(), a_under.data(), TFT_FRAMEBUFFER_WIDTH, TFT_FRAMEBUFFER_HEIGHT));
+	TftProfileCounters cost;
+	fb.getCost(cost);
+	HOST_CHECK(cost.windows == 1);
+	HOST_CHECK(cost.pixelBytes == 180 * 126 * 2);
+}
+
+/// @brief OKのダイアログとOK/Cancelのダイアログ
+static void testMsgBox(void)
+{
+	fb.fillScreen(STDCOLOR.BLACK);
+	for (int16_t i = 0; i < 8; i++) {
+		fb.fillRect(i * 30, 0, 30, 320, (i & 1) ? STDCOLOR.DARK_BLUE : STDCOLOR.DARK_GRAY); // 書き戻した位置のずれが分かる縞
+	}
+	fb.setCursor(0, 120);
+	fb.setTextColor(STDCOLOR.WHITE, STDCOLOR.BLACK);
+	fb.printf("ダイアログの下の文字");
+	std::vector<uint16_t> under(fb.getBuffer(), fb.getBuffer() + TFT_FRAMEBUFFER_WIDTH * TFT_FRAMEBUFFER_HEIGHT);
+
+	GUIMsgBox box(&fb, &ts);
+	static const ScreenStep okSteps[] = {
+		{"msgbox_ok", 60144, 120, 210}, // OK
+	};
+	beginSteps(okSteps);
+	box.showOK(30, 100, "確認", "設定を保存しました\n再起動します", "OK");
+	endSteps();
+	checkDialogClosed(box, under);
+
+	static const ScreenStep cancelSteps[] = {
+		{"msgbox_okcancel", 67552, 150, 208}, // 中断
+	};
+	beginSteps(cancelSteps);
+	HOST_CHECK(box.showOKCancel(30, 100, "確認", "設定を反映するには\n再起動が必要です", "再起動", " 中断 ") == false);
+	endSteps();
+	checkDialogClosed(box, under);
+}
+
+/// @brief 設定メニュー（ルートから各メニューとキーボード・テンキー・タッチパネルの調整・再起動の確認を開いて閉じる）
+static void testSettingsMenu(void)
+{
+	// メニューから戻ったときのルートの上限には、閉じたメニューが画面を消す分（fillScreen）も入る
+	static const ScreenStep steps[] = {
+		{"settings_root", 252640, 60, 40},            // システム設定
+		{"settings_system", 248544, 175, 304},        // キャンセル
+		{"settings_root", 406240, 60, 72},            // AS3935設定
+		{"settings_as3935", 258768, 40, 80},          // ゲインブースト
+		{"settings_as3935_numpad", 18256, 84, 237},   // ESC
+		{"settings_as3935", 21664, 175, 304},         // テンキーの下を書き戻した。キャンセル
+		{"settings_root", 406240, 60, 104},           // ネットワーク設定
+		{"settings_wifi", 248528, 60, 80},            // SSID
+		{"settings_wifi_kb1", 45616, 204, 309},       // キーボードの切り替え
+		{"settings_wifi_kb2", 45920, 204, 309},       // キーボードの切り替え
+		{"settings_wifi_kb0", 45920, 204, 309},       // キーボードの切り替え
+		{nullptr, 45920, 204, 309},                   // キーボードの切り替え
+		{nullptr, 45920, 156, 309},                   // ESC
+		{"settings_wifi", 45952, 40, 304},            // キーボードの下を書き戻した。設定
+		{"settings_root", 406240, 60, 136},           // タッチパネルの調整
+		{"touch_calibration", 256672, 120, 300},      // 終了
+		{"settings_root", 407616, 40, 304},           // 設定（再起動の確認が出る）
+		{"settings_reboot", 67552, 150, 208},         // 中断
+		{"settings_root", 45376, 175, 304},           // ダイアログの下を書き戻した。キャンセル
+	};
+	beginSteps(steps);
+	HOST_CHECK(settings.run2(&fb, &ts) == false);
+	endSteps();
+
+	static const ScreenStep legacySteps[] = {
+		{"settings_legacy", 255984, 175, 304}, // キャンセル
+	};
+	beginSteps(legacySteps);
+	settings.run(&fb, &ts);
+	endSteps();
+}
+
+/// @brief メイン画面（最初の表示と、イベントが増えたときの差分）
+static void testMainScreen(void)
+{
+	static Ili9341Emulator emu;
+	static Adafruit_ILI9341 tft(&SPI, 20, 22, 21);
+	tft.attachHostSink(&emu);
+	tft.begin();
+	tft.setFont(JFDotShinonome16_16x16_LEVEL1, JFDotShinonome16_16x16_LEVEL1_bitmap);
+	mainScreenInit(tft, JFDotShinonome16_16x16_LEVEL1, JFDotShinonome16_16x16_LEVEL1_bitmap);
+	DispClock::init(&tft, true);
+	DispClock::setRedrawFlag();
+
+	AS3935Sim sim(0x03);
+	AS3935 as3935;
+	as3935.setTransport(&sim);
+	HOST_CHECK(as3935.Init(0x03, 0, 4, 5, 2));
+
+	struct MainStep {
+		const char* pName;
+		uint32_t budget;
+		uint8_t u8Dist; ///< 雷の距離（0なら妨害波）
+	};
+	static const MainStep steps[] = {
+		{"main_empty", 268160, 0},
+		{"main_event1", 24480, 12},
+		{"main_event2", 16128, 0},
+		{"main_event3", 19264, 40},
+	};
+	fakeNow = START_TIME;
+	for (const MainStep& s : steps) {
+		bool isSignal = (&s != &steps[0]);
+		if (isSignal) {
+			fakeNow += 61; // 時計の分も変わる
+			if (s.u8Dist != 0) {
+				HOST_CHECK(sim.injectLightning(s.u8Dist, 0x12345));
+			} else {
+				HOST_CHECK(sim.injectDisturber());
+			}
+			irqTimeUs = sim.timeUs();
+		}
+		emu.clearStats();
+		mainDisplay(tft, as3935, isSignal, !isSignal, true, true);
+		emu.getPanel(fb.getBuffer());
+		const Ili9341EmuStats& st = emu.getStats();
+		HOST_CHECK(checkScreen(fb, s.pName, st.commandBytes + st.paramBytes + st.pixelBytes, s.budget));
+		sim.advanceUs(2000000);
+	}
+}
+
+int main()
+{
+	isUpdate = (getenv("HOST_UPDATE_GOLDEN") != nullptr);
+	setenv("TZ", "UTC", 1);
+	tzset();
+	fb.setFont(JFDotShinonome16_16x16_LEVEL1, JFDotShinonome16_16x16_LEVEL1_bitmap);
+
+	testClock();
+	testKeyboard();
+	testMsgBox();
+	testSettingsMenu();
+	testMainScreen();
+	return hostTestResult(isUpdate ? "screens (golden updated)" : "screens");
+}
@@ -0,0 +1,119 @@
+/*!
+ * @file test_scroll_list.cpp
+ *
+ * ScrollListでイベント履歴を１行ずらしたときに、縦スクロールの開始位置（VSCRSADD）が新しい行のピクセルより後に届くかを確かめる。
+ * 先に画面が動くと、一番古い行の内容が先頭に一瞬見える。描画命令リストを使う場合と、直接送る場合の両方を確かめる。
+ */
+#include "HostTest.h"
+#include "Adafruit_ILI9341.h"
+#include "Ili9341Emulator.h"
+#include "TftDisplayList.h"
+#include "TileCompositor.h"
+#include "ScrollList.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define LIST_TOP 150 ///< AS3935APPのイベント履歴と同じ位置
+#define LIST_ROWS 8
+
+/// @brief エミュレータに渡しながら、最後のRAMWRとVSCRSADDが何番目のコマンドだったかを覚える
+class OrderSink : public TftHostSink {
+  public:
+	Ili9341Emulator emu;
+	uint32_t count = 0;     ///< 受け取ったコマンドの数
+	uint32_t lastRamwr = 0; ///< 最後のRAMWRの番号（1から）
+	uint32_t lastScroll = 0; ///< 最後のVSCRSADDの番号（1から）
+
+	void command(uint8_t cmd) override
+	{
+		count++;
+		if (cmd == ILI9341_RAMWR)
+			lastRamwr = count;
+		if (cmd == ILI9341_VSCRSADD)
+			lastScroll = count;
+		emu.command(cmd);
+	}
+	void data(const uint8_t* p, uint32_t len) override { emu.data(p, len); }
+	uint8_t read(void) override { return emu.read(); }
+	void endTransaction(void) override { emu.endTransaction(); }
+	void clearOrder(void) { count = lastRamwr = lastScroll = 0; }
+};
+
+static OrderSink sink;
+static Adafruit_ILI9341 tft(&SPI, 20, 22, 21);
+static TileCompositor compositor;
+static ScrollList rows;
+static TftDisplayList frameList;
+static uint16_t panel[ILI9341_EMU_WIDTH * ILI9341_EMU_HEIGHT];
+
+/// @brief 印の位置（色ごとに変える）
+static int16_t markX(uint16_t a_color) { return (a_color % 29) * 8; }
+
+/// @brief 論理行を、色と、色ごとの位置の印で描く
+static void drawRow(uint8_t a_u8Row, uint16_t a_color)
+{
+	GFXcanvas16* pStrip = rows.beginRow(a_u8Row, a_color);
+	pStrip->fillRect(markX(a_color), 4, 8, 8, ~a_color); // 背景色だけでは分からない行の入れ違いも見つける
+	rows.flushRow();
+}
+
+/// @brief 画面のイベント履歴が、上から colors[] の色の行になっているか
+static bool sameRows(const uint16_t* colors)
+{
+	GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	ref.fillScreen(0);
+	for (uint8_t i = 0; i < LIST_ROWS; i++) {
+		ref.fillRect(0, LIST_TOP + i * SCROLL_LIST_ROW_HEIGHT, ILI9341_TFTWIDTH, SCROLL_LIST_ROW_HEIGHT, colors[i]);
+		ref.fillRect(markX(colors[i]), LIST_TOP + i * SCROLL_LIST_ROW_HEIGHT + 4, 8, 8, ~colors[i]);
+	}
+	sink.emu.getPanel(panel);
+	return hostComparePixels(panel, ref.getBuffer(), ILI9341_EMU_WIDTH, ILI9341_EMU_HEIGHT);
+}
+
+/// @brief 全行を描いてから、１行ずつ新しい行を先頭に足す
+static void testScrollOrder(bool isList)
+{
+	compositor.setList(isList ? &frameList : nullptr);
+	tft.fillScreen(0);
+	compositor.invalidate();
+	rows.reset();
+	uint16_t colors[LIST_ROWS];
+	frameList.clear();
+	for (uint8_t i = 0; i < LIST_ROWS; i++) {
+		colors[i] = (uint16_t)(0x1111 * (i + 1));
+		drawRow(i, colors[i]);
+	}
+	rows.flushScroll();
+	tft.submitList(frameList);
+	HOST_CHECK(sameRows(colors));
+
+	for (int n = 0; n < 3; n++) {
+		frameList.clear();
+		sink.clearOrder();
+		HOST_CHECK(rows.scroll(1));
+		for (uint8_t i = LIST_ROWS - 1; i > 0; i--)
+			colors[i] = colors[i - 1];
+		colors[0] = (uint16_t)(0xF800 + n * 0x20);
+		drawRow(0, colors[0]);
+		rows.flushScroll();
+		if (isList) {
+			HOST_CHECK(sink.lastScroll == 0); // リストを送るまで画面は動かない
+			tft.submitList(frameList);
+		}
+		HOST_CHECK(sink.lastRamwr != 0);
+		HOST_CHECK(sink.lastScroll > sink.lastRamwr); // 新しい行のピクセルの後に画面が動く
+		HOST_CHECK(sameRows(colors));
+	}
+}
+
+int main()
+{
+	tft.attachHostSink(&sink);
+	tft.begin();
+	compositor.init(&tft);
+	rows.init(&tft, &compositor, LIST_TOP, LIST_ROWS);
+	testScrollOrder(true);
+	testScrollOrder(false);
+	return hostTestResult("scroll_list");
+}
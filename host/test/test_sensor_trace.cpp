@@ -0,0 +1,121 @@
+/*!
+ * @file test_sensor_trace.cpp
+ *
+ * AS3935Simにつないで記録したIRQトレースを、別のAS3935SimとAS3935で再生し、validateSignal()の判定が同じ順に並ぶかを確かめる。
+ * 統計クリア（INTが0のレコード）も再生されること、１バイトずつの読み出しで読まなかったレジスタを再生で上書きしないことも見る。
+ */
+#include <vector>
+#include "HostTest.h"
+#include "AS3935.h"
+#include "AS3935Sim.h"
+#include "SensorTrace.h"
+
+#define SIM_ADDR 0x03
+#define SINGLE_READ_REGS 0x00F8 ///< １バイトずつの読み出しで読むレジスタ（REG03～REG07）
+
+static uint8_t traceBuf[sizeof(SensorTraceHeader) + sizeof(SensorTraceRecord) * SENSOR_TRACE_CAPACITY];
+
+/// @brief 再生中のセンサーと、判定の並び
+struct ReplayCtx {
+	AS3935* pAs3935;
+	AS3935Sim* pSim;
+	std::vector<AS3935_SIGNAL> signals;
+};
+
+static void pipeline(void* a_pCtx)
+{
+	ReplayCtx* c = static_cast<ReplayCtx*>(a_pCtx);
+	c->signals.push_back(c->pAs3935->validateSignal(c->pSim->timeUs()));
+}
+
+/// @brief センサーをつないで初期化する
+static void attach(AS3935& as3935, AS3935Sim& sim, bool isBlockRead)
+{
+	AS3935Config config;
+	config.isBlockRead = isBlockRead;
+	as3935.setConfig(config);
+	as3935.setTransport(&sim);
+	HOST_CHECK(as3935.Init(SIM_ADDR, 0, 4, 5, 2));
+}
+
+/// @brief 読み出し方ごとに、記録したトレースを再生して判定を比べる
+static void testRoundTrip(bool isBlockRead)
+{
+	AS3935Sim sim(SIM_ADDR);
+	SensorTraceRecorder recorder;
+	AS3935 as3935;
+	attach(as3935, sim, isBlockRead);
+	as3935.setRecorder(&recorder);
+
+	std::vector<AS3935_SIGNAL> recorded;
+	HOST_CHECK(sim.injectLightning(12, 0x12345));
+	recorded.push_back(as3935.validateSignal(sim.timeUs()));
+	sim.advanceUs(1500000);
+	HOST_CHECK(sim.injectLightning(80, 0x00321));
+	recorded.push_back(as3935.validateSignal(sim.timeUs()));
+	sim.advanceUs(200000);
+	HOST_CHECK(sim.injectDisturber());
+	recorded.push_back(as3935.validateSignal(sim.timeUs()));
+	recorded.push_back(as3935.validateSignal(sim.timeUs())); // 割り込み要因なし（統計クリア）
+	HOST_CHECK(sim.injectNoiseHigh());
+	recorded.push_back(as3935.validateSignal(sim.timeUs()));
+	HOST_CHECK(recorded[3] == AS3935_SIGNAL::STATCLEAR);
+
+	size_t len = recorder.serialize(traceBuf, sizeof(traceBuf));
+	HOST_CHECK(len == sizeof(SensorTraceHeader) + sizeof(SensorTraceRecord) * recorded.size());
+	const SensorTraceRecord* pRecords = reinterpret_cast<const SensorTraceRecord*>(traceBuf + sizeof(SensorTraceHeader));
+	for (size_t i = 0; i < recorded.size(); i++) {
+		HOST_CHECK(pRecords[i].regMask == (isBlockRead ? SENSOR_TRACE_ALL_REGS : SINGLE_READ_REGS));
+	}
+
+	// 新しいセンサーで再生する
+	AS3935Sim replaySim(SIM_ADDR);
+	AS3935 replayAs3935;
+	attach(replayAs3935, replaySim, isBlockRead);
+	uint8_t reg00 = replaySim.peekReg(0x00);
+	uint8_t reg08 = replaySim.peekReg(0x08);
+	SensorTraceReplay replay(&replaySim);
+	HOST_CHECK(replay.load(traceBuf, len));
+	ReplayCtx ctx = {&replayAs3935, &replaySim, {}};
+	SensorReplayStats stats;
+	replay.run(true, pipeline, &ctx, stats);
+	HOST_CHECK(ctx.signals == recorded);
+	HOST_CHECK(stats.events == recorded.size());
+	HOST_CHECK(stats.irqs == recorded.size() - 1);
+	HOST_CHECK(stats.elapsedUs >= 1700000); // 1倍速では記録した間隔を空ける
+	if (isBlockRead == false) {
+		// 読まなかったレジスタは0で記録されているが、再生先の値を残す
+		HOST_CHECK(replaySim.peekReg(0x00) == reg00);
+		HOST_CHECK(replaySim.peekReg(0x08) == reg08);
+	}
+	uint8_t summary, dist;
+	long lEnergy;
+	time_t t;
+	HOST_CHECK(replayAs3935.GetLatestAlarm(0, summary, dist, lEnergy, t) && summary == replayAs3935.SUMM_THUNDER && lEnergy == 0x12345);
+}
+
+/// @brief 形式の違うトレースは読まない
+static void testLoadRejects(void)
+{
+	AS3935Sim sim(SIM_ADDR);
+	SensorTraceRecorder recorder;
+	uint8_t regs[SENSOR_TRACE_REGS] = {0};
+	HOST_CHECK(recorder.hasUnsaved() == false); // 何も無ければフラッシュに書かない
+	recorder.record(100, regs);
+	HOST_CHECK(recorder.hasUnsaved());
+	size_t len = recorder.serialize(traceBuf, sizeof(traceBuf));
+	SensorTraceReplay replay(&sim);
+	HOST_CHECK(replay.load(traceBuf, len));
+	HOST_CHECK(replay.load(traceBuf, len - 1) == false); // レコードが途中で切れている
+	SensorTraceHeader* pHdr = reinterpret_cast<SensorTraceHeader*>(traceBuf);
+	pHdr->version = 1; // 有効ビットの無い以前の形式
+	HOST_CHECK(replay.load(traceBuf, len) == false);
+}
+
+int main()
+{
+	testRoundTrip(false);
+	testRoundTrip(true);
+	testLoadRejects();
+	return hostTestResult("sensor_trace");
+}
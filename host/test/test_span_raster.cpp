@@ -0,0 +1,128 @@
+/*!
+ * @file test_span_raster.cpp
+ *
+ * 走査線の区間で描く fillCircle()/fillRoundRect() が、以前の縦線での描き方（fillCircleHelper()）と１ドットも違わないかを確かめる。
+ * SPAN_MAX_RADIUSを超える半径（区間の表に収まらないもの）も含める。
+ */
+#include "HostTest.h"
+#include "Adafruit_GFX.h"
+#include "Adafruit_ILI9341.h"
+#include "Ili9341Emulator.h"
+
+using namespace ardPort;
+using namespace ardPort::spi;
+
+#define CANVAS_SIZE 480 ///< 半径200の円が収まる大きさ
+#define FG 0xFFE0
+#define BG 0x001F
+
+/// @brief 以前の fillRoundRect()（中央の矩形と左右の縦線）
+static void fillRoundRectByLines(Adafruit_GFX& g, int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+	int16_t max_radius = ((w < h) ? w : h) / 2;
+	if (r > max_radius)
+		r = max_radius;
+	g.startWrite();
+	g.writeFillRect(x + r, y, w - 2 * r, h, color);
+	g.fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+	g.fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+	g.endWrite();
+}
+
+/// @brief 以前の fillCircle()（中心の縦線と左右の縦線）
+static void fillCircleByLines(Adafruit_GFX& g, int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+	g.startWrite();
+	g.writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+	g.fillCircleHelper(x0, y0, r, 3, 0, color);
+	g.endWrite();
+}
+
+static GFXcanvas16 actual(CANVAS_SIZE, CANVAS_SIZE);
+static GFXcanvas16 expected(CANVAS_SIZE, CANVAS_SIZE);
+
+static bool sameCanvas(void)
+{
+	return hostComparePixels(actual.getBuffer(), expected.getBuffer(), CANVAS_SIZE, CANVAS_SIZE);
+}
+
+/// @brief 円（表の半径、計算する半径、SPAN_MAX_RADIUSを超える半径）
+static void testCircles(void)
+{
+	static const int16_t radii[] = {0, 1, 2, 5, SPAN_TABLE_MAX_RADIUS, SPAN_TABLE_MAX_RADIUS + 1, 60, SPAN_MAX_RADIUS, SPAN_MAX_RADIUS + 1, 200, 239};
+	for (int16_t r : radii) {
+		actual.fillScreen(BG);
+		expected.fillScreen(BG);
+		actual.fillCircle(240, 240, r, FG);
+		fillCircleByLines(expected, 240, 240, r, FG);
+		HOST_CHECK(sameCanvas());
+		if (hostTestFailures)
+			fprintf(stderr, "  fillCircle r=%d\n", r);
+
+		// 背景色つきは外接矩形の残りを塗る
+		actual.fillScreen(0);
+		expected.fillScreen(0);
+		actual.fillCircle(240, 240, r, FG, BG);
+		expected.fillRect(240 - r, 240 - r, 2 * r + 1, 2 * r + 1, BG);
+		fillCircleByLines(expected, 240, 240, r, FG);
+		HOST_CHECK(sameCanvas());
+	}
+}
+
+/// @brief 角丸矩形（短辺の半分が SPAN_MAX_RADIUS を超えるものと、はみ出すものを含む）
+static void testRoundRects(void)
+{
+	struct Case {
+		int16_t x, y, w, h, r;
+	};
+	static const Case cases[] = {
+		{10, 10, 100, 40, 8},
+		{10, 10, 100, 40, 30}, // 短辺の半分に切り詰める
+		{0, 0, 400, 340, 170},
+		{20, 30, 440, 420, 210},
+		{-100, -50, 460, 400, 200}, // キャンバスの外にはみ出す
+		{40, 40, 330, 330, 165},
+	};
+	for (const Case& c : cases) {
+		actual.fillScreen(BG);
+		expected.fillScreen(BG);
+		actual.fillRoundRect(c.x, c.y, c.w, c.h, c.r, FG);
+		fillRoundRectByLines(expected, c.x, c.y, c.w, c.h, c.r, FG);
+		HOST_CHECK(sameCanvas());
+
+		actual.fillScreen(0);
+		expected.fillScreen(0);
+		actual.fillRoundRect(c.x, c.y, c.w, c.h, c.r, FG, BG);
+		expected.fillRect(c.x, c.y, c.w, c.h, BG);
+		fillRoundRectByLines(expected, c.x, c.y, c.w, c.h, c.r, FG);
+		HOST_CHECK(sameCanvas());
+	}
+}
+
+/// @brief 液晶より大きな円を、実際のドライバで描く（区間の描き方がサブクラスでも壊れない）
+static void testLargeCircleOnPanel(void)
+{
+	static Ili9341Emulator emu;
+	static Adafruit_ILI9341 tft(&SPI, 20, 22, 21);
+	tft.attachHostSink(&emu);
+	tft.begin();
+	GFXcanvas16 ref(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+	Adafruit_GFX* targets[2] = {&tft, &ref};
+	for (Adafruit_GFX* g : targets) {
+		g->fillScreen(BG);
+		g->fillCircle(120, 160, 200, FG);
+		g->fillCircle(0, 0, 170, BG, 0x07E0);
+		g->fillRoundRect(-20, 200, 400, 340, 170, 0xF800);
+	}
+	static uint16_t panel[ILI9341_EMU_WIDTH * ILI9341_EMU_HEIGHT];
+	emu.getPanel(panel);
+	HOST_CHECK(hostComparePixels(panel, ref.getBuffer(), ILI9341_EMU_WIDTH, ILI9341_EMU_HEIGHT));
+}
+
+int main()
+{
+	testCircles();
+	testRoundRects();
+	testLargeCircleOnPanel();
+	return hostTestResult("span_raster");
+}
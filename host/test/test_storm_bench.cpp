@@ -0,0 +1,89 @@
+/*!
+ * @file test_storm_bench.cpp
+ *
+ * 疑似雷雨の発生器（StormGenerator）が同じ種から同じイベント列を作り、距離とエネルギーが設定の範囲に収まるかを確かめる。
+ * 取りこぼしのベンチマーク（StormBench）は、処理が間に合うときは取りこぼさず、表示に時間がかかると取りこぼして数えるかを見る。
+ */
+#include <vector>
+#include "HostTest.h"
+#include "AS3935.h"
+#include "AS3935Sim.h"
+#include "StormGenerator.h"
+
+#define SIM_ADDR 0x03
+
+/// @brief 同じ種から同じイベント列になり、範囲に収まるか
+static void testGenerator(void)
+{
+	StormConfig config = StormGenerator::defaultConfig();
+	config.eventsPerSec = 20;
+	StormGenerator gen(config);
+	std::vector<StormEvent> first;
+	StormEvent e;
+	uint32_t counts[3] = {0, 0, 0};
+	uint64_t lastUs = 0;
+	while (gen.next(e)) {
+		HOST_CHECK(e.timeUs >= lastUs && e.timeUs < (uint64_t)config.durationSec * 1000000);
+		lastUs = e.timeUs;
+		counts[e.type]++;
+		if (e.type == STORM_LIGHTNING) {
+			HOST_CHECK(e.km >= config.endKm - config.jitterKm && e.km <= config.startKm + config.jitterKm);
+			HOST_CHECK(e.energy >= config.energyMin && e.energy <= config.energyMax);
+		}
+		first.push_back(e);
+	}
+	// 平均20回/秒で10分なので、およそ12000件。種別の割合も設定に近い
+	HOST_CHECK(first.size() > 11000 && first.size() < 13000);
+	HOST_CHECK(counts[STORM_DISTURBER] > first.size() * 15 / 100 && counts[STORM_DISTURBER] < first.size() * 25 / 100);
+	HOST_CHECK(counts[STORM_NOISE] > first.size() * 3 / 100 && counts[STORM_NOISE] < first.size() * 7 / 100);
+
+	gen.reset();
+	for (const StormEvent& f : first) {
+		HOST_CHECK(gen.next(e));
+		HOST_CHECK(e.timeUs == f.timeUs && e.type == f.type && e.km == f.km && e.energy == f.energy);
+	}
+	HOST_CHECK(gen.next(e) == false);
+}
+
+/// @brief ベンチマークの１回分
+static StormBenchStats runBench(double rate, uint32_t displayCostUs)
+{
+	AS3935Sim sim(SIM_ADDR);
+	AS3935 as3935;
+	as3935.setTransport(&sim);
+	HOST_CHECK(as3935.Init(SIM_ADDR, 0, 4, 5, 2));
+	StormConfig config = StormGenerator::defaultConfig();
+	config.eventsPerSec = rate;
+	config.durationSec = 60;
+	StormGenerator gen(config);
+	StormBench bench(&sim);
+	bench.setDisplayCost(displayCostUs);
+	StormBenchStats stats;
+	bench.run(gen, [](void* p) {
+		// 読んだイベントには必ず割り込み要因がある
+		HOST_CHECK(static_cast<AS3935*>(p)->validateSignal() != AS3935_SIGNAL::NONE);
+	}, &as3935, stats);
+	HOST_CHECK(stats.generated == stats.filtered + stats.dropped + stats.processed);
+	return stats;
+}
+
+/// @brief 処理が間に合うときと、間に合わないとき
+static void testBench(void)
+{
+	StormBenchStats fast = runBench(2, 1000);
+	HOST_CHECK(fast.generated > 0 && fast.processed > 0);
+	HOST_CHECK(fast.dropped == 0);
+	HOST_CHECK(fast.latencyMax < 1000 + 1000); // 表示時間とI2Cの転送時間だけ
+
+	StormBenchStats slow = runBench(10, 300000);
+	HOST_CHECK(slow.dropped > 0);
+	HOST_CHECK(slow.latencyP50 >= 300000);
+	HOST_CHECK(slow.latencyP99 >= slow.latencyP50 && slow.latencyMax >= slow.latencyP99);
+}
+
+int main()
+{
+	testGenerator();
+	testBench();
+	return hostTestResult("storm_bench");
+}
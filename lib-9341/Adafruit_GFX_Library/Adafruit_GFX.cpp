@@ -34,6 +34,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "Adafruit_GFX_Library/Adafruit_GFX.h"
 #include "glcdfont.c"
 #include "Kanji/KanjiHelper.h"
+#include "Kanji/GlyphCache.h"
 #include <cstdarg>
 #ifdef MICROPY_BUILD_TYPE
 extern "C" {
@@ -191,6 +192,93 @@ void Adafruit_GFX::setRotation(uint8_t x)
 			_height = WIDTH;
 			break;
 	}
+	clipDepth = 0; // クリップ矩形は回転後の座標なので外す
+}
+
+/*!
+  @brief   クリップ矩形を重ねる
+  @param   x  左上のX座標
+  @param   y  左上のY座標
+  @param   w  幅
+  @param   h  高さ
+  @return  重ねられたらtrue。スタックが一杯ならfalse（クリップ矩形は変わらない）
+  @details
+	現在のクリップ矩形との共通部分が新しいクリップ矩形になる（画面の外も除く）。共通部分が無ければ、popClipRect()までは何も描かれない。
+	クリップは各描画の入口で１回だけ行い、矩形・線・ビットマップ・文字は描く範囲を切り詰めてから送るので、
+	ウィジェットの領域の外には１ピクセルも送らない。popClipRect()と対にして使うこと。
+*/
+bool Adafruit_GFX::pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	if (clipDepth >= GFX_CLIP_STACK_DEPTH) return false;
+	ClipRect r;
+	if (clipRect(x, y, w, h)) {
+		r = {x, y, (int16_t)(x + w), (int16_t)(y + h)};
+	} else {
+		r = {0, 0, 0, 0}; // 空の矩形
+	}
+	clipStack[clipDepth++] = r;
+	return true;
+}
+
+/*!
+  @brief   最後に重ねたクリップ矩形を外し、その前のクリップ矩形に戻す
+*/
+void Adafruit_GFX::popClipRect(void)
+{
+	if (clipDepth > 0) clipDepth--;
+}
+
+/*!
+  @brief   矩形をクリップ矩形で切り詰める
+  @param   x  左上のX座標（切り詰めた矩形に書き換える）
+  @param   y  左上のY座標（同上）
+  @param   w  幅。負なら左に伸びる矩形とみなす（同上、正の値になる）
+  @param   h  高さ。負なら上に伸びる矩形とみなす（同上、正の値になる）
+  @return  描く部分が残ればtrue
+*/
+bool Adafruit_GFX::clipRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const
+{
+	if (w < 0) {
+		x += w + 1;
+		w = -w;
+	}
+	if (h < 0) {
+		y += h + 1;
+		h = -h;
+	}
+	int16_t bx, by;
+	return clipBitmap(x, y, w, h, bx, by);
+}
+
+/*!
+  @brief   ビットマップを描く範囲をクリップ矩形で切り詰める
+  @param   x   左上のX座標（切り詰めた範囲に書き換える）
+  @param   y   左上のY座標（同上）
+  @param   w   幅（同上）
+  @param   h   高さ（同上）
+  @param   bx  切り詰めた範囲の左端の、ビットマップの中での位置
+  @param   by  切り詰めた範囲の上端の、ビットマップの中での位置
+  @return  描く部分が残ればtrue
+*/
+bool Adafruit_GFX::clipBitmap(int16_t& x, int16_t& y, int16_t& w, int16_t& h, int16_t& bx, int16_t& by) const
+{
+	int16_t cx1 = clipLeft(), cy1 = clipTop(), cx2 = clipRight(), cy2 = clipBottom();
+	if (w <= 0 || h <= 0 || x >= cx2 || y >= cy2 || (x + w) <= cx1 || (y + h) <= cy1) return false;
+	bx = 0;
+	by = 0;
+	if (x < cx1) {
+		bx = cx1 - x;
+		w -= bx;
+		x = cx1;
+	}
+	if (y < cy1) {
+		by = cy1 - y;
+		h -= by;
+		y = cy1;
+	}
+	if (x + w > cx2) w = cx2 - x;
+	if (y + h > cy2) h = cy2 - y;
+	return true;
 }
 /**
  * @brief 英文フォントを指定する。
@@ -219,11 +307,12 @@ void Adafruit_GFX::setFont(const GFXfont* f)
  * @brief この設定が行われると、親クラスのisKanjiをTrueにして、漢字フォントを使用するようになる。
  * @param　a_pKanjiData 漢字フォントのデータ
  * @param　a_pBmpData 漢字フォントのビットマップデータ
+ * @param　bpp ビットマップの１ドットのビット数（1:白黒、2/4:階調つき）
  * @details 元の英文に戻すには、英文フォントを指定してsetFontを呼びだすか、Print::KanjiMode(false)を呼び出す。
  */
-void Adafruit_GFX::setFont(const KanjiData* a_pKanjiData, const uint8_t* a_pBmpData)
+void Adafruit_GFX::setFont(const KanjiData* a_pKanjiData, const uint8_t* a_pBmpData, uint8_t bpp)
 {
-	KanjiHelper::SetKanjiFont(a_pKanjiData, a_pBmpData);
+	KanjiHelper::SetKanjiFont(a_pKanjiData, a_pBmpData, bpp);
 	isKanji = true;
 }
 #pragma endregion
@@ -563,15 +652,28 @@ void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
   @param   y0   中心y座標
   @param   r    半径
   @param   color 塗りつぶし色（16ビットRGB565）
+  @details 幅と高さが2r+1の角丸矩形として、走査線ごとの区間で描きます。形はfillCircleHelper()で描いた場合と同じです。
 */
 
 void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
 							  uint16_t color)
 {
-	startWrite();
-	writeFastVLine(x0, y0 - r, 2 * r + 1, color);
-	fillCircleHelper(x0, y0, r, 3, 0, color);
-	endWrite();
+	fillRoundRect(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1, r, color);
+}
+
+/*!
+  @brief   円を塗りつぶし、外接矩形の残りを背景色で塗ります。
+  @param   x0   中心x座標
+  @param   y0   中心y座標
+  @param   r    半径
+  @param   color 塗りつぶし色（16ビットRGB565）
+  @param   bg    背景色（16ビットRGB565）
+  @details 背景色がわかっている場合は、外接矩形を１つのウインドウで送れます（fillSpansOpaque()を参照）。
+*/
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
+							  uint16_t color, uint16_t bg)
+{
+	fillRoundRect(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1, r, color, bg);
 }
 
 /*!
@@ -685,6 +787,9 @@ void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
   @param   h   高さ（ピクセル数）
   @param   r   角の半径
   @param   color 塗りつぶし色（16ビットRGB565）
+  @details
+	走査線ごとの区間で描きます。角の間の同じ幅の行は、まとめて１つの矩形になります。
+	半径がSPAN_MAX_RADIUSを超える角は区間の表に収まらないので、以前と同じく中央の矩形と左右の縦線（fillCircleHelper()）で描きます。
 */
 
 void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
@@ -693,15 +798,137 @@ void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
 	int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
 	if (r > max_radius)
 		r = max_radius;
-	// smarter version
+	if (r > SPAN_MAX_RADIUS) {
+		startWrite();
+		writeFillRect(x + r, y, w - 2 * r, h, color);
+		fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+		fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+		endWrite();
+		return;
+	}
+	RoundRectSpans spans(x, y, w, h, r);
+	fillSpans(spans, color);
+}
+
+/*!
+  @brief   角丸矩形を塗りつぶし、角の外側を背景色で塗ります。
+  @param   x   左上x座標
+  @param   y   左上y座標
+  @param   w   幅（ピクセル数）
+  @param   h   高さ（ピクセル数）
+  @param   r   角の半径
+  @param   color 塗りつぶし色（16ビットRGB565）
+  @param   bg    角の外側の色（16ビットRGB565）
+  @details
+	背景色がわかっている場合は、外接矩形を１つのウインドウで送れます（fillSpansOpaque()を参照）。
+	半径がSPAN_MAX_RADIUSを超えるときは、外接矩形を背景色で塗ってから上の fillRoundRect() で描きます。
+*/
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+								 int16_t r, uint16_t color, uint16_t bg)
+{
+	int16_t max_radius = ((w < h) ? w : h) / 2;
+	if (r > max_radius)
+		r = max_radius;
+	if (r > SPAN_MAX_RADIUS) {
+		fillRect(x, y, w, h, bg);
+		fillRoundRect(x, y, w, h, r, color);
+		return;
+	}
+	RoundRectSpans spans(x, y, w, h, r);
+	fillSpansOpaque(spans, color, bg);
+}
+
+/*!
+  @brief   走査線ごとの区間で図形を塗りつぶします。
+  @param   src   図形の区間
+  @param   color 塗りつぶし色（16ビットRGB565）
+  @details
+	続く行の区間が同じなら１つの矩形にまとめ、１回のトランザクションの中でwriteFillRect()で描きます。
+	サブクラスは、区間をまとめて送る方法があればオーバーライドしてください。
+*/
+void Adafruit_GFX::fillSpans(SpanSource &src, uint16_t color)
+{
+	int16_t runX = 0, runW = 0, runY = src.boxY, runH = 0;
+	int16_t x, w;
+	int16_t y = src.boxY;
 	startWrite();
-	writeFillRect(x + r, y, w - 2 * r, h, color);
-	// draw four corners
-	fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
-	fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+	while (src.next(x, w)) {
+		if (runH > 0 && (x != runX || w != runW)) {
+			writeSpanRun(src, runX, runY, runW, runH, color, 0, false);
+			runH = 0;
+		}
+		if (runH == 0) {
+			runX = x;
+			runW = w;
+			runY = y;
+		}
+		runH++;
+		y++;
+	}
+	if (runH > 0)
+		writeSpanRun(src, runX, runY, runW, runH, color, 0, false);
+	endWrite();
+}
+
+/*!
+  @brief   走査線ごとの区間で図形を塗りつぶし、外接矩形の残りを背景色で塗ります。
+  @param   src   図形の区間
+  @param   color 塗りつぶし色（16ビットRGB565）
+  @param   bg    背景色（16ビットRGB565）
+  @details 外接矩形のすべてのピクセルを塗るので、液晶では１つのウインドウにまとめて送れます（Adafruit_SPITFTを参照）。
+*/
+void Adafruit_GFX::fillSpansOpaque(SpanSource &src, uint16_t color, uint16_t bg)
+{
+	int16_t runX = 0, runW = 0, runY = src.boxY, runH = 0;
+	int16_t x, w;
+	int16_t y = src.boxY;
+	startWrite();
+	while (src.next(x, w)) {
+		if (runH > 0 && (x != runX || w != runW)) {
+			writeSpanRun(src, runX, runY, runW, runH, color, bg, true);
+			runH = 0;
+		}
+		if (runH == 0) {
+			runX = x;
+			runW = w;
+			runY = y;
+		}
+		runH++;
+		y++;
+	}
+	if (runH > 0)
+		writeSpanRun(src, runX, runY, runW, runH, color, bg, true);
 	endWrite();
 }
 
+/*!
+  @brief   同じ区間が続く行をまとめて描きます（fillSpans()/fillSpansOpaque()の下請け）。
+  @param   src      図形の区間（外接矩形を使う）
+  @param   x        区間の左端
+  @param   y        最初の行
+  @param   w        区間の幅
+  @param   h        行数
+  @param   color    塗りつぶし色
+  @param   bg       背景色
+  @param   isOpaque trueなら区間の左右を外接矩形の端まで背景色で塗る
+*/
+void Adafruit_GFX::writeSpanRun(const SpanSource &src, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bg, bool isOpaque)
+{
+	if (w > 0)
+		writeFillRect(x, y, w, h, color);
+	if (isOpaque) {
+		if (w <= 0) {
+			writeFillRect(src.boxX, y, src.boxW, h, bg);
+			return;
+		}
+		if (x > src.boxX)
+			writeFillRect(src.boxX, y, x - src.boxX, h, bg);
+		int16_t right = src.boxX + src.boxW - (x + w);
+		if (right > 0)
+			writeFillRect(x + w, y, right, h, bg);
+	}
+}
+
 /**************************************************************************/
 /*!
   @brief   三角形（枠のみ）を描画します。
@@ -732,97 +959,130 @@ void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   @param   x2  頂点2のx座標
   @param   y2  頂点2のy座標
   @param   color 塗りつぶし色（16ビットRGB565）
-  @details Y座標でソートし、走査線ごとに水平線を描画します。
+  @details Y座標でソートし、走査線ごとの区間（TriangleSpans）で描画します。
 */
 /**************************************************************************/
 void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 								int16_t x2, int16_t y2, uint16_t color)
 {
-	int16_t a, b, y, last;
+	TriangleSpans spans(x0, y0, x1, y1, x2, y2);
+	fillSpans(spans, color);
+}
 
-	// Sort coordinates by Y order (y2 >= y1 >= y0)
-	if (y0 > y1) {
-		_swap_int16_t(y0, y1);
-		_swap_int16_t(x0, x1);
-	}
-	if (y1 > y2) {
-		_swap_int16_t(y2, y1);
-		_swap_int16_t(x2, x1);
-	}
-	if (y0 > y1) {
-		_swap_int16_t(y0, y1);
-		_swap_int16_t(x0, x1);
-	}
+/**************************************************************************/
+/*!
+  @brief   三角形を塗りつぶし、外接矩形の残りを背景色で塗ります。
+  @param   x0  頂点0のx座標
+  @param   y0  頂点0のy座標
+  @param   x1  頂点1のx座標
+  @param   y1  頂点1のy座標
+  @param   x2  頂点2のx座標
+  @param   y2  頂点2のy座標
+  @param   color 塗りつぶし色（16ビットRGB565）
+  @param   bg    背景色（16ビットRGB565）
+*/
+/**************************************************************************/
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+								int16_t x2, int16_t y2, uint16_t color, uint16_t bg)
+{
+	TriangleSpans spans(x0, y0, x1, y1, x2, y2);
+	fillSpansOpaque(spans, color, bg);
+}
+#pragma endregion
+
+#pragma region ビットマップ機能
+
+// BITMAP / XBITMAP / GRAYSCALE / RGB BITMAP FUNCTIONS ---------------------
 
+/*!
+  @brief   圧縮した画像（PackedImage）を描画します。
+  @param   x    左上x座標
+  @param   y    左上y座標
+  @param   img  圧縮した画像
+  @details 読み出したランは行ごとに分けてwriteFastHLine()で、並びはwritePixel()で描きます。画面からはみ出した部分は描きません。
+*/
+void Adafruit_GFX::drawPackedImage(int16_t x, int16_t y, const PackedImage &img)
+{
+	PackedImageReader reader(img);
+	bool isRun;
+	uint16_t len, color;
+	const uint8_t *pIndex;
+	int16_t px = 0, py = 0; // 画像内の次のピクセル
 	startWrite();
-	if (y0 == y2) { // Handle awkward all-on-same-line case as its own thing
-		a = b = x0;
-		if (x1 < a)
-			a = x1;
-		else if (x1 > b)
-			b = x1;
-		if (x2 < a)
-			a = x2;
-		else if (x2 > b)
-			b = x2;
-		writeFastHLine(a, y0, b - a + 1, color);
-		endWrite();
-		return;
+	while (reader.next(isRun, len, color, pIndex)) {
+		if (isRun) {
+			while (len > 0) {
+				int16_t n = img.width - px;
+				if (n > len)
+					n = len;
+				writeFastHLine(x + px, y + py, n, color);
+				len -= n;
+				px += n;
+				if (px >= img.width) {
+					px = 0;
+					py++;
+				}
+			}
+		} else {
+			for (uint16_t i = 0; i < len; i++) {
+				writePixel(x + px, y + py, img.palette[pIndex[i]]);
+				if (++px >= img.width) {
+					px = 0;
+					py++;
+				}
+			}
+		}
 	}
+	endWrite();
+}
 
-	int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
-			dx12 = x2 - x1, dy12 = y2 - y1;
-	int32_t sa = 0, sb = 0;
-
-	// For upper part of triangle, find scanline crossings for segments
-	// 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-	// is included here (and second loop will be skipped, avoiding a /0
-	// error there), otherwise scanline y1 is skipped here and handled
-	// in the second loop...which also avoids a /0 error here if y0=y1
-	// (flat-topped triangle).
-	if (y1 == y2)
-		last = y1; // Include y1 scanline
-	else
-		last = y1 - 1; // Skip it
-
-	for (y = y0; y <= last; y++) {
-		a = x0 + sa / dy01;
-		b = x0 + sb / dy02;
-		sa += dx01;
-		sb += dx02;
-		/* longhand:
-		a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
-		b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-		*/
-		if (a > b)
-			_swap_int16_t(a, b);
-		writeFastHLine(a, y, b - a + 1, color);
-	}
-
-	// For lower part of triangle, find scanline crossings for segments
-	// 0-2 and 1-2.  This loop is skipped if y1=y2.
-	sa = (int32_t)dx12 * (y - y1);
-	sb = (int32_t)dx02 * (y - y0);
-	for (; y <= y2; y++) {
-		a = x1 + sa / dy12;
-		b = x0 + sb / dy02;
-		sa += dx12;
-		sb += dx02;
-		/* longhand:
-		a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
-		b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-		*/
-		if (a > b)
-			_swap_int16_t(a, b);
-		writeFastHLine(a, y, b - a + 1, color);
+/*!
+  @brief   区間で表したスプライト（SpanSprite）を描画します。
+  @param   x       左上x座標
+  @param   y       左上y座標
+  @param   sprite  スプライト
+  @details 汎用の実装で、区間のピクセルを１ドットずつ描く。透過する部分には何も書かない。
+*/
+void Adafruit_GFX::drawSpanSprite(int16_t x, int16_t y, const SpanSprite &sprite)
+{
+	const uint16_t *pPixel = sprite.pixels;
+	startWrite();
+	for (uint16_t k = 0; k < sprite.spanCount; k++) {
+		const SpriteSpan &span = sprite.spans[k];
+		for (uint8_t i = 0; i < span.len; i++) {
+			writePixel(x + span.x + i, y + span.y, *pPixel++);
+		}
 	}
 	endWrite();
 }
-#pragma endregion
 
-#pragma region ビットマップ機能
-
-// BITMAP / XBITMAP / GRAYSCALE / RGB BITMAP FUNCTIONS ---------------------
+/*!
+  @brief   パレット番号で色を表すビットマップ（1/2/4/8ビット/ピクセル）を描画します。
+  @param   x        左上x座標
+  @param   y        左上y座標
+  @param   bitmap   パレット番号の並び。１バイトに上位ビットから左のピクセルを詰め、各行はバイト境界から始まる
+  @param   palette  RGB565のパレット（2^bpp色）
+  @param   bpp      １ピクセルのビット数（1, 2, 4, 8）
+  @param   w        幅
+  @param   h        高さ
+*/
+void Adafruit_GFX::drawIndexedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint16_t palette[], uint8_t bpp, int16_t w, int16_t h)
+{
+	if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8)
+		return;
+	int16_t rowBytes = (w * bpp + 7) / 8;
+	uint8_t mask = (1 << bpp) - 1;
+	startWrite();
+	for (int16_t j = 0; j < h; j++) {
+		const uint8_t *row = bitmap + j * rowBytes;
+		for (int16_t i = 0; i < w; i++) {
+			int16_t bit = i * bpp;
+			uint8_t idx = (row[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+			writePixel(x + i, y + j, palette[idx]);
+		}
+	}
+	endWrite();
+}
 
 /*!
   @brief   指定座標に1ビットビットマップ画像を描画します。()
@@ -1391,10 +1651,10 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 {
 	if (!gfxFont) { // 'Classic' built-in font
 
-		if ((x >= _width) ||              // Clip right
-			(y >= _height) ||             // Clip bottom
-			((x + 6 * size_x - 1) < 0) || // Clip left
-			((y + 8 * size_y - 1) < 0))   // Clip top
+		if ((x >= clipRight()) ||                 // Clip right
+			(y >= clipBottom()) ||                // Clip bottom
+			((x + 6 * size_x - 1) < clipLeft()) || // Clip left
+			((y + 8 * size_y - 1) < clipTop()))    // Clip top
 			return;
 
 		if (!_cp437 && (c >= 176))
@@ -1488,6 +1748,8 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 	} // End classic vs custom font
 }
 
+static uint16_t charBurstBuf[CHAR_BURST_BUF_PIXELS]; ///< drawChar()で展開した数行分のピクセル（全インスタンスで共用）
+
 /// @brief 画面に漢字を１文字表示する。仮想関数なので、Adafruit_GFXを継承したクラスでオーバーロードされる可能性がある。
 /// @param   x   描画開始位置の左上座標
 /// @param   y   描画開始位置の左上座標
@@ -1498,7 +1760,8 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 /// @param   bg 文字の背景色（565カラー）　前景色と同じ色が指定されたら、透過表示とみなす。
 /// @param   size_x 文字の横方向の拡大率
 /// @param   size_y 文字の縦方向の拡大率
-/// @details ここで定義されるのは、最も汎用的になると思われる実装。例えば、ILI9341の場合（おそらくTFT7735も）、描画ウインドウを指定することでより高速に表示できる。
+/// @details 2/4bppの階調つきフォント（KanjiHelper::getBitsPerPixel()）も描ける。背景ありなら前景色と背景色を混ぜる（アンチエイリアス）。<br/>
+/// ここで定義されるのは、最も汎用的になると思われる実装。例えば、ILI9341の場合（おそらくTFT7735も）、描画ウインドウを指定することでより高速に表示できる。
 /// 必要に応じて、このクラスを継承するクラスでは、より効率的な実装を行うべき。
 /// このライブラリでは、Adafruit_ILI9341.cppなどで、drawCharをオーバーロードしている。
 void Adafruit_GFX::drawChar(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* bmpData, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y)
@@ -1507,42 +1770,72 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, uint8_t w, uint8_t h, const ui
 	// 元々の判断そのままだが、すこしオカシイ気がする。
 	// たとえば、表示領域を右にはみ出さないかの判断を、 x > _width　としているが、これだと描画開始地点（文字の左）が横幅を超えるかの判断しかしていない。
 	// 本来、表示領域の右と、表示する文字の右側を比較する必要があるのでは？ x > _width ではなく、 (x+w) >= _width と判断すべきでは？
-	if ((x >= _width) || (y >= _height) || ((x + w * size_x - 1) < 0) || ((y + h * size_y - 1) < 0)) return;
-
-	uint8_t w_bytes = (w + 8 - 1) / 8;  // 横方向のバイト数
-	uint8_t h_bytes = h;                // 縦方向のバイト数
-	uint16_t bmpIdx = 0;                // ビットマップ情報には、bmp + yy*w_bytes + xx でアクセスできるが、順番に並んでいるので最初から順に読むほうが速いのでは？
-	bool isByteMultiple = (w % 8 == 0); // 横幅が8の倍数かのフラグ。横１２ドットなどの場合は、８の倍数にならないので調整が必要になる
-
-	startWrite();
-
-	for (int8_t yy = 0; yy < h_bytes; yy++) {
-		for (int8_t xx = 0; xx < w_bytes; xx++) {
-			uint8_t bitCnt;
-			if (isByteMultiple) {
-				bitCnt = 8;
-			} else {
-				bitCnt = (xx != (w_bytes - 1)) ? 8 : (w % 8);
+	if ((x >= clipRight()) || (y >= clipBottom()) || ((x + w * size_x - 1) < clipLeft()) || ((y + h * size_y - 1) < clipTop())) return;
+
+	uint8_t bpp = KanjiHelper::getBitsPerPixel();
+	uint8_t w_bytes = GlyphCache::getRowBytes(w, bpp); // 横方向のバイト数
+
+	if (color != bg) {
+		// 背景ありなら、階調を背景色と混ぜた表で行ごとに展開し、拡大も行バッファの中で行って drawGlyph565() でまとめて送る。
+		// 右の１列（拡大時は size_x 列）の背景も同じバッファに含める。
+		// 拡大した１行（ww × size_y）もバッファに入らないときは、展開した１行を入るだけ縦に並べて、size_y 行を何回かに分けて送る。
+		int16_t ww = (w + 1) * size_x;
+		int16_t rowsPerBurst = CHAR_BURST_BUF_PIXELS / (ww * size_y);
+		if (rowsPerBurst == 0 && ww <= CHAR_BURST_BUF_PIXELS) {
+			const uint16_t* lut = GlyphCache::getBlendLut(color, bg, bpp);
+			int16_t copies = CHAR_BURST_BUF_PIXELS / ww; // 1以上、size_y未満
+			for (int16_t yy = 0; yy < h; yy++) {
+				GlyphCache::expandRow(bmpData + yy * w_bytes, w, bpp, lut, charBurstBuf, size_x);
+				for (int16_t k = w * size_x; k < ww; k++)
+					charBurstBuf[k] = bg;
+				for (int16_t k = 1; k < copies; k++)
+					memcpy(charBurstBuf + k * ww, charBurstBuf, ww * sizeof(uint16_t));
+				for (int16_t k = 0; k < size_y; k += copies) {
+					int16_t n = (size_y - k < copies) ? (size_y - k) : copies;
+					drawGlyph565(x, y + yy * size_y + k, ww, n, charBurstBuf);
+				}
 			}
-			uint8_t bits = bmpData[bmpIdx];
-			for (int8_t bb = 0; bb < bitCnt; bb++) {
-				if (bits & 0x80) {
-					if (size_x == 1 && size_y == 1)
-						writePixel(x + xx * 8 + bb, y + yy, color);
-					else
-						writeFillRect(x + (xx * 8 + bb) * size_x, y + yy * size_y, size_x, size_y, color);
-				} else {
-					if (color != bg) { // 前景色と背景色が同じときは、透過色として背景色は描画しない。
-						if (size_x == 1 && size_y == 1)
-							writePixel(x + xx * 8 + bb, y + yy, bg);
-						else
-							writeFillRect(x + (xx * 8 + bb) * size_x, y + yy * size_y, size_x, size_y, bg);
-					}
+			return;
+		}
+		if (rowsPerBurst > 0) {
+			const uint16_t* lut = GlyphCache::getBlendLut(color, bg, bpp);
+			for (int16_t yy = 0; yy < h; yy += rowsPerBurst) {
+				int16_t rows = (h - yy < rowsPerBurst) ? (h - yy) : rowsPerBurst;
+				uint16_t* pDst = charBurstBuf;
+				for (int16_t r = 0; r < rows; r++) {
+					GlyphCache::expandRow(bmpData + (yy + r) * w_bytes, w, bpp, lut, pDst, size_x);
+					for (int16_t k = w * size_x; k < ww; k++)
+						pDst[k] = bg;
+					for (uint8_t k = 1; k < size_y; k++)
+						memcpy(pDst + k * ww, pDst, ww * sizeof(uint16_t));
+					pDst += ww * size_y;
 				}
+				drawGlyph565(x, y + yy * size_y, ww, rows * size_y, charBurstBuf);
+			}
+			return;
+		}
+	}
 
-				bits <<= 1;
+	startWrite();
+
+	// 同じ色が続く区間（スパン）ごとに１回の writeFillRect で描く。１ドットずつ描くよりも、座標指定の回数が大幅に減る。
+	// 拡大時はスパンが size_x 倍の幅、size_y 倍の高さの矩形になる。
+	// 階調つきのフォントを透過で描くときは、混ぜる背景がわからないので、階調の半分以上を前景とする。
+	uint8_t maxLevel = (1 << bpp) - 1;
+	for (int16_t yy = 0; yy < h; yy++) {
+		const uint8_t* pRow = bmpData + yy * w_bytes;
+		int16_t xx = 0;
+		while (xx < w) {
+			bool isOn = GlyphCache::getLevel(pRow, xx, bpp) * 2 > maxLevel;
+			int16_t start = xx;
+			do {
+				xx++;
+			} while (xx < w && (GlyphCache::getLevel(pRow, xx, bpp) * 2 > maxLevel) == isOn);
+			if (isOn) {
+				writeFillRect(x + start * size_x, y + yy * size_y, (xx - start) * size_x, size_y, color);
+			} else if (color != bg) { // 前景色と背景色が同じときは、透過色として背景色は描画しない。
+				writeFillRect(x + start * size_x, y + yy * size_y, (xx - start) * size_x, size_y, bg);
 			}
-			bmpIdx++;
 		}
 	}
 	if (bg != color) { // If opaque, draw vertical line for last column
@@ -1554,6 +1847,24 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, uint8_t w, uint8_t h, const ui
 	endWrite();
 }
 
+/// @brief RGB565に展開済みの文字を描画する。
+/// @param x 描画開始位置の左上座標
+/// @param y 描画開始位置の左上座標
+/// @param w 文字の幅
+/// @param h 文字の高さ
+/// @param pixels w×hのRGB565ピクセル
+/// @details 汎用の実装で、１ドットずつ描く。液晶やキャンバスでは、まとめて転送・コピーするようにオーバーライドしている。
+void Adafruit_GFX::drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels)
+{
+	startWrite();
+	for (int16_t yy = 0; yy < h; yy++) {
+		for (int16_t xx = 0; xx < w; xx++) {
+			writePixel(x + xx, y + yy, *pixels++);
+		}
+	}
+	endWrite();
+}
+
 /*!
 	@brief  ASCII１文字を画面に表示する。printなどで使用される
 	@param  c  ８ビットのアスキー文字
@@ -1615,6 +1926,20 @@ size_t Adafruit_GFX::write(uint32_t utf8Code)
 		cursor_x = 0;
 		cursor_y += KanjiHelper::getKanjiWidth() * textsize_y; // 改行
 	} else if (utf8Code != 0x0000000D) {
+		// 等倍・背景あり の文字は、展開済みのピクセルをキャッシュから直接送る
+		bool isCacheable = (pGlyphCache != nullptr && textsize_x == 1 && textsize_y == 1 && textcolor != textbgcolor);
+		if (isCacheable) {
+			const GlyphCacheEntry* pEntry = pGlyphCache->find(utf8Code, KanjiHelper::getFont(), textcolor, textbgcolor);
+			if (pEntry != nullptr) {
+				if (wrap && (cursor_x + pEntry->w) > _width) {
+					cursor_x = 0;
+					cursor_y = cursor_y + pEntry->h;
+				}
+				drawGlyph565(cursor_x, cursor_y, pEntry->w, pEntry->h, pGlyphCache->getPixels(pEntry));
+				cursor_x = cursor_x + pEntry->w;
+				return 1;
+			}
+		}
 		const uint8_t* bmpData;
 		uint8_t w;
 		uint8_t h;
@@ -1643,7 +1968,13 @@ size_t Adafruit_GFX::write(uint32_t utf8Code)
 				cursor_y = cursor_y + h * textsize_y;
 			}
 		}
-		drawChar(cursor_x, cursor_y, w, h, bmpData, textcolor, textbgcolor, textsize_x, textsize_y);
+		uint16_t* pPixels = isCacheable ? pGlyphCache->insert(utf8Code, KanjiHelper::getFont(), textcolor, textbgcolor, w, h) : nullptr;
+		if (pPixels != nullptr) {
+			GlyphCache::expand(bmpData, w, h, textcolor, textbgcolor, pPixels, 0, KanjiHelper::getBitsPerPixel());
+			drawGlyph565(cursor_x, cursor_y, w, h, pPixels);
+		} else {
+			drawChar(cursor_x, cursor_y, w, h, bmpData, textcolor, textbgcolor, textsize_x, textsize_y);
+		}
 		cursor_x = cursor_x + w * textsize_x;
 		return 1;
 	}
@@ -1839,15 +2170,203 @@ void Adafruit_GFX::getTextBounds(const __FlashStringHelper* str, int16_t x,
 	}
 }
 
+/*!
+  @brief  位置を指定して書式付きの文字列を表示する
+  @param  x       表示開始位置
+  @param  y       表示開始位置
+  @param  format  書式
+  @details 背景ありの漢字文字列は、vprintf()を通して行単位でまとめて描かれる。
+*/
 void Adafruit_GFX::printlocf(uint16_t x, uint16_t y, const char* format, ...)
 {
 	setCursor(x, y);
 	va_list args;
 	va_start(args, format);
-	char buffer[64];
-	Print::vprintf(format, args);
+	vprintf(format, args);
+	va_end(args);
+}
+
+/*!
+  @brief  書式付きの文字列を表示する
+  @param  format  書式
+  @return 書き込まれた文字数（書式展開後のバイト数）
+*/
+size_t Adafruit_GFX::printf(const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	size_t written = vprintf(format, args);
 	va_end(args);
+	return written;
+}
 
+/*!
+  @brief  書式付きの文字列を表示する（va_list版）
+  @param  format  書式
+  @param  args    引数
+  @return 書き込まれた文字数（書式展開後のバイト数）
+  @details
+	Print::vprintfと同じく1024バイトのバッファに展開し、背景ありの漢字文字列ならwriteTextRun()で、
+	それ以外はprint()で１文字ずつ描く。
+*/
+size_t Adafruit_GFX::vprintf(const char* format, va_list args)
+{
+	char buffer[TEXT_RUN_PRINTF_BUF];
+	int written = vsnprintf(buffer, sizeof(buffer), format, args);
+	if (written < 0) return 0;
+#if USE_TEXT_RUN
+	if (isTextRunnable()) {
+		size_t len = ((size_t)written < sizeof(buffer)) ? (size_t)written : sizeof(buffer) - 1;
+		writeTextRun((const uint8_t*)buffer, len);
+		return (size_t)written;
+	}
+#endif
+	print(buffer);
+	return (size_t)written;
+}
+
+#if USE_TEXT_RUN
+static uint16_t textRunBuf[TEXT_RUN_BUF_PIXELS]; ///< 文字列１行分のRGB565バッファ（全インスタンスで共用）
+#endif
+
+/*!
+  @brief  UTF-8の文字列を、行単位でまとめて描画する
+  @param  buffer  文字列（UTF-8）
+  @param  size    バイト数
+  @return 描画した文字数
+  @details
+	write(uint32_t)は１文字ごとにウインドウを指定してトランザクションを張るので、
+	ここでは１行分の文字を、行の高さ（半角・全角の高い方）×行の幅のバッファに並べて展開し、
+	drawGlyph565()で１回のウインドウ指定と連続転送で送る。
+	高さの低い文字の下や、フォントに無い文字の部分は、同じバッファの中で背景色で埋めるので、別に消去する必要はない。
+	改行・右端での折り返し・バッファが一杯になったところで行を区切って送る。
+	展開済みの文字がグリフキャッシュにあればそれをコピーし、無ければキャッシュに追加する。
+	行単位で描けない状態（漢字モードでない、拡大あり、背景なし）では、write()で１文字ずつ描く。
+*/
+size_t Adafruit_GFX::writeTextRun(const uint8_t* buffer, size_t size)
+{
+#if USE_TEXT_RUN
+	if (!isTextRunnable() || KanjiHelper::getFont() == nullptr) return write(buffer, size);
+
+	uint8_t asciiH = KanjiHelper::getAsciiHeight();
+	uint8_t kanjiH = KanjiHelper::getKanjiHeight();
+	int16_t lineH = (asciiH > kanjiH) ? asciiH : kanjiH;
+	if (lineH <= 0) return write(buffer, size);
+	int16_t maxRunW = TEXT_RUN_BUF_PIXELS / lineH;
+
+	size_t charCount = 0;
+	size_t i = 0;
+	while (i < size) {
+		int16_t runX = cursor_x;
+		int16_t runW = 0;
+		bool isNewline = false;
+		int16_t wrapH = 0;
+		while (i < size) {
+			uint32_t code;
+			uint8_t step = decodeUtf8(buffer + i, size - i, &code);
+			if (step == 0) {
+				i = size; // 不正なUTF-8バイト以降は描かない
+				break;
+			}
+			if (code == 0x0000000A) {
+				i += step;
+				charCount++;
+				isNewline = true;
+				break;
+			}
+			if (code == 0x0000000D) {
+				i += step;
+				charCount++;
+				continue;
+			}
+
+			// 文字を探す。キャッシュにあれば展開済みのピクセルを使う
+			const GlyphCacheEntry* pEntry = (pGlyphCache != nullptr) ? pGlyphCache->find(code, KanjiHelper::getFont(), textcolor, textbgcolor) : nullptr;
+			const KanjiData* pFont = nullptr;
+			uint8_t w;
+			uint8_t h;
+			if (pEntry != nullptr) {
+				w = pEntry->w;
+				h = pEntry->h;
+			} else {
+				pFont = (code <= 0xFF) ? KanjiHelper::FindAscii(code) : KanjiHelper::FindKanji(code);
+				if (pFont != nullptr) {
+					w = pFont->width;
+					h = pFont->height;
+				} else {
+					w = (code <= 0xFF) ? KanjiHelper::getAsciiWidth() : KanjiHelper::getKanjiWidth();
+					h = 0; // フォントに無い文字は背景色で埋めて進める
+				}
+			}
+			if (h > lineH) h = lineH;
+
+			if (wrap && (runX + runW) > 0 && (runX + runW + w) > _width) {
+				wrapH = (h > 0) ? h : lineH; // 右端を超えるので、この文字は次の行に回す
+				break;
+			}
+			if (runW + w > maxRunW) {
+				if (runW == 0) { // バッファに入らない大きな文字は１文字ずつ描く
+					write(code);
+					i += step;
+					charCount++;
+					runX = cursor_x;
+					continue;
+				}
+				break; // バッファが一杯なので、ここまでを送って同じ行を続ける
+			}
+
+			// バッファのこの文字の位置に展開する
+			uint16_t* pDst = textRunBuf + runW;
+			if (pEntry != nullptr) {
+				const uint16_t* pSrc = pGlyphCache->getPixels(pEntry);
+				for (int16_t yy = 0; yy < h; yy++) {
+					memcpy(pDst + yy * maxRunW, pSrc + yy * w, w * sizeof(uint16_t));
+				}
+			} else if (pFont != nullptr) {
+				const uint8_t* bmpData = KanjiHelper::getBmpData(pFont);
+				uint16_t* pPixels = (pGlyphCache != nullptr) ? pGlyphCache->insert(code, KanjiHelper::getFont(), textcolor, textbgcolor, w, h) : nullptr;
+				if (pPixels != nullptr) {
+					GlyphCache::expand(bmpData, w, h, textcolor, textbgcolor, pPixels, 0, KanjiHelper::getBitsPerPixel());
+					for (int16_t yy = 0; yy < h; yy++) {
+						memcpy(pDst + yy * maxRunW, pPixels + yy * w, w * sizeof(uint16_t));
+					}
+				} else {
+					GlyphCache::expand(bmpData, w, h, textcolor, textbgcolor, pDst, maxRunW, KanjiHelper::getBitsPerPixel());
+				}
+			}
+			for (int16_t yy = h; yy < lineH; yy++) {
+				uint16_t* pFill = pDst + yy * maxRunW;
+				for (uint8_t xx = 0; xx < w; xx++) {
+					pFill[xx] = textbgcolor;
+				}
+			}
+			runW += w;
+			i += step;
+			charCount++;
+		}
+
+		if (runW > 0) {
+			// バッファは maxRunW ピクセル間隔で並んでいるので、幅 runW に詰め直してから送る
+			if (runW != maxRunW) {
+				for (int16_t yy = 1; yy < lineH; yy++) {
+					memmove(textRunBuf + yy * runW, textRunBuf + yy * maxRunW, runW * sizeof(uint16_t));
+				}
+			}
+			drawGlyph565(runX, cursor_y, runW, lineH, textRunBuf);
+			cursor_x = runX + runW;
+		}
+		if (isNewline) {
+			cursor_x = 0;
+			cursor_y += KanjiHelper::getKanjiWidth() * textsize_y;
+		} else if (wrapH > 0) {
+			cursor_x = 0;
+			cursor_y = cursor_y + wrapH;
+		}
+	}
+	return charCount;
+#else
+	return write(buffer, size);
+#endif
 }
 #pragma endregion
 
@@ -2159,7 +2678,7 @@ GFXcanvas1::GFXcanvas1(const GFXcanvas1* pSrc, bool allocate_buffer) :
 void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
 	if (buffer) {
-		if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+		if (!isInClip(x, y))
 			return;
 
 		int16_t t;
@@ -2261,6 +2780,10 @@ bool GFXcanvas1::getRawPixel(int16_t x, int16_t y) const
 /**************************************************************************/
 void GFXcanvas1::fillScreen(uint16_t color)
 {
+	if (isClipped()) { // クリップ矩形の中だけ塗る
+		fillRect(clipLeft(), clipTop(), clipRight() - clipLeft(), clipBottom() - clipTop(), color);
+		return;
+	}
 	if (buffer) {
 		uint32_t bytes = ((WIDTH + 7) / 8) * HEIGHT;
 		memset(buffer, color ? 0xFF : 0x00, bytes);
@@ -2279,28 +2802,12 @@ void GFXcanvas1::fillScreen(uint16_t color)
 void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h,
 							   uint16_t color)
 {
-	if (h < 0) { // Convert negative heights to positive equivalent
-		h *= -1;
-		y -= h - 1;
-		if (y < 0) {
-			h += y;
-			y = 0;
-		}
-	}
-
-	// Edge rejection (no-draw if totally off canvas)
-	if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+	// Clip to the clip rectangle (or the whole canvas)
+	int16_t w = 1;
+	if (!clipRect(x, y, w, h)) {
 		return;
 	}
 
-	if (y < 0) { // Clip top
-		h += y;
-		y = 0;
-	}
-	if (y + h > height()) { // Clip bottom
-		h = height() - y;
-	}
-
 	if (getRotation() == 0) {
 		drawFastRawVLine(x, y, h, color);
 	} else if (getRotation() == 1) {
@@ -2335,28 +2842,12 @@ void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
 							   uint16_t color)
 {
-	if (w < 0) { // Convert negative widths to positive equivalent
-		w *= -1;
-		x -= w - 1;
-		if (x < 0) {
-			w += x;
-			x = 0;
-		}
-	}
-
-	// Edge rejection (no-draw if totally off canvas)
-	if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+	// Clip to the clip rectangle (or the whole canvas)
+	int16_t h = 1;
+	if (!clipRect(x, y, w, h)) {
 		return;
 	}
 
-	if (x < 0) { // Clip left
-		w += x;
-		x = 0;
-	}
-	if (x + w >= width()) { // Clip right
-		w = width() - x;
-	}
-
 	if (getRotation() == 0) {
 		drawFastRawHLine(x, y, w, color);
 	} else if (getRotation() == 1) {
@@ -2586,7 +3077,7 @@ GFXcanvas8* GFXcanvas8::deepCopy(const GFXcanvas8* src)
 void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
 	if (buffer) {
-		if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+		if (!isInClip(x, y))
 			return;
 
 		int16_t t;
@@ -2669,6 +3160,10 @@ uint8_t GFXcanvas8::getRawPixel(int16_t x, int16_t y) const
 /**************************************************************************/
 void GFXcanvas8::fillScreen(uint16_t color)
 {
+	if (isClipped()) { // クリップ矩形の中だけ塗る
+		fillRect(clipLeft(), clipTop(), clipRight() - clipLeft(), clipBottom() - clipTop(), color);
+		return;
+	}
 	if (buffer) {
 		memset(buffer, color, WIDTH * HEIGHT);
 	}
@@ -2687,28 +3182,12 @@ void GFXcanvas8::fillScreen(uint16_t color)
 void GFXcanvas8::drawFastVLine(int16_t x, int16_t y, int16_t h,
 							   uint16_t color)
 {
-	if (h < 0) { // Convert negative heights to positive equivalent
-		h *= -1;
-		y -= h - 1;
-		if (y < 0) {
-			h += y;
-			y = 0;
-		}
-	}
-
-	// Edge rejection (no-draw if totally off canvas)
-	if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+	// Clip to the clip rectangle (or the whole canvas)
+	int16_t w = 1;
+	if (!clipRect(x, y, w, h)) {
 		return;
 	}
 
-	if (y < 0) { // Clip top
-		h += y;
-		y = 0;
-	}
-	if (y + h > height()) { // Clip bottom
-		h = height() - y;
-	}
-
 	if (getRotation() == 0) {
 		drawFastRawVLine(x, y, h, color);
 	} else if (getRotation() == 1) {
@@ -2744,28 +3223,12 @@ void GFXcanvas8::drawFastVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas8::drawFastHLine(int16_t x, int16_t y, int16_t w,
 							   uint16_t color)
 {
-	if (w < 0) { // Convert negative widths to positive equivalent
-		w *= -1;
-		x -= w - 1;
-		if (x < 0) {
-			w += x;
-			x = 0;
-		}
-	}
-
-	// Edge rejection (no-draw if totally off canvas)
-	if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+	// Clip to the clip rectangle (or the whole canvas)
+	int16_t h = 1;
+	if (!clipRect(x, y, w, h)) {
 		return;
 	}
 
-	if (x < 0) { // Clip left
-		w += x;
-		x = 0;
-	}
-	if (x + w >= width()) { // Clip right
-		w = width() - x;
-	}
-
 	if (getRotation() == 0) {
 		drawFastRawHLine(x, y, w, color);
 	} else if (getRotation() == 1) {
@@ -3003,7 +3466,7 @@ GFXcanvas16* GFXcanvas16::deepCopy(const GFXcanvas16* src)
 void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
 	if (buffer) {
-		if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+		if (!isInClip(x, y))
 			return;
 
 		int16_t t;
@@ -3028,6 +3491,67 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color)
 	}
 }
 
+/*!
+  @brief  RGB565に展開済みの文字をキャンバスに描画する。
+  @param  x       描画開始位置の左上座標
+  @param  y       描画開始位置の左上座標
+  @param  w       文字の幅
+  @param  h       文字の高さ
+  @param  pixels  w×hのRGB565ピクセル
+  @details
+	回転なしなら、クリップ矩形で切り詰めた範囲を行ごとにmemcpyでコピーする。
+	回転ありは基底クラスの１ドットずつの描画に任せる。
+*/
+void GFXcanvas16::drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels)
+{
+	if (buffer && rotation == 0) {
+		int16_t srcW = w;
+		int16_t bx, by;
+		if (!clipBitmap(x, y, w, h, bx, by)) return;
+		pixels += by * srcW + bx;
+		uint16_t* pDst = buffer + x + y * WIDTH;
+		for (int16_t yy = 0; yy < h; yy++) {
+			memcpy(pDst, pixels, w * sizeof(uint16_t));
+			pDst += WIDTH;
+			pixels += srcW;
+		}
+		return;
+	}
+	Adafruit_GFX::drawGlyph565(x, y, w, h, pixels);
+}
+
+/*!
+  @brief  区間で表したスプライトを、区間ごとにバッファへコピーする。
+  @param  x       左上のX座標
+  @param  y       左上のY座標
+  @param  sprite  スプライト
+  @details 回転なしなら、区間をクリップ矩形で切り詰めて直接コピーする。回転ありは基底クラスの描画に任せる。
+*/
+void GFXcanvas16::drawSpanSprite(int16_t x, int16_t y, const SpanSprite& sprite)
+{
+	if (buffer && rotation == 0) {
+		int16_t cx1 = clipLeft(), cy1 = clipTop(), cx2 = clipRight(), cy2 = clipBottom();
+		const uint16_t* pPixel = sprite.pixels;
+		for (uint16_t k = 0; k < sprite.spanCount; k++) {
+			const SpriteSpan& span = sprite.spans[k];
+			const uint16_t* pSrc = pPixel;
+			pPixel += span.len;
+			int16_t sx = x + span.x, sy = y + span.y, len = span.len;
+			if (sy < cy1 || sy >= cy2) continue;
+			if (sx < cx1) {
+				pSrc += cx1 - sx;
+				len -= cx1 - sx;
+				sx = cx1;
+			}
+			if (sx + len > cx2) len = cx2 - sx;
+			if (len <= 0) continue;
+			memcpy(buffer + sx + sy * WIDTH, pSrc, len * sizeof(uint16_t));
+		}
+		return;
+	}
+	Adafruit_GFX::drawSpanSprite(x, y, sprite);
+}
+
 /*!
   @brief  指定座標のピクセル色を取得する。
   @param  x   取得するX座標
@@ -3059,6 +3583,34 @@ uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) const
 	return getRawPixel(x, y);
 }
 
+/*!
+  @brief  矩形の中のピクセルを読み出す
+  @param  x     左上のX座標
+  @param  y     左上のY座標
+  @param  w     幅
+  @param  h     高さ
+  @param  pDst  w×hピクセルの出力先（左上から行の順）
+  @return 読み出せたらtrue。矩形が画面からはみ出す・バッファが無い場合はfalse
+  @details バッファがそのまま画面の内容なので、液晶から読み戻す代わりにここから取り出せる。
+*/
+bool GFXcanvas16::readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t* pDst)
+{
+	if (!buffer || w <= 0 || h <= 0 || x < 0 || y < 0 || (x + w) > _width || (y + h) > _height)
+		return false;
+	if (rotation == 0) {
+		for (int16_t j = 0; j < h; j++) {
+			memcpy(pDst + j * w, buffer + x + (y + j) * WIDTH, w * sizeof(uint16_t));
+		}
+		return true;
+	}
+	for (int16_t j = 0; j < h; j++) {
+		for (int16_t i = 0; i < w; i++) {
+			*pDst++ = getPixel(x + i, y + j);
+		}
+	}
+	return true;
+}
+
 /*!
   @brief  指定座標（回転なし）にあるピクセルの色を取得する。
   @param  x   取得するX座標（バッファ座標系、回転なし）
@@ -3088,6 +3640,10 @@ uint16_t GFXcanvas16::getRawPixel(int16_t x, int16_t y) const
 */
 void GFXcanvas16::fillScreen(uint16_t color)
 {
+	if (isClipped()) { // クリップ矩形の中だけ塗る
+		fillRect(clipLeft(), clipTop(), clipRight() - clipLeft(), clipBottom() - clipTop(), color);
+		return;
+	}
 	if (buffer) {
 		uint8_t hi = color >> 8, lo = color & 0xFF;
 		if (hi == lo) {
@@ -3132,28 +3688,12 @@ void GFXcanvas16::byteSwap(void)
 void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
 								uint16_t color)
 {
-	if (h < 0) { // Convert negative heights to positive equivalent
-		h *= -1;
-		y -= h - 1;
-		if (y < 0) {
-			h += y;
-			y = 0;
-		}
-	}
-
-	// Edge rejection (no-draw if totally off canvas)
-	if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+	// Clip to the clip rectangle (or the whole canvas)
+	int16_t w = 1;
+	if (!clipRect(x, y, w, h)) {
 		return;
 	}
 
-	if (y < 0) { // Clip top
-		h += y;
-		y = 0;
-	}
-	if (y + h > height()) { // Clip bottom
-		h = height() - y;
-	}
-
 	if (getRotation() == 0) {
 		drawFastRawVLine(x, y, h, color);
 	} else if (getRotation() == 1) {
@@ -3189,28 +3729,12 @@ void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w,
 								uint16_t color)
 {
-	if (w < 0) { // Convert negative widths to positive equivalent
-		w *= -1;
-		x -= w - 1;
-		if (x < 0) {
-			w += x;
-			x = 0;
-		}
-	}
-
-	// Edge rejection (no-draw if totally off canvas)
-	if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+	// Clip to the clip rectangle (or the whole canvas)
+	int16_t h = 1;
+	if (!clipRect(x, y, w, h)) {
 		return;
 	}
 
-	if (x < 0) { // Clip left
-		w += x;
-		x = 0;
-	}
-	if (x + w >= width()) { // Clip right
-		w = width() - x;
-	}
-
 	if (getRotation() == 0) {
 		drawFastRawHLine(x, y, w, color);
 	} else if (getRotation() == 1) {
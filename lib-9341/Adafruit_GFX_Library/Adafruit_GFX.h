@@ -8,7 +8,11 @@
 	#include "misc/KNJGfx_struct.h"
 	#include "core/Print.h"
 	#include "gfxfont.h"
+	#include "SpanRaster.h"
+	#include "PackedImage.h"
+	#include "SpanSprite.h"
 struct KanjiData;
+class GlyphCache;
 #else
 	#if ARDUINO >= 100
 		#include "Arduino.h"
@@ -25,6 +29,18 @@ struct KanjiData;
 	#include <Adafruit_SPIDevice.h>
 #endif
 
+#ifndef USE_TEXT_RUN
+	#define USE_TEXT_RUN 1 ///< printf()/printlocf()の背景ありの文字列を、１行まとめて１回の転送で描く（0で１文字ずつ描く）
+#endif
+#ifndef TEXT_RUN_BUF_PIXELS
+	#define TEXT_RUN_BUF_PIXELS (320 * 16) ///< 文字列１行分のバッファのピクセル数。行の高さ×幅がこれを超える行は、分割して送る
+#endif
+#ifndef CHAR_BURST_BUF_PIXELS
+	#define CHAR_BURST_BUF_PIXELS 1024 ///< drawChar()で拡大・階調つきの文字を数行まとめて送るバッファのピクセル数
+#endif
+#define TEXT_RUN_PRINTF_BUF 1024 ///< printf()で書式展開に使うバッファのバイト数（Print::printfと同じ）
+#define GFX_CLIP_STACK_DEPTH 8 ///< pushClipRect()で重ねられるクリップ矩形の数
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -147,21 +163,30 @@ namespace ardPort {
 		void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color);
 		void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
 		void fillCircle(XY xy, int16_t r, uint16_t color) { fillCircle(xy.x, xy.y, r, color); }
+		void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg);
 		void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color);
 		void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 		void drawTriangle(XY xy0, XY xy1, XY xy2, uint16_t color) { drawTriangle(xy0.x, xy0.y, xy1.x, xy1.y, xy2.x, xy2.y, color); }
 		void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 		void fillTriangle(XY xy0, XY xy1, XY xy2, uint16_t color) { fillTriangle(xy0.x, xy0.y, xy1.x, xy1.y, xy2.x, xy2.y, color); }
+		void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint16_t bg);
 		void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
 		void drawRoundRect(XYWH xywh, int16_t radius, uint16_t color) { drawRoundRect(xywh.x, xywh.y, xywh.w, xywh.h, radius, color); }
 		void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
 		void fillRoundRect(XYWH xywh, int16_t radius, uint16_t color) { fillRoundRect(xywh.x, xywh.y, xywh.w, xywh.h, radius, color); }
+		void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color, uint16_t bg);
+		void fillRoundRect(XYWH xywh, int16_t radius, uint16_t color, uint16_t bg) { fillRoundRect(xywh.x, xywh.y, xywh.w, xywh.h, radius, color, bg); }
+		virtual void fillSpans(SpanSource& src, uint16_t color);
+		virtual void fillSpansOpaque(SpanSource& src, uint16_t color, uint16_t bg);
 
 		void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
 		void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
 		void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color);
 		void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg);
 		void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+		virtual void drawPackedImage(int16_t x, int16_t y, const PackedImage& img);
+		virtual void drawSpanSprite(int16_t x, int16_t y, const SpanSprite& sprite);
+		virtual void drawIndexedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint16_t palette[], uint8_t bpp, int16_t w, int16_t h);
 		void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h);
 		void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h);
 		void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h);
@@ -191,6 +216,14 @@ namespace ardPort {
 		// virtual void drawChar(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* bmpData, uint16_t color, uint16_t bg, uint8_t size);
 
 		virtual void drawChar(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* bmpData, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y);
+		// RGB565に展開済みの文字を描画する（グリフキャッシュから呼ばれる）
+		virtual void drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+		/// @brief 展開済みの文字を再利用するキャッシュを設定する。nullptrでキャッシュを使わない
+		void setGlyphCache(GlyphCache* a_pCache) { pGlyphCache = a_pCache; }
+		/// @brief 設定されている文字のキャッシュ（未設定ならnullptr）
+		GlyphCache* getGlyphCache() const { return pGlyphCache; }
+		// 描かれている内容を読み出す（ポップアップの下を保存するため）。読み出せない表示器ではfalse
+		virtual bool readRect(int16_t, int16_t, int16_t, int16_t, uint16_t*) { return false; }
 
 		void getTextBounds(const char* string, int16_t x, int16_t y, int16_t* x1,
 						   int16_t* y1, uint16_t* w, uint16_t* h);
@@ -203,8 +236,14 @@ namespace ardPort {
 
 		void setFont(const GFXfont* f = NULL);
 		// 漢字フォントを使用する場合はこっちが呼び出される
-		void setFont(const KanjiData* a_pKanjiData, const uint8_t* a_pBmpData);
+		void setFont(const KanjiData* a_pKanjiData, const uint8_t* a_pBmpData, uint8_t bpp = 1);
 		void printlocf(uint16_t x, uint16_t y, const char* format, ...);
+		// 背景ありの漢字文字列は、行単位でまとめて描く（Print::printf/vprintfを隠す）
+		size_t printf(const char* format, ...);
+		size_t vprintf(const char* format, va_list args);
+		size_t writeTextRun(const uint8_t* buffer, size_t size);
+		/// @brief 行単位の描画が使える状態か（漢字モード・等倍・背景あり）
+		bool isTextRunnable() const { return isKanji && textsize_x == 1 && textsize_y == 1 && textcolor != textbgcolor; }
 
 		/**********************************************************************/
 		/*!
@@ -362,9 +401,28 @@ namespace ardPort {
 		/************************************************************************/
 		int16_t getCursorY(void) const { return cursor_y; };
 
+		// クリップ矩形。すべての描画は、現在のクリップ矩形（スタックが空なら画面全体）の中だけに描かれる
+		bool pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h);
+		void popClipRect(void);
+		/// @brief クリップ矩形をすべて外す
+		void resetClipRect(void) { clipDepth = 0; }
+		/// @brief クリップ矩形が設定されているか
+		bool isClipped(void) const { return clipDepth > 0; }
+		int16_t clipLeft(void) const { return clipDepth ? clipStack[clipDepth - 1].x1 : 0; }         ///< クリップ矩形の左端
+		int16_t clipTop(void) const { return clipDepth ? clipStack[clipDepth - 1].y1 : 0; }          ///< クリップ矩形の上端
+		int16_t clipRight(void) const { return clipDepth ? clipStack[clipDepth - 1].x2 : _width; }   ///< クリップ矩形の右端（含まない）
+		int16_t clipBottom(void) const { return clipDepth ? clipStack[clipDepth - 1].y2 : _height; } ///< クリップ矩形の下端（含まない）
+		/// @brief 点がクリップ矩形の中にあるか
+		bool isInClip(int16_t x, int16_t y) const { return x >= clipLeft() && y >= clipTop() && x < clipRight() && y < clipBottom(); }
+		/// @brief 矩形全体がクリップ矩形の中にあるか
+		bool isRectInClip(int16_t x, int16_t y, int16_t w, int16_t h) const { return x >= clipLeft() && y >= clipTop() && (x + w) <= clipRight() && (y + h) <= clipBottom(); }
+		bool clipRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const;
+		bool clipBitmap(int16_t& x, int16_t& y, int16_t& w, int16_t& h, int16_t& bx, int16_t& by) const;
+
 	  protected:
 		void charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minx,
 						int16_t* miny, int16_t* maxx, int16_t* maxy);
+		void writeSpanRun(const SpanSource& src, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bg, bool isOpaque);
 		int16_t WIDTH;        ///< This is the 'raw' display width - never changes
 		int16_t HEIGHT;       ///< This is the 'raw' display height - never changes
 		int16_t _width;       ///< Display width as modified by current rotation
@@ -379,6 +437,17 @@ namespace ardPort {
 		bool wrap;            ///< If set, 'wrap' text at right edge of display
 		bool _cp437;          ///< If set, use correct CP437 charset (default is off)
 		GFXfont* gfxFont;     ///< Pointer to special font
+		GlyphCache* pGlyphCache = nullptr; ///< 展開済みの文字のキャッシュ（未使用ならnullptr）
+
+		/// @brief クリップ矩形（x2, y2は含まない）
+		struct ClipRect {
+			int16_t x1;
+			int16_t y1;
+			int16_t x2;
+			int16_t y2;
+		};
+		ClipRect clipStack[GFX_CLIP_STACK_DEPTH]; ///< 重ねたクリップ矩形（それまでの矩形との共通部分を積む）
+		uint8_t clipDepth = 0;                    ///< 重ねたクリップ矩形の数
 
 		// テキスト色の一時保存用スタック
 		struct TextColorState {
@@ -623,6 +692,9 @@ namespace ardPort {
 		void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
 		void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 		uint16_t getPixel(int16_t x, int16_t y) const;
+		bool readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t* pDst);
+		void drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+		void drawSpanSprite(int16_t x, int16_t y, const SpanSprite& sprite);
 		/**********************************************************************/
 		/*!
 		  @brief    Get a pointer to the internal buffer memory
@@ -112,11 +112,6 @@ static const struct
 
 #endif // end USE_SPI_DMA
 
-// Possible values for Adafruit_SPITFT.connection:
-#define TFT_HARD_SPI 0 ///< Display interface = hardware SPI
-#define TFT_SOFT_SPI 1 ///< Display interface = software SPI
-#define TFT_PARALLEL 2 ///< Display interface = 8- or 16-bit parallel
-
 // CONSTRUCTORS ------------------------------------------------------------
 
 /*!
@@ -686,6 +681,10 @@ void Adafruit_SPITFT::initSPI(uint32_t freq, uint8_t spiMode)
 		{
 			hwspi._spi->begin();
 		}
+#if defined(ARDUINO_ARCH_RP2040)
+		// 同じバスの他のデバイスが使う前に、非同期のDMA転送を終わらせる
+		static_cast<SPIClassRP2040 *>(hwspi._spi)->setBusWait(dmaWaitHook, this);
+#endif
 	}
 	else if (connection == TFT_SOFT_SPI)
 	{
@@ -1052,6 +1051,13 @@ void Adafruit_SPITFT::startWrite(void)
 	SPI_BEGIN_TRANSACTION();
 	if (_cs >= 0)
 		SPI_CS_LOW();
+#if TFT_PROFILE && defined(ARDUINO_ARCH_RP2040)
+	if (profileDepth++ == 0)
+	{
+		profile.transactions++;
+		profileOpenUs = time_us_32();
+	}
+#endif
 }
 
 /*!
@@ -1062,9 +1068,17 @@ void Adafruit_SPITFT::startWrite(void)
 */
 void Adafruit_SPITFT::endWrite(void)
 {
+#if defined(ARDUINO_ARCH_RP2040)
+	if (dmaPending)
+		dmaWaitInWrite(); // このendWrite()で閉じる
+#endif
 	if (_cs >= 0)
 		SPI_CS_HIGH();
 	SPI_END_TRANSACTION();
+#if TFT_PROFILE && defined(ARDUINO_ARCH_RP2040)
+	if (profileDepth > 0 && --profileDepth == 0)
+		profile.busyUs += time_us_32() - profileOpenUs;
+#endif
 }
 
 // -------------------------------------------------------------------------
@@ -1083,10 +1097,11 @@ void Adafruit_SPITFT::endWrite(void)
 */
 void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color)
 {
-	if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height))
+	if (isInClip(x, y))
 	{
 		setAddrWindow(x, y, 1, 1);
 		SPI_WRITE16(color);
+		TFT_PROFILE_ADD(pixelBytes, 2);
 	}
 }
 
@@ -1126,6 +1141,7 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block,
 {
 	if (!len)
 		return; // Avoid 0-byte transfers
+	TFT_PROFILE_ADD(pixelBytes, len * 2);
 
 	// avoid paramater-not-used complaints
 	(void)block;
@@ -1160,8 +1176,18 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block,
 #elif defined(ARDUINO_ARCH_RP2040)
 	spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
 
+	dmaWaitInWrite(); // 前の非ブロッキング転送を終わらせる
 	if (!bigEndian)
 	{
+#if USE_RP2040_DMA_BLIT
+		if (len >= RP2040_DMA_BLIT_MIN)
+		{
+			dmaStart(pi_spi, colors, len, true);
+			if (block)
+				dmaWait();
+			return;
+		}
+#endif
 		// switch to 16-bit writes
 		hw_write_masked(&spi_get_hw(pi_spi)->cr0, 15 << SPI_SSPCR0_DSS_LSB,
 						SPI_SSPCR0_DSS_BITS);
@@ -1335,6 +1361,20 @@ void Adafruit_SPITFT::dmaWait(void)
 		pinPeripheral(tft8._wr, PIO_OUTPUT); // Switch WR back to GPIO
 	}
 #endif // end __SAMD51__ || ARDUINO_SAMD_ZERO
+#elif defined(ARDUINO_ARCH_RP2040)
+	if (pPioStream != nullptr && pPioStream->isListRunning())
+		pPioStream->waitList(); // 描画命令リストの送信中なら、ピンをSPIに戻してから進む
+	if (!dmaPending)
+		return;
+	spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+	dmaFinish(pi_spi);
+	dmaPending = false;
+	if (dmaEndWritePending)
+	{
+		// drawRGBBitmap()が非同期で戻ったときは、ここでトランザクションを閉じる
+		dmaEndWritePending = false;
+		endWrite();
+	}
 #endif
 }
 /*!
@@ -1345,11 +1385,339 @@ bool Adafruit_SPITFT::dmaBusy(void) const
 {
 #if defined(USE_SPI_DMA) && (defined(__SAMD51__) || defined(ARDUINO_SAMD_ZERO))
 	return dma_busy;
+#elif defined(ARDUINO_ARCH_RP2040)
+	if (!dmaPending)
+		return false;
+	spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+	return dma_channel_is_busy(dmaChannel) ||
+		   (spi_get_hw(pi_spi)->sr & SPI_SSPSR_BSY_BITS);
 #else
 	return false;
 #endif
 }
 
+#if defined(ARDUINO_ARCH_RP2040)
+/*!
+	@brief  DMAで16ビットのピクセル列をSPIに送信し始めます。完了は待ちません。
+	@param  pi_spi     送信に使うSPIインスタンス。
+	@param  src        送信するデータ。XIPフラッシュ上の画像をそのまま指定してよい。
+	@param  len        送信するピクセル数。
+	@param  increment  trueなら src を配列として読み進める。falseなら同じワードを len 回送る（塗りつぶし）。
+	@details SPIを16ビットフレームに切り替え、DMAで DR に書き込む。16ビットフレームではMSBから送出されるので、
+	8ビット送信時のようなバイトスワップは不要。DMAチャネルは最初の呼び出しで確保し、以降は使いまわす。
+	後始末（8ビットフレームに戻す）は dmaWait() で行う。
+*/
+void Adafruit_SPITFT::dmaStart(spi_inst_t *pi_spi, const void *src, uint32_t len, bool increment)
+{
+	dmaWaitInWrite(); // 前の転送が残っていれば先に終わらせる
+	if (dmaChannel < 0)
+	{
+		dmaChannel = dma_claim_unused_channel(true);
+	}
+
+	dma_channel_config c = dma_channel_get_default_config(dmaChannel);
+	channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+	channel_config_set_dreq(&c, spi_get_dreq(pi_spi, true));
+	channel_config_set_read_increment(&c, increment);
+	channel_config_set_write_increment(&c, false);
+
+	// switch to 16-bit writes
+	hw_write_masked(&spi_get_hw(pi_spi)->cr0, 15 << SPI_SSPCR0_DSS_LSB,
+					SPI_SSPCR0_DSS_BITS);
+	// SPIClassRP2040::finishedAsync() がDREQを止めることがあるので、毎回有効にする
+	hw_set_bits(&spi_get_hw(pi_spi)->dmacr, SPI_SSPDMACR_TXDMAE_BITS);
+	dmaPending = true;
+	dma_channel_configure(dmaChannel, &c,
+						  &spi_get_hw(pi_spi)->dr, // write address
+						  src,					  // read address
+						  len,					  // element count
+						  true);				  // start now
+}
+
+/*!
+	@brief  DMAが終わるのを待ち、SPIを8ビットフレームに戻します。
+	@param  pi_spi  送信に使っているSPIインスタンス。
+	@details DMA完了後もTX FIFOにデータが残っているので、SPIがビジーでなくなるのを待ってから切り替える。
+	送信中に受信FIFOに溜まったゴミも捨てておく。
+*/
+void Adafruit_SPITFT::dmaFinish(spi_inst_t *pi_spi)
+{
+	dma_channel_wait_for_finish_blocking(dmaChannel);
+	while (spi_get_hw(pi_spi)->sr & SPI_SSPSR_BSY_BITS)
+		tight_loop_contents();
+	while (spi_is_readable(pi_spi))
+		(void)spi_get_hw(pi_spi)->dr;
+	spi_get_hw(pi_spi)->icr = SPI_SSPICR_RORIC_BITS;
+
+	// switch back to 8-bit
+	hw_write_masked(&spi_get_hw(pi_spi)->cr0, 7 << SPI_SSPCR0_DSS_LSB,
+					SPI_SSPCR0_DSS_BITS);
+}
+
+/*!
+	@brief  トランザクションの中で、実行中のDMAを終わらせる。
+	@details
+		DCやCSを切り替える前と、SPIに次のバイトを書く前に呼ぶ。DMAの完了前にDCを下げると、送信中のピクセルがコマンドとして届く。
+		呼び出し側のトランザクションの中なので、drawRGBBitmap()などが非同期で戻ったときのendWrite()（dmaEndWritePending）はここでは行わず、
+		呼び出し側のendWrite()に任せる。
+*/
+void Adafruit_SPITFT::dmaWaitInWrite(void)
+{
+	dmaEndWritePending = false;
+	dmaWait();
+}
+
+/*!
+	@brief  SPIClassRP2040::beginTransaction() から呼ばれ、実行中のDMAを終わらせる。
+	@param  ctx  Adafruit_SPITFTのインスタンス。
+	@details タッチパネルなど、同じSPIバスを使う別のデバイスがトランザクションを始める前に、
+	非同期で送っている画像の転送を完了させるために使う。
+*/
+void Adafruit_SPITFT::dmaWaitHook(void *ctx)
+{
+	((Adafruit_SPITFT *)ctx)->dmaWait();
+}
+
+/*!
+	@brief  PIOの送信経路で、ウインドウ指定とピクセルデータをまとめて送ります。
+	@param  x       ウインドウの左上（画面内であること）
+	@param  y       ウインドウの左上（画面内であること）
+	@param  w       幅
+	@param  h       高さ
+	@param  pixels  w×hのRGB565ピクセル。isFillなら１ピクセル分の色
+	@param  isFill  trueならpixels[0]の色で塗りつぶす
+	@return PIOで送ったらtrue。PIOが設定されていない、または小さすぎる描画はfalseを返すので、呼び出し側がSPIで送る
+	@details
+		SPIのDMAと送信FIFOが空になってから、ピンをPIOに渡して送り、完了後にSPIへ戻す。
+		ウインドウはsetAddrWindow()を通らずに変わるので、サブクラスが覚えているウインドウを捨てる。
+*/
+bool Adafruit_SPITFT::writeWindowPIO(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels, bool isFill)
+{
+	if (pPioStream == nullptr || !pPioStream->isReady() || (uint32_t)w * h < RP2040_PIO_WINDOW_MIN)
+		return false;
+	spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+	dmaWait();
+	while (spi_is_busy(pi_spi))
+		tight_loop_contents();
+	pPioStream->writeWindow(x, y, w, h, pixels, isFill);
+	invalidateAddrWindow();
+	TFT_PROFILE_ADD(transactions, 1);
+	TFT_PROFILE_ADD(windows, 1);
+	TFT_PROFILE_ADD(commandBytes, 11); // CASET+4, PASET+4, RAMWR
+	TFT_PROFILE_ADD(pixelBytes, (uint32_t)w * h * 2);
+	return true;
+}
+
+/*!
+	@brief  記録した描画命令リストを液晶に送ります。
+	@param  list  送るリスト
+	@details
+		PIOの送信経路があれば、DMAの制御ブロックのチェーンで送信を始めてすぐに戻る。CPUが関わるのは起動の１回だけになる。
+		送信中のリストは、次の描画（SPIのトランザクション開始）かdmaWait()、またはlist.clear()で完了を待つ。
+		PIOが無ければ、リストを先頭から解釈してSPIで送る（完了してから戻る）。
+		どちらの場合もウインドウはsetAddrWindow()を通らずに変わるので、サブクラスが覚えているウインドウを捨てる。
+*/
+void Adafruit_SPITFT::submitList(TftDisplayList &list)
+{
+	if (list.isEmpty())
+		return;
+	spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+	dmaWait();
+	if (pPioStream != nullptr && pPioStream->isReady())
+	{
+		while (spi_is_busy(pi_spi))
+			tight_loop_contents();
+		pPioStream->startList(list);
+		TFT_PROFILE_ADD(transactions, 1); // リストの中身はPIOが送るので数えない
+	}
+	else
+	{
+		replayList(list);
+	}
+	invalidateAddrWindow();
+}
+
+/*!
+	@brief  描画命令リストを先頭から解釈して、SPIで送ります。
+	@param  list  送るリスト
+	@details ストリームの区間ヘッダ（TftPioStream.pioを参照）を読み、コマンドはwriteCommand()、データはwritePixels()/writeColor()で送る。
+*/
+void Adafruit_SPITFT::replayList(const TftDisplayList &list)
+{
+	enum { STATE_HEADER, STATE_CMD, STATE_DATA } state = STATE_HEADER;
+	uint32_t remain = 0; // データ区間の残りの語数
+	const TftListBlock *pBlocks = list.getBlocks();
+
+	startWrite();
+	for (uint16_t i = 0; i < list.getBlockCount(); i++)
+	{
+		const uint16_t *p = (const uint16_t *)pBlocks[i].readAddr;
+		uint32_t count = pBlocks[i].count;
+		bool isIncrement = TftDisplayList::isIncrement(pBlocks[i]);
+		while (count > 0)
+		{
+			if (state == STATE_DATA)
+			{
+				uint32_t n = (count < remain) ? count : remain;
+				if (isIncrement)
+				{
+					writePixels((uint16_t *)p, n, true, false);
+					p += n;
+				}
+				else
+				{
+					writeColor(*p, n);
+				}
+				count -= n;
+				remain -= n;
+				if (remain == 0)
+					state = STATE_HEADER;
+				continue;
+			}
+			uint16_t word = *p;
+			if (isIncrement)
+				p++;
+			count--;
+			if (state == STATE_CMD)
+			{
+				writeCommand(word >> 8);
+				state = STATE_HEADER;
+			}
+			else if ((word >> 14) == TFT_PIO_MODE_CMD)
+			{
+				state = STATE_CMD;
+			}
+			else if ((word >> 14) == TFT_PIO_MODE_DATA)
+			{
+				remain = (word & 0x3FFF) + 1;
+				state = STATE_DATA;
+			}
+		}
+	}
+	endWrite();
+}
+
+#if USE_RP2040_DMA_FILL
+/*!
+	@brief  DMAを使って、同じ色のピクセルを連続して送信します。
+	@param  pi_spi  送信に使うSPIインスタンス。
+	@param  color   16ビットRGB565フォーマットのピクセル色。
+	@param  len     送信するピクセル数。
+	@details 読み出しアドレスを固定したDMAで１ワードの色を len 回 DR に書き込む。
+			 完了は待たずに戻る。次の送信は dmaWaitInWrite()、endWrite() で終わるのを待つ。
+*/
+void Adafruit_SPITFT::writeColorDMA(spi_inst_t *pi_spi, uint16_t color, uint32_t len)
+{
+	dmaWait();
+	dmaFillWord = color; // DMA中に読み出されるので、メンバに置く
+	dmaStart(pi_spi, &dmaFillWord, len, false);
+}
+#endif // USE_RP2040_DMA_FILL
+#endif // ARDUINO_ARCH_RP2040
+
+#if defined(ARDUINO_ARCH_RP2040)
+/*!
+	@brief  送信量と時間の累計を取得します。
+	@param  counters  累計を返す。TFT_PROFILEが0なら全て0。
+*/
+void Adafruit_SPITFT::getProfile(TftProfileCounters &counters) const
+{
+#if TFT_PROFILE
+	counters = profile;
+#else
+	counters = TftProfileCounters();
+#endif
+}
+
+/*!
+	@brief  送信量と時間の累計と、区間ごとの集計を消します。
+*/
+void Adafruit_SPITFT::resetProfile(void)
+{
+#if TFT_PROFILE
+	profile = TftProfileCounters();
+	for (uint8_t i = 0; i < TFT_PROFILE_MAX_REGIONS; i++)
+		profileRegions[i] = TftProfileRegion();
+	profileRegionCount = 0;
+#endif
+}
+
+/*!
+	@brief  名前をつけた区間に入ります。
+	@param  label  区間の名前（文字列の定数。ポインタで区間を見分ける）
+	@return 区間に入ったときの値。profileEnd()に渡す。
+*/
+TftProfileMark Adafruit_SPITFT::profileBegin(const char *label)
+{
+	TftProfileMark mark;
+	mark.label = label;
+#if TFT_PROFILE
+	mark.startUs = time_us_32();
+	mark.counters = profile;
+#else
+	mark.startUs = 0;
+#endif
+	return mark;
+}
+
+/*!
+	@brief  名前をつけた区間から出て、区間の中の送信量と時間を集計に足します。
+	@param  mark  profileBegin()が返した値
+	@details 区間がTFT_PROFILE_MAX_REGIONSを超えたら、超えた分は集計しない。
+*/
+void Adafruit_SPITFT::profileEnd(const TftProfileMark &mark)
+{
+#if TFT_PROFILE
+	TftProfileRegion *pRegion = nullptr;
+	for (uint8_t i = 0; i < profileRegionCount; i++)
+	{
+		if (profileRegions[i].label == mark.label)
+		{
+			pRegion = &profileRegions[i];
+			break;
+		}
+	}
+	if (pRegion == nullptr)
+	{
+		if (profileRegionCount >= TFT_PROFILE_MAX_REGIONS)
+			return;
+		pRegion = &profileRegions[profileRegionCount++];
+		pRegion->label = mark.label;
+	}
+	pRegion->calls++;
+	pRegion->elapsedUs += time_us_32() - mark.startUs;
+	pRegion->counters.transactions += profile.transactions - mark.counters.transactions;
+	pRegion->counters.windows += profile.windows - mark.counters.windows;
+	pRegion->counters.commandBytes += profile.commandBytes - mark.counters.commandBytes;
+	pRegion->counters.pixelBytes += profile.pixelBytes - mark.counters.pixelBytes;
+	pRegion->counters.busyUs += profile.busyUs - mark.counters.busyUs;
+#else
+	(void)mark;
+#endif
+}
+
+/*!
+	@brief  送信量と時間の累計と、区間ごとの集計を出力します。
+	@param  pfnPrintf  出力に使うprintf形式の関数（シリアルへの出力など）
+*/
+void Adafruit_SPITFT::dumpProfile(void (*pfnPrintf)(const char *format, ...))
+{
+#if TFT_PROFILE
+	pfnPrintf("tft profile: trans %lu win %lu cmd %lu B px %lu B busy %lu us\n",
+			  profile.transactions, profile.windows, profile.commandBytes, profile.pixelBytes, profile.busyUs);
+	for (uint8_t i = 0; i < profileRegionCount; i++)
+	{
+		const TftProfileRegion &r = profileRegions[i];
+		pfnPrintf("  %-12s x%lu %lu us: trans %lu win %lu cmd %lu B px %lu B busy %lu us\n",
+				  r.label, r.calls, r.elapsedUs, r.counters.transactions, r.counters.windows,
+				  r.counters.commandBytes, r.counters.pixelBytes, r.counters.busyUs);
+	}
+#else
+	pfnPrintf("tft profile: disabled (build with TFT_PROFILE=1)\n");
+#endif
+}
+#endif // ARDUINO_ARCH_RP2040
+
 /*!
 	@brief  同じ色のピクセルを連続して描画します。
 	@param  color  16ビットRGB565フォーマットのピクセル色。
@@ -1360,6 +1728,7 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len)
 {
 	if (!len)
 		return; // Avoid 0-byte transfers
+	TFT_PROFILE_ADD(pixelBytes, len * 2);
 
 	uint8_t hi = color >> 8, lo = color;
 
@@ -1590,6 +1959,14 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len)
 		} while (len);
 #elif defined(ARDUINO_ARCH_RP2040)
 		spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+		dmaWaitInWrite();
+#if USE_RP2040_DMA_FILL
+		if (len >= RP2040_DMA_FILL_MIN)
+		{
+			writeColorDMA(pi_spi, color, len);
+			return;
+		}
+#endif
 		color = __builtin_bswap16(color);
 
 		while (len--)
@@ -1737,60 +2114,15 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len)
 	@details 単体では完結せず、startWrite()の後に呼び出す必要があります。
 			通常は高レベルのグラフィックスプリミティブから使用され、ユーザーコードが直接呼び出す必要はありません。
 			ユーザーは通常、自己完結型のfillRect()を使うことになります。
-			writeFillRect()は自身でクリッピングや矩形の範囲外判定を行います。
+			writeFillRect()は自身でクリッピング（クリップ矩形、無ければ画面全体）や矩形の範囲外判定を行います。
 			より低レベルな実装についてはwriteFillRectPreclipped()を参照してください。
-	@note   C言語の最適化の都合で、if分岐側を優先するため、このような深いネスト構造になっています。
-			これにより、不要な分岐を避け、できるだけ早い段階で範囲外の矩形を除外します。
 */
 void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 									uint16_t color)
 {
-	if (w && h)
-	{ // Nonzero width and height?
-		if (w < 0)
-		{				// If negative width...
-			x += w + 1; //   Move X to left edge
-			w = -w;		//   Use positive width
-		}
-		if (x < _width)
-		{ // Not off right
-			if (h < 0)
-			{				// If negative height...
-				y += h + 1; //   Move Y to top edge
-				h = -h;		//   Use positive height
-			}
-			if (y < _height)
-			{ // Not off bottom
-				int16_t x2 = x + w - 1;
-				if (x2 >= 0)
-				{ // Not off left
-					int16_t y2 = y + h - 1;
-					if (y2 >= 0)
-					{ // Not off top
-						// Rectangle partly or fully overlaps screen
-						if (x < 0)
-						{
-							x = 0;
-							w = x2 + 1;
-						} // Clip left
-						if (y < 0)
-						{
-							y = 0;
-							h = y2 + 1;
-						} // Clip top
-						if (x2 >= _width)
-						{
-							w = _width - x;
-						} // Clip right
-						if (y2 >= _height)
-						{
-							h = _height - y;
-						} // Clip bottom
-						writeFillRectPreclipped(x, y, w, h, color);
-					}
-				}
-			}
-		}
+	if (clipRect(x, y, w, h))
+	{ // Rectangle partly or fully overlaps the clip rectangle
+		writeFillRectPreclipped(x, y, w, h, color);
 	}
 }
 
@@ -1806,31 +2138,10 @@ void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 void inline Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w,
 											uint16_t color)
 {
-	if ((y >= 0) && (y < _height) && w)
-	{ // Y on screen, nonzero width
-		if (w < 0)
-		{				// If negative width...
-			x += w + 1; //   Move X to left edge
-			w = -w;		//   Use positive width
-		}
-		if (x < _width)
-		{ // Not off right
-			int16_t x2 = x + w - 1;
-			if (x2 >= 0)
-			{ // Not off left
-				// Line partly or fully overlaps screen
-				if (x < 0)
-				{
-					x = 0;
-					w = x2 + 1;
-				} // Clip left
-				if (x2 >= _width)
-				{
-					w = _width - x;
-				} // Clip right
-				writeFillRectPreclipped(x, y, w, 1, color);
-			}
-		}
+	int16_t h = 1;
+	if (clipRect(x, y, w, h))
+	{ // Line partly or fully overlaps the clip rectangle
+		writeFillRectPreclipped(x, y, w, 1, color);
 	}
 }
 
@@ -1848,31 +2159,10 @@ void inline Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w,
 void inline Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h,
 											uint16_t color)
 {
-	if ((x >= 0) && (x < _width) && h)
-	{ // X on screen, nonzero height
-		if (h < 0)
-		{				// If negative height...
-			y += h + 1; //   Move Y to top edge
-			h = -h;		//   Use positive height
-		}
-		if (y < _height)
-		{ // Not off bottom
-			int16_t y2 = y + h - 1;
-			if (y2 >= 0)
-			{ // Not off top
-				// Line partly or fully overlaps screen
-				if (y < 0)
-				{
-					y = 0;
-					h = y2 + 1;
-				} // Clip top
-				if (y2 >= _height)
-				{
-					h = _height - y;
-				} // Clip bottom
-				writeFillRectPreclipped(x, y, 1, h, color);
-			}
-		}
+	int16_t w = 1;
+	if (clipRect(x, y, w, h))
+	{ // Line partly or fully overlaps the clip rectangle
+		writeFillRectPreclipped(x, y, 1, h, color);
 	}
 }
 
@@ -1892,6 +2182,10 @@ inline void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y,
 													 int16_t w, int16_t h,
 													 uint16_t color)
 {
+#if defined(ARDUINO_ARCH_RP2040)
+	if (writeWindowPIO(x, y, w, h, &color, true))
+		return;
+#endif
 	setAddrWindow(x, y, w, h);
 	writeColor(color, (uint32_t)w * h);
 }
@@ -1913,7 +2207,7 @@ inline void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y,
 void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
 	// Clip first...
-	if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height))
+	if (isInClip(x, y))
 	{
 		// THEN set up transaction (if needed) and draw...
 		startWrite();
@@ -1939,54 +2233,11 @@ void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color)
 void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 							   uint16_t color)
 {
-	if (w && h)
-	{ // Nonzero width and height?
-		if (w < 0)
-		{				// If negative width...
-			x += w + 1; //   Move X to left edge
-			w = -w;		//   Use positive width
-		}
-		if (x < _width)
-		{ // Not off right
-			if (h < 0)
-			{				// If negative height...
-				y += h + 1; //   Move Y to top edge
-				h = -h;		//   Use positive height
-			}
-			if (y < _height)
-			{ // Not off bottom
-				int16_t x2 = x + w - 1;
-				if (x2 >= 0)
-				{ // Not off left
-					int16_t y2 = y + h - 1;
-					if (y2 >= 0)
-					{ // Not off top
-						// Rectangle partly or fully overlaps screen
-						if (x < 0)
-						{
-							x = 0;
-							w = x2 + 1;
-						} // Clip left
-						if (y < 0)
-						{
-							y = 0;
-							h = y2 + 1;
-						} // Clip top
-						if (x2 >= _width)
-						{
-							w = _width - x;
-						} // Clip right
-						if (y2 >= _height)
-						{
-							h = _height - y;
-						} // Clip bottom
-						startWrite();
-						writeFillRectPreclipped(x, y, w, h, color);
-						endWrite();
-					}
-				}
-			}
-		}
+	if (clipRect(x, y, w, h))
+	{ // Rectangle partly or fully overlaps the clip rectangle
+		startWrite();
+		writeFillRectPreclipped(x, y, w, h, color);
+		endWrite();
 	}
 }
 
@@ -2004,33 +2255,12 @@ void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w,
 									uint16_t color)
 {
-	if ((y >= 0) && (y < _height) && w)
-	{ // Y on screen, nonzero width
-		if (w < 0)
-		{				// If negative width...
-			x += w + 1; //   Move X to left edge
-			w = -w;		//   Use positive width
-		}
-		if (x < _width)
-		{ // Not off right
-			int16_t x2 = x + w - 1;
-			if (x2 >= 0)
-			{ // Not off left
-				// Line partly or fully overlaps screen
-				if (x < 0)
-				{
-					x = 0;
-					w = x2 + 1;
-				} // Clip left
-				if (x2 >= _width)
-				{
-					w = _width - x;
-				} // Clip right
-				startWrite();
-				writeFillRectPreclipped(x, y, w, 1, color);
-				endWrite();
-			}
-		}
+	int16_t h = 1;
+	if (clipRect(x, y, w, h))
+	{ // Line partly or fully overlaps the clip rectangle
+		startWrite();
+		writeFillRectPreclipped(x, y, w, 1, color);
+		endWrite();
 	}
 }
 
@@ -2049,33 +2279,12 @@ void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w,
 void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h,
 									uint16_t color)
 {
-	if ((x >= 0) && (x < _width) && h)
-	{ // X on screen, nonzero height
-		if (h < 0)
-		{				// If negative height...
-			y += h + 1; //   Move Y to top edge
-			h = -h;		//   Use positive height
-		}
-		if (y < _height)
-		{ // Not off bottom
-			int16_t y2 = y + h - 1;
-			if (y2 >= 0)
-			{ // Not off top
-				// Line partly or fully overlaps screen
-				if (y < 0)
-				{
-					y = 0;
-					h = y2 + 1;
-				} // Clip top
-				if (y2 >= _height)
-				{
-					h = _height - y;
-				} // Clip bottom
-				startWrite();
-				writeFillRectPreclipped(x, y, 1, h, color);
-				endWrite();
-			}
-		}
+	int16_t w = 1;
+	if (clipRect(x, y, w, h))
+	{ // Line partly or fully overlaps the clip rectangle
+		startWrite();
+		writeFillRectPreclipped(x, y, 1, h, color);
+		endWrite();
 	}
 }
 
@@ -2118,36 +2327,34 @@ void Adafruit_SPITFT::pushColor(uint16_t color)
 */
 void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h)
 {
-	int16_t x2, y2;					// Lower-right coord
-	if ((x >= _width) ||			// Off-edge right
-		(y >= _height) ||			// " top
-		((x2 = (x + w - 1)) < 0) || // " left
-		((y2 = (y + h - 1)) < 0))
-		return; // " bottom
-
-	int16_t bx1 = 0, by1 = 0, // Clipped top-left within bitmap
-		saveW = w;			  // Save original bitmap width value
-	if (x < 0)
-	{ // Clip left
-		w += x;
-		bx1 = -x;
-		x = 0;
-	}
-	if (y < 0)
-	{ // Clip top
-		h += y;
-		by1 = -y;
-		y = 0;
-	}
-	if (x2 >= _width)
-		w = _width - x; // Clip right
-	if (y2 >= _height)
-		h = _height - y; // Clip bottom
+	int16_t bx1, by1,  // Clipped top-left within bitmap
+		saveW = w;		   // Save original bitmap width value
+	if (!clipBitmap(x, y, w, h, bx1, by1))
+		return; // Off the clip rectangle (or the screen)
 
 	pcolors += by1 * saveW + bx1; // Offset bitmap ptr to clipped top-left
+#if defined(ARDUINO_ARCH_RP2040)
+	if (w == saveW && writeWindowPIO(x, y, w, h, pcolors, false))
+		return;
+#endif
 	startWrite();
 	setAddrWindow(x, y, w, h); // Clipped area
 
+#if defined(ARDUINO_ARCH_RP2040) && USE_RP2040_DMA_BLIT
+	if (w == saveW)
+	{
+		// 横方向にクリップされていなければ画像はメモリ上で連続しているので、１回のDMAで送り、完了を待たずに戻る。
+		// トランザクションは、次の描画の開始時か dmaWait() で閉じる。
+		writePixels(pcolors, (uint32_t)w * h, false);
+		if (dmaPending)
+		{
+			dmaEndWritePending = true;
+			return;
+		}
+		endWrite();
+		return;
+	}
+#endif
 	while (h--)
 	{							 // For each (clipped) scanline...
 		writePixels(pcolors, w); // Push one (clipped) row
@@ -2156,6 +2363,64 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int
 	endWrite();
 }
 
+/*!
+	@brief  区間で表したスプライト（SpanSprite）を描画します。
+	@param  x       左上のX座標
+	@param  y       左上のY座標
+	@param  sprite  スプライト
+	@details
+		透過しない区間ごとに１行のウインドウを指定し、区間のピクセルをまとめて送る。
+		次の区間のウインドウ指定でDCを下げるので、区間ごとに転送の完了を待つ。
+		区間はクリップ矩形（無ければ画面）で切り詰め、外れる区間は送らない。
+*/
+void Adafruit_SPITFT::drawSpanSprite(int16_t x, int16_t y, const SpanSprite &sprite)
+{
+	int16_t cx1 = clipLeft(), cy1 = clipTop(), cx2 = clipRight(), cy2 = clipBottom();
+	if (x >= cx2 || y >= cy2 || (x + sprite.width) <= cx1 || (y + sprite.height) <= cy1)
+		return;
+	const uint16_t *pPixel = sprite.pixels;
+	startWrite();
+	for (uint16_t k = 0; k < sprite.spanCount; k++)
+	{
+		const SpriteSpan &span = sprite.spans[k];
+		const uint16_t *pSrc = pPixel;
+		pPixel += span.len;
+		int16_t sx = x + span.x, sy = y + span.y, len = span.len;
+		if (sy < cy1 || sy >= cy2)
+			continue;
+		if (sx < cx1)
+		{ // Clip left
+			pSrc += cx1 - sx;
+			len -= cx1 - sx;
+			sx = cx1;
+		}
+		if (sx + len > cx2)
+			len = cx2 - sx; // Clip right
+		if (len <= 0)
+			continue;
+		setAddrWindow(sx, sy, len, 1);
+		writePixels((uint16_t *)pSrc, len, true);
+	}
+	endWrite();
+}
+
+/*!
+	@brief  RRRGGGBBの８ビット色をRGB565にする表（convert8To565()と同じ計算をコンパイル時に済ませておく）
+*/
+struct Rgb332Palette {
+	uint16_t color[256]; ///< [RRRGGGBB]
+	constexpr Rgb332Palette() : color{}
+	{
+		for (int c = 0; c < 256; c++) {
+			uint16_t r5 = (((c & 0b11100000) >> 5) * 0x1F) / 0x07;
+			uint16_t g6 = (((c & 0b00011100) >> 2) * 0x3F) / 0x07;
+			uint16_t b5 = ((c & 0b00000011) * 0x1F) / 0x03;
+			color[c] = (r5 << 11) | (g6 << 5) | b5;
+		}
+	}
+};
+static constexpr Rgb332Palette rgb332Palette{};
+
 /*!
 	@brief  デバイス依存の機能（描画ウインドウ）を使って、８ビットのビットマップ（透過なし）
 			を描画する。8Bit色（RRRGGGBBフォーマット)は、RGB565に変換して描画される。
@@ -2164,93 +2429,403 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int
 	@param  pcolors  表示する画像データのポインタ。画像データはバイトマップ
 	@param  w        Width of bitmap in pixels.
 	@param  h        Height of bitmap in pixels.
+	@details RRRGGGBBの256色をパレットとみなして、drawIndexedBitmap()で描く。
 */
 void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint8_t *pcolors, int16_t w, int16_t h)
 {
-	int16_t x2, y2;					// Lower-right coord
-	if ((x >= _width) ||			// Off-edge right
-		(y >= _height) ||			// " top
-		((x2 = (x + w - 1)) < 0) || // " left
-		((y2 = (y + h - 1)) < 0))
-		return; // " bottom
-
-	int16_t bx1 = 0, by1 = 0, // Clipped top-left within bitmap
-		saveW = w;			  // Save original bitmap width value
-	if (x < 0)
-	{ // Clip left
-		w += x;
-		bx1 = -x;
-		x = 0;
-	}
-	if (y < 0)
-	{ // Clip top
-		h += y;
-		by1 = -y;
-		y = 0;
-	}
-	if (x2 >= _width)
-		w = _width - x; // Clip right
-	if (y2 >= _height)
-		h = _height - y; // Clip bottom
+	drawIndexedBitmap(x, y, pcolors, rgb332Palette.color, 8, w, h);
+}
 
-	pcolors += by1 * saveW + bx1; // Offset bitmap ptr to clipped top-left
+/*!
+	@brief  パレット番号の並びの一部を、RGB565に展開する
+	@param  row      行の先頭
+	@param  palette  パレット
+	@param  bpp      １ピクセルのビット数（1, 2, 4, 8）
+	@param  start    展開を始めるピクセル（行の先頭から）
+	@param  count    展開するピクセル数
+	@param  pDst     展開先
+	@details バイトの途中から始まる分と終わる分は１ピクセルずつ、間のバイトは１バイト分をまとめて展開する。
+*/
+static void expandIndexedRow(const uint8_t *row, const uint16_t *palette, uint8_t bpp, int16_t start, int16_t count, uint16_t *pDst)
+{
+	const uint8_t mask = (1 << bpp) - 1;
+	const uint8_t perByte = 8 / bpp;
+	int16_t i = start;
+	int16_t end = start + count;
+	while (i < end && (i % perByte) != 0) { // 先頭のバイトの途中から
+		int16_t bit = i * bpp;
+		*pDst++ = palette[(row[bit >> 3] >> (8 - bpp - (bit & 7))) & mask];
+		i++;
+	}
+	const uint8_t *p = row + (i * bpp) / 8;
+	int16_t bytes = (end - i) / perByte;
+	switch (bpp) {
+	case 1:
+		for (int16_t k = 0; k < bytes; k++) {
+			uint8_t b = *p++;
+			pDst[0] = palette[b >> 7];
+			pDst[1] = palette[(b >> 6) & 1];
+			pDst[2] = palette[(b >> 5) & 1];
+			pDst[3] = palette[(b >> 4) & 1];
+			pDst[4] = palette[(b >> 3) & 1];
+			pDst[5] = palette[(b >> 2) & 1];
+			pDst[6] = palette[(b >> 1) & 1];
+			pDst[7] = palette[b & 1];
+			pDst += 8;
+		}
+		break;
+	case 2:
+		for (int16_t k = 0; k < bytes; k++) {
+			uint8_t b = *p++;
+			pDst[0] = palette[b >> 6];
+			pDst[1] = palette[(b >> 4) & 3];
+			pDst[2] = palette[(b >> 2) & 3];
+			pDst[3] = palette[b & 3];
+			pDst += 4;
+		}
+		break;
+	case 4:
+		for (int16_t k = 0; k < bytes; k++) {
+			uint8_t b = *p++;
+			pDst[0] = palette[b >> 4];
+			pDst[1] = palette[b & 15];
+			pDst += 2;
+		}
+		break;
+	default:
+		for (; bytes >= 4; bytes -= 4) {
+			pDst[0] = palette[p[0]];
+			pDst[1] = palette[p[1]];
+			pDst[2] = palette[p[2]];
+			pDst[3] = palette[p[3]];
+			p += 4;
+			pDst += 4;
+		}
+		while (bytes-- > 0)
+			*pDst++ = palette[*p++];
+		break;
+	}
+	i += ((end - i) / perByte) * perByte;
+	while (i < end) { // 最後のバイトの途中まで
+		int16_t bit = i * bpp;
+		*pDst++ = palette[(row[bit >> 3] >> (8 - bpp - (bit & 7))) & mask];
+		i++;
+	}
+}
+
+/*!
+	@brief  パレット番号で色を表すビットマップ（1/2/4/8ビット/ピクセル）を描画します。
+	@param  x        左上のX座標
+	@param  y        左上のY座標
+	@param  bitmap   パレット番号の並び。１バイトに上位ビットから左のピクセルを詰め、各行はバイト境界から始まる
+	@param  palette  RGB565のパレット（2^bpp色）
+	@param  bpp      １ピクセルのビット数（1, 2, 4, 8）
+	@param  w        幅
+	@param  h        高さ
+	@details
+		画面に収まる部分を１つのウインドウにして、１行ずつパレットで展開して送る。
+		展開先は２つの行バッファで、DMAが片方を読んでいる間にもう片方に次の行を展開する。
+		はみ出す部分は切り取るので、１行は画面の幅（INDEXED_LINE_PIXELS以下）に収まる。
+*/
+void Adafruit_SPITFT::drawIndexedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint16_t palette[], uint8_t bpp, int16_t w, int16_t h)
+{
+	static uint16_t indexedLineBuf[2][INDEXED_LINE_PIXELS]; // DMAが読んでいる間に次の行を展開するので２つ
+	if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8)
+		return;
+	int16_t bx1, by1; // Clipped top-left within bitmap
+	int16_t rowBytes = (w * bpp + 7) / 8;
+	if (!clipBitmap(x, y, w, h, bx1, by1))
+		return; // Off the clip rectangle (or the screen)
+
+	const uint8_t *row = bitmap + by1 * rowBytes;
+	uint8_t cur = 0;
 	startWrite();
 	setAddrWindow(x, y, w, h); // Clipped area
-	// 一行ずつ出力しているので、それに合わせる。
-	//
 	while (h--)
-	{ // For each (clipped) scanline...
-		uint16_t *cvtBuf = (uint16_t *)alloca(w * 2);
-		uint16_t *pWk = cvtBuf;
-		for (int i = 0; i < w; i++)
+	{
+		expandIndexedRow(row, palette, bpp, bx1, w, indexedLineBuf[cur]);
+		writePixels(indexedLineBuf[cur], w, false); // 次のwritePixels()/endWrite()が完了を待つ
+		cur ^= 1;
+		row += rowBytes;
+	}
+	endWrite();
+}
+
+/*!
+	@brief  RGB565に展開済みの文字を描画します。
+	@param  x       描画開始位置の左上座標
+	@param  y       描画開始位置の左上座標
+	@param  w       文字の幅
+	@param  h       文字の高さ
+	@param  pixels  w×hのRGB565ピクセル（グリフキャッシュのスロット、または文字列１行分のバッファ）
+	@details クリップ矩形（無ければ画面）で切り詰めた範囲を、１回のウインドウ指定とwritePixels()で送る。
+	横が切り詰められたときは、行ごとに残った部分を送る。スロットや行バッファはすぐに別の文字で上書きされることが
+	あるので、DMAの完了を待ってから戻る。
+*/
+void Adafruit_SPITFT::drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels)
+{
+	int16_t srcW = w;
+	int16_t bx, by;
+	if (!clipBitmap(x, y, w, h, bx, by))
+		return;
+	pixels += by * srcW + bx;
+#if defined(ARDUINO_ARCH_RP2040)
+	if (w == srcW && writeWindowPIO(x, y, w, h, pixels, false))
+		return;
+#endif
+	startWrite();
+	setAddrWindow(x, y, w, h);
+	if (w == srcW)
+	{
+		writePixels((uint16_t *)pixels, (uint32_t)w * h, true);
+	}
+	else
+	{
+		for (int16_t yy = 0; yy < h; yy++)
 		{
-			*pWk = convert8To565(*(pcolors + i));
-			pWk++;
+			writePixels((uint16_t *)pixels, w, false); // 次のwritePixels()/endWrite()が完了を待つ
+			pixels += srcW;
 		}
-		writePixels(cvtBuf, w); // Push one (clipped) row
-		pcolors += saveW;		// Advance pointer by one full (unclipped) line
 	}
 	endWrite();
 }
 
 /*!
-	@brief  DMAを使って、画面全体を描画する。
-	@param  pcolors  表示する画像データのポインタ。画像データはワードマップ
-	@note  没？　試してみたが、１画面の更新について、普通に描画するのより遅かった
-			DMAでは、Little Endianにする必要があるので、最初に全画面分上位下位を入れ替えている。
-			DMA 109.6 μs (上位下位のスワップをやめても、77.0 μs)
-			通常描画  66.0 μs
+	@brief  圧縮した画像の(col, row)から len ピクセル進め、そのうち見える範囲に入るピクセル数を返す
+	@param  width  画像の幅
+	@param  col    今の列（進めた後の列を返す）
+	@param  row    今の行（進めた後の行を返す）
+	@param  len    進めるピクセル数
+	@param  vx1    見える範囲の左端（画像の左上からの座標）
+	@param  vy1    見える範囲の上端
+	@param  vx2    見える範囲の右端（含まない）
+	@param  vy2    見える範囲の下端（含まない）
+	@details 見える範囲のピクセルは、ウインドウに送る順に並んでいるので、１つのランの見える部分は行をまたいでも続けて送れる。
+*/
+static uint32_t advancePackedClip(int16_t width, int16_t &col, int16_t &row, uint32_t len, int16_t vx1, int16_t vy1, int16_t vx2, int16_t vy2)
+{
+	uint32_t visible = 0;
+	while (len > 0)
+	{
+		int16_t seg = (len < (uint32_t)(width - col)) ? (int16_t)len : (width - col); // この行に入る分
+		if (row >= vy1 && row < vy2)
+		{
+			int16_t a = (col > vx1) ? col : vx1;
+			int16_t b = (col + seg < vx2) ? (col + seg) : vx2;
+			if (b > a)
+				visible += b - a;
+		}
+		len -= seg;
+		col += seg;
+		if (col == width)
+		{
+			col = 0;
+			row++;
+		}
+	}
+	return visible;
+}
 
+/*!
+	@brief  圧縮した画像（PackedImage）を展開しながら送ります。
+	@param  x    左上のX座標
+	@param  y    左上のY座標
+	@param  img  圧縮した画像
+	@details
+		ウインドウは画像の見える範囲で１回だけ指定し、読み出した順にピクセルを送る。
+		PACKED_RUN_MIN以上のランはwriteColor()で、並びと短いランは２つのバッファに交互に詰めてwritePixels()で送る。
+		DMAが読むのはRAM上のバッファなので、フラッシュ（XIPキャッシュ）から読むのは圧縮したデータとパレットだけになる。
+		クリップ矩形（無ければ画面）からはみ出す画像は、読み出しながら見えない行と列を捨てる（ランは見える部分の長さに縮める）。
 */
-void Adafruit_SPITFT::drawDMABitmap(const uint16_t *pcolors)
+void Adafruit_SPITFT::drawPackedImage(int16_t x, int16_t y, const PackedImage &img)
 {
-	uint16_t chgEndien[WIDTH * HEIGHT];
+	static uint16_t packedBurstBuf[2][PACKED_BURST_PIXELS]; // DMAが読んでいる間にもう一方に詰める
+	// 画像の中で見える範囲（画像の左上からの座標）
+	int16_t vx1 = clipLeft() - x, vy1 = clipTop() - y;
+	int16_t vx2 = clipRight() - x, vy2 = clipBottom() - y;
+	if (vx1 < 0)
+		vx1 = 0;
+	if (vy1 < 0)
+		vy1 = 0;
+	if (vx2 > (int16_t)img.width)
+		vx2 = img.width;
+	if (vy2 > (int16_t)img.height)
+		vy2 = img.height;
+	if (vx1 >= vx2 || vy1 >= vy2)
+		return;
+	bool isWhole = (vx1 == 0 && vy1 == 0 && vx2 == (int16_t)img.width && vy2 == (int16_t)img.height);
+
+	PackedImageReader reader(img);
+	bool isRun;
+	uint16_t len, color;
+	const uint8_t *pIndex;
+	uint8_t cur = 0;
+	uint16_t n = 0;				   // バッファに詰めたピクセル数
+	int16_t col = 0, row = 0;	   // 次に読むピクセルの画像の中の位置（切り詰めるときだけ数える）
+	startWrite();
+	setAddrWindow(x + vx1, y + vy1, vx2 - vx1, vy2 - vy1);
+	while (row < vy2 && reader.next(isRun, len, color, pIndex))
+	{
+		uint32_t count = len; // 送るピクセル数（ランのとき）
+		if (isRun && !isWhole)
+			count = advancePackedClip(img.width, col, row, len, vx1, vy1, vx2, vy2);
+		if (isRun && count >= PACKED_RUN_MIN)
+		{
+			if (n > 0)
+			{
+				writePixels(packedBurstBuf[cur], n, false);
+				cur ^= 1;
+				n = 0;
+			}
+			writeColor(color, count);
+			continue;
+		}
+		if (isRun)
+			len = count;
+		for (uint16_t i = 0; i < len; i++)
+		{
+			if (!isRun && !isWhole)
+			{
+				bool isVisible = (row >= vy1 && row < vy2 && col >= vx1 && col < vx2);
+				if (++col == (int16_t)img.width)
+				{
+					col = 0;
+					row++;
+				}
+				if (!isVisible)
+					continue;
+			}
+			if (n == PACKED_BURST_PIXELS)
+			{
+				writePixels(packedBurstBuf[cur], n, false);
+				cur ^= 1;
+				n = 0;
+			}
+			packedBurstBuf[cur][n++] = isRun ? color : img.palette[pIndex[i]];
+		}
+	}
+	if (n > 0)
+		writePixels(packedBurstBuf[cur], n, false);
+	endWrite();
+}
 
-	for (int i = 0; i < WIDTH * HEIGHT; i++)
+/*!
+	@brief  塗りつぶし図形を、外接矩形の１つのウインドウで送ります。
+	@param  src    図形の区間
+	@param  color  塗りつぶし色
+	@param  bg     外接矩形のうち図形の外側の色
+	@details
+		外接矩形のすべてのピクセルを上の行から順に送るので、ウインドウの指定は１回で済む。
+		図形の外側と内側を並べた行を２つの行バッファに交互に組み立て、DMAで送っている間に次の行を組み立てる。
+		前の行と同じ区間の行は同じバッファを送り直し、１色だけの行（角丸矩形の間の行など）は続く行をまとめて１回のwriteColor()で送る。
+		クリップ矩形（無ければ画面）からはみ出す図形は、外接矩形の見える部分をウインドウにして、行と区間をその範囲に切り詰める。
+		見える部分が行バッファより広い図形は、基底クラスの矩形に分けた描画に任せる。
+*/
+void Adafruit_SPITFT::fillSpansOpaque(SpanSource &src, uint16_t color, uint16_t bg)
+{
+	static uint16_t spanLineBuf[2][SPAN_LINE_PIXELS]; // DMAが読んでいる間に次の行を組み立てるので２つ
+	int16_t bx = src.boxX, by = src.boxY, bw = src.boxW, bh = src.boxH;
+	if (bw <= 0 || bh <= 0)
+		return;
+	// 外接矩形の見える部分（画面座標）
+	int16_t vx1 = (bx > clipLeft()) ? bx : clipLeft();
+	int16_t vy1 = (by > clipTop()) ? by : clipTop();
+	int16_t vx2 = (bx + bw < clipRight()) ? (bx + bw) : clipRight();
+	int16_t vy2 = (by + bh < clipBottom()) ? (by + bh) : clipBottom();
+	if (vx1 >= vx2 || vy1 >= vy2)
+		return;
+	int16_t vw = vx2 - vx1;
+	if (vw > SPAN_LINE_PIXELS)
 	{
-		chgEndien[i] = __builtin_bswap16(*(pcolors + i));
+		Adafruit_GFX::fillSpansOpaque(src, color, bg);
+		return;
 	}
 
+	int16_t x, w;
+	int16_t prevX = -1, prevW = -1; // 行バッファに組み立ててある区間
+	uint8_t cur = 1;				// 最後に組み立てた行バッファ
+	uint16_t solidColor = 0;		// まとめて送る１色の行の色
+	uint32_t solidRows = 0;			// まとめて送る１色の行の数
+	int16_t yy = by;				// next()が返す行
 	startWrite();
-	setAddrWindow(0, 0, width(), height()); // Clipped area
-	const uint dma_tx = dma_claim_unused_channel(true);
-	dma_channel_config c = dma_channel_get_default_config(dma_tx);
-	channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-	spi_inst_t *currentSPI = hwspi._spi == &SPI ? spi0 : spi1;
-	channel_config_set_dreq(&c, spi_get_dreq(currentSPI, true));
-	channel_config_set_write_increment(&c, false);
-	volatile void *pWriteAddr = &spi_get_hw(currentSPI)->dr;
-	dma_channel_configure(dma_tx, &c,
-						  pWriteAddr,		  // write address
-						  chgEndien,		  // read address
-						  WIDTH * HEIGHT * 2, // element count (each element is of size transfer_data_size)
-						  false);			  // don't start yet
-	dma_start_channel_mask(1u << dma_tx);
-	dma_channel_wait_for_finish_blocking(dma_tx); // DMA転送完了を待機
-	dma_channel_unclaim(dma_tx);
+	setAddrWindow(vx1, vy1, vw, vy2 - vy1);
+	while (yy < vy2 && src.next(x, w))
+	{
+		if (yy++ < vy1)
+			continue;
+		if (w > 0)
+		{ // 区間を見える部分に切り詰める
+			int16_t x2 = x + w;
+			if (x < vx1)
+				x = vx1;
+			if (x2 > vx2)
+				x2 = vx2;
+			w = x2 - x;
+		}
+		bool isSolid = (w <= 0 || w == vw);
+		uint16_t rowColor = (w <= 0) ? bg : color;
+		if (solidRows > 0 && (!isSolid || rowColor != solidColor))
+		{
+			writeColor(solidColor, solidRows * vw);
+			solidRows = 0;
+		}
+		if (isSolid)
+		{
+			solidColor = rowColor;
+			solidRows++;
+			continue;
+		}
+		if (x != prevX || w != prevW)
+		{
+			cur ^= 1; // もう一方のバッファは、前の転送が始まった時点で読み終わっている
+			uint16_t *p = spanLineBuf[cur];
+			int16_t left = x - vx1;
+			int16_t i = 0;
+			for (; i < left; i++)
+				p[i] = bg;
+			for (; i < left + w; i++)
+				p[i] = color;
+			for (; i < vw; i++)
+				p[i] = bg;
+			prevX = x;
+			prevW = w;
+		}
+		writePixels(spanLineBuf[cur], vw, false);
+	}
+	if (solidRows > 0)
+		writeColor(solidColor, solidRows * vw);
 	endWrite();
 }
 
+/*!
+	@brief  DMAを使って、画面全体を描画する。
+	@param  pcolors  表示する画像データのポインタ。画像データはワードマップ（width()×height()、リトルエンディアンのRGB565）
+	@details
+		SPIを16ビットフレームにして、画像をそのままDMAで送る。16ビットフレームはMSBから送出されるので上位下位の入れ替えは要らず、
+		画面分のバッファも使わない。DMAはフラッシュ上の画像（XIP）もRAM上の画像も直接読む。
+		PIOの送信経路があればそちらで送る。どちらも完了を待たずに戻り、トランザクションは次の描画の開始時かdmaWait()で閉じる。
+		RAM上の画像を書き換えるときは、先にdmaWait()を呼ぶこと。クリップ矩形があるときは、drawRGBBitmap()でその中だけを送る。
+	@note  以前は画面分（150KB）のスタック上の配列で上位下位を入れ替えてから8ビットで送っていて、普通に描画するより遅かった。
+*/
+void Adafruit_SPITFT::drawDMABitmap(const uint16_t *pcolors)
+{
+#if defined(ARDUINO_ARCH_RP2040)
+	if (!isClipped())
+	{
+		if (writeWindowPIO(0, 0, _width, _height, pcolors, false))
+			return;
+		uint32_t len = (uint32_t)_width * _height;
+		startWrite();
+		setAddrWindow(0, 0, _width, _height);
+		TFT_PROFILE_ADD(pixelBytes, len * 2);
+		dmaStart(hwspi._spi == &SPI ? spi0 : spi1, pcolors, len, true);
+		dmaEndWritePending = true;
+		return;
+	}
+#endif
+	drawRGBBitmap(0, 0, pcolors, _width, _height); // クリップ矩形があれば、その中だけを送る
+}
+
 /// @brief デバイス依存の機能（描画ウインドウ）を使って、白黒ﾋﾞｯﾄﾏｯﾌﾟを表示する
 /// @param x 表示するX座標
 /// @param y 表示するY座標
@@ -2260,31 +2835,10 @@ void Adafruit_SPITFT::drawDMABitmap(const uint16_t *pcolors)
 
 void Adafruit_SPITFT::drawBWBitmap(int16_t x, int16_t y, uint8_t *pcolors, int16_t w, int16_t h)
 {
-	int16_t x2, y2;					// Lower-right coord
-	if ((x >= _width) ||			// Off-edge right
-		(y >= _height) ||			// " top
-		((x2 = (x + w - 1)) < 0) || // " left
-		((y2 = (y + h - 1)) < 0))
-		return; // " bottom
-
-	int16_t bx1 = 0, by1 = 0, // Clipped top-left within bitmap
-		saveW = w;			  // Save original bitmap width value
-	if (x < 0)
-	{ // Clip left
-		w += x;
-		bx1 = -x;
-		x = 0;
-	}
-	if (y < 0)
-	{ // Clip top
-		h += y;
-		by1 = -y;
-		y = 0;
-	}
-	if (x2 >= _width)
-		w = _width - x; // Clip right
-	if (y2 >= _height)
-		h = _height - y; // Clip bottom
+	int16_t bx1, by1,  // Clipped top-left within bitmap
+		saveW = w;		   // Save original bitmap width value
+	if (!clipBitmap(x, y, w, h, bx1, by1))
+		return; // Off the clip rectangle (or the screen)
 
 	unsigned int saveWBytes = (saveW + 7) / 8;
 	unsigned int bx1Bytes = (bx1 + 7) / 8;
@@ -2336,31 +2890,10 @@ void Adafruit_SPITFT::drawBWBitmap(int16_t x, int16_t y, uint8_t *pcolors, int16
 */
 void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h, uint16_t colorTransparent)
 {
-	int16_t x2, y2;					// Lower-right coord
-	if ((x >= _width) ||			// Off-edge right
-		(y >= _height) ||			// " top
-		((x2 = (x + w - 1)) < 0) || // " left
-		((y2 = (y + h - 1)) < 0))
-		return; // " bottom
-
-	int16_t bx1 = 0, by1 = 0, // Clipped top-left within bitmap
-		saveW = w;			  // Save original bitmap width value
-	if (x < 0)
-	{ // Clip left
-		w += x;
-		bx1 = -x;
-		x = 0;
-	}
-	if (y < 0)
-	{ // Clip top
-		h += y;
-		by1 = -y;
-		y = 0;
-	}
-	if (x2 >= _width)
-		w = _width - x; // Clip right
-	if (y2 >= _height)
-		h = _height - y; // Clip bottom
+	int16_t bx1, by1,  // Clipped top-left within bitmap
+		saveW = w;		   // Save original bitmap width value
+	if (!clipBitmap(x, y, w, h, bx1, by1))
+		return; // Off the clip rectangle (or the screen)
 
 	pcolors += by1 * saveW + bx1; // Offset bitmap ptr to clipped top-left
 	startWrite();
@@ -2369,7 +2902,7 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int
 	{
 		for (int ix = x; ix < (x + w); ix++)
 		{
-			uint32_t pictIdx = (by1 + (iy - y)) * saveW + bx1 + (ix - x);
+			uint32_t pictIdx = (iy - y) * saveW + (ix - x); // pcolorsは切り詰めた左上を指している
 			uint16_t color = pcolors[pictIdx];
 			if (color != colorTransparent)
 			{
@@ -2641,6 +3174,8 @@ void Adafruit_SPITFT::spiWrite(uint8_t b)
 		hwspi._spi->write(b);
 #elif defined(ARDUINO_ARCH_RP2040)
 		spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+		if (dmaPending)
+			dmaWaitInWrite();
 		spi_write_blocking(pi_spi, &b, 1);
 #else
 		hwspi._spi->transfer(b);
@@ -2682,9 +3217,14 @@ void Adafruit_SPITFT::spiWrite(uint8_t b)
 */
 void Adafruit_SPITFT::writeCommand(uint8_t cmd)
 {
+#if defined(ARDUINO_ARCH_RP2040)
+	if (dmaPending)
+		dmaWaitInWrite(); // 送信中のピクセルがあれば、DCを下げる前に送り終える
+#endif
 	SPI_DC_LOW();
 	spiWrite(cmd);
 	SPI_DC_HIGH();
+	TFT_PROFILE_ADD(commandBytes, 1);
 }
 
 /*!
@@ -2790,9 +3330,14 @@ void Adafruit_SPITFT::write16(uint16_t w)
 */
 void Adafruit_SPITFT::writeCommand16(uint16_t cmd)
 {
+#if defined(ARDUINO_ARCH_RP2040)
+	if (dmaPending)
+		dmaWaitInWrite(); // 送信中のピクセルがあれば、DCを下げる前に送り終える
+#endif
 	SPI_DC_LOW();
 	write16(cmd);
 	SPI_DC_HIGH();
+	TFT_PROFILE_ADD(commandBytes, 2);
 }
 
 /*!
@@ -2947,6 +3492,8 @@ void Adafruit_SPITFT::SPI_WRITE16(uint16_t w)
 		hwspi._spi->write16(w);
 #elif defined(ARDUINO_ARCH_RP2040)
 		spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+		if (dmaPending)
+			dmaWaitInWrite();
 		w = __builtin_bswap16(w);
 		spi_write_blocking(pi_spi, (uint8_t *)&w, 2);
 #elif defined(ARDUINO_ARCH_RTTHREAD)
@@ -3012,6 +3559,8 @@ void Adafruit_SPITFT::SPI_WRITE32(uint32_t l)
 		hwspi._spi->write32(l);
 #elif defined(ARDUINO_ARCH_RP2040)
 		spi_inst_t *pi_spi = hwspi._spi == &SPI ? spi0 : spi1;
+		if (dmaPending)
+			dmaWaitInWrite();
 		l = __builtin_bswap32(l);
 		spi_write_blocking(pi_spi, (uint8_t *)&l, 4);
 #elif defined(ARDUINO_ARCH_RTTHREAD)
@@ -23,10 +23,17 @@
 #if !defined(__AVR_ATtiny85__) && !defined(__AVR_ATtiny84__)
 
 	#include "Adafruit_GFX.h"
+	#include "TftProfile.h"
 
 	#ifdef STD_SDK
 		#include "../spi/SPI.h"
 		#include "hardware/dma.h"
+		#include "hardware/timer.h"
+		#include "TftPioStream.h"
+		#include "TftDisplayList.h"
+		#if defined(TFT_HOST_BUS)
+			#include "TftHostBus.h"
+		#endif
 	#else
 		#include <SPI.h>
 	#endif
@@ -90,6 +97,32 @@ namespace ardPort {
 											   // #define USE_SPI_DMA ///< If set,
 											   //  use DMA if available
 	#endif
+	// Possible values for Adafruit_SPITFT.connection:
+	#define TFT_HARD_SPI 0 ///< Display interface = hardware SPI
+	#define TFT_SOFT_SPI 1 ///< Display interface = software SPI
+	#define TFT_PARALLEL 2 ///< Display interface = 8- or 16-bit parallel
+
+	#define PACKED_BURST_PIXELS 256 ///< drawPackedImage()で並びと短いランをまとめて送るバッファのピクセル数
+	#define PACKED_RUN_MIN 32       ///< drawPackedImage()でバッファを通さずwriteColor()で送るランの長さ
+	#if TFT_PROFILE && defined(ARDUINO_ARCH_RP2040)
+		#define TFT_PROFILE_ADD(field, n) (profile.field += (n)) ///< 送信量を数える（TFT_PROFILEが0なら何もしない）
+	#else
+		#define TFT_PROFILE_ADD(field, n) ((void)0)
+	#endif
+	#define INDEXED_LINE_PIXELS 320 ///< drawIndexedBitmap()で１行を展開するバッファのピクセル数（画面の長辺）
+	#define SPAN_LINE_PIXELS 320 ///< fillSpansOpaque()で１行を組み立てるバッファのピクセル数（これより広い図形は矩形に分けて描く）
+	#if defined(ARDUINO_ARCH_RP2040)
+		#ifndef USE_RP2040_DMA_FILL
+			#define USE_RP2040_DMA_FILL 1 ///< writeColor()の塗りつぶしをDMAで行う（0でCPUによる送信）
+		#endif
+		#define RP2040_DMA_FILL_MIN 32 ///< これより少ないピクセル数はDMAの設定コストの方が大きいのでCPUで送る
+		#ifndef USE_RP2040_DMA_BLIT
+			#define USE_RP2040_DMA_BLIT 1 ///< drawRGBBitmap()/writePixels()をDMAで非同期に送る（0でCPUによる送信）
+		#endif
+		#define RP2040_DMA_BLIT_MIN 32 ///< これより少ないピクセル数はCPUで送る
+		#define RP2040_PIO_WINDOW_MIN 64 ///< PIOで送るウインドウの最小ピクセル数（ピンの切り替えの方が高くつく小さな描画はSPIで送る）
+	#endif
+
 	// Another "oops" name -- this now also handles parallel DMA.
 	// If DMA is enabled, Arduino sketch MUST #include <Adafruit_ZeroDMA.h>
 	// Estimated RAM usage:
@@ -214,6 +247,8 @@ namespace ardPort {
 		*/
 		virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w,
 								   uint16_t h) = 0;
+		/// @brief setAddrWindow()を通さずにウインドウを変えたとき（PIOでの送信など）に、サブクラスが覚えているウインドウを捨てる
+		virtual void invalidateAddrWindow(void) {}
 
 		// Remaining functions do not need to be declared in subclasses
 		// unless they wish to provide hardware-specific optimizations.
@@ -268,6 +303,21 @@ namespace ardPort {
 		// user code, so it's public...
 		bool dmaBusy(void) const; // true if DMA is used and busy, false otherwise
 		void swapBytes(uint16_t* src, uint32_t len, uint16_t* dest = NULL);
+	#if defined(ARDUINO_ARCH_RP2040)
+		// 送信量と時間の計数（TFT_PROFILEが1のときだけ数える。区間はTftProfileScopeで名前をつける）
+		void getProfile(TftProfileCounters& counters) const;
+		void resetProfile(void);
+		void dumpProfile(void (*pfnPrintf)(const char* format, ...));
+		TftProfileMark profileBegin(const char* label);
+		void profileEnd(const TftProfileMark& mark);
+		/// @brief ウインドウ指定とピクセルデータをまとめて送るPIOの送信経路を設定する。nullptrでSPIだけを使う
+		void setPioStream(TftPioStream* a_pPio) { pPioStream = a_pPio; }
+		void submitList(TftDisplayList& list);
+		#if defined(TFT_HOST_BUS)
+		/// @brief ホストのビルドで、液晶に送るバイトの受け取り先を設定する（DC・CSのピンはbegin()で決めたもの）
+		void attachHostSink(TftHostSink* a_pSink) { tftHostBusAttach(a_pSink, _dc, _cs); }
+		#endif
+	#endif
 
 		// These functions are similar to the 'write' functions above, but with
 		// a chip-select and/or SPI transaction built-in. They're typically used
@@ -292,7 +342,18 @@ namespace ardPort {
 		void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) { drawRGBBitmap(x, y, (uint16_t*)bitmap, w, h); }
 		void drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int16_t w, int16_t h, uint16_t colorTransparent);
 		void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* pcolors, int16_t w, int16_t h, uint16_t colorTransparent) { drawRGBBitmap(x, y, (uint16_t*)pcolors, w, h, colorTransparent); }
+		// 画面全体の転送（画像から直接DMAで送る）
 		void drawDMABitmap(const uint16_t* pcolors);
+		// 展開済みの文字の転送（グリフキャッシュ用）
+		void drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+		// 圧縮した画像の転送（展開しながら１つのウインドウで送る）
+		void drawPackedImage(int16_t x, int16_t y, const PackedImage& img) override;
+		// 区間で表したスプライトの転送（区間ごとに１つのウインドウで送る）
+		void drawSpanSprite(int16_t x, int16_t y, const SpanSprite& sprite) override;
+		// パレット番号のビットマップの転送（１行ずつパレットで展開して送る）
+		void drawIndexedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint16_t palette[], uint8_t bpp, int16_t w, int16_t h) override;
+		// 背景色つきの塗りつぶし図形（外接矩形を１つのウインドウで送る）
+		void fillSpansOpaque(SpanSource& src, uint16_t color, uint16_t bg) override;
 		// ８ビットカラーのビットマップ転送
 		void drawRGBBitmap(int16_t x, int16_t y, uint8_t* pcolors, int16_t w, int16_t h);
 		// １ビットカラーのビットマップ転送
@@ -582,6 +643,29 @@ namespace ardPort {
 		uint32_t lastFillLen = 0;          ///< # of pixels w/last fill
 		uint8_t onePixelBuf;               ///< For hi==lo fill
 	#endif
+	#if defined(ARDUINO_ARCH_RP2040)
+		void dmaStart(spi_inst_t* pi_spi, const void* src, uint32_t len, bool increment);
+		void dmaFinish(spi_inst_t* pi_spi);
+		void dmaWaitInWrite(void);
+		static void dmaWaitHook(void* ctx);
+		#if USE_RP2040_DMA_FILL
+		void writeColorDMA(spi_inst_t* pi_spi, uint16_t color, uint32_t len);
+		#endif
+		int dmaChannel = -1;             ///< 表示用DMAチャネル（未確保なら-1）
+		uint16_t dmaFillWord = 0;        ///< 塗りつぶしDMAの読み出し元（固定アドレス）
+		bool dmaPending = false;         ///< DMA転送の後始末（dmaWait）がまだ
+		bool dmaEndWritePending = false; ///< DMA完了後にendWrite()が必要
+		#if TFT_PROFILE
+		TftProfileCounters profile;                              ///< 送信量と時間の累計
+		TftProfileRegion profileRegions[TFT_PROFILE_MAX_REGIONS]; ///< 名前をつけた区間ごとの集計
+		uint8_t profileRegionCount = 0;                          ///< 使っている区間の数
+		uint8_t profileDepth = 0;                                ///< startWrite()の入れ子の深さ
+		uint32_t profileOpenUs = 0;                              ///< トランザクションを開いた時刻
+		#endif
+		bool writeWindowPIO(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels, bool isFill);
+		void replayList(const TftDisplayList& list);
+		TftPioStream* pPioStream = nullptr; ///< PIOの送信経路（未使用ならnullptr）
+	#endif
 	#if defined(USE_FAST_PINIO)
 		#if defined(HAS_PORT_SET_CLR)
 			#if !defined(KINETISK)
@@ -608,6 +692,26 @@ namespace ardPort {
 		uint32_t _freq = 0; ///< Dummy var to keep subclasses happy
 	};
 
+	#if defined(ARDUINO_ARCH_RP2040)
+	/*!
+	  @brief  名前をつけた区間の送信量と時間を集計する（作ってから壊れるまでが区間）
+	  @details TFT_PROFILEが0なら何もしない（コードは残らない）。
+	*/
+	class TftProfileScope {
+	  public:
+		#if TFT_PROFILE
+		TftProfileScope(Adafruit_SPITFT& tft, const char* label) : tft(tft), mark(tft.profileBegin(label)) {}
+		~TftProfileScope() { tft.profileEnd(mark); }
+
+	  private:
+		Adafruit_SPITFT& tft; ///< 集計する液晶
+		TftProfileMark mark;  ///< 区間に入ったときの値
+		#else
+		TftProfileScope(Adafruit_SPITFT&, const char*) {}
+		#endif
+	};
+	#endif
+
 } // namespace ardPort
 
 #endif // end __AVR_ATtiny85__ __AVR_ATtiny84__
@@ -0,0 +1,60 @@
+/*!
+ * @file PackedImage.cpp
+ *
+ * 圧縮した画像の読み出しの実装。
+ */
+#include "PackedImage.h"
+
+namespace ardPort {
+
+	/*!
+		@brief  次のランまたは並びを読み出す
+		@param  isRun   ランならtrue（colorの色がlenピクセル続く）、並びならfalse（pIndexのパレット番号がlen個）
+		@param  len     ピクセル数
+		@param  color   ランの色（RGB565）
+		@param  pIndex  並びのパレット番号の先頭（データの中を指す）
+		@return 読み出せればtrue。データの終わりならfalse
+	*/
+	bool PackedImageReader::next(bool& isRun, uint16_t& len, uint16_t& color, const uint8_t*& pIndex)
+	{
+		if (pos >= img.dataLen) return false;
+		const uint8_t* p = img.data;
+		uint8_t tag = p[pos++];
+		if ((tag & 0x80) == 0) {
+			isRun = false;
+			len = (tag & 0x7F) + 1;
+			pIndex = &p[pos];
+			pos += len;
+			return true;
+		}
+		isRun = true;
+		if (tag == PACKED_LONG_RUN) {
+			len = p[pos] | (p[pos + 1] << 8);
+			pos += 2;
+		} else {
+			len = (tag & 0x7F) + 2;
+		}
+		color = img.palette[p[pos++]];
+		return true;
+	}
+
+	/*!
+		@brief  画像全体をRGB565に展開する
+		@param  img   圧縮した画像
+		@param  pDst  width×heightピクセルの展開先
+	*/
+	void PackedImageReader::decode(const PackedImage& img, uint16_t* pDst)
+	{
+		PackedImageReader reader(img);
+		bool isRun;
+		uint16_t len, color;
+		const uint8_t* pIndex;
+		while (reader.next(isRun, len, color, pIndex)) {
+			if (isRun) {
+				for (uint16_t i = 0; i < len; i++) *pDst++ = color;
+			} else {
+				for (uint16_t i = 0; i < len; i++) *pDst++ = img.palette[pIndex[i]];
+			}
+		}
+	}
+} // namespace ardPort
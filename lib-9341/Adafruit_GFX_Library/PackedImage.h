@@ -0,0 +1,45 @@
+/*!
+ * @file PackedImage.h
+ *
+ * パレットとランレングスで圧縮したRGB565画像の形式と、その読み出し。
+ * 時計の数字やキーボードのように、少ない色で同じ色が続く画像を、生のRGB565配列の数分の一の大きさで持つ。
+ * 画像は tools/pack_images.py で pictData.h から作る（pictPacked.h）。
+ *
+ * データの並び（上の行から、左から右へ）
+ *   0nnnnnnn i0 i1 ... : パレット番号を n+1 個そのまま並べる（1～128ピクセル）
+ *   1nnnnnnn i         : パレット番号 i の色を n+2 ピクセル続ける（2～128ピクセル。n=127は使わない）
+ *   11111111 lo hi i   : パレット番号 i の色を (hi<<8 | lo) ピクセル続ける（長いラン）
+ * ランと並びは行をまたいでよい。
+ */
+#pragma once
+#include <stdint.h>
+
+#define PACKED_LONG_RUN 0xFF ///< 長いランの印
+
+namespace ardPort {
+
+	/*!
+	  @brief  圧縮した画像
+	*/
+	struct PackedImage {
+		uint16_t width;         ///< 幅
+		uint16_t height;        ///< 高さ
+		const uint16_t* palette; ///< パレット（RGB565、最大256色）
+		const uint8_t* data;    ///< 圧縮したデータ
+		uint32_t dataLen;       ///< dataのバイト数
+	};
+
+	/*!
+	  @brief  圧縮した画像を、ランと並びの単位で先頭から読み出すクラス
+	*/
+	class PackedImageReader {
+	  public:
+		PackedImageReader(const PackedImage& img) : img(img), pos(0) {}
+		bool next(bool& isRun, uint16_t& len, uint16_t& color, const uint8_t*& pIndex);
+		static void decode(const PackedImage& img, uint16_t* pDst);
+
+	  private:
+		const PackedImage& img; ///< 読み出す画像
+		uint32_t pos;           ///< 次に読むdataの位置
+	};
+} // namespace ardPort
@@ -0,0 +1,126 @@
+/*!
+ * @file SpanRaster.cpp
+ *
+ * 塗りつぶし図形を走査線の区間に分解するクラスの実装。
+ */
+#include "SpanRaster.h"
+
+namespace ardPort {
+
+	/*!
+		@brief  角丸矩形の区間を作る
+		@param  x  左上のX座標
+		@param  y  左上のY座標
+		@param  w  幅
+		@param  h  高さ
+		@param  r  角の半径（短辺の半分とSPAN_MAX_RADIUSを超える分は切り詰める）
+		@details 半径がSPAN_TABLE_MAX_RADIUS以下なら表を使い、それより大きければここで計算する。
+	*/
+	RoundRectSpans::RoundRectSpans(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r)
+	{
+		boxX = x;
+		boxY = y;
+		boxW = (w > 0) ? w : 0;
+		boxH = (h > 0) ? h : 0;
+		int16_t maxRadius = ((boxW < boxH) ? boxW : boxH) / 2;
+		if (r > maxRadius) r = maxRadius;
+		if (r > SPAN_MAX_RADIUS) r = SPAN_MAX_RADIUS; // insetBufを越えないように（大きな半径はfillRoundRect()が別に描く）
+		if (r < 0) r = 0;
+		radius = r;
+		if (r <= SPAN_TABLE_MAX_RADIUS) {
+			pInset = quarterCircleTable.inset[r];
+		} else {
+			QuarterCircle::build(r, insetBuf);
+			pInset = insetBuf;
+		}
+	}
+
+	/*!
+		@brief  次の行の区間を返す
+		@details 上下の角の行は引っ込み量の分だけ狭く、間の行は外接矩形の幅いっぱいになる。
+	*/
+	bool RoundRectSpans::next(int16_t& x, int16_t& w)
+	{
+		if (row >= boxH) return false;
+		int16_t i = (row < radius) ? row : boxH - 1 - row; // 上または下の辺からの行
+		int16_t inset = (i < radius) ? pInset[i] : 0;
+		x = boxX + inset;
+		w = boxW - 2 * inset;
+		row++;
+		return true;
+	}
+
+	/*!
+		@brief  三角形の区間を作る
+		@details 頂点をYの順に並べ、外接矩形を求める。
+	*/
+	TriangleSpans::TriangleSpans(int16_t a_x0, int16_t a_y0, int16_t a_x1, int16_t a_y1, int16_t a_x2, int16_t a_y2)
+	{
+		int16_t t;
+		if (a_y0 > a_y1) {
+			t = a_y0, a_y0 = a_y1, a_y1 = t;
+			t = a_x0, a_x0 = a_x1, a_x1 = t;
+		}
+		if (a_y1 > a_y2) {
+			t = a_y2, a_y2 = a_y1, a_y1 = t;
+			t = a_x2, a_x2 = a_x1, a_x1 = t;
+		}
+		if (a_y0 > a_y1) {
+			t = a_y0, a_y0 = a_y1, a_y1 = t;
+			t = a_x0, a_x0 = a_x1, a_x1 = t;
+		}
+		x0 = a_x0, y0 = a_y0, x1 = a_x1, y1 = a_y1, x2 = a_x2, y2 = a_y2;
+		y = y0;
+		last = (y1 == y2) ? y1 : y1 - 1; // 下が平らなら、y1の行も上半分で描く
+
+		int16_t minX = x0, maxX = x0;
+		if (x1 < minX) minX = x1;
+		if (x1 > maxX) maxX = x1;
+		if (x2 < minX) minX = x2;
+		if (x2 > maxX) maxX = x2;
+		boxX = minX;
+		boxY = y0;
+		boxW = maxX - minX + 1;
+		boxH = y2 - y0 + 1;
+	}
+
+	/*!
+		@brief  次の行の区間を返す
+		@details 上半分は辺0-1と辺0-2、下半分は辺1-2と辺0-2の交点を、fillTriangle()と同じ整数計算で求める。
+	*/
+	bool TriangleSpans::next(int16_t& x, int16_t& w)
+	{
+		if (y > y2) return false;
+		int16_t a, b;
+		if (y0 == y2) { // すべての頂点が同じ行
+			x = boxX;
+			w = boxW;
+			y++;
+			return true;
+		}
+		if (y <= last) {
+			a = x0 + sa / (y1 - y0);
+			b = x0 + sb / (y2 - y0);
+			sa += x1 - x0;
+			sb += x2 - x0;
+		} else {
+			if (y == last + 1) { // 下半分の始まり
+				sa = (int32_t)(x2 - x1) * (y - y1);
+				sb = (int32_t)(x2 - x0) * (y - y0);
+			}
+			a = x1 + sa / (y2 - y1);
+			b = x0 + sb / (y2 - y0);
+			sa += x2 - x1;
+			sb += x2 - x0;
+		}
+		if (a > b) {
+			int16_t t = a;
+			a = b;
+			b = t;
+		}
+		x = a;
+		w = b - a + 1;
+		y++;
+		return true;
+	}
+} // namespace ardPort
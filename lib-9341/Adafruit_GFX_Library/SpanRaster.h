@@ -0,0 +1,130 @@
+/*!
+ * @file SpanRaster.h
+ *
+ * 塗りつぶし図形（角丸矩形・円・三角形）を、走査線ごとの区間（スパン）に分解するクラス。
+ * 円の１/４の形は、fillCircleHelper()と同じBresenhamの計算で求めた値を、よく使う半径についてコンパイル時に表にしておく。
+ * Adafruit_GFX::fillSpans()/fillSpansOpaque()がこの区間を受け取って描く。
+ */
+#pragma once
+#include <stdint.h>
+
+#ifndef SPAN_TABLE_MAX_RADIUS
+	#define SPAN_TABLE_MAX_RADIUS 16 ///< 表にしておく半径の上限（これより大きい半径は描くときに計算する）
+#endif
+#define SPAN_MAX_RADIUS 160 ///< 扱える半径の上限（画面の短辺の半分）
+
+namespace ardPort {
+
+	/*!
+	  @brief  円の１/４の形を、上の行からの「左右の引っ込み量」で表す
+	  @details
+		半径rの角丸の上からi行目（0≦i<r）は、外接矩形の左右の辺から inset[i] ドット内側から塗られる。
+		fillCircleHelper()が縦線で描く形と１ドットも違わないように、同じ計算で縦線の長さを求め、行ごとの幅に直している。
+	*/
+	struct QuarterCircle {
+		/*!
+			@brief  半径rの角丸の引っ込み量を求める
+			@param  r       半径（1以上SPAN_MAX_RADIUS以下）
+			@param  pInset  r個の引っ込み量を受け取る配列
+		*/
+		static constexpr void build(int16_t r, uint8_t* pInset)
+		{
+			// 列c（中心からの水平距離）の縦線が、中心から上下に何行まで届くか（fillCircleHelper()と同じ計算）
+			int16_t reach[SPAN_MAX_RADIUS + 1] = {};
+			reach[0] = r; // 中心の列は矩形の部分が塗る
+			int16_t f = 1 - r;
+			int16_t ddF_x = 1;
+			int16_t ddF_y = -2 * r;
+			int16_t x = 0;
+			int16_t y = r;
+			int16_t px = x;
+			int16_t py = y;
+			while (x < y) {
+				if (f >= 0) {
+					y--;
+					ddF_y += 2;
+					f += ddF_y;
+				}
+				x++;
+				ddF_x += 2;
+				f += ddF_x;
+				if (x < (y + 1) && reach[x] < y) reach[x] = y;
+				if (y != py) {
+					if (reach[py] < px) reach[py] = px;
+					py = y;
+				}
+				px = x;
+			}
+			// 上からi行目（中心からr-i行上）を塗る一番外側の列を探す
+			for (int16_t i = 0; i < r; i++) {
+				int16_t c = r;
+				while (c > 0 && reach[c] < r - i) c--;
+				pInset[i] = (uint8_t)(r - c);
+			}
+		}
+	};
+
+	/*!
+	  @brief  半径1～SPAN_TABLE_MAX_RADIUSの引っ込み量の表（コンパイル時に作る）
+	*/
+	struct QuarterCircleTable {
+		uint8_t inset[SPAN_TABLE_MAX_RADIUS + 1][SPAN_TABLE_MAX_RADIUS]; ///< [半径][上からの行]
+		constexpr QuarterCircleTable() : inset{}
+		{
+			for (int16_t r = 1; r <= SPAN_TABLE_MAX_RADIUS; r++) {
+				QuarterCircle::build(r, inset[r]);
+			}
+		}
+	};
+	inline constexpr QuarterCircleTable quarterCircleTable{};
+
+	/*!
+	  @brief  走査線の区間を上の行から順に返すクラスの基底
+	  @details 図形は外接矩形（boxX, boxY, boxW, boxH）の中にあり、１行に区間は１つ（凸な図形）。
+	*/
+	class SpanSource {
+	  public:
+		int16_t boxX = 0; ///< 外接矩形の左端
+		int16_t boxY = 0; ///< 外接矩形の上端
+		int16_t boxW = 0; ///< 外接矩形の幅
+		int16_t boxH = 0; ///< 外接矩形の高さ（next()を呼ぶ回数）
+		/*!
+			@brief  次の行の区間を返す
+			@param  x  区間の左端（画面座標）
+			@param  w  区間の幅（0なら塗る部分が無い）
+			@return 行が残っていればtrue
+		*/
+		virtual bool next(int16_t& x, int16_t& w) = 0;
+	};
+
+	/*!
+	  @brief  角丸矩形（円は w = h = 2r+1 の角丸矩形）の区間
+	*/
+	class RoundRectSpans : public SpanSource {
+	  public:
+		RoundRectSpans(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r);
+		bool next(int16_t& x, int16_t& w) override;
+
+	  private:
+		int16_t radius;                     ///< 角の半径
+		int16_t row = 0;                    ///< 次に返す行
+		const uint8_t* pInset;              ///< 引っ込み量（表か、insetBuf）
+		uint8_t insetBuf[SPAN_MAX_RADIUS]; ///< 表に無い半径の引っ込み量
+	};
+
+	/*!
+	  @brief  三角形の区間（fillTriangle()と同じ計算）
+	*/
+	class TriangleSpans : public SpanSource {
+	  public:
+		TriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+		bool next(int16_t& x, int16_t& w) override;
+
+	  private:
+		int16_t x0, y0, x1, y1, x2, y2; ///< Yの順に並べた頂点
+		int16_t y;                      ///< 次に返す行
+		int16_t last;                   ///< 上半分の最後の行
+		int32_t sa = 0;                 ///< 辺0-1（下半分は辺1-2）の交点の計算用
+		int32_t sb = 0;                 ///< 辺0-2の交点の計算用
+	};
+} // namespace ardPort
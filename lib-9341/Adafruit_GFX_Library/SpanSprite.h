@@ -0,0 +1,33 @@
+/*!
+ * @file SpanSprite.h
+ *
+ * 透過色を持つ小さなアイコンを、行ごとの「透過しない区間（スパン）」と、その区間のピクセルだけの並びで持つ形式。
+ * 透過色つきのdrawRGBBitmap()が１ピクセルずつ色を比べて書くのに対し、区間ごとに１つのウインドウとまとめた転送で描ける。
+ * 区間は tools/pack_images.py で pictData.h から作る（pictPacked.h）。
+ */
+#pragma once
+#include <stdint.h>
+
+namespace ardPort {
+
+	/*!
+	  @brief  透過しない区間（１行の中の連続したピクセル）
+	*/
+	struct SpriteSpan {
+		uint8_t y;   ///< 行（スプライトの上端から）
+		uint8_t x;   ///< 区間の左端（スプライトの左端から）
+		uint8_t len; ///< 区間のピクセル数
+	};
+
+	/*!
+	  @brief  区間で表したスプライト
+	  @details spansは上の行から、同じ行の中は左から並ぶ。pixelsはspansの順に区間のピクセルを詰めたもの。
+	*/
+	struct SpanSprite {
+		uint16_t width;          ///< 幅
+		uint16_t height;         ///< 高さ
+		uint16_t spanCount;      ///< 区間の数
+		const SpriteSpan* spans; ///< 区間
+		const uint16_t* pixels;  ///< 区間のピクセル（RGB565）
+	};
+} // namespace ardPort
@@ -0,0 +1,237 @@
+/*!
+ * @file TftDisplayList.cpp
+ *
+ * 描画命令リストの記録部分の実装。
+ * ヘッダ・コマンド・座標は words[] に続けて書き、連続している間は１つの制御ブロックにまとめる。
+ * ピクセルデータは呼び出し側のメモリ（またはarena）を指す制御ブロックとして記録し、塗りつぶしは色の１語を読み出しアドレスを進めずに送る。
+ */
+#include "TftDisplayList.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+	#include <string.h>
+
+namespace ardPort {
+
+	/// @brief データ区間の数（TFT_PIO_MAX_WORDSごとに分ける）
+	static inline uint32_t chunkCount(uint32_t len) { return (len + TFT_PIO_MAX_WORDS - 1) / TFT_PIO_MAX_WORDS; }
+
+	TftDisplayList::TftDisplayList() :
+		blockCount(0),
+		wordCount(0),
+		arenaUsed(0),
+		isClosed(false),
+		isInlineOpen(false),
+		pRunner(nullptr)
+	{
+	}
+
+	/*!
+		@brief  記録を消す
+		@details 送信中なら、送り終わるまで待ってから消す。
+	*/
+	void TftDisplayList::clear(void)
+	{
+		if (pRunner != nullptr) pRunner->waitList();
+		blockCount = 0;
+		wordCount = 0;
+		arenaUsed = 0;
+		isClosed = false;
+		isInlineOpen = false;
+	}
+
+	/*!
+		@brief  語数とブロック数の空きがあるか
+		@param  nWords   使う語数
+		@param  nBlocks  使うブロック数
+	*/
+	bool TftDisplayList::fits(uint32_t nWords, uint32_t nBlocks) const
+	{
+		if (isClosed) return false;
+		return (wordCount + nWords <= TFT_LIST_MAX_WORDS) && (blockCount + nBlocks <= TFT_LIST_MAX_BLOCKS);
+	}
+
+	/*!
+		@brief  words[] に続けて書き、直前のブロックが words[] の続きならそれを伸ばす
+		@param  src  書く語
+		@param  n    語数
+	*/
+	void TftDisplayList::pushWords(const uint16_t* src, uint16_t n)
+	{
+		uint16_t* dst = &words[wordCount];
+		memcpy(dst, src, n * sizeof(uint16_t));
+		wordCount += n;
+		if (isInlineOpen) {
+			blocks[blockCount - 1].count += n;
+			return;
+		}
+		TftListBlock& b = blocks[blockCount++];
+		b.ctrl = DMA_CH0_CTRL_TRIG_INCR_READ_BITS;
+		b.readAddr = dst;
+		b.writeAddr = nullptr;
+		b.count = n;
+		isInlineOpen = true;
+	}
+
+	/*!
+		@brief  外部のメモリを読むブロックを追加する
+		@param  src        読み出すアドレス
+		@param  len        16ビットの語数
+		@param  increment  読み出しアドレスを進めるか
+	*/
+	void TftDisplayList::pushRef(const void* src, uint32_t len, bool increment)
+	{
+		TftListBlock& b = blocks[blockCount++];
+		b.ctrl = increment ? DMA_CH0_CTRL_TRIG_INCR_READ_BITS : 0;
+		b.readAddr = src;
+		b.writeAddr = nullptr;
+		b.count = len;
+		isInlineOpen = false;
+	}
+
+	/*!
+		@brief  書き込みウインドウを指定し、メモリへの書き込みを始める（CASET/PASET/RAMWR）
+		@param  x  ウインドウの左上（液晶のメモリ座標）
+		@param  y  ウインドウの左上（液晶のメモリ座標）
+		@param  w  幅
+		@param  h  高さ
+		@return 記録できればtrue
+	*/
+	bool TftDisplayList::setWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+	{
+		if (w == 0 || h == 0 || !fits(12, 1)) return false;
+		const uint16_t seq[12] = {
+			TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1), TFT_DCS_CASET << 8,
+			TFT_PIO_HEADER(TFT_PIO_MODE_DATA, 2), x, (uint16_t)(x + w - 1),
+			TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1), TFT_DCS_PASET << 8,
+			TFT_PIO_HEADER(TFT_PIO_MODE_DATA, 2), y, (uint16_t)(y + h - 1),
+			TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1), TFT_DCS_RAMWR << 8};
+		pushWords(seq, 12);
+		return true;
+	}
+
+	/*!
+		@brief  直前に指定したウインドウに、同じ色をlenピクセル書く
+		@param  color  RGB565の色
+		@param  len    ピクセル数
+		@return 記録できればtrue
+	*/
+	bool TftDisplayList::fill(uint16_t color, uint32_t len)
+	{
+		uint32_t chunks = chunkCount(len);
+		if (len == 0 || !fits(chunks * 2, chunks * 2)) return false;
+		while (len > 0) {
+			uint32_t n = (len > TFT_PIO_MAX_WORDS) ? TFT_PIO_MAX_WORDS : len;
+			uint16_t header = TFT_PIO_HEADER(TFT_PIO_MODE_DATA, n);
+			pushWords(&header, 1);
+			uint16_t* pColor = &words[wordCount++];
+			*pColor = color;
+			pushRef(pColor, n, false);
+			len -= n;
+		}
+		return true;
+	}
+
+	/*!
+		@brief  直前に指定したウインドウに、呼び出し側のピクセルを参照で書く
+		@param  pPixels  RGB565のピクセル（送り終わるまで変えないこと）
+		@param  len      ピクセル数
+		@return 記録できればtrue
+	*/
+	bool TftDisplayList::pixels(const uint16_t* pPixels, uint32_t len)
+	{
+		uint32_t chunks = chunkCount(len);
+		if (len == 0 || !fits(chunks, chunks * 2)) return false;
+		while (len > 0) {
+			uint32_t n = (len > TFT_PIO_MAX_WORDS) ? TFT_PIO_MAX_WORDS : len;
+			uint16_t header = TFT_PIO_HEADER(TFT_PIO_MODE_DATA, n);
+			pushWords(&header, 1);
+			pushRef(pPixels, n, true);
+			pPixels += n;
+			len -= n;
+		}
+		return true;
+	}
+
+	/*!
+		@brief  直前に指定したウインドウにlenピクセル書く領域をリスト内に確保する
+		@param  len  ピクセル数
+		@return 書き込み先。呼び出し側が送信までにピクセルを書き込む。空きが無ければnullptr
+	*/
+	uint16_t* TftDisplayList::copy(uint32_t len)
+	{
+		if (len == 0 || arenaUsed + len > TFT_LIST_ARENA_PIXELS) return nullptr;
+		uint16_t* dst = &arena[arenaUsed];
+		if (!pixels(dst, len)) return nullptr;
+		arenaUsed += len;
+		return dst;
+	}
+
+	/*!
+		@brief  矩形を単色で塗りつぶす
+		@return 記録できればtrue（falseなら何も記録していない）
+	*/
+	bool TftDisplayList::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+	{
+		uint32_t chunks = chunkCount((uint32_t)w * h);
+		if (!fits(12 + chunks * 2, 1 + chunks * 2)) return false;
+		return setWindow(x, y, w, h) && fill(color, (uint32_t)w * h);
+	}
+
+	/*!
+		@brief  RGB565のビットマップ（w×h、詰めて並んでいること）を参照で描く
+		@return 記録できればtrue（falseなら何も記録していない）
+	*/
+	bool TftDisplayList::bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pPixels)
+	{
+		uint32_t chunks = chunkCount((uint32_t)w * h);
+		if (!fits(12 + chunks, 1 + chunks * 2)) return false;
+		return setWindow(x, y, w, h) && pixels(pPixels, (uint32_t)w * h);
+	}
+
+	/*!
+		@brief  ウインドウを指定し、w×hピクセルを書く領域をリスト内に確保する
+		@return 書き込み先（w×h、詰めて並べる）。空きが無ければnullptr（何も記録していない）
+	*/
+	uint16_t* TftDisplayList::copyRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+	{
+		uint32_t len = (uint32_t)w * h;
+		if (arenaUsed + len > TFT_LIST_ARENA_PIXELS || !fits(12 + chunkCount(len), 1 + chunkCount(len) * 2)) return nullptr;
+		if (!setWindow(x, y, w, h)) return nullptr;
+		return copy(len);
+	}
+
+	/*!
+		@brief  縦スクロールの開始位置を変える（VSCRSADD）
+		@details 前に記録した行を送り終えてから画面が動くので、スクロールで空いた行を描いたあとに記録する。
+		@param  y  スクロール開始位置（液晶のメモリの行）
+		@return 記録できればtrue
+	*/
+	bool TftDisplayList::scrollTo(uint16_t y)
+	{
+		if (!fits(4, 1)) return false;
+		const uint16_t seq[4] = {
+			TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1), TFT_DCS_VSCRSADD << 8,
+			TFT_PIO_HEADER(TFT_PIO_MODE_DATA, 1), y};
+		pushWords(seq, 4);
+		return true;
+	}
+
+	/*!
+		@brief  終了区間（CS=H）と、DMAの制御チェーンを止める終端ブロックを付ける
+		@details 容量は予備を取ってあるので、記録の上限に達していても付けられる。
+	*/
+	void TftDisplayList::close(void)
+	{
+		if (isClosed) return;
+		uint16_t end = TFT_PIO_HEADER(TFT_PIO_MODE_END, 1);
+		pushWords(&end, 1);
+		TftListBlock& b = blocks[blockCount];
+		b.ctrl = 0;
+		b.readAddr = nullptr;
+		b.writeAddr = nullptr;
+		b.count = 0; // TRANS_COUNT_TRIGへの0の書き込みは転送を起動しない
+		isClosed = true;
+		isInlineOpen = false;
+	}
+} // namespace ardPort
+#endif
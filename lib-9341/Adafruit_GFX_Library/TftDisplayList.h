@@ -0,0 +1,89 @@
+/*!
+ * @file TftDisplayList.h
+ *
+ * 描画命令（ウインドウ指定、単色の塗りつぶし、ビットマップの参照）を記録しておき、まとめて液晶に送るためのリスト。
+ * 記録はTftPioStream.pioのストリーム形式で行い、DMAの制御ブロック（CHx_AL1の ctrl, read_addr, write_addr, count）の並びとして持つ。
+ * PIOの送信経路があれば、制御用のDMAチャネルがブロックを順にデータ用チャネルに書き込んで、CPUを介さずに最後まで送る。
+ */
+#pragma once
+#include "misc/defines.h"
+#include <stdint.h>
+
+#if defined(ARDUINO_ARCH_RP2040)
+	#include "TftPioStream.h"
+
+	#ifndef TFT_LIST_MAX_BLOCKS
+		#define TFT_LIST_MAX_BLOCKS 128 ///< 記録できるDMA制御ブロックの数
+	#endif
+	#ifndef TFT_LIST_MAX_WORDS
+		#define TFT_LIST_MAX_WORDS 1024 ///< ヘッダ・コマンド・座標・塗りつぶし色を入れる語数
+	#endif
+	#ifndef TFT_LIST_ARENA_PIXELS
+		#define TFT_LIST_ARENA_PIXELS 4096 ///< copy()で写しを取るピクセルの領域（8KB）
+	#endif
+
+namespace ardPort {
+
+	/*!
+	  @brief  DMAの制御ブロック。データ用チャネルの CHx_AL1_CTRL から始まる４つのレジスタにそのまま書き込まれる
+	*/
+	struct TftListBlock {
+		uint32_t ctrl;           ///< CTRL（記録中は読み出しアドレスを進めるかのビットだけ）
+		const void* readAddr;    ///< 読み出しアドレス
+		volatile void* writeAddr; ///< 書き込みアドレス（PIOのTX FIFO。送信開始時に設定）
+		uint32_t count;          ///< 16ビットの転送回数（書き込むと転送が始まる。0で終わり）
+	};
+
+	/*!
+	  @brief  液晶に送る描画命令を記録するリスト
+	  @details
+		setWindow()のあとに fill()/pixels()/copy() でそのウインドウのピクセルを記録する。fillRect()/bitmap()/glyph()/copyRect()はその組み合わせ。
+		scrollTo()は縦スクロールの開始位置を、記録した順（前に記録したピクセルを送った後）に変える。
+		pixels()/bitmap()/glyph()は呼び出し側のメモリを参照するだけなので、送り終わるまで内容を変えてはいけない。
+		一時的なバッファ（行キャンバスなど）は copy() でリスト内に写しを取る。
+		どれも容量が足りなければ何も記録せずにfalseを返すので、呼び出し側はいったん送ってから clear() して記録し直す。
+		送信中に clear() すると、送り終わるまで待つ。
+	*/
+	class TftDisplayList {
+	  public:
+		TftDisplayList();
+		void clear(void);
+		bool setWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+		bool fill(uint16_t color, uint32_t len);
+		bool pixels(const uint16_t* pixels, uint32_t len);
+		uint16_t* copy(uint32_t len);
+		bool fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+		bool bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pPixels);
+		uint16_t* copyRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+		bool scrollTo(uint16_t y);
+		/// @brief 展開済みの文字（グリフキャッシュのスロットなど）を参照で描く。送り終わるまでスロットを追い出さないこと
+		bool glyph(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pPixels) { return bitmap(x, y, w, h, pPixels); }
+
+		bool isEmpty() const { return blockCount == 0; }          ///< 何も記録されていないか
+		uint16_t getBlockCount() const { return blockCount; }     ///< 記録したDMA制御ブロックの数
+		uint16_t getWordCount() const { return wordCount; }       ///< 使った語数
+		uint32_t getArenaUsed() const { return arenaUsed; }       ///< copy()で使ったピクセル数
+		/// @brief ブロックの並び（CPUで送るときに使う）
+		const TftListBlock* getBlocks() const { return blocks; }
+		/// @brief ブロックが読み出しアドレスを進めるか
+		static bool isIncrement(const TftListBlock& b) { return (b.ctrl & DMA_CH0_CTRL_TRIG_INCR_READ_BITS) != 0; }
+
+	  private:
+		friend class TftPioStream;
+		bool fits(uint32_t nWords, uint32_t nBlocks) const;
+		void pushWords(const uint16_t* src, uint16_t n);
+		void pushRef(const void* src, uint32_t len, bool increment);
+		void close(void);
+
+		TftListBlock blocks[TFT_LIST_MAX_BLOCKS + 2]; ///< 制御ブロック（終了区間と終端の分を余分に持つ）
+		uint16_t words[TFT_LIST_MAX_WORDS + 1];       ///< ヘッダ・コマンド・座標・塗りつぶし色
+		uint16_t arena[TFT_LIST_ARENA_PIXELS];        ///< copy()の写し
+		uint16_t blockCount;                          ///< 記録したブロック数（close()の後は終了区間を含む）
+		uint16_t wordCount;                           ///< 使った語数
+		uint32_t arenaUsed;                           ///< copy()で使ったピクセル数
+		bool isClosed;                                ///< 終了区間と終端を付けたか
+		bool isInlineOpen;                            ///< 最後のブロックが words[] の続きで伸ばせるか
+		TftPioStream* pRunner;                        ///< 送信中ならその送信経路
+	};
+} // namespace ardPort
+#endif
@@ -0,0 +1,434 @@
+/*!
+ * @file TftFramebuffer.cpp
+ *
+ * メモリ上の画面に描き、液晶に送ったときの量を見積もるクラスの実装。
+ */
+#include "TftFramebuffer.h"
+#include <stdio.h>
+#include <vector>
+
+namespace ardPort {
+
+	/*!
+		@brief  240×320の画面を作る（黒で初期化される）
+	*/
+	TftFramebuffer::TftFramebuffer() : GFXcanvas16(TFT_FRAMEBUFFER_WIDTH, TFT_FRAMEBUFFER_HEIGHT)
+	{
+	}
+
+	/*!
+		@brief  送信量の見積もりを取得する
+		@param  counters  見積もりの累計を返す。busyUsはバイト数とSPIのクロックから求めた送信時間
+	*/
+	void TftFramebuffer::getCost(TftProfileCounters& counters) const
+	{
+		counters = cost;
+		counters.busyUs = (uint32_t)(((uint64_t)(cost.commandBytes + cost.pixelBytes) * 8 * 1000000) / spiClockHz);
+	}
+
+	/*!
+		@brief  送信量の見積もりを消す（ILI9341と同じく、覚えているウインドウも捨てる）
+	*/
+	void TftFramebuffer::resetCost(void)
+	{
+		cost = TftProfileCounters();
+		oldX1 = oldX2 = oldY1 = oldY2 = -1;
+	}
+
+	/*!
+		@brief  ウインドウ指定を数える
+		@details 列・行の範囲が前回と同じなら、CASET/PASETは送らない（Adafruit_ILI9341::setAddrWindow()と同じ）。
+	*/
+	void TftFramebuffer::chargeWindow(int16_t x, int16_t y, int16_t w, int16_t h)
+	{
+		int16_t x2 = x + w - 1, y2 = y + h - 1;
+		cost.windows++;
+		if (x != oldX1 || x2 != oldX2) {
+			cost.commandBytes += 5; // CASET + 4
+			oldX1 = x;
+			oldX2 = x2;
+		}
+		if (y != oldY1 || y2 != oldY2) {
+			cost.commandBytes += 5; // PASET + 4
+			oldY1 = y;
+			oldY2 = y2;
+		}
+		cost.commandBytes += 1; // RAMWR
+	}
+
+	/*!
+		@brief  矩形を１つのウインドウで送る量を数える
+		@return クリップ矩形（無ければ画面）に収まる部分があればtrue
+		@details はみ出す部分は切り取る。startWrite()の外なら、それだけで１つのトランザクションになる。
+	*/
+	bool TftFramebuffer::chargeRect(int16_t x, int16_t y, int16_t w, int16_t h)
+	{
+		if (!clipRect(x, y, w, h)) return false;
+		if (writeDepth == 0) cost.transactions++;
+		chargeWindow(x, y, w, h);
+		cost.pixelBytes += (uint32_t)w * h * 2;
+		return true;
+	}
+
+	/*!
+		@brief  トランザクションを開く（入れ子の一番外だけを数える）
+	*/
+	void TftFramebuffer::startWrite(void)
+	{
+		if (writeDepth++ == 0 && chargeDepth == 0) cost.transactions++;
+	}
+
+	/*!
+		@brief  トランザクションを閉じる
+	*/
+	void TftFramebuffer::endWrite(void)
+	{
+		if (writeDepth > 0) writeDepth--;
+	}
+
+	void TftFramebuffer::drawPixel(int16_t x, int16_t y, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, 1, 1);
+		GFXcanvas16::drawPixel(x, y, color);
+	}
+
+	void TftFramebuffer::writePixel(int16_t x, int16_t y, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, 1, 1);
+		chargeDepth++;
+		GFXcanvas16::drawPixel(x, y, color);
+		chargeDepth--;
+	}
+
+	void TftFramebuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, w, h);
+		chargeDepth++;
+		GFXcanvas16::fillRect(x, y, w, h, color);
+		chargeDepth--;
+	}
+
+	void TftFramebuffer::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, w, h);
+		chargeDepth++;
+		GFXcanvas16::writeFillRect(x, y, w, h, color);
+		chargeDepth--;
+	}
+
+	void TftFramebuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, w, 1);
+		chargeDepth++;
+		GFXcanvas16::drawFastHLine(x, y, w, color);
+		chargeDepth--;
+	}
+
+	void TftFramebuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, 1, h);
+		chargeDepth++;
+		GFXcanvas16::drawFastVLine(x, y, h, color);
+		chargeDepth--;
+	}
+
+	void TftFramebuffer::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, w, 1);
+		chargeDepth++;
+		GFXcanvas16::drawFastHLine(x, y, w, color);
+		chargeDepth--;
+	}
+
+	void TftFramebuffer::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, 1, h);
+		chargeDepth++;
+		GFXcanvas16::drawFastVLine(x, y, h, color);
+		chargeDepth--;
+	}
+
+	void TftFramebuffer::fillScreen(uint16_t color)
+	{
+		if (chargeDepth == 0) chargeRect(clipLeft(), clipTop(), clipRight() - clipLeft(), clipBottom() - clipTop());
+		chargeDepth++;
+		GFXcanvas16::fillScreen(color);
+		chargeDepth--;
+	}
+
+	/*!
+		@brief  展開済みの文字を描く
+		@details クリップ矩形（無ければ画面）で切り詰めた部分を１つのウインドウ。
+	*/
+	void TftFramebuffer::drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels)
+	{
+		if (chargeDepth > 0) {
+			GFXcanvas16::drawGlyph565(x, y, w, h, pixels);
+			return;
+		}
+		chargeRect(x, y, w, h);
+		chargeDepth++;
+		GFXcanvas16::drawGlyph565(x, y, w, h, pixels);
+		chargeDepth--;
+	}
+
+	/*!
+		@brief  圧縮した画像を描く（クリップ矩形に収まれば１つのウインドウ）
+	*/
+	void TftFramebuffer::drawPackedImage(int16_t x, int16_t y, const PackedImage& img)
+	{
+		if (chargeDepth > 0 || !isRectInClip(x, y, img.width, img.height)) {
+			GFXcanvas16::drawPackedImage(x, y, img);
+			return;
+		}
+		chargeRect(x, y, img.width, img.height);
+		chargeDepth++;
+		GFXcanvas16::drawPackedImage(x, y, img);
+		chargeDepth--;
+	}
+
+	/*!
+		@brief  区間で表したスプライトを描く（クリップ矩形で切り詰めた区間ごとに１行のウインドウ）
+	*/
+	void TftFramebuffer::drawSpanSprite(int16_t x, int16_t y, const SpanSprite& sprite)
+	{
+		if (chargeDepth > 0) {
+			GFXcanvas16::drawSpanSprite(x, y, sprite);
+			return;
+		}
+		int16_t sw = sprite.width, sh = sprite.height, bx, by;
+		int16_t sx0 = x, sy0 = y;
+		if (clipBitmap(sx0, sy0, sw, sh, bx, by)) {
+			if (writeDepth == 0) cost.transactions++;
+			for (uint16_t k = 0; k < sprite.spanCount; k++) {
+				const SpriteSpan& span = sprite.spans[k];
+				int16_t sx = x + span.x, sy = y + span.y, len = span.len;
+				if (sy < clipTop() || sy >= clipBottom()) continue;
+				if (sx < clipLeft()) {
+					len -= clipLeft() - sx;
+					sx = clipLeft();
+				}
+				if (sx + len > clipRight()) len = clipRight() - sx;
+				if (len <= 0) continue;
+				chargeWindow(sx, sy, len, 1);
+				cost.pixelBytes += len * 2;
+			}
+		}
+		chargeDepth++;
+		GFXcanvas16::drawSpanSprite(x, y, sprite);
+		chargeDepth--;
+	}
+
+	/*!
+		@brief  パレット番号のビットマップを描く（画面に収まる部分を１つのウインドウ）
+	*/
+	void TftFramebuffer::drawIndexedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint16_t palette[], uint8_t bpp, int16_t w, int16_t h)
+	{
+		if (chargeDepth == 0) chargeRect(x, y, w, h);
+		chargeDepth++;
+		GFXcanvas16::drawIndexedBitmap(x, y, bitmap, palette, bpp, w, h);
+		chargeDepth--;
+	}
+
+	/*!
+		@brief  背景色つきの塗りつぶし図形を描く（クリップ矩形に収まれば外接矩形を１つのウインドウ）
+	*/
+	void TftFramebuffer::fillSpansOpaque(SpanSource& src, uint16_t color, uint16_t bg)
+	{
+		if (chargeDepth > 0 || !isRectInClip(src.boxX, src.boxY, src.boxW, src.boxH)) {
+			GFXcanvas16::fillSpansOpaque(src, color, bg);
+			return;
+		}
+		chargeRect(src.boxX, src.boxY, src.boxW, src.boxH);
+		chargeDepth++;
+		GFXcanvas16::fillSpansOpaque(src, color, bg);
+		chargeDepth--;
+	}
+
+	/*!
+		@brief  CRC-32（PNGのチャンク用）を更新する
+	*/
+	static uint32_t pngCrc(uint32_t crc, const uint8_t* p, uint32_t len)
+	{
+		crc = ~crc;
+		while (len--) {
+			crc ^= *p++;
+			for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+		return ~crc;
+	}
+
+	/*!
+		@brief  PNGのチャンクを１つ追加する
+	*/
+	static void pngChunk(std::vector<uint8_t>& out, const char* type, const uint8_t* data, uint32_t len)
+	{
+		uint8_t head[8] = {(uint8_t)(len >> 24), (uint8_t)(len >> 16), (uint8_t)(len >> 8), (uint8_t)len,
+						   (uint8_t)type[0], (uint8_t)type[1], (uint8_t)type[2], (uint8_t)type[3]};
+		uint32_t crc = pngCrc(0, head + 4, 4);
+		crc = pngCrc(crc, data, len);
+		out.insert(out.end(), head, head + 8);
+		if (len > 0) out.insert(out.end(), data, data + len);
+		out.push_back(crc >> 24);
+		out.push_back(crc >> 16);
+		out.push_back(crc >> 8);
+		out.push_back(crc);
+	}
+
+	/*!
+		@brief  deflateのビット列（下位ビットから詰める）
+	*/
+	struct DeflateBits {
+		std::vector<uint8_t>& out;
+		uint32_t bits = 0;
+		uint8_t count = 0;
+		explicit DeflateBits(std::vector<uint8_t>& a_out) : out(a_out) {}
+		/// @brief 値を下位ビットから書く（ブロックの見出しと追加ビット）
+		void put(uint32_t value, uint8_t n)
+		{
+			bits |= value << count;
+			count += n;
+			while (count >= 8) {
+				out.push_back(bits & 0xFF);
+				bits >>= 8;
+				count -= 8;
+			}
+		}
+		/// @brief ハフマン符号を上位ビットから書く
+		void putCode(uint32_t code, uint8_t n)
+		{
+			uint32_t rev = 0;
+			for (uint8_t i = 0; i < n; i++) rev |= ((code >> i) & 1) << (n - 1 - i);
+			put(rev, n);
+		}
+		/// @brief 固定ハフマン符号のリテラル・長さの記号を書く
+		void putSymbol(uint16_t sym)
+		{
+			if (sym < 144) putCode(0x30 + sym, 8);
+			else if (sym < 256) putCode(0x190 + sym - 144, 9);
+			else if (sym < 280) putCode(sym - 256, 7);
+			else putCode(0xC0 + sym - 280, 8);
+		}
+		/// @brief 一致（長さ3〜258、距離1〜32768）を書く
+		void putMatch(uint16_t len, uint16_t dist)
+		{
+			static const uint16_t lenBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+			static const uint8_t lenExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+			static const uint16_t distBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+			static const uint8_t distExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+			uint8_t l = 28;
+			while (lenBase[l] > len) l--;
+			putSymbol(257 + l);
+			put(len - lenBase[l], lenExtra[l]);
+			uint8_t d = 29;
+			while (distBase[d] > dist) d--;
+			putCode(d, 5);
+			put(dist - distBase[d], distExtra[d]);
+		}
+		/// @brief 残りのビットをバイトに揃える
+		void flush(void)
+		{
+			if (count > 0) out.push_back(bits & 0xFF);
+			bits = 0;
+			count = 0;
+		}
+	};
+
+	/*!
+		@brief  前のピクセルまたは上の行と同じ長さを求める
+	*/
+	static uint16_t matchLength(const uint8_t* raw, uint32_t pos, uint32_t rawLen, uint32_t dist)
+	{
+		if (pos < dist) return 0;
+		uint16_t len = 0;
+		while (len < 258 && pos + len < rawLen && raw[pos + len] == raw[pos + len - dist]) len++;
+		return len;
+	}
+
+	/*!
+		@brief  画面をPNG（RGB 8ビット）にしてメモリに書き出す
+		@param  out  PNGのバイト列を返す
+		@return 書き出せればtrue
+		@details 圧縮は固定ハフマン符号のdeflateで、一致は前のピクセル（3バイト前）と上の行だけを探す（ライブラリを使わないため）。
+				 同じ画面からは必ず同じバイト列になるので、保存したPNGとバイトで比べられる。回転は反映しない（液晶のメモリの並び）。
+	*/
+	bool TftFramebuffer::encodePNG(std::vector<uint8_t>& out) const
+	{
+		const uint16_t* pBuf = getBuffer();
+		if (pBuf == nullptr) return false;
+		const uint32_t rowBytes = 1 + WIDTH * 3; // フィルタの種類 + RGB
+		const uint32_t rawLen = rowBytes * HEIGHT;
+		std::vector<uint8_t> raw(rawLen);
+
+		uint8_t* p = raw.data();
+		for (int16_t y = 0; y < HEIGHT; y++) {
+			*p++ = 0; // フィルタなし
+			for (int16_t x = 0; x < WIDTH; x++) {
+				uint16_t c = pBuf[y * WIDTH + x];
+				*p++ = ((c >> 11) & 0x1F) * 255 / 31;
+				*p++ = ((c >> 5) & 0x3F) * 255 / 63;
+				*p++ = (c & 0x1F) * 255 / 31;
+			}
+		}
+		uint32_t a = 1, b = 0; // Adler-32
+		for (uint32_t i = 0; i < rawLen; i++) {
+			a = (a + raw[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		std::vector<uint8_t> idat;
+		idat.push_back(0x78); // zlibのヘッダ（32Kの窓、既定の圧縮）
+		idat.push_back(0x9C);
+		DeflateBits bits(idat);
+		bits.put(1, 1); // 最後のブロック
+		bits.put(1, 2); // 固定ハフマン符号
+		for (uint32_t pos = 0; pos < rawLen;) {
+			uint16_t lenPixel = matchLength(raw.data(), pos, rawLen, 3);
+			uint16_t lenRow = matchLength(raw.data(), pos, rawLen, rowBytes);
+			if (lenPixel >= 3 && lenPixel >= lenRow) {
+				bits.putMatch(lenPixel, 3);
+				pos += lenPixel;
+			} else if (lenRow >= 3) {
+				bits.putMatch(lenRow, rowBytes);
+				pos += lenRow;
+			} else {
+				bits.putSymbol(raw[pos++]);
+			}
+		}
+		bits.putSymbol(256); // ブロックの終わり
+		bits.flush();
+		uint32_t adler = (b << 16) | a;
+		idat.push_back(adler >> 24);
+		idat.push_back(adler >> 16);
+		idat.push_back(adler >> 8);
+		idat.push_back(adler);
+
+		static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+		uint8_t ihdr[13] = {(uint8_t)(WIDTH >> 24), (uint8_t)(WIDTH >> 16), (uint8_t)(WIDTH >> 8), (uint8_t)WIDTH,
+							(uint8_t)(HEIGHT >> 24), (uint8_t)(HEIGHT >> 16), (uint8_t)(HEIGHT >> 8), (uint8_t)HEIGHT,
+							8, 2, 0, 0, 0}; // 8ビット、RGB、圧縮0、フィルタ0、インターレースなし
+		out.assign(sig, sig + 8);
+		pngChunk(out, "IHDR", ihdr, sizeof(ihdr));
+		pngChunk(out, "IDAT", idat.data(), (uint32_t)idat.size());
+		pngChunk(out, "IEND", nullptr, 0);
+		return true;
+	}
+
+	/*!
+		@brief  画面をPNG（RGB 8ビット）に書き出す
+		@param  path  書き出すファイル
+		@return 書き出せればtrue
+	*/
+	bool TftFramebuffer::savePNG(const char* path) const
+	{
+		std::vector<uint8_t> png;
+		if (encodePNG(png) == false) return false;
+		bool bRet = false;
+		FILE* fp = fopen(path, "wb");
+		if (fp != nullptr) {
+			fwrite(png.data(), 1, png.size(), fp);
+			bRet = (ferror(fp) == 0);
+			fclose(fp);
+		}
+		return bRet;
+	}
+} // namespace ardPort
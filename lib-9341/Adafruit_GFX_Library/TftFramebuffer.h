@@ -0,0 +1,73 @@
+/*!
+ * @file TftFramebuffer.h
+ *
+ * 液晶の代わりに、メモリ上の240×320のRGB565の画面に描くクラス（ホストのLinuxで描画を確かめるため）。
+ * 描いた画面はPNGに書き出せる（メモリにも書き出せるので、保存した画面と比べられる）。あわせて、同じ描画をAdafruit_SPITFTで液晶に送ったときの
+ * トランザクション数・ウインドウ指定の数・コマンドとピクセルのバイト数を見積もる（TftProfileCountersと同じ項目）。
+ *
+ * 見積もりはAdafruit_SPITFTの送り方に合わせている。
+ *   - 塗りつぶし・線・１ピクセル : 画面に収まる部分を１つのウインドウで送る
+ *   - 展開済みの文字（drawGlyph565）・パレットのビットマップ : クリップ矩形（無ければ画面）で切り詰めた部分を１つのウインドウ
+ *   - 圧縮した画像 : クリップ矩形に収まれば１つのウインドウ
+ *   - スプライト : 切り詰めた区間ごとに１行のウインドウ
+ *   - 背景色つきの塗りつぶし図形（fillSpansOpaque）: クリップ矩形に収まれば外接矩形を１つのウインドウ
+ *   - ウインドウの列・行の範囲が前回と同じなら、ILI9341と同じくCASET/PASETを省く
+ * これらの中から呼ばれる描画（fillRect()の中のwriteFastVLine()など）は数えない。
+ */
+#pragma once
+#include "Adafruit_GFX.h"
+#include "TftProfile.h"
+#include <vector>
+
+#define TFT_FRAMEBUFFER_WIDTH 240  ///< 画面の幅
+#define TFT_FRAMEBUFFER_HEIGHT 320 ///< 画面の高さ
+
+namespace ardPort {
+
+	/*!
+	  @brief  メモリ上の画面に描き、液晶に送ったときの量を見積もるクラス
+	*/
+	class TftFramebuffer : public GFXcanvas16 {
+	  public:
+		TftFramebuffer();
+
+		// 送信量の見積もり
+		void getCost(TftProfileCounters& counters) const;
+		void resetCost(void);
+		void setSpiClock(uint32_t hz) { spiClockHz = hz; } ///< 送信時間の見積もりに使うSPIのクロック
+		// 画面の書き出し
+		bool encodePNG(std::vector<uint8_t>& out) const;
+		bool savePNG(const char* path) const;
+
+		// Adafruit_SPITFTの送り方で数える描画
+		void startWrite(void) override;
+		void endWrite(void) override;
+		void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+		void writePixel(int16_t x, int16_t y, uint16_t color) override;
+		void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+		void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+		void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+		void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+		void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+		void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+		void fillScreen(uint16_t color) override;
+		void drawGlyph565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) override;
+		void drawPackedImage(int16_t x, int16_t y, const PackedImage& img) override;
+		void drawSpanSprite(int16_t x, int16_t y, const SpanSprite& sprite) override;
+		void drawIndexedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint16_t palette[], uint8_t bpp, int16_t w, int16_t h) override;
+		void fillSpansOpaque(SpanSource& src, uint16_t color, uint16_t bg) override;
+
+	  private:
+		bool chargeRect(int16_t x, int16_t y, int16_t w, int16_t h);
+		void chargeWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+
+		TftProfileCounters cost;        ///< 送信量の見積もりの累計
+		uint32_t spiClockHz = 24000000; ///< SPIのクロック（ILI9341のSPI_DEFAULT_FREQ）
+		uint8_t writeDepth = 0;         ///< startWrite()の入れ子の深さ
+		uint8_t chargeDepth = 0;        ///< 数えている描画の入れ子の深さ（中から呼ばれる描画は数えない）
+		int16_t oldX1 = -1;             ///< 前回のウインドウの左端
+		int16_t oldX2 = -1;             ///< 前回のウインドウの右端
+		int16_t oldY1 = -1;             ///< 前回のウインドウの上端
+		int16_t oldY2 = -1;             ///< 前回のウインドウの下端
+	};
+} // namespace ardPort
@@ -0,0 +1,32 @@
+/*!
+ * @file TftHostBus.h
+ *
+ * ホストのLinuxでのビルド（TFT_HOST_BUS）で、Adafruit_SPITFTが液晶に送るバイトを受け取る口。
+ * pico-sdkの代わり（host/stub）が、SPIとDMAに書かれたバイトを、そのときのDCのレベルで振り分けて渡す。
+ * CSがHのあいだに送られたバイトは液晶に届かないので渡さない。
+ * DMAの転送は、待つ（dma_channel_wait_for_finish_blocking()など）かSPIに次の書き込みがあるまで送らず、その時点のDC・CSで振り分ける。
+ * このため、DMAの完了を待たずにDCやCSを切り替える誤りは、コマンドの化けやピクセルの欠けとして見える。
+ */
+#pragma once
+#include <stdint.h>
+
+namespace ardPort {
+
+	/*!
+	  @brief  液晶に届くバイトを受け取るクラスの基底（Ili9341Emulatorなど）
+	*/
+	class TftHostSink {
+	  public:
+		virtual ~TftHostSink() {}
+		/// @brief コマンドを受け取る（DC=L）
+		virtual void command(uint8_t cmd) = 0;
+		/// @brief データを受け取る（DC=H）
+		virtual void data(const uint8_t* p, uint32_t len) = 0;
+		/// @brief 読み出しで液晶が返す１バイト（MISO）
+		virtual uint8_t read(void) { return 0; }
+		/// @brief CSがHになった
+		virtual void endTransaction(void) {}
+	};
+
+	void tftHostBusAttach(TftHostSink* pSink, int8_t dcPin, int8_t csPin);
+} // namespace ardPort
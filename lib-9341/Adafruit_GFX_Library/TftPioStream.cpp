@@ -0,0 +1,241 @@
+/*!
+ * @file TftPioStream.cpp
+ *
+ * PIOを使った液晶の送信経路の実装。
+ * DMAは３チャネルをチェーンし、「ウインドウ指定とデータ区間のヘッダ」→「ピクセルデータ」→「終了区間」の順に
+ * 途切れなくPIOのFIFOに流し込む。CPUはチェーンを起動して、ステートマシンが終了区間を処理し終わるのを待つだけになる。
+ */
+#include "TftPioStream.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+	#include "hardware/gpio.h"
+	#include "hardware/clocks.h"
+	#include "TftPioStream.pio.h"
+	#include "TftDisplayList.h"
+
+namespace ardPort {
+
+	TftPioStream::TftPioStream() {}
+
+	/*!
+		@brief  PIOのプログラムを読み込み、ステートマシンとDMAチャネルを確保する
+		@param  pio      使用するPIO（pio0/pio1）
+		@param  sckPin   SCKのピン
+		@param  mosiPin  MOSIのピン
+		@param  dcPin    DCのピン
+		@param  csPin    CSのピン（dcPin+2であること）
+		@param  freq     SCKの周波数（Hz）。clk_sys/2が上限
+		@return 使える状態になればtrue。ピン配置が合わない、PIOに空きが無い場合はfalse（SPIのまま使う）
+		@details ピンはこの時点ではPIOに渡さない。
+	*/
+	bool TftPioStream::init(PIO a_pio, uint8_t a_sckPin, uint8_t a_mosiPin, uint8_t a_dcPin, uint8_t a_csPin, uint32_t freq)
+	{
+		if (a_csPin != a_dcPin + 2) return false;
+		if (!pio_can_add_program(a_pio, &tft_stream_program)) return false;
+		int a_sm = pio_claim_unused_sm(a_pio, false);
+		if (a_sm < 0) return false;
+
+		pio = a_pio;
+		sm = a_sm;
+		sckPin = a_sckPin;
+		mosiPin = a_mosiPin;
+		dcPin = a_dcPin;
+		csPin = a_csPin;
+
+		float div = (float)clock_get_hz(clk_sys) / (2.0f * freq);
+		if (div < 1.0f) div = 1.0f;
+		uint offset = pio_add_program(pio, &tft_stream_program);
+		tft_stream_program_init(pio, sm, offset, sckPin, mosiPin, dcPin, div);
+
+		chPrefix = dma_claim_unused_channel(true);
+		chPayload = dma_claim_unused_channel(true);
+		chTail = dma_claim_unused_channel(true);
+		chCtrl = dma_claim_unused_channel(true);
+		return true;
+	}
+
+	/*!
+		@brief  SCK/MOSI/DC/CSをPIOに切り替える
+		@details 切り替えの瞬間はPIO側の出力（SCK=L, DC=H, CS=H）になる。
+	*/
+	void TftPioStream::acquirePins(void)
+	{
+		gpio_function func = (pio == pio0) ? GPIO_FUNC_PIO0 : GPIO_FUNC_PIO1;
+		gpio_set_function(sckPin, func);
+		gpio_set_function(mosiPin, func);
+		gpio_set_function(dcPin, func);
+		gpio_set_function(csPin, func);
+	}
+
+	/*!
+		@brief  SCK/MOSIをSPIに、DC/CSをSIOに戻す
+		@details DC/CSは、PIOに渡す前にdigitalWriteで設定されていた状態に戻る。
+	*/
+	void TftPioStream::releasePins(void)
+	{
+		gpio_set_function(sckPin, GPIO_FUNC_SPI);
+		gpio_set_function(mosiPin, GPIO_FUNC_SPI);
+		gpio_set_function(dcPin, GPIO_FUNC_SIO);
+		gpio_set_function(csPin, GPIO_FUNC_SIO);
+	}
+
+	/*!
+		@brief  prefix → payload → tail をDMAチェーンで送り、ステートマシンが終了区間を処理するまで待つ
+		@param  prefixLen   prefixの語数
+		@param  payload     ピクセルデータ
+		@param  payloadLen  ピクセル数（TFT_PIO_MAX_WORDS以下）
+		@param  increment   payloadを進めるか（falseなら同じ色で塗りつぶす）
+	*/
+	void TftPioStream::sendChain(uint32_t prefixLen, const uint16_t* payload, uint32_t payloadLen, bool increment)
+	{
+		uint dreq = pio_get_dreq(pio, sm, true);
+		volatile void* txf = &pio->txf[sm];
+
+		dma_channel_config c = dma_channel_get_default_config(chTail);
+		channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+		channel_config_set_dreq(&c, dreq);
+		channel_config_set_read_increment(&c, false);
+		channel_config_set_write_increment(&c, false);
+		dma_channel_configure(chTail, &c, txf, &tail, 1, false);
+
+		c = dma_channel_get_default_config(chPayload);
+		channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+		channel_config_set_dreq(&c, dreq);
+		channel_config_set_read_increment(&c, increment);
+		channel_config_set_write_increment(&c, false);
+		channel_config_set_chain_to(&c, chTail);
+		dma_channel_configure(chPayload, &c, txf, payload, payloadLen, false);
+
+		c = dma_channel_get_default_config(chPrefix);
+		channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+		channel_config_set_dreq(&c, dreq);
+		channel_config_set_read_increment(&c, true);
+		channel_config_set_write_increment(&c, false);
+		channel_config_set_chain_to(&c, chPayload);
+		dma_channel_configure(chPrefix, &c, txf, prefix, prefixLen, true);
+
+		// FIFOが空なら終了区間は取り出されている。最後のデータを送り終えて終了区間を処理するとCSがHに戻るので、それを待つ
+		dma_channel_wait_for_finish_blocking(chTail);
+		while (!pio_sm_is_tx_fifo_empty(pio, sm))
+			tight_loop_contents();
+		while (!gpio_get(csPin))
+			tight_loop_contents();
+	}
+
+	/*!
+		@brief  ウインドウを指定してピクセルデータを送る
+		@param  x       ウインドウの左上（液晶のメモリ座標）
+		@param  y       ウインドウの左上（液晶のメモリ座標）
+		@param  w       幅
+		@param  h       高さ
+		@param  pixels  w×hのRGB565ピクセル。isFillなら１ピクセル分の色
+		@param  isFill  trueならpixels[0]の色で塗りつぶす
+		@details
+			CASET/PASET/RAMWRとピクセルデータを１回のDMAチェーンで送る。TFT_PIO_MAX_WORDSを超える分は、
+			RAMWRC（Memory Write Continue）で続ける。呼び出し側は、SPIの送信が終わっていることを保証すること。
+	*/
+	void TftPioStream::writeWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, bool isFill)
+	{
+		uint32_t len = (uint32_t)w * h;
+		if (sm < 0 || len == 0) return;
+
+		waitList();
+		acquirePins();
+		uint32_t n = (len > TFT_PIO_MAX_WORDS) ? TFT_PIO_MAX_WORDS : len;
+		int i = 0;
+		prefix[i++] = TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1);
+		prefix[i++] = TFT_DCS_CASET << 8;
+		prefix[i++] = TFT_PIO_HEADER(TFT_PIO_MODE_DATA, 2);
+		prefix[i++] = x;
+		prefix[i++] = x + w - 1;
+		prefix[i++] = TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1);
+		prefix[i++] = TFT_DCS_PASET << 8;
+		prefix[i++] = TFT_PIO_HEADER(TFT_PIO_MODE_DATA, 2);
+		prefix[i++] = y;
+		prefix[i++] = y + h - 1;
+		prefix[i++] = TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1);
+		prefix[i++] = TFT_DCS_RAMWR << 8;
+		prefix[i++] = TFT_PIO_HEADER(TFT_PIO_MODE_DATA, n);
+		sendChain(i, pixels, n, !isFill);
+		len -= n;
+		if (!isFill) pixels += n;
+
+		while (len > 0) {
+			n = (len > TFT_PIO_MAX_WORDS) ? TFT_PIO_MAX_WORDS : len;
+			prefix[0] = TFT_PIO_HEADER(TFT_PIO_MODE_CMD, 1);
+			prefix[1] = TFT_DCS_RAMWRC << 8;
+			prefix[2] = TFT_PIO_HEADER(TFT_PIO_MODE_DATA, n);
+			sendChain(3, pixels, n, !isFill);
+			len -= n;
+			if (!isFill) pixels += n;
+		}
+		releasePins();
+
+		windowCount++;
+		pixelCount += (uint32_t)w * h;
+	}
+
+	/*!
+		@brief  描画命令リストの送信を始める
+		@param  list  送るリスト（送り終わるまで変えないこと。clear()は完了を待つ）
+		@return 始めたらtrue。初期化されていなければfalse
+		@details
+			リストに終了区間と終端ブロックを付け、各ブロックのCTRLと書き込みアドレス（TX FIFO）を埋めてから、
+			制御用チャネル（chCtrl）を起動する。chCtrlはブロックを１つずつデータ用チャネル（chPayload）の
+			AL1レジスタ（CTRL, READ_ADDR, WRITE_ADDR, TRANS_COUNT_TRIG）に書き込み、chPayloadは転送を終えるとchCtrlにチェーンして次のブロックを読ませる。
+			終端ブロックで転送数0を書き込むとチェーンが止まる。呼び出し側は、SPIの送信が終わっていることを保証すること。
+	*/
+	bool TftPioStream::startList(TftDisplayList& list)
+	{
+		if (sm < 0) return false;
+		waitList();
+		list.close();
+
+		dma_channel_config c = dma_channel_get_default_config(chPayload);
+		channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+		channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+		channel_config_set_read_increment(&c, false);
+		channel_config_set_write_increment(&c, false);
+		channel_config_set_chain_to(&c, chCtrl);
+		channel_config_set_irq_quiet(&c, true);
+		uint32_t ctrl = channel_config_get_ctrl_value(&c);
+		volatile void* txf = &pio->txf[sm];
+		for (uint16_t i = 0; i < list.blockCount; i++) {
+			TftListBlock& b = list.blocks[i];
+			b.ctrl = ctrl | (b.ctrl & DMA_CH0_CTRL_TRIG_INCR_READ_BITS);
+			b.writeAddr = txf;
+		}
+
+		acquirePins();
+		c = dma_channel_get_default_config(chCtrl);
+		channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+		channel_config_set_read_increment(&c, true);
+		channel_config_set_write_increment(&c, true);
+		channel_config_set_ring(&c, true, 4); // 書き込み先はAL1の４レジスタ（16バイト）で折り返す
+		dma_channel_configure(chCtrl, &c, &dma_hw->ch[chPayload].al1_ctrl, list.blocks, 4, true);
+
+		list.pRunner = this;
+		pRunning = &list;
+		listCount++;
+		return true;
+	}
+
+	/*!
+		@brief  送信中の描画命令リストが終わるのを待ち、ピンをSPIに返す
+		@details 送信中でなければ何もしない。
+	*/
+	void TftPioStream::waitList(void)
+	{
+		if (pRunning == nullptr) return;
+		while (dma_channel_is_busy(chCtrl) || dma_channel_is_busy(chPayload))
+			tight_loop_contents();
+		while (!pio_sm_is_tx_fifo_empty(pio, sm))
+			tight_loop_contents();
+		while (!gpio_get(csPin))
+			tight_loop_contents();
+		releasePins();
+		pRunning->pRunner = nullptr;
+		pRunning = nullptr;
+	}
+} // namespace ardPort
+#endif
@@ -0,0 +1,79 @@
+/*!
+ * @file TftPioStream.h
+ *
+ * PIOを使った液晶の送信経路。SCK/MOSI/DC/CSをすべてPIOのステートマシンが駆動し、
+ * コマンドとデータの区切りを含んだストリーム（TftPioStream.pioを参照）をDMAでFIFOに流し込む。
+ * CASET/PASET/RAMWRとピクセルデータを、CPUがDCを切り替えることなく１回のDMAチェーンで送れる。
+ */
+#pragma once
+#include "misc/defines.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+	#include "hardware/pio.h"
+	#include "hardware/dma.h"
+
+	#define TFT_PIO_MODE_END 0  ///< 区間の種類：終了（CS=H）
+	#define TFT_PIO_MODE_CMD 1  ///< 区間の種類：コマンド（１バイト）
+	#define TFT_PIO_MODE_DATA 2 ///< 区間の種類：データ
+	#define TFT_PIO_MAX_WORDS 16384 ///< １つのデータ区間で送れる16ビット語数（ヘッダの語数が14ビットのため）
+	/// ストリームの区間ヘッダ
+	#define TFT_PIO_HEADER(mode, words) ((uint16_t)(((mode) << 14) | (((words) - 1) & 0x3FFF)))
+
+	#define TFT_DCS_CASET 0x2A  ///< Column Address Set（MIPI DCS）
+	#define TFT_DCS_PASET 0x2B  ///< Page Address Set（MIPI DCS）
+	#define TFT_DCS_RAMWR 0x2C  ///< Memory Write（MIPI DCS）
+	#define TFT_DCS_RAMWRC 0x3C ///< Memory Write Continue（MIPI DCS）
+	#define TFT_DCS_VSCRSADD 0x37 ///< Vertical Scrolling Start Address（MIPI DCS）
+
+namespace ardPort {
+	class TftDisplayList;
+
+	/*!
+	  @brief  PIOとDMAで、ウインドウ指定とピクセルデータを１続きで液晶に送るクラス
+	  @details
+		タッチパネルとSPIを共有しているので、PIOがピンを使うのはwriteWindow()の間だけで、
+		戻る前にSCK/MOSIはSPIに、DC/CSはSIO（digitalWrite）に返す。このためwriteWindow()は転送の完了を待って戻る。
+		CSはDCの２つ上のピン（間の１本は液晶のRSTで、PIOには渡さない）でなければならない。
+		描画命令リスト（TftDisplayList）は例外で、startList()は送信を始めてすぐに戻る。ピンはwaitList()でSPIに返す。
+	*/
+	class TftPioStream {
+	  public:
+		TftPioStream();
+		bool init(PIO pio, uint8_t sckPin, uint8_t mosiPin, uint8_t dcPin, uint8_t csPin, uint32_t freq);
+		/// @brief 初期化済みか
+		bool isReady() const { return sm >= 0; }
+		void writeWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, bool isFill);
+		bool startList(TftDisplayList& list);
+		void waitList(void);
+		/// @brief 描画命令リストを送信中か（waitList()がまだ）
+		bool isListRunning() const { return pRunning != nullptr; }
+
+		uint32_t getWindowCount() const { return windowCount; } ///< writeWindow()の呼び出し回数
+		uint32_t getPixelCount() const { return pixelCount; }   ///< 送ったピクセル数
+		uint32_t getListCount() const { return listCount; }     ///< startList()の呼び出し回数
+		void clearStats() { windowCount = pixelCount = listCount = 0; }
+
+	  private:
+		void acquirePins(void);
+		void releasePins(void);
+		void sendChain(uint32_t prefixLen, const uint16_t* payload, uint32_t payloadLen, bool increment);
+
+		PIO pio = nullptr;   ///< 使用するPIO
+		int sm = -1;         ///< ステートマシン（未初期化なら-1）
+		int chPrefix = -1;   ///< ヘッダ・コマンド部分を送るDMAチャネル
+		int chPayload = -1;  ///< ピクセルデータを送るDMAチャネル
+		int chTail = -1;     ///< 終了区間を送るDMAチャネル
+		int chCtrl = -1;     ///< 描画命令リストの制御ブロックをchPayloadに書き込むDMAチャネル
+		uint8_t sckPin = 0;  ///< SCKのピン
+		uint8_t mosiPin = 0; ///< MOSIのピン
+		uint8_t dcPin = 0;   ///< DCのピン
+		uint8_t csPin = 0;   ///< CSのピン
+		uint16_t prefix[16]; ///< ウインドウ指定とデータ区間のヘッダ
+		uint16_t tail = TFT_PIO_HEADER(TFT_PIO_MODE_END, 1); ///< 終了区間
+		uint32_t windowCount = 0; ///< writeWindow()の呼び出し回数
+		uint32_t pixelCount = 0;  ///< 送ったピクセル数
+		uint32_t listCount = 0;   ///< startList()の呼び出し回数
+		TftDisplayList* pRunning = nullptr; ///< 送信中の描画命令リスト
+	};
+} // namespace ardPort
+#endif
@@ -0,0 +1,48 @@
+/*!
+ * @file TftProfile.h
+ *
+ * 液晶への送信量と時間の計数（プロファイル）に使う型。
+ * Adafruit_SPITFTがトランザクション・ウインドウ指定・コマンドとピクセルのバイト数・送信中の時間を数え、
+ * 呼び出し側はTftProfileScopeで区間に名前をつけて、区間ごとの量を集計できる。
+ * TFT_PROFILEを1にしてビルドしたときだけ数える。0（既定）では計数のコードは無くなる。
+ */
+#pragma once
+#include <stdint.h>
+
+#ifndef TFT_PROFILE
+	#define TFT_PROFILE 0 ///< 1で液晶への送信量と時間を数える
+#endif
+#define TFT_PROFILE_MAX_REGIONS 8 ///< 名前をつけて集計できる区間の数
+
+namespace ardPort {
+
+	/*!
+	  @brief  送信量と時間の累計
+	*/
+	struct TftProfileCounters {
+		uint32_t transactions = 0; ///< トランザクション（startWrite()とendWrite()の組）の数
+		uint32_t windows = 0;      ///< ウインドウ指定の数
+		uint32_t commandBytes = 0; ///< コマンドとその引数のバイト数
+		uint32_t pixelBytes = 0;   ///< ピクセルデータのバイト数
+		uint32_t busyUs = 0;       ///< トランザクションを開いていた時間（μ秒）
+	};
+
+	/*!
+	  @brief  名前をつけた区間の集計
+	*/
+	struct TftProfileRegion {
+		const char* label = nullptr; ///< 区間の名前
+		uint32_t calls = 0;          ///< 区間を通った回数
+		uint32_t elapsedUs = 0;      ///< 区間の経過時間の累計（μ秒。送信していない時間も含む）
+		TftProfileCounters counters; ///< 区間の中の送信量と時間
+	};
+
+	/*!
+	  @brief  区間の始まりで控えておく値
+	*/
+	struct TftProfileMark {
+		const char* label;           ///< 区間の名前
+		uint32_t startUs;            ///< 区間に入った時刻
+		TftProfileCounters counters; ///< 区間に入ったときの累計
+	};
+} // namespace ardPort
@@ -72,6 +72,8 @@ using namespace ardPort;
 #endif
 
 #include <limits.h>
+#include <string.h>
+#include "Kanji/KanjiHelper.h"
 
 #if defined(ARDUINO_ARCH_ARC32) || defined(ARDUINO_MAXIM)
 	#define SPI_DEFAULT_FREQ 16000000
@@ -252,6 +254,8 @@ void Adafruit_ILI9341::setRotation(uint8_t m) {
 			_height = ILI9341_TFTWIDTH;
 			break;
 	}
+	clipDepth = 0; // クリップ矩形は回転後の座標なので外す
+	madctl = m;
 
 	sendCommand(ILI9341_MADCTL, &m, 1);
 }
@@ -313,23 +317,23 @@ void Adafruit_ILI9341::setScrollMargins(uint16_t top, uint16_t bottom) {
 /**************************************************************************/
 void Adafruit_ILI9341::setAddrWindow(uint16_t x1, uint16_t y1, uint16_t w,
 									 uint16_t h) {
-	static uint16_t old_x1 = 0xffff, old_x2 = 0xffff;
-	static uint16_t old_y1 = 0xffff, old_y2 = 0xffff;
-
 	uint16_t x2 = (x1 + w - 1), y2 = (y1 + h - 1);
-	if (x1 != old_x1 || x2 != old_x2) {
+	TFT_PROFILE_ADD(windows, 1);
+	if (x1 != oldX1 || x2 != oldX2) {
 		writeCommand(ILI9341_CASET);  // Column address set
 		SPI_WRITE16(x1);
 		SPI_WRITE16(x2);
-		old_x1 = x1;
-		old_x2 = x2;
+		TFT_PROFILE_ADD(commandBytes, 4);
+		oldX1 = x1;
+		oldX2 = x2;
 	}
-	if (y1 != old_y1 || y2 != old_y2) {
+	if (y1 != oldY1 || y2 != oldY2) {
 		writeCommand(ILI9341_PASET);  // Row address set
 		SPI_WRITE16(y1);
 		SPI_WRITE16(y2);
-		old_y1 = y1;
-		old_y2 = y2;
+		TFT_PROFILE_ADD(commandBytes, 4);
+		oldY1 = y1;
+		oldY2 = y2;
 	}
 	writeCommand(ILI9341_RAMWR);  // Write to RAM
 }
@@ -351,6 +355,72 @@ uint8_t Adafruit_ILI9341::readcommand8(uint8_t commandByte, uint8_t index) {
 	return Adafruit_SPITFT::readcommand8(commandByte);
 }
 
+/**
+ * @brief   GRAMの矩形を読み出す（RAMRD）
+ * @param   x     左上のX座標
+ * @param   y     左上のY座標
+ * @param   w     幅
+ * @param   h     高さ
+ * @param   pDst  w×hピクセルの出力先（左上から行の順、565カラー）
+ * @return  読み出せたらtrue。液晶のSDOがつながっていない・矩形が画面からはみ出す場合はfalse
+ * @details
+ *   読み出しはSCKを遅くしないと化けるので、ILI9341_GRAM_READ_FREQに落として読む。
+ *   SPIではピクセルは書き込みの形式に関係なく３バイト（R,G,Bの上位6ビット）で返るので、565に詰め直す。
+ *   SDOをMISOにつないでいない基板もあるため、最初の１回だけMADCTLを読み、送った値が返るかで読み出せるかを決める。
+ */
+bool Adafruit_ILI9341::readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pDst) {
+	if (connection != TFT_HARD_SPI || w <= 0 || h <= 0 || x < 0 || y < 0 || (x + w) > _width || (y + h) > _height)
+		return false;
+#if defined(SPI_HAS_TRANSACTION)
+	SPISettings fastSettings = hwspi.settings;
+	hwspi.settings = SPISettings(ILI9341_GRAM_READ_FREQ, MSBFIRST, hwspi._mode);
+	if (gramReadable < 0) {
+		gramReadable = (readcommand8(ILI9341_RDMADCTL) == madctl) ? 1 : 0;
+	}
+	if (gramReadable == 0) {
+		hwspi.settings = fastSettings;
+		return false;
+	}
+	uint8_t line[ILI9341_TFTHEIGHT * 3]; ///< １行分の読み出し（R,G,B）
+	dmaWait(); // 送信中の描画が終わってから読む
+	startWrite();
+	setAddrWindow(x, y, w, h);
+	writeCommand(ILI9341_RAMRD);
+	spiRead(); // 最初の１バイトはダミー
+	for (int16_t j = 0; j < h; j++) {
+		memset(line, 0, w * 3);
+		hwspi._spi->transfer(line, w * 3);
+		const uint8_t *pRgb = line;
+		for (int16_t i = 0; i < w; i++, pRgb += 3) {
+			*pDst++ = ((pRgb[0] & 0xF8) << 8) | ((pRgb[1] & 0xFC) << 3) | (pRgb[2] >> 3);
+		}
+	}
+	endWrite();
+	hwspi.settings = fastSettings;
+	return true;
+#else
+	return false; // SCKを落とせないので読まない
+#endif
+}
+
+/**
+ * @brief   文字の前景色・背景色から、ビットマップの4ビット（ニブル）を4ピクセルに展開する表を作る
+ * @param   color 文字の前景色（565カラー）
+ * @param   bg 文字の背景色（565カラー）
+ * @details 前回と同じ色の組み合わせなら作り直さない。表の各要素は、ニブルの上位ビットから順に並んだ4ピクセル。
+ */
+void Adafruit_ILI9341::buildNibbleLut(uint16_t color, uint16_t bg) {
+	if (isLutValid && lutFg == color && lutBg == bg) return;
+	for (int n = 0; n < 16; n++) {
+		for (int b = 0; b < 4; b++) {
+			nibbleLut[n][b] = (n & (0x08 >> b)) ? color : bg;
+		}
+	}
+	lutFg = color;
+	lutBg = bg;
+	isLutValid = true;
+}
+
 /**
  * @brief   サイズが１倍で、背景色が無く、ILI9341を使っているときは、文字の描画にウインドウを使用して高速に処理する
  * @param   x   描画開始位置の左上座標
@@ -364,43 +434,58 @@ uint8_t Adafruit_ILI9341::readcommand8(uint8_t commandByte, uint8_t index) {
  * @param   size_y 文字の縦方向の拡大率
  * @return  None
  * @details このメソッドは、Adafruit_GFXの仮想関数をオーバーロードする。ILI9341の場合、ウインドウを指定してそこに画像の色を連続的に
- * 送ることで、毎回の座標指定をせずに描画できる。Adafruit_GFXの文字表示では、XY座標を指定し、毎回点を打っているのでそれを避けるために
- * ここでオーバーライドしている。
- * 実測で PICO_Wを使って１万文字表示で、Adafruitオリジナルで32秒、このルーチンで15秒と改善していると思われる。
+ * 送ることで、毎回の座標指定をせずに描画できる。
+ * 以前は１ドットごとにpushColor()（＝１ドットごとにトランザクションとCSの上げ下げ）で送っていたが、
+ * 現在はビットマップをニブル単位の表引きで行バッファに展開し、バッファが一杯になるか文字の最後でまとめてwritePixels()で送る。
+ * クリップ矩形（無ければ画面）からはみ出す文字は、ウインドウが外を指してしまうので基底クラスの描画（行単位で切り詰められる）に任せる。
+ * 階調つき（2/4bpp）のフォントも、背景色と混ぜる表で展開する基底クラスの描画に任せる。
  */
 void Adafruit_ILI9341::drawChar(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t *bmpData, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
-	if (bUseWindow == true &&  size_x == 1 && size_y == 1 && color != bg) {
-		if ((x >= _width) || (y >= _height) || ((x + w * size_x - 1) < 0) || ((y + h * size_y - 1) < 0)) return;
-
-		uint8_t w_bytes = (w + 8 - 1) / 8;   // 横方向のバイト数
-		uint8_t h_bytes = h;                 // 縦方向のバイト数
-		uint16_t bmpIdx = 0;                 // ビットマップ情報には、bmp + yy*w_bytes + xx でアクセスできるが、順番に並んでいるので最初から順に読むほうが速いのでは？
-		bool isByteMultiple = (w % 8 == 0);  // 横幅が8の倍数かのフラグ。横１２ドットなどの場合は、８の倍数にならないので調整が必要になる
+	if (bUseWindow == true && size_x == 1 && size_y == 1 && color != bg && KanjiHelper::getBitsPerPixel() == 1 &&
+		isRectInClip(x, y, w, h) && w > 0) {
+		uint16_t lineBuf[ILI9341_GLYPH_BUF_PIXELS]; // 展開した文字のピクセル（数行分）
+		uint8_t w_bytes = (w + 8 - 1) / 8;          // 横方向のバイト数
+		int rowsPerBurst = ILI9341_GLYPH_BUF_PIXELS / w; // 一度に送る行数
+		if (rowsPerBurst == 0) {
+			Adafruit_GFX::drawChar(x, y, w, h, bmpData, color, bg, size_x, size_y);
+			return;
+		}
+		buildNibbleLut(color, bg);
 
 		startWrite();
 		setAddrWindow(x, y, w, h);
-		for (int8_t yy = 0; yy < h_bytes; yy++) {
-			for (int8_t xx = 0; xx < w_bytes; xx++) {
-				uint8_t bitCnt;
-				if (isByteMultiple) {
-					bitCnt = 8;
+		uint16_t *pDst = lineBuf;
+		int rows = 0;
+		for (uint8_t yy = 0; yy < h; yy++) {
+			int16_t remain = w; // この行の残りドット数
+			for (uint8_t xx = 0; xx < w_bytes; xx++) {
+				uint8_t bits = *bmpData++;
+				if (remain >= 8) {
+					memcpy(pDst, nibbleLut[bits >> 4], sizeof(nibbleLut[0]));
+					memcpy(pDst + 4, nibbleLut[bits & 0x0F], sizeof(nibbleLut[0]));
+					pDst += 8;
+					remain -= 8;
 				} else {
-					bitCnt = (xx != (w_bytes - 1)) ? 8 : (w % 8);
-				}
-				uint8_t bits = bmpData[bmpIdx];
-				for (int8_t bb = 0; bb < bitCnt; bb++) {
-					if (bits & 0x80) {
-						pushColor(color);
-					} else {
-						pushColor(bg);
+					// 横幅が8の倍数でない文字の最後のバイト
+					for (int16_t bb = 0; bb < remain; bb++) {
+						*pDst++ = (bits & 0x80) ? color : bg;
+						bits <<= 1;
 					}
-					bits <<= 1;
+					remain = 0;
 				}
-				bmpIdx++;
 			}
+			if (++rows == rowsPerBurst) {
+				writePixels(lineBuf, rows * w);
+				pDst = lineBuf;
+				rows = 0;
+			}
+		}
+		if (rows) {
+			writePixels(lineBuf, rows * w);
 		}
+		endWrite();
 	} else {
-		/// 拡大フォントや背景色が透過の場合にはウインドウでの描画は使用できないので基底クラスのdrawCharを呼び出す
+		/// 拡大フォントや背景色が透過の場合、画面からはみ出す場合にはウインドウでの描画は使用できないので基底クラスのdrawCharを呼び出す
 		Adafruit_GFX::drawChar(x, y, w, h, bmpData, color, bg, size_x, size_y);
 	}
 }
\ No newline at end of file
@@ -59,6 +59,9 @@ namespace ardPort
 #define ILI9341_TFTWIDTH 240  ///< ILI9341 max TFT width
 #define ILI9341_TFTHEIGHT 320 ///< ILI9341 max TFT height
 
+#define ILI9341_GLYPH_BUF_PIXELS 576 ///< drawCharで一度に送るピクセル数（24×24ドットの文字が１回で送れる）
+#define ILI9341_GRAM_READ_FREQ 6000000 ///< GRAMを読み出すときのSCK周波数（読み出しのSCKの周期は150ns以上）
+
 #define ILI9341_NOP 0x00	 ///< No-op register
 #define ILI9341_SWRESET 0x01 ///< Software reset register
 #define ILI9341_RDDID 0x04	 ///< Read display identification information
@@ -200,6 +203,17 @@ namespace ardPort
 	{
 	private:
 		bool bUseWindow;
+		uint16_t nibbleLut[16][4]; ///< ビットマップの4ビットを4ピクセルに展開する表
+		uint16_t lutFg = 0;        ///< nibbleLutを作ったときの前景色
+		uint16_t lutBg = 0;        ///< nibbleLutを作ったときの背景色
+		bool isLutValid = false;   ///< nibbleLutが作られているか
+		uint16_t oldX1 = 0xffff;   ///< 最後に送ったCASETの開始列
+		uint16_t oldX2 = 0xffff;   ///< 最後に送ったCASETの終了列
+		uint16_t oldY1 = 0xffff;   ///< 最後に送ったPASETの開始行
+		uint16_t oldY2 = 0xffff;   ///< 最後に送ったPASETの終了行
+		uint8_t madctl = 0x48;     ///< 最後に送ったMADCTL（初期化のコマンド列の値から始まる）
+		int8_t gramReadable = -1;  ///< GRAMが読み出せるか（-1:まだ確かめていない 0:読めない 1:読める）
+		void buildNibbleLut(uint16_t color, uint16_t bg);
 
 	public:
 		Adafruit_ILI9341(); // デフォルトコンストラクタ
@@ -233,6 +247,8 @@ namespace ardPort
 
 		// Transaction API not used by GFX
 		void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+		/// @brief 最後に送ったウインドウを忘れ、次のsetAddrWindow()でCASET/PASETを必ず送るようにする
+		void invalidateAddrWindow(void) { oldX1 = oldX2 = oldY1 = oldY2 = 0xffff; }
 
 		void displaySleep(bool enterSleep);
 		void setGamma(ILI9341_GAMMA gamma);
@@ -243,6 +259,7 @@ namespace ardPort
 		void setIFControl(ILI9341_IFCTRL_WEMODE weMode, uint8_t EPF, uint8_t MDT, ILI9341_IFCTRL_ENDIAN endian, ILI9341_IFCTRL_DM dmMode, ILI9341_IFCTRL_RM rmMode, ILI9341_IFCTRL_RIM rimMode);
 
 		uint8_t readcommand8(uint8_t reg, uint8_t index = 0);
+		bool readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pDst);
 	};
 #ifdef STD_SDK
 }
@@ -0,0 +1,336 @@
+/*!
+ * @file Ili9341Emulator.cpp
+ *
+ * ILI9341のコマンド列のエミュレータの実装。
+ */
+#include "Ili9341Emulator.h"
+#include <string.h>
+
+namespace ardPort {
+
+	/*!
+		@brief  リセット直後の状態で作る
+	*/
+	Ili9341Emulator::Ili9341Emulator()
+	{
+		reset();
+	}
+
+	/*!
+		@brief  リセット直後の状態に戻す（GRAMは0、ウインドウは全体、MADCTLは0、スクロールなし）
+	*/
+	void Ili9341Emulator::reset(void)
+	{
+		memset(gram, 0, sizeof(gram));
+		clearStats();
+		hasCmd = false;
+		paramLen = 0;
+		ramBytes = 0;
+		readBytes = 0;
+		wrapped = false;
+		sc = 0;
+		ec = ILI9341_EMU_WIDTH - 1;
+		sp = 0;
+		ep = ILI9341_EMU_HEIGHT - 1;
+		col = page = 0;
+		madctl = 0;
+		tfa = 0;
+		vsa = ILI9341_EMU_HEIGHT;
+		vsp = 0;
+		streamState = 0;
+		streamRemain = 0;
+	}
+
+	/*!
+		@brief  数えた値を消す
+	*/
+	void Ili9341Emulator::clearStats(void)
+	{
+		memset(&stats, 0, sizeof(stats));
+	}
+
+	/*!
+		@brief  前のコマンドを締めくくる（RAMWRでピクセルが無い・半端なバイトで終わったものを数える）
+	*/
+	void Ili9341Emulator::finishCommand(void)
+	{
+		if (!hasCmd)
+			return;
+		if (cmd == CMD_RAMWR || cmd == CMD_RAMWRC) {
+			if (ramBytes == 0) {
+				stats.emptyRamwr++;
+				stats.wastedBytes += 1;
+			} else if (ramBytes & 1) {
+				stats.oddBytes++;
+				stats.wastedBytes += 1;
+			}
+		}
+		hasCmd = false;
+	}
+
+	/*!
+		@brief  コマンドを受け取る（DC=L）
+		@param  a_cmd  コマンド
+	*/
+	void Ili9341Emulator::command(uint8_t a_cmd)
+	{
+		finishCommand();
+		cmd = a_cmd;
+		hasCmd = true;
+		paramLen = 0;
+		ramBytes = 0;
+		readBytes = 0;
+		stats.commandCount[cmd]++;
+		stats.commandBytes++;
+		if (cmd == CMD_RAMWR || cmd == CMD_RAMRD) {
+			col = sc;
+			page = sp;
+			wrapped = false;
+		}
+	}
+
+	/*!
+		@brief  データを１バイト受け取る（DC=H）
+		@details RAMWR/RAMWRCのあとは上位バイトから２バイトで１ピクセル。それ以外はコマンドの引数で、揃った時点で実行する。
+	*/
+	void Ili9341Emulator::data(uint8_t b)
+	{
+		if (!hasCmd)
+			return; // コマンドの前のデータは液晶が捨てる
+		if (cmd == CMD_RAMRD || cmd == CMD_RDMADCTL)
+			return; // 読み出し中のMOSIは液晶が見ない
+		if (cmd == CMD_RAMWR || cmd == CMD_RAMWRC) {
+			stats.pixelBytes++;
+			if ((ramBytes++ & 1) == 0) {
+				pixelHi = b;
+			} else {
+				writePixel((uint16_t)(pixelHi << 8) | b);
+			}
+			return;
+		}
+		stats.paramBytes++;
+		if (paramLen < sizeof(param))
+			param[paramLen] = b;
+		paramLen++;
+		switch (cmd) {
+		case CMD_CASET:
+		case CMD_PASET:
+			if (paramLen == 4) {
+				uint16_t s = (param[0] << 8) | param[1];
+				uint16_t e = (param[2] << 8) | param[3];
+				if (cmd == CMD_CASET) {
+					if (s == sc && e == ec) {
+						stats.redundantCaset++;
+						stats.wastedBytes += 5;
+					}
+					sc = s;
+					ec = e;
+				} else {
+					if (s == sp && e == ep) {
+						stats.redundantPaset++;
+						stats.wastedBytes += 5;
+					}
+					sp = s;
+					ep = e;
+				}
+			}
+			break;
+		case CMD_MADCTL:
+			if (paramLen == 1)
+				madctl = param[0];
+			break;
+		case CMD_VSCRDEF:
+			if (paramLen == 6) {
+				tfa = (param[0] << 8) | param[1];
+				vsa = (param[2] << 8) | param[3];
+			}
+			break;
+		case CMD_VSCRSADD:
+			if (paramLen == 2)
+				vsp = (param[0] << 8) | param[1];
+			break;
+		default:
+			break;
+		}
+	}
+
+	/*!
+		@brief  データを続けて受け取る
+	*/
+	void Ili9341Emulator::data(const uint8_t* p, uint32_t len)
+	{
+		while (len--)
+			data(*p++);
+	}
+
+	/*!
+		@brief  液晶が返す１バイトを読む
+		@details
+			RDMADCTLはMADCTLの値を返す。RAMRDは最初の１バイトがダミーで、そのあとはウインドウの中を
+			書き込みと同じ順に、１ピクセルを３バイト（R,G,Bを上位に詰めた6ビット）で返す。それ以外は0。
+	*/
+	uint8_t Ili9341Emulator::read(void)
+	{
+		if (!hasCmd)
+			return 0;
+		if (cmd == CMD_RDMADCTL)
+			return madctl;
+		if (cmd != CMD_RAMRD)
+			return 0;
+		uint32_t n = readBytes++;
+		if (n == 0)
+			return 0; // ダミー
+		switch ((n - 1) % 3) {
+		case 0:
+			{
+				int32_t i = gramIndex();
+				readPixel = (i >= 0) ? gram[i] : 0;
+				advance();
+				return (readPixel >> 8) & 0xF8;
+			}
+		case 1:
+			return (readPixel >> 3) & 0xFC;
+		default:
+			return (readPixel << 3) & 0xF8;
+		}
+	}
+
+	/*!
+		@brief  CSがHになった（コマンドの状態は液晶と同じく残す）
+	*/
+	void Ili9341Emulator::endTransaction(void)
+	{
+		stats.transactions++;
+	}
+
+	/*!
+		@brief  TftPioStream.pioのストリームを受け取る
+		@param  p          16ビットの語の並び
+		@param  words      語数
+		@param  increment  falseなら p[0] を words 回受け取る（TftDisplayListの塗りつぶしのブロック）
+		@details 区間の途中で切れていてもよい（続きは次の呼び出しで受け取る）。DMAの制御ブロックごとに、
+				TftDisplayList::isIncrement()をそのまま渡せる。
+	*/
+	void Ili9341Emulator::stream(const uint16_t* p, uint32_t words, bool increment)
+	{
+		while (words--) {
+			uint16_t w = *p;
+			if (increment)
+				p++;
+			switch (streamState) {
+			case 0: // ヘッダ
+				switch (w >> 14) {
+				case 0:
+					endTransaction();
+					break;
+				case 1:
+					streamState = 1;
+					break;
+				case 2:
+					streamRemain = (w & 0x3FFF) + 1;
+					streamState = 2;
+					break;
+				default:
+					break;
+				}
+				break;
+			case 1: // コマンド（上位8ビット）
+				command(w >> 8);
+				streamState = 0;
+				break;
+			default: // データ
+				data(w >> 8);
+				data(w & 0xFF);
+				if (--streamRemain == 0)
+					streamState = 0;
+				break;
+			}
+		}
+	}
+
+	/*!
+		@brief  書き込み位置のGRAMの添字を求める
+		@return 添字（液晶の外なら-1）
+		@details MADCTLのMVで列とページが入れ替わり、MX/MYで向きが変わる。回転0（MX）の列とページがそのままGRAMの(x, y)になるように並べている。
+	*/
+	int32_t Ili9341Emulator::gramIndex(void) const
+	{
+		bool mv = (madctl & 0x20) != 0;
+		bool mx = (madctl & 0x40) != 0;
+		bool my = (madctl & 0x80) != 0;
+		int32_t a = mv ? page : col; // 液晶の横方向
+		int32_t b = mv ? col : page; // 液晶の縦方向
+		if (a >= ILI9341_EMU_WIDTH || b >= ILI9341_EMU_HEIGHT)
+			return -1;
+		int32_t x = mx ? a : (ILI9341_EMU_WIDTH - 1 - a);
+		int32_t y = my ? (ILI9341_EMU_HEIGHT - 1 - b) : b;
+		return y * ILI9341_EMU_WIDTH + x;
+	}
+
+	/*!
+		@brief  書き込み位置にピクセルを書き、位置を進める
+	*/
+	void Ili9341Emulator::writePixel(uint16_t color)
+	{
+		int32_t i = gramIndex();
+		if (i >= 0)
+			gram[i] = color;
+		stats.pixels++;
+		if (wrapped)
+			stats.wrappedPixels++; // 前に書いたところを上書きしている
+		advance();
+	}
+
+	/*!
+		@brief  書き込み（読み出し）位置を進める
+		@details ウインドウの終わりを越えると先頭に戻る（液晶と同じ）。
+	*/
+	void Ili9341Emulator::advance(void)
+	{
+		if (col == ec) {
+			col = sc;
+			if (page == ep) {
+				page = sp;
+				wrapped = true;
+			} else {
+				page++;
+			}
+		} else {
+			col++;
+		}
+	}
+
+	/*!
+		@brief  液晶に見えている画面を取得する
+		@param  pDst  240×320ピクセルの出力先（縦置きの並び）
+		@details 縦スクロールの領域（TFA～TFA+VSA）は、VSPの行から始まるように巡回して並べる。
+	*/
+	void Ili9341Emulator::getPanel(uint16_t* pDst) const
+	{
+		for (int32_t y = 0; y < ILI9341_EMU_HEIGHT; y++) {
+			int32_t src = y;
+			if (vsa > 0 && y >= tfa && y < tfa + vsa) {
+				src = tfa + ((y - tfa) + (vsp - tfa) + vsa) % vsa;
+			}
+			memcpy(pDst + y * ILI9341_EMU_WIDTH, gram + src * ILI9341_EMU_WIDTH, ILI9341_EMU_WIDTH * sizeof(uint16_t));
+		}
+	}
+
+	/*!
+		@brief  数えた値を出力する
+		@param  pfnPrintf  出力に使うprintf形式の関数
+	*/
+	void Ili9341Emulator::dumpStats(void (*pfnPrintf)(const char* format, ...)) const
+	{
+		pfnPrintf("ili9341 emu: trans %lu cmd %lu B param %lu B px %lu B (%lu px, wrapped %lu)\n",
+				  (unsigned long)stats.transactions, (unsigned long)stats.commandBytes, (unsigned long)stats.paramBytes,
+				  (unsigned long)stats.pixelBytes, (unsigned long)stats.pixels, (unsigned long)stats.wrappedPixels);
+		pfnPrintf("  wasted %lu B: same CASET %lu, same PASET %lu, empty RAMWR %lu, odd bytes %lu\n",
+				  (unsigned long)stats.wastedBytes, (unsigned long)stats.redundantCaset, (unsigned long)stats.redundantPaset,
+				  (unsigned long)stats.emptyRamwr, (unsigned long)stats.oddBytes);
+		for (int i = 0; i < 256; i++) {
+			if (stats.commandCount[i] > 0)
+				pfnPrintf("  cmd 0x%02X x%lu\n", i, (unsigned long)stats.commandCount[i]);
+		}
+	}
+} // namespace ardPort
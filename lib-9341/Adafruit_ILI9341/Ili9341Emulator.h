@@ -0,0 +1,107 @@
+/*!
+ * @file Ili9341Emulator.h
+ *
+ * ILI9341に送られるバイト列（DCつき）を受け取って、液晶の中で起きることを再現するクラス（ホストで送信内容を確かめるため）。
+ * GRAM、CASET/PASETのウインドウ、RAMWR/RAMWRCでの書き込み位置、MADCTLの回転、縦スクロールを扱い、
+ * コマンドごとの回数と、意味の無い送信（同じ範囲のCASET/PASET、ピクセルの無いRAMWR、半端なバイト）を数える。
+ *
+ * 入力は２通り。
+ *   - command()/data() : SPIでDCを切り替えて送るバイト列（Adafruit_SPITFTのwriteCommand()/spiWrite()に当たる）。
+ *                        TftHostSinkなので、ホストのビルドではAdafruit_SPITFT::attachHostSink()で実際のドライバの送信をつなげる
+ *   - stream()         : TftPioStream.pioの16ビットのストリーム（TftPioStream::writeWindow()やTftDisplayListが送るもの）
+ * RDMADCTLとRAMRDの読み出しにも答える（read()）。
+ * getPanel()で、液晶に見えている画面（縦スクロールを反映、液晶を縦に置いた向き）が得られる。
+ * 回転0～3のGFXcanvas16のバッファ（回転前の並び）とそのまま比べられる。
+ */
+#pragma once
+#include <stdint.h>
+#include "../Adafruit_GFX_Library/TftHostBus.h"
+
+#define ILI9341_EMU_WIDTH 240  ///< 液晶の幅（縦置き）
+#define ILI9341_EMU_HEIGHT 320 ///< 液晶の高さ（縦置き）
+
+namespace ardPort {
+
+	/*!
+	  @brief  エミュレータが数える値
+	*/
+	struct Ili9341EmuStats {
+		uint32_t commandCount[256]; ///< コマンドごとの回数
+		uint32_t commandBytes;      ///< コマンドのバイト数
+		uint32_t paramBytes;        ///< コマンドの引数のバイト数（RAMWRのピクセルを除く）
+		uint32_t pixelBytes;        ///< RAMWR/RAMWRCのあとに送られたバイト数
+		uint32_t pixels;            ///< 書き込んだピクセル数
+		uint32_t wrappedPixels;     ///< ウインドウの終わりを越えて先頭に戻って書いたピクセル数
+		uint32_t redundantCaset;    ///< 範囲が変わらないCASETの回数
+		uint32_t redundantPaset;    ///< 範囲が変わらないPASETの回数
+		uint32_t emptyRamwr;        ///< ピクセルを１つも書かずに終わったRAMWR/RAMWRCの回数
+		uint32_t oddBytes;          ///< ピクセルの途中で終わった（半端な）バイト数
+		uint32_t wastedBytes;       ///< 無駄なバイト数（上の３つに使ったバイト）
+		uint32_t transactions;      ///< CSがHになった回数
+	};
+
+	/*!
+	  @brief  ILI9341のコマンド列のエミュレータ
+	*/
+	class Ili9341Emulator : public TftHostSink {
+	  public:
+		Ili9341Emulator();
+		void reset(void);
+
+		// SPIのバイト列
+		void command(uint8_t cmd) override;
+		void data(uint8_t b);
+		void data(const uint8_t* p, uint32_t len) override;
+		uint8_t read(void) override;
+		void endTransaction(void) override;
+		// PIOのストリーム
+		void stream(const uint16_t* p, uint32_t words, bool increment = true);
+
+		void getPanel(uint16_t* pDst) const;
+		uint16_t getGram(int16_t x, int16_t y) const { return gram[y * ILI9341_EMU_WIDTH + x]; } ///< GRAMの値（縦置きの座標）
+		const Ili9341EmuStats& getStats(void) const { return stats; }
+		void clearStats(void);
+		void dumpStats(void (*pfnPrintf)(const char* format, ...)) const;
+
+	  private:
+		static constexpr uint8_t CMD_RDMADCTL = 0x0B;
+		static constexpr uint8_t CMD_CASET = 0x2A;
+		static constexpr uint8_t CMD_PASET = 0x2B;
+		static constexpr uint8_t CMD_RAMWR = 0x2C;
+		static constexpr uint8_t CMD_VSCRDEF = 0x33;
+		static constexpr uint8_t CMD_MADCTL = 0x36;
+		static constexpr uint8_t CMD_VSCRSADD = 0x37;
+		static constexpr uint8_t CMD_RAMRD = 0x2E;
+		static constexpr uint8_t CMD_RAMWRC = 0x3C;
+
+		void finishCommand(void);
+		void writePixel(uint16_t color);
+		int32_t gramIndex(void) const;
+		void advance(void);
+
+		uint16_t gram[ILI9341_EMU_WIDTH * ILI9341_EMU_HEIGHT]; ///< GRAM（縦置きの並び）
+		Ili9341EmuStats stats;                                  ///< 数えた値
+
+		uint8_t cmd = 0;         ///< 実行中のコマンド
+		bool hasCmd = false;     ///< コマンドを受け取ったあとか
+		uint8_t param[8];        ///< 引数
+		uint8_t paramLen = 0;    ///< 受け取った引数のバイト数
+		uint32_t ramBytes = 0;   ///< RAMWRのあとに受け取ったバイト数
+		uint8_t pixelHi = 0;     ///< ピクセルの上位バイト
+		uint32_t readBytes = 0;  ///< RAMRDのあとに読み出したバイト数（ダミーを含む）
+		uint16_t readPixel = 0;  ///< RAMRDで読み出し中のピクセル
+		uint16_t sc = 0;         ///< CASETの開始
+		uint16_t ec = 239;       ///< CASETの終了
+		uint16_t sp = 0;         ///< PASETの開始
+		uint16_t ep = 319;       ///< PASETの終了
+		uint16_t col = 0;        ///< 次に書く列
+		uint16_t page = 0;       ///< 次に書くページ
+		bool wrapped = false;    ///< ウインドウの終わりを越えて先頭に戻ったか
+		uint8_t madctl = 0;      ///< MADCTL
+		uint16_t tfa = 0;        ///< 縦スクロールの上の固定領域
+		uint16_t vsa = 320;      ///< 縦スクロールの領域
+		uint16_t vsp = 0;        ///< 縦スクロールの開始位置
+		uint16_t streamRemain = 0; ///< ストリームのデータ区間の残りの語数
+		uint8_t streamState = 0;   ///< ストリームの状態（0:ヘッダ 1:コマンド 2:データ）
+	};
+} // namespace ardPort
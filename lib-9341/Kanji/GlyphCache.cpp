@@ -0,0 +1,283 @@
+#include "GlyphCache.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*!
+  @brief  コンストラクタ。init()が呼ばれるまでキャッシュは無効（findは常にミス、insertは常に失敗）。
+*/
+GlyphCache::GlyphCache() :
+	pArena(nullptr),
+	pEntries(nullptr),
+	slots(0)
+{
+	clear();
+	clearStats();
+}
+
+GlyphCache::~GlyphCache()
+{
+	free(pArena);
+	free(pEntries);
+}
+
+/*!
+  @brief  メモリ予算を指定してアリーナを確保する
+  @param  budgetBytes  キャッシュに使ってよいバイト数（ピクセルとエントリの合計）。0ならキャッシュを無効にする。
+  @return 確保できたらtrue
+  @details 何度呼んでもよいが、呼ぶたびに内容は捨てられる。
+*/
+bool GlyphCache::init(size_t budgetBytes)
+{
+	free(pArena);
+	free(pEntries);
+	pArena = nullptr;
+	pEntries = nullptr;
+	slots = 0;
+	clear();
+
+	size_t slotBytes = GLYPH_CACHE_SLOT_PIXELS * sizeof(uint16_t) + sizeof(GlyphCacheEntry);
+	size_t n = budgetBytes / slotBytes;
+	if (n > GLYPH_CACHE_NONE - 1) n = GLYPH_CACHE_NONE - 1;
+	if (n == 0) return budgetBytes == 0;
+
+	pArena = (uint16_t*)malloc(n * GLYPH_CACHE_SLOT_PIXELS * sizeof(uint16_t));
+	pEntries = (GlyphCacheEntry*)malloc(n * sizeof(GlyphCacheEntry));
+	if (pArena == nullptr || pEntries == nullptr) {
+		free(pArena);
+		free(pEntries);
+		pArena = nullptr;
+		pEntries = nullptr;
+		return false;
+	}
+	slots = (uint16_t)n;
+	return true;
+}
+
+/*!
+  @brief  キャッシュの内容をすべて捨てる（アリーナは保持する）
+*/
+void GlyphCache::clear()
+{
+	used = 0;
+	head = tail = GLYPH_CACHE_NONE;
+	for (int i = 0; i < GLYPH_CACHE_BUCKETS; i++) {
+		bucket[i] = GLYPH_CACHE_NONE;
+	}
+}
+
+/*!
+  @brief  キーからバケット番号を求める
+*/
+uint16_t GlyphCache::hashKey(uint32_t code, const KanjiData* pFont, uint16_t fg, uint16_t bg)
+{
+	uint32_t h = code * 2654435761u;
+	h ^= (uint32_t)(uintptr_t)pFont;
+	h ^= ((uint32_t)fg << 16 | bg) * 40503u;
+	h ^= h >> 15;
+	return (uint16_t)(h & (GLYPH_CACHE_BUCKETS - 1));
+}
+
+/*!
+  @brief  LRUリストからエントリを外す
+*/
+void GlyphCache::unlinkLru(uint16_t idx)
+{
+	GlyphCacheEntry& e = pEntries[idx];
+	if (e.prev != GLYPH_CACHE_NONE) pEntries[e.prev].next = e.next;
+	else head = e.next;
+	if (e.next != GLYPH_CACHE_NONE) pEntries[e.next].prev = e.prev;
+	else tail = e.prev;
+}
+
+/*!
+  @brief  エントリをLRUリストの先頭（最も新しい）に置く
+*/
+void GlyphCache::pushFront(uint16_t idx)
+{
+	GlyphCacheEntry& e = pEntries[idx];
+	e.prev = GLYPH_CACHE_NONE;
+	e.next = head;
+	if (head != GLYPH_CACHE_NONE) pEntries[head].prev = idx;
+	head = idx;
+	if (tail == GLYPH_CACHE_NONE) tail = idx;
+}
+
+/*!
+  @brief  ハッシュ表のチェーンからエントリを外す
+*/
+void GlyphCache::unlinkChain(uint16_t idx)
+{
+	GlyphCacheEntry& e = pEntries[idx];
+	uint16_t* pLink = &bucket[hashKey(e.code, e.pFont, e.fg, e.bg)];
+	while (*pLink != GLYPH_CACHE_NONE) {
+		if (*pLink == idx) {
+			*pLink = e.chain;
+			return;
+		}
+		pLink = &pEntries[*pLink].chain;
+	}
+}
+
+/*!
+  @brief  キャッシュを検索する
+  @param  code   文字コード
+  @param  pFont  フォント
+  @param  fg     前景色
+  @param  bg     背景色
+  @return 見つかったエントリ。無ければnullptr。見つかったエントリは最も新しいものになる。
+*/
+const GlyphCacheEntry* GlyphCache::find(uint32_t code, const KanjiData* pFont, uint16_t fg, uint16_t bg)
+{
+	if (slots == 0) return nullptr;
+	for (uint16_t idx = bucket[hashKey(code, pFont, fg, bg)]; idx != GLYPH_CACHE_NONE; idx = pEntries[idx].chain) {
+		GlyphCacheEntry& e = pEntries[idx];
+		if (e.code == code && e.pFont == pFont && e.fg == fg && e.bg == bg) {
+			if (head != idx) {
+				unlinkLru(idx);
+				pushFront(idx);
+			}
+			hits++;
+			return &e;
+		}
+	}
+	misses++;
+	return nullptr;
+}
+
+/*!
+  @brief  キャッシュにエントリを追加し、ピクセルの書き込み先を返す
+  @param  code   文字コード
+  @param  pFont  フォント
+  @param  fg     前景色
+  @param  bg     背景色
+  @param  w      幅
+  @param  h      高さ
+  @return 幅×高さのRGB565ピクセルを書き込む先。スロットに入らない、またはキャッシュが無効ならnullptr。
+  @details 空きスロットが無ければ最も古いエントリを追い出す。呼び出し側は返されたバッファにすぐ展開すること。
+*/
+uint16_t* GlyphCache::insert(uint32_t code, const KanjiData* pFont, uint16_t fg, uint16_t bg, uint8_t w, uint8_t h)
+{
+	if (slots == 0 || (uint16_t)w * h > GLYPH_CACHE_SLOT_PIXELS) return nullptr;
+
+	uint16_t idx;
+	if (used < slots) {
+		idx = used++;
+	} else {
+		idx = tail;
+		unlinkLru(idx);
+		unlinkChain(idx);
+		evictions++;
+	}
+	GlyphCacheEntry& e = pEntries[idx];
+	e.code = code;
+	e.pFont = pFont;
+	e.fg = fg;
+	e.bg = bg;
+	e.w = w;
+	e.h = h;
+	uint16_t b = hashKey(code, pFont, fg, bg);
+	e.chain = bucket[b];
+	bucket[b] = idx;
+	pushFront(idx);
+	return pArena + idx * GLYPH_CACHE_SLOT_PIXELS;
+}
+
+/*!
+  @brief  階調（0～(1 << bpp) - 1）をRGB565に変換する表を取得する
+  @param  fg   前景色
+  @param  bg   背景色
+  @param  bpp  １ドットのビット数（1/2/4）
+  @return 階調ごとの色（最大16色）
+  @details
+	前景色と背景色をR/G/Bそれぞれ階調の割合で混ぜた色の表。色とビット数が前回と同じなら作り直さない。
+	文字列は同じ色で続けて描くことがほとんどなので、表を作るのは色が変わったときの１回で済む。
+*/
+const uint16_t* GlyphCache::getBlendLut(uint16_t fg, uint16_t bg, uint8_t bpp)
+{
+	static uint16_t lut[16];
+	static uint16_t lutFg = 0;
+	static uint16_t lutBg = 0;
+	static uint8_t lutBpp = 0;
+	if (bpp == lutBpp && fg == lutFg && bg == lutBg) return lut;
+
+	uint8_t maxLevel = (1 << bpp) - 1;
+	int16_t fr = fg >> 11, fgr = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+	int16_t br = bg >> 11, bgr = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+	for (uint8_t v = 0; v <= maxLevel; v++) {
+		uint16_t r = (br * (maxLevel - v) + fr * v + maxLevel / 2) / maxLevel;
+		uint16_t g = (bgr * (maxLevel - v) + fgr * v + maxLevel / 2) / maxLevel;
+		uint16_t b = (bb * (maxLevel - v) + fb * v + maxLevel / 2) / maxLevel;
+		lut[v] = (r << 11) | (g << 5) | b;
+	}
+	lutFg = fg;
+	lutBg = bg;
+	lutBpp = bpp;
+	return lut;
+}
+
+/*!
+  @brief  フォントビットマップの１行をRGB565に展開する
+  @param  pRow   行の先頭
+  @param  w      幅
+  @param  bpp    １ドットのビット数（1/2/4）
+  @param  lut    getBlendLut()で得た表
+  @param  pDst   展開先（w×scaleピクセル）
+  @param  scale  横の拡大率（１ドットをscale回並べる）
+*/
+void GlyphCache::expandRow(const uint8_t* pRow, uint8_t w, uint8_t bpp, const uint16_t* lut, uint16_t* pDst, uint8_t scale)
+{
+	if (scale == 1) {
+		switch (bpp) {
+		case 1:
+			for (uint8_t xx = 0; xx < w; xx++)
+				*pDst++ = lut[(pRow[xx >> 3] >> (7 - (xx & 7))) & 1];
+			return;
+		case 2:
+			for (uint8_t xx = 0; xx < w; xx++)
+				*pDst++ = lut[(pRow[xx >> 2] >> (6 - 2 * (xx & 3))) & 3];
+			return;
+		case 4:
+			for (uint8_t xx = 0; xx < w; xx++)
+				*pDst++ = lut[(pRow[xx >> 1] >> ((xx & 1) ? 0 : 4)) & 15];
+			return;
+		default:
+			break;
+		}
+	}
+	for (uint8_t xx = 0; xx < w; xx++) {
+		uint16_t c = lut[getLevel(pRow, xx, bpp)];
+		for (uint8_t k = 0; k < scale; k++)
+			*pDst++ = c;
+	}
+}
+
+/*!
+  @brief  フォントビットマップをRGB565に展開する
+  @param  bmpData  フォントビットマップ（各行はバイト境界から始まる）
+  @param  w        幅
+  @param  h        高さ
+  @param  fg       前景色
+  @param  bg       背景色
+  @param  dst      展開先（w×hピクセル）
+  @param  stride   展開先の１行のピクセル数。0なら幅と同じ（詰めて展開する）
+  @param  bpp      １ドットのビット数。1は白黒、2/4は階調つき（アンチエイリアス）で、背景色と混ぜた色にする
+*/
+void GlyphCache::expand(const uint8_t* bmpData, uint8_t w, uint8_t h, uint16_t fg, uint16_t bg, uint16_t* dst, uint16_t stride, uint8_t bpp)
+{
+	uint8_t w_bytes = getRowBytes(w, bpp);
+	if (stride == 0) stride = w;
+	if (bpp == 1) {
+		for (uint8_t yy = 0; yy < h; yy++) {
+			const uint8_t* pRow = bmpData + yy * w_bytes;
+			uint16_t* pDst = dst + yy * stride;
+			for (uint8_t xx = 0; xx < w; xx++) {
+				*pDst++ = (pRow[xx >> 3] & (0x80 >> (xx & 7))) ? fg : bg;
+			}
+		}
+		return;
+	}
+	const uint16_t* lut = getBlendLut(fg, bg, bpp);
+	for (uint8_t yy = 0; yy < h; yy++) {
+		expandRow(bmpData + yy * w_bytes, w, bpp, lut, dst + yy * stride);
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+#include "Fonts/KanjiFontStructure.h"
+
+#ifndef GLYPH_CACHE_SLOT_PIXELS
+	#define GLYPH_CACHE_SLOT_PIXELS 256 ///< １スロットに入るピクセル数。16×16ドットまでの文字をキャッシュする
+#endif
+#define GLYPH_CACHE_BUCKETS 64 ///< 検索用ハッシュ表のバケット数（2のべき乗）
+#define GLYPH_CACHE_NONE 0xFFFF ///< リストの終端
+
+/*!
+  @brief  キャッシュされた１文字分の情報
+*/
+struct GlyphCacheEntry {
+	uint32_t code;          ///< 文字コード（Unicode）
+	const KanjiData* pFont; ///< フォント（KanjiHelperに設定されているフォントデータの先頭）
+	uint16_t fg;            ///< 前景色
+	uint16_t bg;            ///< 背景色
+	uint8_t w;              ///< 幅
+	uint8_t h;              ///< 高さ
+	uint16_t prev;          ///< LRUリストの前（新しい側）
+	uint16_t next;          ///< LRUリストの次（古い側）
+	uint16_t chain;         ///< 同じバケットの次のエントリ
+};
+
+/*!
+  @brief
+	RGB565に展開済みの文字を、(文字コード, フォント, 前景色, 背景色) をキーにして保持するLRUキャッシュ。
+
+  @details
+	メイン画面のように同じ文字（数字、距離、強さ、km、検出など）を何度も描く場合に、
+	KanjiHelperのバイナリサーチと1bpp→565の展開を省き、展開済みのピクセルをそのまま液晶に送るために使う。
+
+	メモリはinit()で指定した予算から一度だけ確保し（専用アリーナ）、以降は確保・解放しない。
+	アリーナは GLYPH_CACHE_SLOT_PIXELS ピクセルの固定長スロットに分け、スロットに入らない大きな文字はキャッシュしない。
+	スロットがすべて埋まっていれば、最も長く使われていないスロットを再利用する。
+
+	ヒット率の確認用に、ヒット・ミス・追い出しの回数を数えている。
+*/
+class GlyphCache {
+  public:
+	GlyphCache();
+	~GlyphCache();
+
+	bool init(size_t budgetBytes);
+	const GlyphCacheEntry* find(uint32_t code, const KanjiData* pFont, uint16_t fg, uint16_t bg);
+	uint16_t* insert(uint32_t code, const KanjiData* pFont, uint16_t fg, uint16_t bg, uint8_t w, uint8_t h);
+	void clear();
+	/*!
+	  @brief  エントリのピクセルデータを取得する
+	  @param  pEntry  find()で得たエントリ
+	  @return 幅×高さのRGB565ピクセル
+	*/
+	const uint16_t* getPixels(const GlyphCacheEntry* pEntry) const { return pArena + (pEntry - pEntries) * GLYPH_CACHE_SLOT_PIXELS; }
+
+	static void expand(const uint8_t* bmpData, uint8_t w, uint8_t h, uint16_t fg, uint16_t bg, uint16_t* dst, uint16_t stride = 0, uint8_t bpp = 1);
+	static void expandRow(const uint8_t* pRow, uint8_t w, uint8_t bpp, const uint16_t* lut, uint16_t* pDst, uint8_t scale = 1);
+	static const uint16_t* getBlendLut(uint16_t fg, uint16_t bg, uint8_t bpp);
+	/// @brief フォントビットマップの１行のバイト数
+	static uint8_t getRowBytes(uint8_t w, uint8_t bpp) { return (uint8_t)(((uint16_t)w * bpp + 8 - 1) / 8); }
+	/*!
+	  @brief  フォントビットマップの１ドットの階調を取得する
+	  @param  pRow  行の先頭
+	  @param  xx    横の位置
+	  @param  bpp   １ドットのビット数（1/2/4）
+	  @return 0（背景）～ (1 << bpp) - 1（前景）
+	*/
+	static uint8_t getLevel(const uint8_t* pRow, uint16_t xx, uint8_t bpp)
+	{
+		uint16_t bit = xx * bpp;
+		return (pRow[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1);
+	}
+
+	uint32_t getHits() const { return hits; }           ///< ヒット回数
+	uint32_t getMisses() const { return misses; }       ///< ミス回数
+	uint32_t getEvictions() const { return evictions; } ///< 追い出し回数
+	uint16_t getSlots() const { return slots; }         ///< スロット数
+	/// @brief ヒット率（0～100％）
+	uint8_t getHitRate() const { return (hits + misses) ? (uint8_t)((uint64_t)hits * 100 / (hits + misses)) : 0; }
+	void clearStats() { hits = misses = evictions = 0; }
+
+  private:
+	static uint16_t hashKey(uint32_t code, const KanjiData* pFont, uint16_t fg, uint16_t bg);
+	void unlinkLru(uint16_t idx);
+	void pushFront(uint16_t idx);
+	void unlinkChain(uint16_t idx);
+
+	uint16_t* pArena;           ///< ピクセル用アリーナ（slots × GLYPH_CACHE_SLOT_PIXELS）
+	GlyphCacheEntry* pEntries;  ///< エントリ（スロットと同じ数）
+	uint16_t slots;             ///< スロット数
+	uint16_t used;              ///< 使用中のスロット数
+	uint16_t head;              ///< LRUリストの先頭（最も新しい）
+	uint16_t tail;              ///< LRUリストの末尾（最も古い）
+	uint16_t bucket[GLYPH_CACHE_BUCKETS]; ///< ハッシュ表
+
+	uint32_t hits;      ///< ヒット回数
+	uint32_t misses;    ///< ミス回数
+	uint32_t evictions; ///< 追い出し回数
+};
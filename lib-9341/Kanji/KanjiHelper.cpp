@@ -13,6 +13,7 @@ uint8_t KanjiHelper::AsciiWidth = 0;
 uint8_t KanjiHelper::AsciiHeight = 0;
 uint8_t KanjiHelper::KanjiWidth = 0;
 uint8_t KanjiHelper::KanjiHeight = 0;
+uint8_t KanjiHelper::BitsPerPixel = 1;
 
 /**
  * @file KanjiHelper.cpp
@@ -20,9 +21,15 @@ uint8_t KanjiHelper::KanjiHeight = 0;
  * 処理を行う、KanjiHelperクラスを定義する。KanjiHelperクラスはすべてstaticメソッドで、インスタンス化することはできない。
  */
 
-void KanjiHelper::SetKanjiFont(const KanjiData *a_pKanjiData, const uint8_t *a_pBmpData) {
+/// @brief 漢字フォントを設定する。
+/// @param a_pKanjiData フォントテーブル
+/// @param a_pBmpData ビットマップデータ
+/// @param bpp ビットマップの１ドットのビット数。1（白黒）のほか、2/4（階調つき、アンチエイリアス）が使える。それ以外は1とみなす。<br/>
+/// 階調つきのビットマップも各行はバイト境界から始まり、上位ビットが左のドット。0が背景、最大値が前景になる。
+void KanjiHelper::SetKanjiFont(const KanjiData *a_pKanjiData, const uint8_t *a_pBmpData, uint8_t bpp) {
 	pKanjiData = a_pKanjiData;
 	pBmpData = (uint8_t *)a_pBmpData;
+	BitsPerPixel = (bpp == 2 || bpp == 4) ? bpp : 1;
 	// 構造体のサイズを求める
 	DataSize = 0;
 	for (KanjiData *p = (KanjiData *)pKanjiData; p->width != 0; p++) {
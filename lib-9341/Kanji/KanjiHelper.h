@@ -3,6 +3,7 @@
 #include <errno.h>
 #include <iconv.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "Fonts/KanjiFontStructure.h"
@@ -35,6 +36,7 @@
 	  - DataSize:   フォントデータのエントリ数
 	  - AsciiWidth, AsciiHeight:  ASCII文字の幅・高さ（ピクセル単位）
 	  - KanjiWidth, KanjiHeight:  漢字文字の幅・高さ（ピクセル単位）
+	  - BitsPerPixel: ビットマップの１ドットのビット数（1:白黒、2/4:階調つき）
 
 	これらの情報をもとに、FindKanji/FindAsciiでフォント情報を検索し、getBmpDataでビットマップを取得できます。
 */
@@ -50,6 +52,7 @@ class KanjiHelper {
 	static uint8_t AsciiHeight;
 	static uint8_t KanjiWidth;
 	static uint8_t KanjiHeight;
+	static uint8_t BitsPerPixel;
 
    private:
 	KanjiHelper() {};
@@ -59,14 +62,16 @@ class KanjiHelper {
 	 static int compareUnicode(const void* a, const void* b);
 
 	public:
-	 static void SetKanjiFont(const KanjiData *pKanjiData, const uint8_t* pBmpData);
+	 static void SetKanjiFont(const KanjiData *pKanjiData, const uint8_t* pBmpData, uint8_t bpp = 1);
 	 static const KanjiData* FindKanji(uint32_t unicode);
 	 static const KanjiData* FindAscii(uint8_t asciicode);
 	 static const uint8_t getKanjiWidth() { return KanjiWidth; };
 	 static const uint8_t getKanjiHeight() { return KanjiHeight; };
 	 static const uint8_t getAsciiWidth() { return AsciiWidth; };
 	 static const uint8_t getAsciiHeight() { return AsciiHeight; };
+	 static const uint8_t getBitsPerPixel() { return BitsPerPixel; };
 	 static const uint8_t* getBmpData(const KanjiData *pFont);
+	 static const KanjiData* getFont() { return pKanjiData; };
 
 	 
 };
@@ -52,6 +52,42 @@ void Print::KanjiMode(bool a_isEnable) {
 	isKanji = a_isEnable;
 }
 
+/// @brief  UTF-8の１文字を取り出す
+/// @param buffer 文字列の現在位置
+/// @param size 残りのバイト数
+/// @param pCode 取り出した文字。UTF-8のバイト列をそのまま詰めた値（漢字フォントの検索キー）
+/// @return 文字のバイト数。不正なUTF-8バイト、または途中で切れている場合は0
+uint8_t Print::decodeUtf8(const uint8_t *buffer, size_t size, uint32_t *pCode) {
+	uint8_t step = 0;
+	if ((buffer[0] & 0x80) == 0x00) {
+		step = 1;  // 1バイト文字 (ASCII)
+	} else if ((buffer[0] & 0xE0) == 0xC0) {
+		step = 2;  // 2バイト文字
+	} else if ((buffer[0] & 0xF0) == 0xE0) {
+		step = 3;  // 3バイト文字
+	} else if ((buffer[0] & 0xF8) == 0xF0) {
+		step = 4;  // 4バイト文字
+	} else {
+		return 0;  // 不正なUTF-8バイト
+	}
+	if (step > size) return 0;
+	uint32_t utf8codes = buffer[0];
+	for (uint8_t i = 1; i < step; i++) {
+		utf8codes = (utf8codes << 8) | buffer[i];
+	}
+
+#ifdef TFT_FORCE_HANKANA  // 半角カナを1バイト文字として処理
+	uint16_t top2bytes = (uint16_t)(utf8codes >> 8);
+	if (top2bytes == 0xefbd) {
+		utf8codes = utf8codes & 0x000000FF;
+	} else if (top2bytes == 0xefbe) {
+		utf8codes = (utf8codes & 0x000000FF) + 0x40;
+	}
+#endif
+	*pCode = utf8codes;
+	return step;
+}
+
 /* default implementation: may be overridden */
 /// @brief  文字列描画の仮想関数。必要に応じてオーバーロードする。
 /// @param buffer 描画する文字列
@@ -65,31 +101,10 @@ size_t Print::write(const uint8_t *buffer, size_t size) {
 		int i = 0;
 		while (i < (int)size) {
 			uint32_t utf8codes = 0;
-			uint8_t step = 0;
-			if ((buffer[i] & 0x80) == 0x00) {
-				step = 1;  // 1バイト文字 (ASCII)
-				utf8codes = buffer[i];
-			} else if ((buffer[i] & 0xE0) == 0xC0) {
-				step = 2;  // 2バイト文字
-				utf8codes = (buffer[i] << 8) | buffer[i + 1];
-			} else if ((buffer[i] & 0xF0) == 0xE0) {
-				step = 3;  // 3バイト文字
-				utf8codes = (buffer[i] << 16) | (buffer[i + 1] << 8) | buffer[i + 2];
-			} else if ((buffer[i] & 0xF8) == 0xF0) {
-				utf8codes = (buffer[i] << 24) | (buffer[i + 1] << 16) | (buffer[i + 2] << 8) | buffer[i + 3];
-				step = 4;  // 4バイト文字
-			} else {
+			uint8_t step = decodeUtf8(buffer + i, size - i, &utf8codes);
+			if (step == 0) {
 				return 0;  // 不正なUTF-8バイト
 			}
-
-#ifdef TFT_FORCE_HANKANA  // 半角カナを1バイト文字として処理
-			uint16_t top2bytes = (uint16_t)(utf8codes >> 8);
-			if (top2bytes == 0xefbd) {
-				utf8codes = utf8codes & 0x000000FF;
-			} else if (top2bytes == 0xefbe) {
-				utf8codes = (utf8codes & 0x000000FF) + 0x40;
-			}
-#endif
 			charCount++;
 			write(utf8codes);  // 文字列描画
 			i += step;
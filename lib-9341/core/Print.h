@@ -74,6 +74,7 @@ namespace ardPort::core {
 
 	   protected:
 		void setWriteError(int err = 1) { write_error = err; }
+		static uint8_t decodeUtf8(const uint8_t *buffer, size_t size, uint32_t *pCode);
 
 	   public:
 		Print() :
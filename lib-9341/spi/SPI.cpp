@@ -161,6 +161,9 @@ void SPIClassRP2040::transfer(const void* txbuf, void* rxbuf, size_t count)
 void SPIClassRP2040::beginTransaction(SPISettings settings)
 {
 	DEBUGSPI("SPI::beginTransaction(clk=%lu, bo=%s)\n", settings.getClockFreq(), (settings.getBitOrder() == MSBFIRST) ? "MSB" : "LSB");
+	if (_busWait) {
+		_busWait(_busWaitCtx);
+	}
 	if (_initted && settings == _spis) {
 		DEBUGSPI("SPI: Reusing existing initted SPI\n");
 	} else {
@@ -120,6 +120,21 @@ public:
     void abortAsync();
 
 
+    /**
+        @brief Register a function called at the start of every beginTransaction()
+
+        @details
+        A display driver that leaves a DMA transfer running after it returns uses this to
+        finish that transfer before another device on the same bus starts a transaction.
+
+        @param [in] func Function to call, or nullptr to remove
+        @param [in] ctx Argument passed to ``func``
+    */
+    void setBusWait(void (*func)(void *), void *ctx) {
+        _busWait = func;
+        _busWaitCtx = ctx;
+    }
+
     /**
            @brief Begin an SPI transaction, sets SPI speed and masks necessary interrupts
 
@@ -270,6 +285,10 @@ private:
     uint8_t *_rxFinalBuffer;
     uint32_t _dummy;
     SPIHelper _helper;
+
+    // Called before a transaction begins (see setBusWait)
+    void (*_busWait)(void *) = nullptr;
+    void *_busWaitCtx = nullptr;
 };
 
 
@@ -0,0 +1,1837 @@
+/**
+ * @file pictPacked.h
+ * @brief pictData.h の画像をパレット＋ランレングスで圧縮したものと、アイコンのスプライト（tools/pack_images.py で生成。直接編集しないこと）
+ */
+#pragma once
+#include "lib-9341/Adafruit_GFX_Library/PackedImage.h"
+#include "lib-9341/Adafruit_GFX_Library/SpanSprite.h"
+
+// num_blank: 32×51, 25色, 3264 → 128 バイト
+const uint16_t num_blank_palette[] = {
+	0x0000, 0x0020, 0x0841, 0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x52AA, 0x94B2, 0x3186, 0x1081, 0xA534,
+	0x9CD3, 0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2,
+};
+const uint8_t num_blank_data[] = {
+	0xFF, 0xDC, 0x02, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x02, 0x98, 0x00, 0x80, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x03, 0x96, 0x08, 0x04,
+	0x00, 0x09, 0x0A, 0x0B, 0x0C, 0x80, 0x08, 0x00, 0x02, 0x96, 0x0D, 0x00, 0x0E, 0x80, 0x0F, 0x01, 0x10, 0x08, 0x80, 0x11, 0x00, 0x12, 0x96, 0x0D,
+	0x00, 0x12, 0x80, 0x13, 0x01, 0x14, 0x09, 0x80, 0x15, 0x00, 0x00, 0x96, 0x08, 0x00, 0x03, 0x80, 0x16, 0x03, 0x17, 0x18, 0x04, 0x02, 0x9A, 0x00,
+	0x00, 0x02, 0xFF, 0xC0, 0x02, 0x00,
+};
+const ardPort::PackedImage num_blank_packed = {32, 51, num_blank_palette, num_blank_data, 78};
+
+// num_0: 32×51, 43色, 3264 → 704 バイト
+const uint16_t num_0_palette[] = {
+	0x0000, 0x8410, 0xB596, 0xDEDB, 0xEF7D, 0xFFFF, 0xE71C, 0xD69A, 0xA514, 0x39E7, 0x18E3, 0xF7BE, 0x9492, 0x52AA, 0xC638, 0x6B6D,
+	0xFFDF, 0xF79E, 0x6B4D, 0x0841, 0x10A2, 0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x3186, 0x1081,
+	0xA534, 0x9CD3, 0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x0020, 0xBDF7,
+};
+const uint8_t num_0_data[] = {
+	0xA8, 0x00, 0x03, 0x01, 0x02, 0x03, 0x04, 0x82, 0x05, 0x03, 0x06, 0x07, 0x08, 0x09, 0x8F, 0x00, 0x02, 0x0A, 0x02, 0x0B, 0x8A, 0x05, 0x01, 0x06,
+	0x0C, 0x8C, 0x00, 0x01, 0x01, 0x0B, 0x8E, 0x05, 0x01, 0x06, 0x0D, 0x89, 0x00, 0x00, 0x0C, 0x92, 0x05, 0x00, 0x0C, 0x87, 0x00, 0x00, 0x0C, 0x94,
+	0x05, 0x00, 0x0C, 0x85, 0x00, 0x00, 0x09, 0x95, 0x05, 0x01, 0x0B, 0x09, 0x84, 0x00, 0x00, 0x0E, 0x96, 0x05, 0x00, 0x03, 0x83, 0x00, 0x00, 0x0A,
+	0x89, 0x05, 0x03, 0x07, 0x0A, 0x00, 0x02, 0x89, 0x05, 0x00, 0x09, 0x82, 0x00, 0x00, 0x01, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0A, 0x89,
+	0x05, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x89, 0x05, 0x82, 0x00, 0x89, 0x05, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x82, 0x00, 0x00,
+	0x06, 0x88, 0x05, 0x00, 0x0B, 0x82, 0x00, 0x00, 0x06, 0x89, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x82, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00,
+	0x03, 0x89, 0x05, 0x00, 0x0A, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00,
+	0x03, 0x89, 0x05, 0x00, 0x0F, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00,
+	0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0D, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8A,
+	0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80,
+	0x00, 0x00, 0x0F, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x87,
+	0x05, 0x02, 0x10, 0x11, 0x12, 0x80, 0x00, 0x01, 0x13, 0x14, 0x89, 0x05, 0x82, 0x00, 0x00, 0x03, 0x88, 0x05, 0x80, 0x15, 0x04, 0x16, 0x17, 0x18,
+	0x19, 0x15, 0x96, 0x1A, 0x04, 0x00, 0x1B, 0x1C, 0x0D, 0x1D, 0x80, 0x1A, 0x00, 0x13, 0x96, 0x1E, 0x00, 0x1F, 0x80, 0x20, 0x01, 0x21, 0x1A, 0x80,
+	0x22, 0x00, 0x23, 0x96, 0x1E, 0x00, 0x23, 0x80, 0x24, 0x01, 0x25, 0x1B, 0x80, 0x26, 0x00, 0x00, 0x96, 0x1A, 0x00, 0x15, 0x80, 0x27, 0x03, 0x28,
+	0x14, 0x16, 0x13, 0x89, 0x05, 0x82, 0x00, 0x00, 0x03, 0x88, 0x05, 0x06, 0x16, 0x29, 0x13, 0x00, 0x12, 0x11, 0x0B, 0x88, 0x05, 0x82, 0x00, 0x00,
+	0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8A,
+	0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80,
+	0x00, 0x00, 0x0F, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89,
+	0x05, 0x00, 0x0F, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89,
+	0x05, 0x00, 0x0F, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x00, 0x0F, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89,
+	0x05, 0x00, 0x0D, 0x81, 0x00, 0x8A, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x82, 0x00, 0x00, 0x03, 0x89, 0x05, 0x82, 0x00, 0x00, 0x06, 0x89,
+	0x05, 0x82, 0x00, 0x00, 0x0E, 0x89, 0x05, 0x82, 0x00, 0x89, 0x05, 0x00, 0x03, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x05, 0x00, 0x0D, 0x80, 0x00, 0x00,
+	0x0A, 0x89, 0x05, 0x00, 0x0E, 0x82, 0x00, 0x00, 0x0A, 0x89, 0x05, 0x00, 0x0E, 0x80, 0x0A, 0x00, 0x0E, 0x89, 0x05, 0x00, 0x0F, 0x83, 0x00, 0x00,
+	0x2A, 0x96, 0x05, 0x00, 0x04, 0x84, 0x00, 0x01, 0x0A, 0x0B, 0x95, 0x05, 0x00, 0x0F, 0x85, 0x00, 0x00, 0x01, 0x94, 0x05, 0x00, 0x2A, 0x87, 0x00,
+	0x00, 0x0C, 0x92, 0x05, 0x00, 0x0E, 0x89, 0x00, 0x01, 0x0C, 0x0B, 0x8F, 0x05, 0x00, 0x02, 0x8B, 0x00, 0x02, 0x0A, 0x0E, 0x0B, 0x8B, 0x05, 0x01,
+	0x07, 0x0D, 0x8F, 0x00, 0x03, 0x01, 0x02, 0x03, 0x06, 0x83, 0x05, 0x03, 0x03, 0x0E, 0x0C, 0x09, 0x87, 0x00,
+};
+const ardPort::PackedImage num_0_packed = {32, 51, num_0_palette, num_0_data, 618};
+
+// num_1: 32×51, 38色, 3264 → 514 バイト
+const uint16_t num_1_palette[] = {
+	0x0000, 0x18E3, 0xE71C, 0xFFFF, 0xDEDB, 0x8410, 0xF7BE, 0x39E7, 0x6B6D, 0xC638, 0xBDF7, 0xEF7D, 0xA514, 0xB596, 0x0020, 0x0841,
+	0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x52AA, 0x94B2, 0x3186, 0x1081, 0xA534, 0x9CD3, 0xA4F3, 0x0840,
+	0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2,
+};
+const uint8_t num_1_data[] = {
+	0xAC, 0x00, 0x01, 0x01, 0x02, 0x84, 0x03, 0x00, 0x04, 0x94, 0x00, 0x01, 0x01, 0x02, 0x85, 0x03, 0x00, 0x04, 0x93, 0x00, 0x01, 0x01, 0x02, 0x86,
+	0x03, 0x00, 0x04, 0x92, 0x00, 0x01, 0x05, 0x06, 0x87, 0x03, 0x00, 0x04, 0x90, 0x00, 0x01, 0x07, 0x04, 0x89, 0x03, 0x00, 0x04, 0x8E, 0x00, 0x01,
+	0x08, 0x09, 0x8B, 0x03, 0x00, 0x04, 0x8B, 0x00, 0x02, 0x08, 0x0A, 0x0B, 0x8D, 0x03, 0x00, 0x04, 0x89, 0x00, 0x00, 0x0A, 0x91, 0x03, 0x00, 0x04,
+	0x89, 0x00, 0x00, 0x04, 0x91, 0x03, 0x00, 0x04, 0x89, 0x00, 0x00, 0x04, 0x91, 0x03, 0x00, 0x04, 0x89, 0x00, 0x00, 0x04, 0x91, 0x03, 0x00, 0x04,
+	0x89, 0x00, 0x00, 0x04, 0x91, 0x03, 0x00, 0x04, 0x89, 0x00, 0x00, 0x04, 0x91, 0x03, 0x00, 0x04, 0x8D, 0x00, 0x03, 0x01, 0x08, 0x0C, 0x0B, 0x8A,
+	0x03, 0x00, 0x04, 0x90, 0x00, 0x01, 0x01, 0x06, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x09, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x83, 0x00, 0x00, 0x0E,
+	0x82, 0x00, 0x01, 0x0E, 0x0F, 0x85, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x84, 0x00, 0x80, 0x10, 0x04, 0x11, 0x12, 0x13, 0x14, 0x10, 0x96,
+	0x15, 0x04, 0x00, 0x16, 0x17, 0x18, 0x19, 0x80, 0x15, 0x00, 0x0F, 0x96, 0x1A, 0x00, 0x1B, 0x80, 0x1C, 0x01, 0x1D, 0x15, 0x80, 0x1E, 0x00, 0x1F,
+	0x96, 0x1A, 0x00, 0x1F, 0x80, 0x20, 0x01, 0x21, 0x16, 0x80, 0x22, 0x00, 0x00, 0x96, 0x15, 0x00, 0x10, 0x80, 0x23, 0x03, 0x24, 0x25, 0x11, 0x0F,
+	0x85, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x86, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x03, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0D,
+	0x89, 0x03, 0x00, 0x04, 0xC7, 0x00,
+};
+const ardPort::PackedImage num_1_packed = {32, 51, num_1_palette, num_1_data, 438};
+
+// num_2: 32×51, 40色, 3264 → 590 バイト
+const uint16_t num_2_palette[] = {
+	0x0000, 0x52AA, 0xB596, 0xDEDB, 0xEF7D, 0xFFFF, 0x8410, 0xE71C, 0xF7BE, 0x18E3, 0xC638, 0x9492, 0xA514, 0x6B6D, 0x39E7, 0xD69A,
+	0xBDF7, 0x0020, 0x0841, 0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x3186, 0x1081, 0xA534, 0x9CD3,
+	0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2,
+};
+const uint8_t num_2_data[] = {
+	0xA8, 0x00, 0x03, 0x01, 0x02, 0x03, 0x04, 0x82, 0x05, 0x03, 0x04, 0x03, 0x02, 0x06, 0x90, 0x00, 0x01, 0x06, 0x07, 0x8A, 0x05, 0x02, 0x08, 0x02,
+	0x09, 0x8B, 0x00, 0x01, 0x09, 0x0A, 0x8E, 0x05, 0x01, 0x08, 0x0B, 0x89, 0x00, 0x01, 0x09, 0x07, 0x91, 0x05, 0x00, 0x0A, 0x88, 0x00, 0x00, 0x0A,
+	0x93, 0x05, 0x00, 0x0C, 0x86, 0x00, 0x00, 0x06, 0x95, 0x05, 0x00, 0x0D, 0x85, 0x00, 0x00, 0x04, 0x95, 0x05, 0x00, 0x04, 0x84, 0x00, 0x00, 0x06,
+	0x88, 0x05, 0x04, 0x07, 0x0E, 0x00, 0x0D, 0x08, 0x88, 0x05, 0x00, 0x0B, 0x83, 0x00, 0x00, 0x0A, 0x88, 0x05, 0x00, 0x0E, 0x81, 0x00, 0x00, 0x0B,
+	0x88, 0x05, 0x00, 0x0F, 0x83, 0x00, 0x00, 0x03, 0x87, 0x05, 0x00, 0x07, 0x82, 0x00, 0x00, 0x0E, 0x89, 0x05, 0x83, 0x00, 0x88, 0x05, 0x00, 0x03,
+	0x83, 0x00, 0x89, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x88, 0x05, 0x00, 0x03, 0x83, 0x00, 0x89, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x88, 0x05, 0x00, 0x03,
+	0x82, 0x00, 0x00, 0x0E, 0x89, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x88, 0x05, 0x00, 0x03, 0x82, 0x00, 0x00, 0x0B, 0x89, 0x05, 0x00, 0x0D, 0x82, 0x00,
+	0x88, 0x05, 0x00, 0x03, 0x82, 0x00, 0x00, 0x0A, 0x89, 0x05, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x01, 0x88, 0x05, 0x00, 0x03, 0x81, 0x00, 0x01, 0x09,
+	0x08, 0x89, 0x05, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x0D, 0x88, 0x05, 0x00, 0x03, 0x81, 0x00, 0x00, 0x0B, 0x8A, 0x05, 0x91, 0x00, 0x00, 0x07, 0x89,
+	0x05, 0x00, 0x07, 0x90, 0x00, 0x00, 0x0D, 0x8A, 0x05, 0x00, 0x10, 0x90, 0x00, 0x00, 0x03, 0x8A, 0x05, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x0D, 0x8A,
+	0x05, 0x00, 0x04, 0x90, 0x00, 0x00, 0x03, 0x8A, 0x05, 0x00, 0x0C, 0x82, 0x00, 0x01, 0x11, 0x12, 0x89, 0x00, 0x00, 0x0B, 0x8A, 0x05, 0x01, 0x08,
+	0x09, 0x80, 0x13, 0x04, 0x14, 0x15, 0x16, 0x17, 0x13, 0x96, 0x18, 0x04, 0x00, 0x19, 0x1A, 0x01, 0x1B, 0x80, 0x18, 0x00, 0x12, 0x96, 0x1C, 0x00,
+	0x1D, 0x80, 0x1E, 0x01, 0x1F, 0x18, 0x80, 0x20, 0x00, 0x21, 0x96, 0x1C, 0x00, 0x21, 0x80, 0x22, 0x01, 0x23, 0x19, 0x80, 0x24, 0x00, 0x00, 0x96,
+	0x18, 0x00, 0x13, 0x80, 0x25, 0x03, 0x26, 0x27, 0x14, 0x12, 0x86, 0x00, 0x00, 0x0E, 0x8B, 0x05, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x12, 0x89, 0x00,
+	0x00, 0x03, 0x8A, 0x05, 0x00, 0x0A, 0x8F, 0x00, 0x00, 0x0D, 0x8A, 0x05, 0x01, 0x08, 0x09, 0x8F, 0x00, 0x00, 0x04, 0x8A, 0x05, 0x00, 0x0C, 0x8F,
+	0x00, 0x00, 0x0C, 0x8A, 0x05, 0x00, 0x03, 0x8F, 0x00, 0x01, 0x09, 0x08, 0x8A, 0x05, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x10, 0x8A, 0x05, 0x00, 0x02,
+	0x8F, 0x00, 0x00, 0x0E, 0x8A, 0x05, 0x01, 0x04, 0x09, 0x8F, 0x00, 0x00, 0x03, 0x8A, 0x05, 0x00, 0x0D, 0x8F, 0x00, 0x00, 0x06, 0x8A, 0x05, 0x00,
+	0x10, 0x90, 0x00, 0x00, 0x04, 0x89, 0x05, 0x01, 0x04, 0x09, 0x8F, 0x00, 0x00, 0x02, 0x8A, 0x05, 0x00, 0x06, 0x8F, 0x00, 0x01, 0x0E, 0x08, 0x89,
+	0x05, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x89, 0x05, 0x01, 0x08, 0x09, 0x8F, 0x00, 0x00, 0x0D, 0x8A, 0x05, 0x00, 0x06, 0x90, 0x00, 0x00, 0x07,
+	0x97, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x0D, 0x98, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x0D, 0x98, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x0D,
+	0x98, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x0D, 0x98, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x0D, 0x98, 0x05, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x0D,
+	0x98, 0x05, 0x00, 0x0D, 0xA0, 0x00,
+};
+const ardPort::PackedImage num_2_packed = {32, 51, num_2_palette, num_2_data, 510};
+
+// num_3: 32×51, 39色, 3264 → 694 バイト
+const uint16_t num_3_palette[] = {
+	0x0000, 0x18E3, 0x8410, 0xB596, 0xDEDB, 0xE71C, 0xFFFF, 0x39E7, 0xC638, 0xF7BE, 0x9492, 0xA514, 0x6B6D, 0xEF7D, 0x0020, 0x0841,
+	0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x52AA, 0x94B2, 0x3186, 0x1081, 0xA534, 0x9CD3, 0xA4F3, 0x0840,
+	0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2, 0xBDF7,
+};
+const uint8_t num_3_data[] = {
+	0xA5, 0x00, 0x04, 0x01, 0x02, 0x03, 0x04, 0x05, 0x84, 0x06, 0x80, 0x04, 0x02, 0x03, 0x02, 0x01, 0x8C, 0x00, 0x02, 0x07, 0x08, 0x09, 0x8D, 0x06,
+	0x01, 0x08, 0x07, 0x89, 0x00, 0x01, 0x0A, 0x09, 0x91, 0x06, 0x00, 0x03, 0x87, 0x00, 0x00, 0x02, 0x94, 0x06, 0x00, 0x08, 0x85, 0x00, 0x01, 0x01,
+	0x09, 0x95, 0x06, 0x00, 0x02, 0x84, 0x00, 0x00, 0x0B, 0x96, 0x06, 0x01, 0x09, 0x01, 0x83, 0x00, 0x00, 0x05, 0x97, 0x06, 0x00, 0x0B, 0x83, 0x00,
+	0x8A, 0x06, 0x03, 0x0B, 0x00, 0x07, 0x05, 0x88, 0x06, 0x00, 0x05, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x02, 0x89,
+	0x06, 0x00, 0x01, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x07, 0x89, 0x06, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x03, 0x89,
+	0x06, 0x00, 0x04, 0x82, 0x00, 0x89, 0x06, 0x00, 0x0B, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x82, 0x00, 0x89, 0x06, 0x00, 0x03, 0x81,
+	0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x82, 0x00, 0x89, 0x06, 0x00, 0x03, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x82, 0x00, 0x89,
+	0x06, 0x00, 0x03, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x82, 0x00, 0x89, 0x06, 0x00, 0x03, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00,
+	0x04, 0x82, 0x00, 0x89, 0x06, 0x00, 0x03, 0x92, 0x00, 0x89, 0x06, 0x00, 0x03, 0x91, 0x00, 0x00, 0x07, 0x89, 0x06, 0x00, 0x0C, 0x91, 0x00, 0x00,
+	0x02, 0x89, 0x06, 0x00, 0x07, 0x91, 0x00, 0x00, 0x08, 0x88, 0x06, 0x00, 0x04, 0x8F, 0x00, 0x02, 0x01, 0x0C, 0x03, 0x89, 0x06, 0x00, 0x0C, 0x8B,
+	0x00, 0x00, 0x0C, 0x8E, 0x06, 0x01, 0x0A, 0x0E, 0x82, 0x00, 0x01, 0x0E, 0x0F, 0x85, 0x00, 0x00, 0x0C, 0x8C, 0x06, 0x01, 0x0D, 0x0C, 0x80, 0x00,
+	0x80, 0x10, 0x04, 0x11, 0x12, 0x13, 0x14, 0x10, 0x96, 0x15, 0x04, 0x00, 0x16, 0x17, 0x18, 0x19, 0x80, 0x15, 0x00, 0x0F, 0x96, 0x1A, 0x00, 0x1B,
+	0x80, 0x1C, 0x01, 0x1D, 0x15, 0x80, 0x1E, 0x00, 0x1F, 0x96, 0x1A, 0x00, 0x1F, 0x80, 0x20, 0x01, 0x21, 0x16, 0x80, 0x22, 0x00, 0x00, 0x96, 0x15,
+	0x00, 0x10, 0x80, 0x23, 0x03, 0x24, 0x25, 0x11, 0x0F, 0x85, 0x00, 0x00, 0x0C, 0x90, 0x06, 0x80, 0x00, 0x00, 0x0F, 0x8B, 0x00, 0x03, 0x18, 0x0C,
+	0x26, 0x09, 0x8A, 0x06, 0x00, 0x02, 0x90, 0x00, 0x00, 0x18, 0x8A, 0x06, 0x00, 0x03, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00,
+	0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x09, 0x81, 0x00,
+	0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x8A, 0x06, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C,
+	0x8A, 0x06, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x8A, 0x06, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06, 0x00, 0x04,
+	0x81, 0x00, 0x00, 0x0C, 0x8A, 0x06, 0x81, 0x00, 0x00, 0x02, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x8A, 0x06, 0x81, 0x00, 0x00, 0x0C,
+	0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C,
+	0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x07, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x08, 0x82, 0x00, 0x89, 0x06,
+	0x00, 0x04, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x03, 0x82, 0x00, 0x00, 0x05, 0x88, 0x06, 0x00, 0x05, 0x81, 0x00, 0x00, 0x03, 0x89, 0x06,
+	0x00, 0x0C, 0x82, 0x00, 0x00, 0x08, 0x89, 0x06, 0x03, 0x0A, 0x00, 0x07, 0x0D, 0x88, 0x06, 0x00, 0x09, 0x83, 0x00, 0x00, 0x0C, 0x97, 0x06, 0x00,
+	0x08, 0x84, 0x00, 0x00, 0x04, 0x96, 0x06, 0x00, 0x07, 0x84, 0x00, 0x01, 0x07, 0x09, 0x94, 0x06, 0x00, 0x03, 0x86, 0x00, 0x01, 0x18, 0x09, 0x92,
+	0x06, 0x00, 0x08, 0x88, 0x00, 0x01, 0x07, 0x04, 0x90, 0x06, 0x00, 0x03, 0x8B, 0x00, 0x01, 0x0A, 0x05, 0x8C, 0x06, 0x01, 0x08, 0x07, 0x8E, 0x00,
+	0x04, 0x07, 0x0B, 0x08, 0x04, 0x09, 0x82, 0x06, 0x04, 0x0D, 0x04, 0x26, 0x02, 0x01, 0x87, 0x00,
+};
+const ardPort::PackedImage num_3_packed = {32, 51, num_3_palette, num_3_data, 616};
+
+// num_4: 32×51, 40色, 3264 → 586 バイト
+const uint16_t num_4_palette[] = {
+	0x0000, 0x9492, 0xFFFF, 0xDEDB, 0xD69A, 0x18E3, 0xC638, 0xF7BE, 0x8410, 0xA514, 0xEF7D, 0x6B6D, 0x39E7, 0x0020, 0x0841, 0x1082,
+	0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x52AA, 0x94B2, 0x3186, 0x1081, 0xA534, 0x9CD3, 0xA4F3, 0x0840, 0x9CD2,
+	0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2, 0xE71C, 0xB596, 0xBDF7,
+};
+const uint8_t num_4_data[] = {
+	0xC9, 0x00, 0x00, 0x01, 0x8D, 0x02, 0x00, 0x03, 0x8D, 0x00, 0x00, 0x04, 0x8D, 0x02, 0x00, 0x03, 0x8C, 0x00, 0x00, 0x05, 0x8E, 0x02, 0x00, 0x03,
+	0x8C, 0x00, 0x00, 0x01, 0x8E, 0x02, 0x00, 0x03, 0x8C, 0x00, 0x00, 0x04, 0x8E, 0x02, 0x00, 0x03, 0x8B, 0x00, 0x00, 0x05, 0x8F, 0x02, 0x00, 0x03,
+	0x8B, 0x00, 0x00, 0x01, 0x8F, 0x02, 0x00, 0x03, 0x8B, 0x00, 0x00, 0x04, 0x8F, 0x02, 0x00, 0x03, 0x8A, 0x00, 0x00, 0x05, 0x90, 0x02, 0x00, 0x03,
+	0x8A, 0x00, 0x00, 0x01, 0x90, 0x02, 0x00, 0x03, 0x8A, 0x00, 0x00, 0x06, 0x90, 0x02, 0x00, 0x03, 0x8A, 0x00, 0x00, 0x07, 0x84, 0x02, 0x00, 0x07,
+	0x89, 0x02, 0x00, 0x03, 0x89, 0x00, 0x00, 0x08, 0x85, 0x02, 0x00, 0x04, 0x89, 0x02, 0x00, 0x03, 0x89, 0x00, 0x00, 0x06, 0x85, 0x02, 0x00, 0x09,
+	0x89, 0x02, 0x00, 0x03, 0x89, 0x00, 0x00, 0x07, 0x84, 0x02, 0x01, 0x0A, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x88, 0x00, 0x00, 0x08, 0x85, 0x02, 0x01,
+	0x06, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x88, 0x00, 0x00, 0x06, 0x85, 0x02, 0x01, 0x01, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x88, 0x00, 0x00, 0x07, 0x85,
+	0x02, 0x01, 0x0C, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x87, 0x00, 0x00, 0x08, 0x85, 0x02, 0x02, 0x0A, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x87, 0x00,
+	0x00, 0x06, 0x85, 0x02, 0x02, 0x06, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x87, 0x00, 0x00, 0x07, 0x85, 0x02, 0x02, 0x01, 0x00, 0x0B, 0x89, 0x02,
+	0x01, 0x03, 0x0D, 0x82, 0x00, 0x03, 0x0D, 0x0E, 0x00, 0x08, 0x86, 0x02, 0x02, 0x05, 0x00, 0x0B, 0x89, 0x02, 0x01, 0x03, 0x00, 0x80, 0x0F, 0x04,
+	0x10, 0x11, 0x12, 0x13, 0x0F, 0x96, 0x14, 0x04, 0x00, 0x15, 0x16, 0x17, 0x18, 0x80, 0x14, 0x00, 0x0E, 0x96, 0x19, 0x00, 0x1A, 0x80, 0x1B, 0x01,
+	0x1C, 0x14, 0x80, 0x1D, 0x00, 0x1E, 0x96, 0x19, 0x00, 0x1E, 0x80, 0x1F, 0x01, 0x20, 0x15, 0x80, 0x21, 0x00, 0x00, 0x96, 0x14, 0x00, 0x0F, 0x80,
+	0x22, 0x04, 0x23, 0x24, 0x10, 0x0E, 0x0A, 0x85, 0x02, 0x00, 0x25, 0x81, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x81, 0x00, 0x00, 0x0E, 0x80,
+	0x00, 0x01, 0x16, 0x07, 0x85, 0x02, 0x00, 0x26, 0x81, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x27, 0x86, 0x02, 0x00, 0x0B,
+	0x81, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x0A, 0x86, 0x02, 0x82, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x83, 0x00,
+	0x00, 0x17, 0x86, 0x02, 0x00, 0x03, 0x82, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x83, 0x00, 0x00, 0x27, 0x86, 0x02, 0x00, 0x26, 0x82, 0x00,
+	0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x83, 0x00, 0x00, 0x03, 0x9B, 0x02, 0x02, 0x0B, 0x00, 0x03, 0x9B, 0x02, 0x02, 0x0B, 0x00, 0x03, 0x9B, 0x02,
+	0x02, 0x0B, 0x00, 0x03, 0x9B, 0x02, 0x02, 0x0B, 0x00, 0x03, 0x9B, 0x02, 0x02, 0x0B, 0x00, 0x03, 0x9B, 0x02, 0x02, 0x0B, 0x00, 0x03, 0x9B, 0x02,
+	0x02, 0x0B, 0x00, 0x03, 0x9B, 0x02, 0x00, 0x0B, 0x8D, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03,
+	0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03,
+	0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03, 0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x03,
+	0xA2, 0x00,
+};
+const ardPort::PackedImage num_4_packed = {32, 51, num_4_palette, num_4_data, 506};
+
+// num_5: 32×51, 43色, 3264 → 600 バイト
+const uint16_t num_5_palette[] = {
+	0x0000, 0xFFFF, 0x6B6D, 0x8410, 0xD69A, 0xEF7D, 0xE71C, 0xC638, 0x52AA, 0x9492, 0xBDF7, 0xA514, 0x39E7, 0xFFDF, 0xF79E, 0xCE79,
+	0x0020, 0x0861, 0xDEDB, 0x1082, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x0841, 0x3186, 0x1081, 0xA534, 0x9CD3,
+	0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2, 0xB596, 0xF7BE, 0x18E3,
+};
+const uint8_t num_5_data[] = {
+	0xC1, 0x00, 0x98, 0x01, 0x84, 0x00, 0x98, 0x01, 0x84, 0x00, 0x98, 0x01, 0x84, 0x00, 0x98, 0x01, 0x84, 0x00, 0x98, 0x01, 0x84, 0x00, 0x98, 0x01,
+	0x84, 0x00, 0x98, 0x01, 0x84, 0x00, 0x89, 0x01, 0x93, 0x00, 0x89, 0x01, 0x93, 0x00, 0x89, 0x01, 0x93, 0x00, 0x89, 0x01, 0x93, 0x00, 0x89, 0x01,
+	0x92, 0x00, 0x00, 0x02, 0x89, 0x01, 0x92, 0x00, 0x00, 0x02, 0x89, 0x01, 0x81, 0x00, 0x02, 0x03, 0x04, 0x05, 0x81, 0x01, 0x02, 0x06, 0x07, 0x03,
+	0x86, 0x00, 0x00, 0x02, 0x89, 0x01, 0x02, 0x00, 0x08, 0x06, 0x87, 0x01, 0x01, 0x05, 0x03, 0x84, 0x00, 0x00, 0x02, 0x89, 0x01, 0x00, 0x09, 0x8B,
+	0x01, 0x00, 0x09, 0x83, 0x00, 0x00, 0x02, 0x98, 0x01, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x98, 0x01, 0x00, 0x05, 0x82, 0x00, 0x00, 0x02, 0x99,
+	0x01, 0x00, 0x08, 0x81, 0x00, 0x00, 0x02, 0x99, 0x01, 0x00, 0x0A, 0x81, 0x00, 0x00, 0x02, 0x8A, 0x01, 0x03, 0x0B, 0x00, 0x0C, 0x06, 0x87, 0x01,
+	0x02, 0x0D, 0x0E, 0x0F, 0x80, 0x00, 0x01, 0x10, 0x11, 0x89, 0x01, 0x00, 0x12, 0x81, 0x00, 0x00, 0x0C, 0x88, 0x01, 0x80, 0x13, 0x04, 0x11, 0x14,
+	0x15, 0x16, 0x13, 0x96, 0x17, 0x04, 0x00, 0x18, 0x19, 0x08, 0x1A, 0x80, 0x17, 0x00, 0x1B, 0x96, 0x1C, 0x00, 0x1D, 0x80, 0x1E, 0x01, 0x1F, 0x17,
+	0x80, 0x20, 0x00, 0x21, 0x96, 0x1C, 0x00, 0x21, 0x80, 0x22, 0x01, 0x23, 0x18, 0x80, 0x24, 0x00, 0x00, 0x96, 0x17, 0x00, 0x13, 0x80, 0x25, 0x03,
+	0x26, 0x27, 0x11, 0x1B, 0x8E, 0x00, 0x00, 0x12, 0x87, 0x01, 0x80, 0x11, 0x00, 0x13, 0x91, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x91, 0x00,
+	0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x91, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x28, 0x89, 0x01, 0x00, 0x28, 0x82, 0x00,
+	0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x28, 0x89, 0x01, 0x00, 0x28, 0x82, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00,
+	0x00, 0x28, 0x89, 0x01, 0x00, 0x28, 0x82, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x28, 0x89, 0x01, 0x00, 0x28, 0x82, 0x00,
+	0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x28, 0x89, 0x01, 0x00, 0x28, 0x82, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00,
+	0x00, 0x28, 0x89, 0x01, 0x00, 0x28, 0x82, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x89, 0x01, 0x00, 0x0A, 0x82, 0x00,
+	0x00, 0x12, 0x89, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x89, 0x01, 0x00, 0x12, 0x82, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x0C, 0x80, 0x00,
+	0x00, 0x0C, 0x89, 0x01, 0x00, 0x12, 0x82, 0x00, 0x00, 0x06, 0x89, 0x01, 0x82, 0x00, 0x00, 0x29, 0x88, 0x01, 0x00, 0x12, 0x82, 0x00, 0x89, 0x01,
+	0x00, 0x29, 0x82, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x2A, 0x81, 0x00, 0x89, 0x01, 0x00, 0x12, 0x82, 0x00, 0x00, 0x0B, 0x89, 0x01, 0x00, 0x07,
+	0x80, 0x2A, 0x00, 0x07, 0x89, 0x01, 0x00, 0x0B, 0x82, 0x00, 0x01, 0x2A, 0x29, 0x97, 0x01, 0x00, 0x0C, 0x83, 0x00, 0x00, 0x28, 0x96, 0x01, 0x00,
+	0x0A, 0x85, 0x00, 0x00, 0x06, 0x94, 0x01, 0x01, 0x05, 0x2A, 0x85, 0x00, 0x01, 0x2A, 0x06, 0x92, 0x01, 0x01, 0x29, 0x08, 0x87, 0x00, 0x01, 0x2A,
+	0x0A, 0x90, 0x01, 0x01, 0x12, 0x0C, 0x8A, 0x00, 0x02, 0x0C, 0x07, 0x29, 0x8B, 0x01, 0x01, 0x06, 0x09, 0x8F, 0x00, 0x03, 0x03, 0x28, 0x12, 0x06,
+	0x82, 0x01, 0x04, 0x29, 0x12, 0x04, 0x0B, 0x0C, 0x86, 0x00,
+};
+const ardPort::PackedImage num_5_packed = {32, 51, num_5_palette, num_5_data, 514};
+
+// num_6: 32×51, 41色, 3264 → 745 バイト
+const uint16_t num_6_palette[] = {
+	0x0000, 0x18E3, 0x8410, 0xBDF7, 0xDEDB, 0xEF7D, 0xFFFF, 0x9492, 0x39E7, 0xC638, 0xD69A, 0x6B6D, 0xE71C, 0xB596, 0xF7BE, 0xA514,
+	0x52AA, 0x1082, 0x10A2, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x0841, 0x3186, 0x1081, 0xA534, 0x9CD3,
+	0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x0020, 0xF79E,
+};
+const uint8_t num_6_data[] = {
+	0xA7, 0x00, 0x04, 0x01, 0x02, 0x03, 0x04, 0x05, 0x82, 0x06, 0x04, 0x05, 0x04, 0x03, 0x07, 0x01, 0x8E, 0x00, 0x01, 0x08, 0x09, 0x8C, 0x06, 0x01,
+	0x0A, 0x0B, 0x8B, 0x00, 0x00, 0x03, 0x90, 0x06, 0x01, 0x03, 0x01, 0x87, 0x00, 0x01, 0x01, 0x0C, 0x92, 0x06, 0x01, 0x0C, 0x01, 0x86, 0x00, 0x00,
+	0x0C, 0x94, 0x06, 0x00, 0x0C, 0x85, 0x00, 0x00, 0x0D, 0x96, 0x06, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x08, 0x97, 0x06, 0x01, 0x0E, 0x01, 0x82, 0x00,
+	0x00, 0x09, 0x89, 0x06, 0x03, 0x0F, 0x00, 0x08, 0x0A, 0x89, 0x06, 0x00, 0x07, 0x82, 0x00, 0x00, 0x0E, 0x88, 0x06, 0x00, 0x09, 0x81, 0x00, 0x00,
+	0x01, 0x89, 0x06, 0x00, 0x0A, 0x81, 0x00, 0x00, 0x0B, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x88, 0x06, 0x00, 0x0E, 0x81, 0x00, 0x00,
+	0x02, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00,
+	0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00,
+	0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x91, 0x00, 0x00,
+	0x0D, 0x89, 0x06, 0x00, 0x0D, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x91, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x80, 0x00, 0x02,
+	0x08, 0x03, 0x0C, 0x81, 0x06, 0x02, 0x0C, 0x09, 0x0B, 0x86, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x02, 0x0D, 0x00, 0x03, 0x87, 0x06, 0x01, 0x04, 0x10,
+	0x84, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x01, 0x0D, 0x09, 0x8A, 0x06, 0x00, 0x07, 0x83, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0C, 0x8C, 0x06, 0x00,
+	0x02, 0x82, 0x00, 0x00, 0x0D, 0x98, 0x06, 0x01, 0x05, 0x01, 0x81, 0x00, 0x01, 0x11, 0x12, 0x98, 0x06, 0x80, 0x11, 0x04, 0x13, 0x14, 0x15, 0x16,
+	0x11, 0x96, 0x17, 0x04, 0x00, 0x18, 0x19, 0x10, 0x1A, 0x80, 0x17, 0x00, 0x1B, 0x96, 0x1C, 0x00, 0x1D, 0x80, 0x1E, 0x01, 0x1F, 0x17, 0x80, 0x20,
+	0x00, 0x21, 0x96, 0x1C, 0x00, 0x21, 0x80, 0x22, 0x01, 0x23, 0x18, 0x80, 0x24, 0x00, 0x00, 0x96, 0x17, 0x00, 0x11, 0x80, 0x25, 0x03, 0x26, 0x12,
+	0x13, 0x1B, 0x88, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x88, 0x06, 0x06, 0x13, 0x27, 0x1B, 0x00, 0x09, 0x28, 0x0E, 0x87, 0x06, 0x00, 0x0D,
+	0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B,
+	0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D,
+	0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B,
+	0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D,
+	0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B,
+	0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D,
+	0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x0B,
+	0x80, 0x00, 0x00, 0x02, 0x89, 0x06, 0x00, 0x0D, 0x82, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x01, 0x80, 0x00, 0x00, 0x10, 0x89, 0x06, 0x00, 0x03,
+	0x82, 0x00, 0x00, 0x0E, 0x89, 0x06, 0x82, 0x00, 0x00, 0x0E, 0x88, 0x06, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x08, 0x89, 0x06, 0x00, 0x0C, 0x82, 0x00,
+	0x00, 0x09, 0x89, 0x06, 0x03, 0x0F, 0x00, 0x08, 0x0C, 0x89, 0x06, 0x00, 0x03, 0x82, 0x00, 0x00, 0x08, 0x98, 0x06, 0x00, 0x08, 0x83, 0x00, 0x00,
+	0x03, 0x96, 0x06, 0x00, 0x09, 0x84, 0x00, 0x01, 0x01, 0x0C, 0x94, 0x06, 0x01, 0x0C, 0x01, 0x85, 0x00, 0x01, 0x01, 0x0C, 0x92, 0x06, 0x01, 0x05,
+	0x10, 0x87, 0x00, 0x01, 0x01, 0x0A, 0x90, 0x06, 0x01, 0x0A, 0x01, 0x8A, 0x00, 0x01, 0x0B, 0x0A, 0x8C, 0x06, 0x01, 0x04, 0x0B, 0x8E, 0x00, 0x04,
+	0x01, 0x07, 0x03, 0x04, 0x05, 0x82, 0x06, 0x04, 0x0E, 0x04, 0x09, 0x07, 0x08, 0x87, 0x00,
+};
+const ardPort::PackedImage num_6_packed = {32, 51, num_6_palette, num_6_data, 663};
+
+// num_7: 32×51, 40色, 3264 → 494 バイト
+const uint16_t num_7_palette[] = {
+	0x0000, 0xB596, 0xFFFF, 0xD69A, 0xEF7D, 0x18E3, 0x6B6D, 0xDEDB, 0xF7BE, 0x39E7, 0x8410, 0x52AA, 0x9492, 0x0020, 0x0841, 0xBDF7,
+	0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x3186, 0x1081, 0xA534, 0x9CD3, 0xA4F3, 0x0840, 0x9CD2,
+	0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2, 0xC638, 0xE71C, 0xA514,
+};
+const uint8_t num_7_data[] = {
+	0xC2, 0x00, 0x00, 0x01, 0x94, 0x02, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x94, 0x02, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x94, 0x02, 0x00, 0x01,
+	0x86, 0x00, 0x00, 0x01, 0x94, 0x02, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x94, 0x02, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x94, 0x02, 0x00, 0x01,
+	0x86, 0x00, 0x00, 0x01, 0x94, 0x02, 0x00, 0x01, 0x92, 0x00, 0x00, 0x03, 0x88, 0x02, 0x00, 0x01, 0x92, 0x00, 0x00, 0x04, 0x88, 0x02, 0x00, 0x01,
+	0x91, 0x00, 0x00, 0x05, 0x89, 0x02, 0x00, 0x01, 0x91, 0x00, 0x00, 0x06, 0x89, 0x02, 0x00, 0x06, 0x91, 0x00, 0x00, 0x01, 0x89, 0x02, 0x00, 0x05,
+	0x91, 0x00, 0x00, 0x07, 0x88, 0x02, 0x00, 0x04, 0x92, 0x00, 0x00, 0x08, 0x88, 0x02, 0x00, 0x03, 0x91, 0x00, 0x00, 0x09, 0x89, 0x02, 0x00, 0x01,
+	0x91, 0x00, 0x00, 0x0A, 0x89, 0x02, 0x00, 0x06, 0x91, 0x00, 0x00, 0x01, 0x89, 0x02, 0x00, 0x05, 0x91, 0x00, 0x00, 0x07, 0x88, 0x02, 0x00, 0x08,
+	0x92, 0x00, 0x00, 0x08, 0x88, 0x02, 0x00, 0x07, 0x91, 0x00, 0x00, 0x0B, 0x89, 0x02, 0x00, 0x01, 0x91, 0x00, 0x00, 0x0C, 0x89, 0x02, 0x00, 0x0A,
+	0x80, 0x00, 0x00, 0x0D, 0x82, 0x00, 0x01, 0x0D, 0x0E, 0x88, 0x00, 0x00, 0x0F, 0x89, 0x02, 0x00, 0x09, 0x81, 0x00, 0x80, 0x10, 0x04, 0x11, 0x12,
+	0x13, 0x14, 0x10, 0x96, 0x15, 0x04, 0x00, 0x16, 0x17, 0x0B, 0x18, 0x80, 0x15, 0x00, 0x0E, 0x96, 0x19, 0x00, 0x1A, 0x80, 0x1B, 0x01, 0x1C, 0x15,
+	0x80, 0x1D, 0x00, 0x1E, 0x96, 0x19, 0x00, 0x1E, 0x80, 0x1F, 0x01, 0x20, 0x16, 0x80, 0x21, 0x00, 0x00, 0x96, 0x15, 0x00, 0x10, 0x80, 0x22, 0x03,
+	0x23, 0x24, 0x11, 0x0E, 0x87, 0x00, 0x00, 0x25, 0x89, 0x02, 0x00, 0x09, 0x84, 0x00, 0x00, 0x0E, 0x8A, 0x00, 0x00, 0x26, 0x88, 0x02, 0x00, 0x08,
+	0x92, 0x00, 0x89, 0x02, 0x00, 0x07, 0x91, 0x00, 0x00, 0x06, 0x89, 0x02, 0x00, 0x0F, 0x91, 0x00, 0x00, 0x27, 0x89, 0x02, 0x00, 0x0C, 0x91, 0x00,
+	0x00, 0x25, 0x89, 0x02, 0x00, 0x0B, 0x91, 0x00, 0x00, 0x04, 0x89, 0x02, 0x91, 0x00, 0x00, 0x05, 0x89, 0x02, 0x00, 0x07, 0x91, 0x00, 0x00, 0x06,
+	0x89, 0x02, 0x00, 0x0F, 0x91, 0x00, 0x00, 0x01, 0x89, 0x02, 0x00, 0x0C, 0x91, 0x00, 0x00, 0x03, 0x89, 0x02, 0x00, 0x0B, 0x91, 0x00, 0x00, 0x04,
+	0x89, 0x02, 0x91, 0x00, 0x00, 0x05, 0x89, 0x02, 0x00, 0x07, 0x91, 0x00, 0x00, 0x0A, 0x89, 0x02, 0x00, 0x0F, 0x91, 0x00, 0x00, 0x01, 0x89, 0x02,
+	0x00, 0x27, 0x91, 0x00, 0x00, 0x07, 0x89, 0x02, 0x00, 0x06, 0x91, 0x00, 0x00, 0x08, 0x89, 0x02, 0x91, 0x00, 0x00, 0x09, 0x89, 0x02, 0x00, 0x26,
+	0x91, 0x00, 0x00, 0x0A, 0x89, 0x02, 0x00, 0x25, 0x91, 0x00, 0x00, 0x01, 0x89, 0x02, 0x00, 0x27, 0x91, 0x00, 0x00, 0x07, 0x89, 0x02, 0x00, 0x06,
+	0x91, 0x00, 0x8A, 0x02, 0xAA, 0x00,
+};
+const ardPort::PackedImage num_7_packed = {32, 51, num_7_palette, num_7_data, 414};
+
+// num_8: 32×51, 41色, 3264 → 768 バイト
+const uint16_t num_8_palette[] = {
+	0x0000, 0x52AA, 0xB596, 0xD69A, 0xE71C, 0xFFFF, 0xDEDB, 0xBDF7, 0x8410, 0x18E3, 0x9492, 0xEF7D, 0xC638, 0x39E7, 0xF7BE, 0xA514,
+	0x6B6D, 0x0020, 0x0841, 0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x3186, 0x1081, 0xA534, 0x9CD3,
+	0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2, 0x6B4D,
+};
+const uint8_t num_8_data[] = {
+	0xA8, 0x00, 0x03, 0x01, 0x02, 0x03, 0x04, 0x83, 0x05, 0x04, 0x04, 0x06, 0x07, 0x08, 0x09, 0x8E, 0x00, 0x01, 0x0A, 0x0B, 0x8C, 0x05, 0x01, 0x0C,
+	0x0D, 0x8A, 0x00, 0x01, 0x01, 0x04, 0x90, 0x05, 0x00, 0x0A, 0x88, 0x00, 0x01, 0x01, 0x0E, 0x92, 0x05, 0x00, 0x0F, 0x86, 0x00, 0x01, 0x09, 0x0E,
+	0x94, 0x05, 0x00, 0x10, 0x85, 0x00, 0x00, 0x0C, 0x95, 0x05, 0x00, 0x0B, 0x84, 0x00, 0x00, 0x0D, 0x97, 0x05, 0x00, 0x08, 0x83, 0x00, 0x00, 0x07,
+	0x89, 0x05, 0x03, 0x0A, 0x00, 0x10, 0x0E, 0x88, 0x05, 0x00, 0x0C, 0x83, 0x00, 0x00, 0x04, 0x88, 0x05, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0x88,
+	0x05, 0x00, 0x0E, 0x83, 0x00, 0x89, 0x05, 0x00, 0x03, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00,
+	0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00,
+	0x0A, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x02, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00,
+	0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x02, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00,
+	0x02, 0x81, 0x00, 0x00, 0x01, 0x89, 0x05, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x10, 0x82, 0x00, 0x89, 0x05, 0x00, 0x02, 0x81,
+	0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x10, 0x82, 0x00, 0x00, 0x06, 0x88, 0x05, 0x00, 0x03, 0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x83, 0x00, 0x00,
+	0x0A, 0x88, 0x05, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0x88, 0x05, 0x00, 0x0C, 0x84, 0x00, 0x00, 0x0B, 0x88, 0x05, 0x03, 0x0A, 0x00, 0x10, 0x0E,
+	0x87, 0x05, 0x01, 0x0E, 0x0D, 0x84, 0x00, 0x00, 0x08, 0x94, 0x05, 0x01, 0x0E, 0x01, 0x86, 0x00, 0x00, 0x0A, 0x92, 0x05, 0x02, 0x04, 0x0D, 0x11,
+	0x82, 0x00, 0x01, 0x11, 0x12, 0x81, 0x00, 0x00, 0x10, 0x90, 0x05, 0x01, 0x04, 0x09, 0x80, 0x00, 0x80, 0x13, 0x04, 0x14, 0x15, 0x16, 0x17, 0x13,
+	0x96, 0x18, 0x04, 0x00, 0x19, 0x1A, 0x01, 0x1B, 0x80, 0x18, 0x00, 0x12, 0x96, 0x1C, 0x00, 0x1D, 0x80, 0x1E, 0x01, 0x1F, 0x18, 0x80, 0x20, 0x00,
+	0x21, 0x96, 0x1C, 0x00, 0x21, 0x80, 0x22, 0x01, 0x23, 0x19, 0x80, 0x24, 0x00, 0x00, 0x96, 0x18, 0x00, 0x13, 0x80, 0x25, 0x03, 0x26, 0x27, 0x14,
+	0x12, 0x89, 0x05, 0x04, 0x0E, 0x10, 0x00, 0x10, 0x0E, 0x88, 0x05, 0x02, 0x14, 0x11, 0x12, 0x80, 0x00, 0x01, 0x28, 0x0E, 0x88, 0x05, 0x00, 0x07,
+	0x81, 0x00, 0x00, 0x07, 0x89, 0x05, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x0F, 0x89, 0x05, 0x00, 0x02, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x02,
+	0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x05, 0x00, 0x10,
+	0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06, 0x81, 0x00, 0x00, 0x06, 0x89, 0x05, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06,
+	0x81, 0x00, 0x00, 0x06, 0x89, 0x05, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06, 0x81, 0x00, 0x00, 0x06, 0x89, 0x05, 0x00, 0x10,
+	0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06, 0x81, 0x00, 0x00, 0x06, 0x89, 0x05, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06,
+	0x81, 0x00, 0x00, 0x06, 0x89, 0x05, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06, 0x81, 0x00, 0x00, 0x06, 0x89, 0x05, 0x00, 0x10,
+	0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06, 0x81, 0x00, 0x00, 0x0C, 0x89, 0x05, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06,
+	0x81, 0x00, 0x00, 0x02, 0x89, 0x05, 0x00, 0x08, 0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x06, 0x81, 0x00, 0x00, 0x0A, 0x89, 0x05, 0x00, 0x02,
+	0x81, 0x00, 0x00, 0x10, 0x89, 0x05, 0x00, 0x07, 0x81, 0x00, 0x00, 0x01, 0x89, 0x05, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x0F, 0x89, 0x05, 0x00, 0x0F,
+	0x82, 0x00, 0x00, 0x0E, 0x89, 0x05, 0x03, 0x10, 0x00, 0x0D, 0x0B, 0x89, 0x05, 0x00, 0x01, 0x82, 0x00, 0x00, 0x0C, 0x97, 0x05, 0x00, 0x0B, 0x83,
+	0x00, 0x00, 0x0D, 0x97, 0x05, 0x00, 0x0A, 0x84, 0x00, 0x00, 0x0F, 0x95, 0x05, 0x00, 0x06, 0x86, 0x00, 0x00, 0x07, 0x93, 0x05, 0x01, 0x04, 0x09,
+	0x87, 0x00, 0x01, 0x0A, 0x0E, 0x90, 0x05, 0x01, 0x07, 0x09, 0x89, 0x00, 0x02, 0x09, 0x02, 0x0E, 0x8C, 0x05, 0x01, 0x0C, 0x01, 0x8E, 0x00, 0x03,
+	0x08, 0x02, 0x06, 0x04, 0x83, 0x05, 0x04, 0x04, 0x06, 0x07, 0x08, 0x09, 0x86, 0x00,
+};
+const ardPort::PackedImage num_8_packed = {32, 51, num_8_palette, num_8_data, 686};
+
+// num_9: 32×51, 44色, 3264 → 699 バイト
+const uint16_t num_9_palette[] = {
+	0x0000, 0x18E3, 0x9492, 0xBDF7, 0xDEDB, 0xF7BE, 0xFFFF, 0xC638, 0xA514, 0x39E7, 0xE71C, 0x52AA, 0x6B6D, 0xB596, 0xFFDF, 0xF79E,
+	0xCE79, 0x0020, 0x10A2, 0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x0841, 0x3186, 0x1081, 0xA534,
+	0x9CD3, 0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0xD6BA, 0xD69A, 0xEF7D, 0x8410,
+};
+const uint8_t num_9_data[] = {
+	0xA7, 0x00, 0x04, 0x01, 0x02, 0x03, 0x04, 0x05, 0x82, 0x06, 0x04, 0x05, 0x04, 0x07, 0x08, 0x09, 0x8E, 0x00, 0x01, 0x09, 0x07, 0x8C, 0x06, 0x01,
+	0x04, 0x02, 0x8B, 0x00, 0x00, 0x03, 0x90, 0x06, 0x01, 0x04, 0x09, 0x87, 0x00, 0x01, 0x01, 0x0A, 0x92, 0x06, 0x01, 0x05, 0x0B, 0x86, 0x00, 0x00,
+	0x04, 0x94, 0x06, 0x01, 0x05, 0x09, 0x84, 0x00, 0x00, 0x08, 0x96, 0x06, 0x00, 0x04, 0x83, 0x00, 0x01, 0x01, 0x05, 0x97, 0x06, 0x00, 0x02, 0x82,
+	0x00, 0x00, 0x02, 0x89, 0x06, 0x03, 0x05, 0x0C, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x07, 0x89, 0x06, 0x00, 0x02, 0x81, 0x00,
+	0x00, 0x07, 0x89, 0x06, 0x00, 0x0B, 0x81, 0x00, 0x00, 0x04, 0x89, 0x06, 0x00, 0x01, 0x81, 0x00, 0x00, 0x08, 0x89, 0x06, 0x00, 0x08, 0x81, 0x00,
+	0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x0D, 0x81, 0x00, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x07, 0x81, 0x00,
+	0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00,
+	0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x80, 0x00,
+	0x00, 0x09, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x80, 0x00, 0x00, 0x0C, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06,
+	0x00, 0x04, 0x80, 0x00, 0x00, 0x0C, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x80, 0x00, 0x00, 0x0C, 0x8A, 0x06, 0x82, 0x00,
+	0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x80, 0x00, 0x00, 0x01, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x8A, 0x06,
+	0x82, 0x00, 0x00, 0x0C, 0x87, 0x06, 0x02, 0x0E, 0x0F, 0x10, 0x80, 0x00, 0x01, 0x11, 0x12, 0x89, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x88, 0x06, 0x80,
+	0x13, 0x04, 0x14, 0x15, 0x16, 0x17, 0x13, 0x96, 0x18, 0x04, 0x00, 0x19, 0x1A, 0x0B, 0x1B, 0x80, 0x18, 0x00, 0x1C, 0x96, 0x1D, 0x00, 0x1E, 0x80,
+	0x1F, 0x01, 0x20, 0x18, 0x80, 0x21, 0x00, 0x22, 0x96, 0x1D, 0x00, 0x22, 0x80, 0x23, 0x01, 0x24, 0x19, 0x80, 0x25, 0x00, 0x00, 0x96, 0x18, 0x00,
+	0x13, 0x80, 0x26, 0x03, 0x27, 0x12, 0x14, 0x1C, 0x98, 0x06, 0x00, 0x14, 0x80, 0x1C, 0x81, 0x00, 0x00, 0x28, 0x98, 0x06, 0x00, 0x04, 0x82, 0x00,
+	0x01, 0x0B, 0x05, 0x8B, 0x06, 0x00, 0x04, 0x89, 0x06, 0x00, 0x04, 0x83, 0x00, 0x01, 0x0B, 0x05, 0x89, 0x06, 0x01, 0x0A, 0x0C, 0x89, 0x06, 0x00,
+	0x04, 0x84, 0x00, 0x01, 0x01, 0x29, 0x87, 0x06, 0x02, 0x04, 0x01, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x86, 0x00, 0x02, 0x0B, 0x03, 0x04, 0x81, 0x06,
+	0x02, 0x2A, 0x07, 0x0C, 0x80, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0C,
+	0x89, 0x06, 0x00, 0x04, 0x91, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04,
+	0x81, 0x00, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x04, 0x81, 0x00, 0x8A, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x07,
+	0x81, 0x00, 0x00, 0x2A, 0x89, 0x06, 0x82, 0x00, 0x00, 0x0C, 0x89, 0x06, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x04, 0x89, 0x06, 0x82, 0x00, 0x00, 0x0C,
+	0x89, 0x06, 0x00, 0x08, 0x81, 0x00, 0x00, 0x0D, 0x89, 0x06, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x08, 0x89, 0x06, 0x00, 0x09, 0x81, 0x00, 0x00, 0x0B,
+	0x89, 0x06, 0x04, 0x0A, 0x0B, 0x00, 0x0C, 0x05, 0x88, 0x06, 0x00, 0x0A, 0x83, 0x00, 0x00, 0x04, 0x97, 0x06, 0x00, 0x2B, 0x83, 0x00, 0x00, 0x0C,
+	0x96, 0x06, 0x00, 0x04, 0x85, 0x00, 0x00, 0x03, 0x94, 0x06, 0x01, 0x2A, 0x01, 0x86, 0x00, 0x00, 0x07, 0x92, 0x06, 0x01, 0x2A, 0x0B, 0x88, 0x00,
+	0x00, 0x08, 0x90, 0x06, 0x01, 0x29, 0x01, 0x8A, 0x00, 0x02, 0x09, 0x07, 0x05, 0x8B, 0x06, 0x01, 0x29, 0x0C, 0x8F, 0x00, 0x03, 0x2B, 0x03, 0x04,
+	0x0A, 0x82, 0x06, 0x04, 0x05, 0x04, 0x07, 0x02, 0x09, 0x87, 0x00,
+};
+const ardPort::PackedImage num_9_packed = {32, 51, num_9_palette, num_9_data, 611};
+
+// num_10: 32×51, 41色, 3264 → 853 バイト
+const uint16_t num_10_palette[] = {
+	0x0000, 0xB596, 0xEF7D, 0xFFFF, 0xE71C, 0xA514, 0xF7BE, 0x18E3, 0x8410, 0x52AA, 0x9492, 0x39E7, 0xDEDB, 0x6B6D, 0xBDF7, 0xC638,
+	0xFFDF, 0xF79E, 0x0020, 0x0841, 0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x3186, 0x1081, 0xA534,
+	0x9CD3, 0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2,
+};
+const uint8_t num_10_data[] = {
+	0xB1, 0x00, 0x01, 0x01, 0x02, 0x80, 0x03, 0x01, 0x04, 0x05, 0x8D, 0x00, 0x00, 0x04, 0x82, 0x03, 0x82, 0x00, 0x01, 0x01, 0x06, 0x84, 0x03, 0x00,
+	0x04, 0x8B, 0x00, 0x00, 0x07, 0x83, 0x03, 0x81, 0x00, 0x00, 0x08, 0x87, 0x03, 0x01, 0x04, 0x09, 0x88, 0x00, 0x01, 0x07, 0x04, 0x83, 0x03, 0x81,
+	0x00, 0x8A, 0x03, 0x88, 0x00, 0x00, 0x06, 0x84, 0x03, 0x80, 0x00, 0x00, 0x0A, 0x8A, 0x03, 0x00, 0x0A, 0x85, 0x00, 0x01, 0x0B, 0x0C, 0x85, 0x03,
+	0x80, 0x00, 0x8B, 0x03, 0x00, 0x06, 0x84, 0x00, 0x00, 0x0D, 0x87, 0x03, 0x80, 0x00, 0x8C, 0x03, 0x82, 0x00, 0x01, 0x0D, 0x0E, 0x88, 0x03, 0x01,
+	0x00, 0x07, 0x84, 0x03, 0x01, 0x07, 0x00, 0x84, 0x03, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0E, 0x8A, 0x03, 0x01, 0x00, 0x08, 0x84, 0x03, 0x80, 0x00,
+	0x84, 0x03, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0C, 0x8A, 0x03, 0x01, 0x00, 0x01, 0x84, 0x03, 0x80, 0x00, 0x84, 0x03, 0x00, 0x0C, 0x80, 0x00, 0x00,
+	0x0C, 0x8A, 0x03, 0x01, 0x00, 0x0C, 0x84, 0x03, 0x80, 0x00, 0x00, 0x04, 0x83, 0x03, 0x00, 0x06, 0x80, 0x00, 0x00, 0x0C, 0x8A, 0x03, 0x01, 0x00,
+	0x04, 0x84, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x8A, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84,
+	0x03, 0x80, 0x00, 0x00, 0x0C, 0x8A, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x83, 0x00, 0x01, 0x0D, 0x02, 0x86, 0x03,
+	0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x84, 0x00, 0x01, 0x07, 0x06, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00,
+	0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x0F, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85,
+	0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00,
+	0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85,
+	0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00,
+	0x0C, 0x82, 0x03, 0x01, 0x10, 0x11, 0x81, 0x00, 0x01, 0x12, 0x13, 0x80, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00,
+	0x0C, 0x83, 0x03, 0x80, 0x14, 0x04, 0x15, 0x16, 0x17, 0x18, 0x14, 0x96, 0x19, 0x04, 0x00, 0x1A, 0x1B, 0x09, 0x1C, 0x80, 0x19, 0x00, 0x13, 0x96,
+	0x1D, 0x00, 0x1E, 0x80, 0x1F, 0x01, 0x20, 0x19, 0x80, 0x21, 0x00, 0x22, 0x96, 0x1D, 0x00, 0x22, 0x80, 0x23, 0x01, 0x24, 0x1A, 0x80, 0x25, 0x00,
+	0x00, 0x96, 0x19, 0x00, 0x14, 0x80, 0x26, 0x03, 0x27, 0x28, 0x15, 0x13, 0x80, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00,
+	0x00, 0x0C, 0x83, 0x03, 0x02, 0x15, 0x00, 0x13, 0x83, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03,
+	0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00,
+	0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03,
+	0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00,
+	0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03,
+	0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00,
+	0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03,
+	0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x80, 0x00, 0x00, 0x0C, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x01, 0x00,
+	0x0C, 0x84, 0x03, 0x80, 0x00, 0x00, 0x04, 0x84, 0x03, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x01, 0x00, 0x0F, 0x84, 0x03, 0x80, 0x00, 0x84, 0x03,
+	0x00, 0x0C, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x01, 0x00, 0x0A, 0x84, 0x03, 0x80, 0x00, 0x84, 0x03, 0x00, 0x0F, 0x85, 0x00, 0x00, 0x01, 0x85,
+	0x03, 0x01, 0x00, 0x07, 0x84, 0x03, 0x80, 0x07, 0x84, 0x03, 0x00, 0x0D, 0x85, 0x00, 0x00, 0x01, 0x85, 0x03, 0x80, 0x00, 0x8C, 0x03, 0x86, 0x00,
+	0x00, 0x01, 0x85, 0x03, 0x80, 0x00, 0x00, 0x06, 0x8B, 0x03, 0x86, 0x00, 0x00, 0x01, 0x85, 0x03, 0x80, 0x00, 0x00, 0x08, 0x8A, 0x03, 0x00, 0x0E,
+	0x86, 0x00, 0x00, 0x01, 0x85, 0x03, 0x81, 0x00, 0x8A, 0x03, 0x87, 0x00, 0x00, 0x01, 0x85, 0x03, 0x81, 0x00, 0x00, 0x0A, 0x88, 0x03, 0x00, 0x01,
+	0x87, 0x00, 0x00, 0x01, 0x85, 0x03, 0x82, 0x00, 0x01, 0x0F, 0x06, 0x85, 0x03, 0x00, 0x09, 0x96, 0x00, 0x01, 0x01, 0x04, 0x81, 0x03, 0x01, 0x0F,
+	0x0B, 0x84, 0x00,
+};
+const ardPort::PackedImage num_10_packed = {32, 51, num_10_palette, num_10_data, 771};
+
+// num_11: 32×51, 36色, 3264 → 682 バイト
+const uint16_t num_11_palette[] = {
+	0x0000, 0xE71C, 0xFFFF, 0x18E3, 0xF7BE, 0x39E7, 0xDEDB, 0x6B6D, 0xBDF7, 0xEF7D, 0xC638, 0xB596, 0x0020, 0x0841, 0x1082, 0x0861,
+	0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x52AA, 0x94B2, 0x3186, 0x1081, 0xA534, 0x9CD3, 0xA4F3, 0x0840, 0x9CD2, 0x9CF2,
+	0x4A69, 0x3A07, 0x39E8, 0x10A2,
+};
+const uint8_t num_11_data[] = {
+	0xC6, 0x00, 0x00, 0x01, 0x82, 0x02, 0x88, 0x00, 0x00, 0x01, 0x82, 0x02, 0x89, 0x00, 0x00, 0x03, 0x83, 0x02, 0x87, 0x00, 0x00, 0x03, 0x83, 0x02,
+	0x88, 0x00, 0x01, 0x03, 0x01, 0x83, 0x02, 0x86, 0x00, 0x01, 0x03, 0x01, 0x83, 0x02, 0x88, 0x00, 0x00, 0x04, 0x84, 0x02, 0x86, 0x00, 0x00, 0x04,
+	0x84, 0x02, 0x86, 0x00, 0x01, 0x05, 0x06, 0x85, 0x02, 0x84, 0x00, 0x01, 0x05, 0x06, 0x85, 0x02, 0x85, 0x00, 0x00, 0x07, 0x87, 0x02, 0x83, 0x00,
+	0x00, 0x07, 0x87, 0x02, 0x83, 0x00, 0x01, 0x07, 0x08, 0x88, 0x02, 0x81, 0x00, 0x01, 0x07, 0x08, 0x88, 0x02, 0x82, 0x00, 0x00, 0x08, 0x8A, 0x02,
+	0x80, 0x00, 0x00, 0x08, 0x8A, 0x02, 0x82, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x80, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x82, 0x00, 0x00, 0x06, 0x8A, 0x02,
+	0x80, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x82, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x80, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x82, 0x00, 0x00, 0x06, 0x8A, 0x02,
+	0x80, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x82, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x80, 0x00, 0x00, 0x06, 0x8A, 0x02, 0x85, 0x00, 0x01, 0x07, 0x09, 0x86,
+	0x02, 0x83, 0x00, 0x01, 0x07, 0x09, 0x86, 0x02, 0x86, 0x00, 0x01, 0x03, 0x04, 0x85, 0x02, 0x84, 0x00, 0x01, 0x03, 0x04, 0x85, 0x02, 0x87, 0x00,
+	0x00, 0x0A, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0A, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00,
+	0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00,
+	0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x00, 0x0C,
+	0x82, 0x00, 0x01, 0x0C, 0x0D, 0x80, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x00, 0x00, 0x80, 0x0E, 0x04, 0x0F, 0x10,
+	0x11, 0x12, 0x0E, 0x96, 0x13, 0x04, 0x00, 0x14, 0x15, 0x16, 0x17, 0x80, 0x13, 0x00, 0x0D, 0x96, 0x18, 0x00, 0x19, 0x80, 0x1A, 0x01, 0x1B, 0x13,
+	0x80, 0x1C, 0x00, 0x1D, 0x96, 0x18, 0x00, 0x1D, 0x80, 0x1E, 0x01, 0x1F, 0x14, 0x80, 0x20, 0x00, 0x00, 0x96, 0x13, 0x00, 0x0E, 0x80, 0x21, 0x03,
+	0x22, 0x23, 0x0F, 0x0D, 0x80, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x81, 0x00, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0x87, 0x00, 0x00, 0x0B,
+	0x85, 0x02, 0x85, 0x00, 0x00, 0x0B, 0x85, 0x02, 0xA2, 0x00,
+};
+const ardPort::PackedImage num_11_packed = {32, 51, num_11_palette, num_11_data, 610};
+
+// num_12: 32×51, 42色, 3264 → 778 バイト
+const uint16_t num_12_palette[] = {
+	0x0000, 0x52AA, 0xB596, 0xEF7D, 0xFFFF, 0xDEDB, 0x8410, 0xE71C, 0xF7BE, 0x18E3, 0xC638, 0xA514, 0x39E7, 0x6B6D, 0xBDF7, 0x9492,
+	0xD69A, 0xFFDF, 0xF79E, 0x0020, 0x0841, 0x1082, 0x0861, 0x4228, 0x4207, 0x4208, 0xA513, 0x5289, 0x528A, 0x94B2, 0x3186, 0x1081,
+	0xA534, 0x9CD3, 0xA4F3, 0x0840, 0x9CD2, 0x9CF2, 0x4A69, 0x3A07, 0x39E8, 0x10A2,
+};
+const uint8_t num_12_data[] = {
+	0xB1, 0x00, 0x02, 0x01, 0x02, 0x03, 0x80, 0x04, 0x02, 0x03, 0x05, 0x06, 0x8B, 0x00, 0x00, 0x07, 0x82, 0x04, 0x83, 0x00, 0x00, 0x06, 0x86, 0x04,
+	0x01, 0x08, 0x09, 0x88, 0x00, 0x00, 0x09, 0x83, 0x04, 0x82, 0x00, 0x00, 0x09, 0x88, 0x04, 0x00, 0x08, 0x87, 0x00, 0x01, 0x09, 0x07, 0x83, 0x04,
+	0x81, 0x00, 0x01, 0x09, 0x07, 0x89, 0x04, 0x00, 0x0A, 0x86, 0x00, 0x00, 0x08, 0x84, 0x04, 0x81, 0x00, 0x00, 0x0A, 0x8B, 0x04, 0x00, 0x0B, 0x83,
+	0x00, 0x01, 0x0C, 0x05, 0x85, 0x04, 0x81, 0x00, 0x8D, 0x04, 0x82, 0x00, 0x00, 0x0D, 0x87, 0x04, 0x81, 0x00, 0x8D, 0x04, 0x80, 0x00, 0x01, 0x0D,
+	0x0E, 0x88, 0x04, 0x80, 0x00, 0x00, 0x06, 0x84, 0x04, 0x02, 0x07, 0x00, 0x08, 0x84, 0x04, 0x01, 0x0F, 0x0E, 0x8A, 0x04, 0x80, 0x00, 0x00, 0x0A,
+	0x84, 0x04, 0x02, 0x0C, 0x00, 0x0F, 0x84, 0x04, 0x01, 0x10, 0x05, 0x8A, 0x04, 0x80, 0x00, 0x00, 0x05, 0x83, 0x04, 0x00, 0x07, 0x80, 0x00, 0x00,
+	0x0C, 0x85, 0x04, 0x00, 0x05, 0x8A, 0x04, 0x80, 0x00, 0x84, 0x04, 0x00, 0x05, 0x81, 0x00, 0x85, 0x04, 0x00, 0x05, 0x8A, 0x04, 0x80, 0x00, 0x84,
+	0x04, 0x00, 0x05, 0x81, 0x00, 0x85, 0x04, 0x00, 0x05, 0x8A, 0x04, 0x80, 0x00, 0x84, 0x04, 0x00, 0x05, 0x80, 0x00, 0x00, 0x0C, 0x85, 0x04, 0x00,
+	0x05, 0x8A, 0x04, 0x80, 0x00, 0x84, 0x04, 0x00, 0x05, 0x80, 0x00, 0x00, 0x0F, 0x85, 0x04, 0x81, 0x00, 0x01, 0x0D, 0x03, 0x86, 0x04, 0x80, 0x00,
+	0x84, 0x04, 0x00, 0x05, 0x80, 0x00, 0x00, 0x0A, 0x85, 0x04, 0x82, 0x00, 0x01, 0x09, 0x08, 0x85, 0x04, 0x01, 0x00, 0x01, 0x84, 0x04, 0x00, 0x05,
+	0x80, 0x00, 0x00, 0x08, 0x85, 0x04, 0x83, 0x00, 0x00, 0x0A, 0x85, 0x04, 0x01, 0x00, 0x0D, 0x84, 0x04, 0x00, 0x05, 0x80, 0x00, 0x86, 0x04, 0x83,
+	0x00, 0x00, 0x02, 0x85, 0x04, 0x89, 0x00, 0x85, 0x04, 0x00, 0x07, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x88, 0x00, 0x00, 0x0D, 0x85, 0x04, 0x00,
+	0x0E, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x88, 0x00, 0x00, 0x05, 0x85, 0x04, 0x00, 0x01, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x88, 0x00, 0x86,
+	0x04, 0x84, 0x00, 0x00, 0x02, 0x85, 0x04, 0x88, 0x00, 0x83, 0x04, 0x00, 0x11, 0x80, 0x12, 0x80, 0x00, 0x01, 0x13, 0x14, 0x80, 0x00, 0x00, 0x02,
+	0x85, 0x04, 0x87, 0x00, 0x00, 0x0F, 0x84, 0x04, 0x80, 0x15, 0x04, 0x16, 0x17, 0x18, 0x19, 0x15, 0x96, 0x1A, 0x04, 0x00, 0x1B, 0x1C, 0x01, 0x1D,
+	0x80, 0x1A, 0x00, 0x14, 0x96, 0x1E, 0x00, 0x1F, 0x80, 0x20, 0x01, 0x21, 0x1A, 0x80, 0x22, 0x00, 0x23, 0x96, 0x1E, 0x00, 0x23, 0x80, 0x24, 0x01,
+	0x25, 0x1B, 0x80, 0x26, 0x00, 0x00, 0x96, 0x1A, 0x00, 0x15, 0x80, 0x27, 0x03, 0x28, 0x29, 0x16, 0x14, 0x80, 0x00, 0x00, 0x02, 0x85, 0x04, 0x85,
+	0x00, 0x00, 0x0C, 0x86, 0x04, 0x80, 0x00, 0x00, 0x14, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x85, 0x00, 0x00, 0x05, 0x85, 0x04, 0x00, 0x0A, 0x86,
+	0x00, 0x00, 0x02, 0x85, 0x04, 0x84, 0x00, 0x00, 0x0D, 0x86, 0x04, 0x00, 0x09, 0x86, 0x00, 0x00, 0x02, 0x85, 0x04, 0x84, 0x00, 0x00, 0x03, 0x86,
+	0x04, 0x87, 0x00, 0x00, 0x02, 0x85, 0x04, 0x84, 0x00, 0x86, 0x04, 0x00, 0x05, 0x87, 0x00, 0x00, 0x02, 0x85, 0x04, 0x83, 0x00, 0x00, 0x09, 0x86,
+	0x04, 0x00, 0x01, 0x87, 0x00, 0x00, 0x02, 0x85, 0x04, 0x83, 0x00, 0x00, 0x0E, 0x85, 0x04, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x85, 0x04, 0x83,
+	0x00, 0x86, 0x04, 0x00, 0x09, 0x88, 0x00, 0x00, 0x02, 0x85, 0x04, 0x83, 0x00, 0x86, 0x04, 0x89, 0x00, 0x00, 0x02, 0x85, 0x04, 0x82, 0x00, 0x00,
+	0x06, 0x85, 0x04, 0x00, 0x0E, 0x89, 0x00, 0x00, 0x02, 0x85, 0x04, 0x82, 0x00, 0x00, 0x03, 0x84, 0x04, 0x01, 0x03, 0x09, 0x89, 0x00, 0x00, 0x02,
+	0x85, 0x04, 0x81, 0x00, 0x00, 0x02, 0x85, 0x04, 0x00, 0x06, 0x8A, 0x00, 0x00, 0x02, 0x85, 0x04, 0x81, 0x00, 0x00, 0x08, 0x85, 0x04, 0x8B, 0x00,
+	0x00, 0x02, 0x85, 0x04, 0x81, 0x00, 0x85, 0x04, 0x00, 0x08, 0x8B, 0x00, 0x00, 0x02, 0x85, 0x04, 0x80, 0x00, 0x00, 0x0D, 0x85, 0x04, 0x00, 0x06,
+	0x8B, 0x00, 0x00, 0x02, 0x85, 0x04, 0x80, 0x00, 0x00, 0x07, 0x8D, 0x04, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x01, 0x00, 0x0D, 0x8E,
+	0x04, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x01, 0x00, 0x0D, 0x8E, 0x04, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x01, 0x00,
+	0x0D, 0x8E, 0x04, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x01, 0x00, 0x0D, 0x8E, 0x04, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04,
+	0x01, 0x00, 0x0D, 0x8E, 0x04, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x02, 0x85, 0x04, 0x01, 0x00, 0x0D, 0x8E, 0x04, 0x00, 0x0D, 0x9E, 0x00,
+};
+const ardPort::PackedImage num_12_packed = {32, 51, num_12_palette, num_12_data, 694};
+
+// num_am: 30×30, 50色, 1800 → 665 バイト
+const uint16_t num_am_palette[] = {
+	0x4208, 0x39E7, 0x29E5, 0x21E4, 0x01C0, 0x0440, 0x0560, 0x0260, 0x02A0, 0x0580, 0x05A0, 0x06E0, 0x07A0, 0x0500, 0x07E0, 0x0280,
+	0x0300, 0x04A0, 0x0640, 0x0220, 0x0400, 0x06C0, 0x06A0, 0x0460, 0x05C0, 0x02C0, 0x03E0, 0x03A0, 0x0720, 0x04C0, 0x0480, 0x0660,
+	0x0380, 0x0420, 0x03C0, 0x0540, 0x0760, 0x0700, 0x0340, 0x0360, 0x00E0, 0x0200, 0x01E0, 0x0180, 0x0120, 0x0240, 0x0160, 0x0140,
+	0x0100, 0x01A0,
+};
+const uint8_t num_am_data[] = {
+	0x81, 0x00, 0x00, 0x01, 0x93, 0x02, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x03, 0x93, 0x04, 0x01, 0x03, 0x01, 0x83, 0x00, 0x00, 0x02, 0x82, 0x04,
+	0x02, 0x05, 0x06, 0x07, 0x81, 0x04, 0x00, 0x08, 0x80, 0x09, 0x83, 0x04, 0x01, 0x09, 0x0A, 0x81, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x82,
+	0x04, 0x02, 0x0B, 0x0C, 0x0D, 0x81, 0x04, 0x00, 0x08, 0x80, 0x0E, 0x00, 0x0F, 0x81, 0x04, 0x00, 0x0F, 0x80, 0x0E, 0x81, 0x04, 0x00, 0x02, 0x83,
+	0x00, 0x00, 0x02, 0x81, 0x04, 0x03, 0x10, 0x0E, 0x0D, 0x0C, 0x81, 0x04, 0x00, 0x08, 0x80, 0x0E, 0x00, 0x11, 0x81, 0x04, 0x00, 0x11, 0x80, 0x0E,
+	0x81, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x81, 0x04, 0x04, 0x06, 0x12, 0x13, 0x0E, 0x14, 0x80, 0x04, 0x03, 0x08, 0x0E, 0x0A, 0x15, 0x81,
+	0x04, 0x02, 0x16, 0x0A, 0x0E, 0x81, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x81, 0x04, 0x04, 0x0E, 0x17, 0x04, 0x18, 0x16, 0x80, 0x04, 0x09,
+	0x08, 0x0E, 0x19, 0x0E, 0x19, 0x04, 0x0F, 0x0E, 0x1A, 0x0E, 0x81, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x80, 0x04, 0x01, 0x1A, 0x0E, 0x80,
+	0x04, 0x0D, 0x1B, 0x0E, 0x08, 0x04, 0x08, 0x0E, 0x08, 0x1C, 0x1D, 0x04, 0x1E, 0x1F, 0x1A, 0x0E, 0x81, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02,
+	0x80, 0x04, 0x00, 0x15, 0x83, 0x0E, 0x0B, 0x09, 0x04, 0x08, 0x0E, 0x08, 0x1D, 0x16, 0x04, 0x1F, 0x20, 0x1A, 0x0E, 0x81, 0x04, 0x00, 0x02, 0x83,
+	0x00, 0x04, 0x02, 0x04, 0x0F, 0x0E, 0x21, 0x81, 0x08, 0x0C, 0x0D, 0x0E, 0x04, 0x08, 0x0E, 0x08, 0x04, 0x0E, 0x22, 0x0E, 0x04, 0x22, 0x0E, 0x81,
+	0x04, 0x00, 0x02, 0x83, 0x00, 0x03, 0x02, 0x04, 0x23, 0x24, 0x82, 0x04, 0x0C, 0x08, 0x0E, 0x21, 0x08, 0x0E, 0x08, 0x04, 0x12, 0x1C, 0x09, 0x04,
+	0x20, 0x0E, 0x81, 0x04, 0x00, 0x02, 0x83, 0x00, 0x03, 0x02, 0x04, 0x0E, 0x0D, 0x83, 0x04, 0x0B, 0x16, 0x25, 0x08, 0x0E, 0x08, 0x04, 0x1A, 0x0E,
+	0x26, 0x04, 0x27, 0x0E, 0x81, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x95, 0x04, 0x00, 0x02, 0x83, 0x00, 0x00, 0x01, 0x95, 0x02, 0x00, 0x01,
+	0xC1, 0x00, 0x93, 0x28, 0x86, 0x00, 0x80, 0x28, 0x00, 0x29, 0x81, 0x2A, 0x01, 0x04, 0x2B, 0x80, 0x28, 0x00, 0x2C, 0x80, 0x2A, 0x83, 0x28, 0x01,
+	0x2A, 0x29, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x2D, 0x80, 0x29, 0x04, 0x07, 0x08, 0x29, 0x28, 0x2C, 0x80, 0x08, 0x00, 0x2C, 0x81,
+	0x28, 0x00, 0x2C, 0x80, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x2E, 0x81, 0x28, 0x03, 0x2B, 0x08, 0x2F, 0x2C, 0x80, 0x08, 0x00,
+	0x04, 0x81, 0x28, 0x00, 0x04, 0x80, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x2E, 0x81, 0x28, 0x06, 0x2C, 0x08, 0x2E, 0x2C, 0x08,
+	0x29, 0x2D, 0x81, 0x28, 0x02, 0x2D, 0x29, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x2B, 0x80, 0x28, 0x02, 0x30, 0x13, 0x0F, 0x80,
+	0x2C, 0x08, 0x08, 0x2F, 0x08, 0x2C, 0x28, 0x2C, 0x08, 0x2B, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x83, 0x08, 0x0C, 0x2D, 0x2E, 0x28, 0x2C,
+	0x08, 0x2C, 0x07, 0x04, 0x28, 0x31, 0x13, 0x2B, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x31, 0x80, 0x2C, 0x00, 0x30, 0x81, 0x28,
+	0x09, 0x2C, 0x08, 0x2C, 0x04, 0x2D, 0x28, 0x13, 0x2E, 0x2B, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x2E, 0x84, 0x28, 0x09, 0x2C,
+	0x08, 0x2C, 0x28, 0x08, 0x2B, 0x08, 0x28, 0x2B, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x2E, 0x84, 0x28, 0x09, 0x2C, 0x08, 0x2C,
+	0x28, 0x13, 0x07, 0x2A, 0x28, 0x2E, 0x08, 0x81, 0x28, 0x85, 0x00, 0x80, 0x28, 0x01, 0x08, 0x2E, 0x84, 0x28, 0x09, 0x2C, 0x08, 0x2C, 0x28, 0x2B,
+	0x08, 0x2E, 0x28, 0x2E, 0x08, 0x81, 0x28, 0x86, 0x00, 0x93, 0x28, 0xBF, 0x00,
+};
+const ardPort::PackedImage num_am_packed = {30, 30, num_am_palette, num_am_data, 565};
+
+// num_pm: 30×30, 46色, 1800 → 661 バイト
+const uint16_t num_pm_palette[] = {
+	0x4208, 0x00E0, 0x01A0, 0x01E0, 0x0120, 0x0200, 0x0240, 0x0280, 0x01C0, 0x02A0, 0x0140, 0x0220, 0x0100, 0x0180, 0x0160, 0x0260,
+	0x39E7, 0x29E5, 0x21E4, 0x05A0, 0x0540, 0x0520, 0x04E0, 0x03C0, 0x0580, 0x07E0, 0x06C0, 0x05E0, 0x0700, 0x03E0, 0x02E0, 0x04A0,
+	0x0380, 0x06A0, 0x0620, 0x07A0, 0x02C0, 0x03A0, 0x0720, 0x04C0, 0x0480, 0x0660, 0x0460, 0x0640, 0x0340, 0x0360,
+};
+const uint8_t num_pm_data[] = {
+	0xA0, 0x00, 0x93, 0x01, 0x86, 0x00, 0x82, 0x01, 0x02, 0x02, 0x03, 0x04, 0x81, 0x01, 0x00, 0x04, 0x80, 0x03, 0x83, 0x01, 0x01, 0x03, 0x05, 0x81,
+	0x01, 0x85, 0x00, 0x82, 0x01, 0x02, 0x06, 0x07, 0x08, 0x81, 0x01, 0x00, 0x04, 0x80, 0x09, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x80, 0x09, 0x81,
+	0x01, 0x85, 0x00, 0x81, 0x01, 0x03, 0x0A, 0x09, 0x08, 0x07, 0x81, 0x01, 0x00, 0x04, 0x80, 0x09, 0x00, 0x08, 0x81, 0x01, 0x00, 0x08, 0x80, 0x09,
+	0x81, 0x01, 0x85, 0x00, 0x81, 0x01, 0x04, 0x03, 0x0B, 0x0C, 0x09, 0x0D, 0x80, 0x01, 0x03, 0x04, 0x09, 0x05, 0x06, 0x81, 0x01, 0x02, 0x06, 0x05,
+	0x09, 0x81, 0x01, 0x85, 0x00, 0x81, 0x01, 0x04, 0x09, 0x02, 0x01, 0x05, 0x06, 0x80, 0x01, 0x09, 0x04, 0x09, 0x0A, 0x09, 0x04, 0x01, 0x04, 0x09,
+	0x0D, 0x09, 0x81, 0x01, 0x85, 0x00, 0x80, 0x01, 0x01, 0x0D, 0x09, 0x80, 0x01, 0x0D, 0x0E, 0x09, 0x04, 0x01, 0x04, 0x09, 0x04, 0x0F, 0x08, 0x01,
+	0x02, 0x0B, 0x0D, 0x09, 0x81, 0x01, 0x85, 0x00, 0x80, 0x01, 0x00, 0x06, 0x83, 0x09, 0x0B, 0x03, 0x01, 0x04, 0x09, 0x04, 0x08, 0x06, 0x01, 0x0B,
+	0x0E, 0x0D, 0x09, 0x81, 0x01, 0x85, 0x00, 0x03, 0x01, 0x04, 0x09, 0x0D, 0x81, 0x04, 0x0C, 0x08, 0x09, 0x01, 0x04, 0x09, 0x04, 0x01, 0x09, 0x0D,
+	0x09, 0x01, 0x0D, 0x09, 0x81, 0x01, 0x85, 0x00, 0x02, 0x01, 0x03, 0x0F, 0x82, 0x01, 0x0C, 0x04, 0x09, 0x0D, 0x04, 0x09, 0x04, 0x01, 0x0B, 0x0F,
+	0x03, 0x01, 0x0E, 0x09, 0x81, 0x01, 0x85, 0x00, 0x02, 0x01, 0x09, 0x03, 0x83, 0x01, 0x0B, 0x06, 0x0F, 0x04, 0x09, 0x04, 0x01, 0x0D, 0x09, 0x0E,
+	0x01, 0x0E, 0x09, 0x81, 0x01, 0x86, 0x00, 0x93, 0x01, 0xC2, 0x00, 0x00, 0x10, 0x93, 0x11, 0x00, 0x10, 0x84, 0x00, 0x01, 0x10, 0x12, 0x93, 0x08,
+	0x01, 0x12, 0x10, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x01, 0x13, 0x14, 0x80, 0x15, 0x01, 0x16, 0x17, 0x80, 0x08, 0x00, 0x09, 0x80, 0x18, 0x83,
+	0x08, 0x01, 0x18, 0x13, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x08, 0x19, 0x1A, 0x1B, 0x13, 0x1C, 0x19, 0x1B, 0x08, 0x09,
+	0x80, 0x19, 0x00, 0x07, 0x81, 0x08, 0x00, 0x07, 0x80, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x01, 0x19, 0x17, 0x81,
+	0x08, 0x03, 0x1D, 0x19, 0x1E, 0x09, 0x80, 0x19, 0x00, 0x1F, 0x81, 0x08, 0x00, 0x1F, 0x80, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11,
+	0x80, 0x08, 0x01, 0x19, 0x17, 0x81, 0x08, 0x06, 0x09, 0x19, 0x20, 0x09, 0x19, 0x13, 0x1A, 0x81, 0x08, 0x02, 0x21, 0x13, 0x19, 0x81, 0x08, 0x00,
+	0x11, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x01, 0x19, 0x17, 0x80, 0x03, 0x0D, 0x06, 0x22, 0x23, 0x0F, 0x09, 0x19, 0x24, 0x19, 0x24, 0x08, 0x07,
+	0x19, 0x1D, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x83, 0x19, 0x0C, 0x1A, 0x25, 0x08, 0x09, 0x19, 0x09, 0x26, 0x27,
+	0x08, 0x28, 0x29, 0x1D, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x01, 0x19, 0x2A, 0x80, 0x24, 0x00, 0x05, 0x81, 0x08,
+	0x09, 0x09, 0x19, 0x09, 0x27, 0x21, 0x08, 0x29, 0x20, 0x1D, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x01, 0x19, 0x17,
+	0x84, 0x08, 0x09, 0x09, 0x19, 0x09, 0x08, 0x19, 0x17, 0x19, 0x08, 0x17, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11, 0x80, 0x08, 0x01,
+	0x19, 0x17, 0x84, 0x08, 0x09, 0x09, 0x19, 0x09, 0x08, 0x2B, 0x26, 0x18, 0x08, 0x20, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x00, 0x11, 0x80,
+	0x08, 0x01, 0x19, 0x17, 0x84, 0x08, 0x09, 0x09, 0x19, 0x09, 0x08, 0x1D, 0x19, 0x2C, 0x08, 0x2D, 0x19, 0x81, 0x08, 0x00, 0x11, 0x83, 0x00, 0x01,
+	0x10, 0x12, 0x93, 0x08, 0x01, 0x12, 0x10, 0x84, 0x00, 0x00, 0x10, 0x93, 0x11, 0x00, 0x10, 0xA0, 0x00,
+};
+const ardPort::PackedImage num_pm_packed = {30, 30, num_pm_palette, num_pm_data, 569};
+
+// colon: 16×51, 7色, 1632 → 194 バイト
+const uint16_t colon_palette[] = {
+	0x0000, 0xE71C, 0xFFFF, 0xDEFB, 0x5ACB, 0x630C, 0x0020,
+};
+const uint8_t colon_data[] = {
+	0xFF, 0x93, 0x00, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02,
+	0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02,
+	0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02,
+	0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x88, 0x04, 0xFF, 0xB6, 0x00, 0x00, 0x88, 0x05, 0x84, 0x00, 0x00, 0x01,
+	0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01,
+	0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01,
+	0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x00, 0x01,
+	0x86, 0x02, 0x00, 0x03, 0x84, 0x00, 0x88, 0x06, 0xFF, 0x83, 0x00, 0x00,
+};
+const ardPort::PackedImage colon_packed = {16, 51, colon_palette, colon_data, 180};
+
+// secQ0: 10×10, 1色, 200 → 4 バイト
+const uint16_t secQ0_palette[] = {
+	0x2142,
+};
+const uint8_t secQ0_data[] = {
+	0xE2, 0x00,
+};
+const ardPort::PackedImage secQ0_packed = {10, 10, secQ0_palette, secQ0_data, 2};
+
+// secQ1: 10×10, 12色, 200 → 88 バイト
+const uint16_t secQ1_palette[] = {
+	0xF1E2, 0xD1C2, 0x99A2, 0x4962, 0x2142, 0xF9E2, 0xC1A2, 0x4142, 0x6162, 0x6962, 0x3942, 0xB9A2,
+};
+const uint8_t secQ1_data[] = {
+	0x03, 0x00, 0x01, 0x02, 0x03, 0x84, 0x04, 0x82, 0x05, 0x01, 0x06, 0x07, 0x82, 0x04, 0x83, 0x05, 0x01, 0x00, 0x08, 0x81, 0x04, 0x85, 0x05, 0x00,
+	0x09, 0x80, 0x04, 0x85, 0x05, 0x02, 0x00, 0x07, 0x04, 0x86, 0x05, 0x01, 0x06, 0x04, 0x87, 0x05, 0x02, 0x03, 0x0A, 0x0B, 0x85, 0x05, 0x00, 0x02,
+	0x80, 0x04, 0x00, 0x0B, 0x84, 0x05, 0x00, 0x01, 0x80, 0x04, 0x00, 0x0A, 0x84, 0x05, 0x00, 0x00,
+};
+const ardPort::PackedImage secQ1_packed = {10, 10, secQ1_palette, secQ1_data, 64};
+
+// secQ2: 10×10, 12色, 200 → 88 バイト
+const uint16_t secQ2_palette[] = {
+	0x2142, 0x3942, 0xF9E2, 0xF1E2, 0xB9A2, 0xD1C2, 0x99A2, 0x4962, 0xC1A2, 0x4142, 0x6962, 0x6162,
+};
+const uint8_t secQ2_data[] = {
+	0x80, 0x00, 0x00, 0x01, 0x84, 0x02, 0x00, 0x03, 0x80, 0x00, 0x00, 0x04, 0x84, 0x02, 0x02, 0x05, 0x01, 0x04, 0x85, 0x02, 0x00, 0x06, 0x87, 0x02,
+	0x00, 0x07, 0x86, 0x02, 0x01, 0x08, 0x00, 0x85, 0x02, 0x02, 0x03, 0x09, 0x00, 0x85, 0x02, 0x00, 0x0A, 0x80, 0x00, 0x83, 0x02, 0x01, 0x03, 0x0B,
+	0x81, 0x00, 0x82, 0x02, 0x01, 0x08, 0x09, 0x82, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x84, 0x00,
+};
+const ardPort::PackedImage secQ2_packed = {10, 10, secQ2_palette, secQ2_data, 64};
+
+// secQ3: 10×10, 12色, 200 → 88 バイト
+const uint16_t secQ3_palette[] = {
+	0xF1E2, 0xF9E2, 0x3942, 0x2142, 0xD1C2, 0xB9A2, 0x99A2, 0x4962, 0xC1A2, 0x4142, 0x6962, 0x6162,
+};
+const uint8_t secQ3_data[] = {
+	0x00, 0x00, 0x84, 0x01, 0x00, 0x02, 0x80, 0x03, 0x00, 0x04, 0x84, 0x01, 0x00, 0x05, 0x80, 0x03, 0x00, 0x06, 0x85, 0x01, 0x02, 0x05, 0x02, 0x07,
+	0x87, 0x01, 0x01, 0x03, 0x08, 0x86, 0x01, 0x02, 0x03, 0x09, 0x00, 0x85, 0x01, 0x80, 0x03, 0x00, 0x0A, 0x85, 0x01, 0x81, 0x03, 0x01, 0x0B, 0x00,
+	0x83, 0x01, 0x82, 0x03, 0x01, 0x09, 0x08, 0x82, 0x01, 0x84, 0x03, 0x03, 0x07, 0x06, 0x04, 0x00,
+};
+const ardPort::PackedImage secQ3_packed = {10, 10, secQ3_palette, secQ3_data, 64};
+
+// secQ4: 10×10, 12色, 200 → 88 バイト
+const uint16_t secQ4_palette[] = {
+	0x2142, 0x4962, 0x99A2, 0xD1C2, 0xF1E2, 0x4142, 0xC1A2, 0xF9E2, 0x6162, 0x6962, 0xB9A2, 0x3942,
+};
+const uint8_t secQ4_data[] = {
+	0x84, 0x00, 0x03, 0x01, 0x02, 0x03, 0x04, 0x82, 0x00, 0x01, 0x05, 0x06, 0x82, 0x07, 0x81, 0x00, 0x01, 0x08, 0x04, 0x83, 0x07, 0x80, 0x00, 0x00,
+	0x09, 0x85, 0x07, 0x02, 0x00, 0x05, 0x04, 0x85, 0x07, 0x01, 0x00, 0x06, 0x86, 0x07, 0x00, 0x01, 0x87, 0x07, 0x00, 0x02, 0x85, 0x07, 0x02, 0x0A,
+	0x0B, 0x03, 0x84, 0x07, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x04, 0x84, 0x07, 0x00, 0x0B, 0x80, 0x00,
+};
+const ardPort::PackedImage secQ4_packed = {10, 10, secQ4_palette, secQ4_data, 64};
+
+// picKB0: 240×95, 64色, 45600 → 7349 バイト
+const uint16_t picKB0_palette[] = {
+	0xFFFF, 0x0000, 0xB5B6, 0x1082, 0x4228, 0x2104, 0xA534, 0x7BCF, 0xD69A, 0x8C51, 0x52AA, 0xEF7D, 0xC618, 0x31A6, 0x9CD3, 0xDEFB,
+	0x6B4D, 0xCE59, 0xE71C, 0x39E7, 0xE73C, 0xBDD7, 0x9492, 0x8430, 0xDEDB, 0xF7BE, 0xD6BA, 0xBDF7, 0x8410, 0x632C, 0x6B6D, 0xAD75,
+	0xF79E, 0x5AEB, 0x630C, 0xC638, 0x8C71, 0x73AE, 0x738E, 0xA514, 0x7BEF, 0xAD55, 0x5ACB, 0x4A49, 0x4A69, 0x2965, 0x4208, 0x528A,
+	0x2945, 0xCE79, 0xEF5D, 0x18E3, 0x39C7, 0x18C3, 0x94B2, 0xB596, 0x2124, 0x0841, 0x9CF3, 0x0020, 0xFFDF, 0x0861, 0x10A2, 0x3186,
+};
+const uint8_t picKB0_data[] = {
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x02, 0x02, 0x03, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x02, 0x05, 0x01, 0x05, 0x06, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x04, 0x07, 0x03, 0x01, 0x04, 0x08, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x02, 0x80, 0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x04,
+	0x82, 0x01, 0x00, 0x09, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x07, 0x80, 0x01, 0x01, 0x0A, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
+	0x0C, 0x83, 0x01, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x07, 0x03, 0x01, 0x0D, 0x08, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00,
+	0x07, 0x80, 0x01, 0x01, 0x0A, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x0B, 0x04, 0x01, 0x03, 0x06, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x00, 0x0D, 0x80, 0x01, 0x00, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x08, 0x01, 0x0A, 0x0C, 0x04, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x05, 0x09, 0x01, 0x0E, 0x02, 0x05, 0x03, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x04, 0x0D, 0x01, 0x88, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x01, 0x04, 0x0D, 0x81, 0x0C, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x07, 0x01, 0x0E, 0x02, 0x05, 0x06, 0x89, 0x00, 0x00,
+	0x01, 0x82, 0x00, 0x00, 0x0B, 0x81, 0x0C, 0x02, 0x02, 0x01, 0x09, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x09, 0x01, 0x06, 0x0C, 0x0D, 0x03,
+	0x0B, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x09, 0x01, 0x0E, 0x02, 0x03, 0x10, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x04, 0x03, 0x02,
+	0x10, 0x01, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x10, 0x06, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x06, 0x05, 0x0F,
+	0x00, 0x0C, 0x01, 0x09, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x0E, 0x04, 0x80, 0x00, 0x01, 0x09, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x03, 0x0C, 0x03, 0x09, 0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x04, 0x0A, 0x8C, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x03, 0x10, 0x8D,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x07, 0x03, 0x0B, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x04, 0x0D, 0x80, 0x00, 0x02, 0x02, 0x01, 0x0C,
+	0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x05, 0x0D, 0x80, 0x00, 0x02, 0x09, 0x01, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x0F, 0x01,
+	0x09, 0x00, 0x0B, 0x01, 0x10, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x06, 0x01, 0x06,
+	0x88, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x0F, 0x80, 0x0D, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x0A, 0x07, 0x09, 0x01, 0x88, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x05, 0x04, 0x0A, 0x05, 0x01, 0x0A, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x06, 0x0C, 0x01, 0x0E, 0x04, 0x01, 0x10, 0x0B,
+	0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x0F, 0x01, 0x09, 0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x07, 0x01, 0x09, 0x0F, 0x04, 0x05, 0x88,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x04, 0x80, 0x00, 0x02, 0x0C, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0C, 0x01, 0x0C,
+	0x80, 0x00, 0x01, 0x05, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x08, 0x03, 0x0D,
+	0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x80, 0x01, 0x01, 0x04, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x0F, 0x01, 0x0F, 0x09, 0x01, 0x88,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x04, 0x03, 0x02, 0x0E, 0x01, 0x10, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x06, 0x0C, 0x01, 0x0A, 0x02, 0x0E,
+	0x01, 0x09, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x07, 0x01, 0x0B, 0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x0B, 0x0A, 0x80, 0x01, 0x01,
+	0x05, 0x0F, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x0A, 0x01, 0x08, 0x0B, 0x0D, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x09,
+	0x01, 0x0C, 0x80, 0x00, 0x80, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x08, 0x03,
+	0x0D, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x03, 0x0C, 0x0E, 0x03, 0x0D, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x10, 0x0A, 0x00, 0x09,
+	0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x80, 0x02, 0x80, 0x00, 0x01, 0x04, 0x03, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x02,
+	0x80, 0x00, 0x01, 0x0D, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x05, 0x04, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x08, 0x0D, 0x07,
+	0x10, 0x01, 0x04, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x08, 0x03, 0x80, 0x01, 0x02, 0x10, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x02, 0x09, 0x01, 0x0C, 0x80, 0x00, 0x80, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03,
+	0x0F, 0x03, 0x0D, 0x0B, 0x8A, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x02, 0x0E, 0x01, 0x0C, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x0B, 0x01, 0x0C,
+	0x00, 0x09, 0x01, 0x88, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x04, 0x01, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x0C, 0x80, 0x00,
+	0x80, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x08, 0x01, 0x09, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00, 0x80, 0x04, 0x80, 0x00, 0x02, 0x0E,
+	0x01, 0x02, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x0C, 0x0F, 0x06, 0x01, 0x08, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0C, 0x01, 0x0C,
+	0x80, 0x00, 0x01, 0x03, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x80, 0x0D, 0x00, 0x0B,
+	0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x80, 0x10, 0x80, 0x00, 0x02, 0x06, 0x01, 0x0C, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x0C, 0x84, 0x01,
+	0x00, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x0B, 0x0A, 0x07, 0x80, 0x00, 0x01, 0x0D, 0x03, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02,
+	0x0F, 0x01, 0x09, 0x80, 0x00, 0x01, 0x05, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x01, 0x01, 0x07, 0x80, 0x00, 0x02, 0x0F, 0x01, 0x09, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x10, 0x03, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x06, 0x08, 0x01, 0x09, 0x00, 0x0B, 0x01, 0x07, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x08, 0x0C, 0x01, 0x0D, 0x0C, 0x0F, 0x87, 0x00, 0x00,
+	0x01, 0x84, 0x00, 0x02, 0x09, 0x01, 0x0E, 0x81, 0x0C, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x10, 0x01, 0x0E, 0x02, 0x05, 0x03,
+	0x0B, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x0B, 0x81, 0x0C, 0x03, 0x10, 0x01, 0x0C, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x0D,
+	0x03, 0x02, 0x0E, 0x01, 0x09, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x04, 0x03, 0x02, 0x0E, 0x01, 0x06, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x02, 0x0A, 0x01, 0x08, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x04, 0x03, 0x02, 0x0C, 0x0A, 0x01, 0x0F, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x01, 0x06, 0x05, 0x80, 0x06, 0x01, 0x01, 0x07, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x04, 0x03, 0x02, 0x10, 0x01, 0x0C, 0x86, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x00, 0x04, 0x82, 0x01, 0x00, 0x09, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x04, 0x83, 0x01, 0x00, 0x09, 0x88, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x01, 0x0B, 0x10, 0x80, 0x01, 0x01, 0x04, 0x08, 0x86, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x09, 0x01, 0x88, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x04, 0x08, 0x04, 0x01, 0x03, 0x07, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x0B, 0x0A, 0x01, 0x03, 0x09, 0x8A, 0x00, 0x00, 0x01,
+	0x84, 0x00, 0x01, 0x04, 0x01, 0x8D, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x0B, 0x10, 0x80, 0x01, 0x01, 0x0D, 0x02, 0x88, 0x00, 0x00, 0x01, 0x84,
+	0x00, 0x01, 0x0B, 0x04, 0x80, 0x01, 0x01, 0x07, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x08, 0x04, 0x01, 0x03, 0x06, 0x87, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x80, 0x11, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x06, 0x12, 0x88, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x0D, 0x13, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x01, 0x06, 0x88, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x14, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x15, 0x07, 0x16, 0x00, 0x17, 0x18, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x17, 0x16, 0x80, 0x00, 0x02,
+	0x19, 0x17, 0x1A, 0x80, 0x00, 0x01, 0x15, 0x17, 0x84, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x1B, 0x80, 0x1C, 0x00, 0x15, 0x87, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x04, 0x13, 0x1D, 0x11, 0x1E, 0x06, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x1A, 0x1C, 0x01, 0x0A, 0x16, 0x0F, 0x86, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x01, 0x17, 0x1F, 0x81, 0x00, 0x01, 0x02, 0x17, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x20, 0x17, 0x81, 0x00, 0x01, 0x11,
+	0x17, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x21, 0x22, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x23, 0x24, 0x25, 0x0E, 0x88, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x04, 0x17, 0x0B, 0x1F, 0x26, 0x27, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x28, 0x01, 0x21, 0x13, 0x05, 0x01, 0x15, 0x86,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x17, 0x03, 0x80, 0x00, 0x02, 0x29, 0x01, 0x1C, 0x80, 0x00, 0x01, 0x2A, 0x2B, 0x84, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x05, 0x07, 0x01, 0x17, 0x2C, 0x01, 0x06, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x10, 0x2D, 0x01, 0x21, 0x2B, 0x89, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x05, 0x1A, 0x0A, 0x01, 0x2E, 0x2F, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x07, 0x30, 0x81, 0x00, 0x01, 0x2F, 0x22, 0x85,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x31, 0x01, 0x32, 0x80, 0x00, 0x01, 0x0E, 0x33, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2E, 0x2C, 0x89,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x07, 0x01, 0x21, 0x1E, 0x33, 0x34, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x01, 0x2C, 0x04, 0x07, 0x33,
+	0x2E, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x35, 0x36, 0x80, 0x00, 0x02, 0x28, 0x01, 0x15, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x08,
+	0x01, 0x37, 0x00, 0x10, 0x01, 0x34, 0x80, 0x00, 0x01, 0x03, 0x0E, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23, 0x01, 0x08, 0x80, 0x00, 0x01,
+	0x2B, 0x0D, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x10, 0x01, 0x15, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x01, 0x1F, 0x88, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x06, 0x31, 0x01, 0x02, 0x00, 0x20, 0x01, 0x02, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x31, 0x01, 0x32, 0x80, 0x00, 0x01,
+	0x0E, 0x33, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2E, 0x2C, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x29, 0x80, 0x00, 0x02,
+	0x15, 0x01, 0x27, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x21, 0x80, 0x00, 0x02, 0x1F, 0x01, 0x23, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x02, 0x0F, 0x01, 0x0F, 0x80, 0x00, 0x02, 0x0F, 0x01, 0x15, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x09, 0x38, 0x21, 0x00, 0x39, 0x17, 0x01, 0x19,
+	0x31, 0x01, 0x14, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x3A, 0x01, 0x80, 0x09, 0x02, 0x17, 0x04, 0x3B, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x01, 0x10, 0x2C, 0x8C, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x01, 0x37, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x0D, 0x2F, 0x00, 0x27, 0x35,
+	0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x31, 0x01, 0x32, 0x80, 0x00, 0x01, 0x0E, 0x33, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2E, 0x2C,
+	0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x02, 0x01, 0x0B, 0x81, 0x00, 0x01, 0x2D, 0x25, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x02,
+	0x81, 0x00, 0x01, 0x39, 0x36, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x0C, 0x01, 0x0F, 0x80, 0x00, 0x02, 0x0F, 0x01, 0x15, 0x86, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x08, 0x1E, 0x3B, 0x14, 0x01, 0x19, 0x01, 0x29, 0x17, 0x2E, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x17, 0x01, 0x2C, 0x2F,
+	0x2A, 0x22, 0x26, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x10, 0x2C, 0x8C, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x01, 0x37, 0x88, 0x00, 0x00,
+	0x01, 0x88, 0x00, 0x04, 0x24, 0x01, 0x00, 0x30, 0x1E, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x31, 0x01, 0x32, 0x80, 0x00, 0x01, 0x0E, 0x33,
+	0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2E, 0x2C, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x3A, 0x01, 0x3C, 0x81, 0x00, 0x01, 0x34, 0x1D,
+	0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x02, 0x81, 0x00, 0x01, 0x35, 0x09, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x1A, 0x01, 0x23,
+	0x80, 0x00, 0x02, 0x0C, 0x01, 0x15, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x08, 0x15, 0x01, 0x1C, 0x2E, 0x00, 0x0A, 0x22, 0x34, 0x24, 0x85, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x01, 0x06, 0x01, 0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x10, 0x2C, 0x8C, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x3B,
+	0x37, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x14, 0x01, 0x24, 0x01, 0x1B, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x1A, 0x01, 0x18, 0x80,
+	0x00, 0x01, 0x1D, 0x33, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2E, 0x2C, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x1B, 0x01, 0x08, 0x81,
+	0x00, 0x01, 0x38, 0x17, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x36, 0x80, 0x00, 0x02, 0x32, 0x01, 0x29, 0x87, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x06, 0x2D, 0x2F, 0x0B, 0x08, 0x34, 0x01, 0x15, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x07, 0x39, 0x3D, 0x17, 0x00, 0x3A, 0x3E, 0x01, 0x18,
+	0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x20, 0x3D, 0x1C, 0x80, 0x00, 0x01, 0x0F, 0x0E, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x10, 0x2F,
+	0x8C, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x35, 0x07, 0x3C, 0x87, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x2C, 0x39, 0x05, 0x87, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x06, 0x19, 0x39, 0x13, 0x00, 0x1F, 0x01, 0x33, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2E, 0x2C, 0x89, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x06, 0x38, 0x22, 0x14, 0x0B, 0x1C, 0x03, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x01, 0x03, 0x16, 0x3C, 0x26, 0x35, 0x88, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x06, 0x1B, 0x3D, 0x01, 0x03, 0x25, 0x01, 0x15, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x0A, 0x01, 0x23, 0x00, 0x14,
+	0x01, 0x0D, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x15, 0x2D, 0x01, 0x35, 0x03, 0x3F, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x10, 0x2F,
+	0x8C, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x07, 0x80, 0x01, 0x00, 0x29, 0x86, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x06, 0x01, 0x25, 0x87, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x05, 0x16, 0x39, 0x3B, 0x30, 0x24, 0x01, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2E, 0x2C, 0x89, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x01, 0x0C, 0x2D, 0x80, 0x01, 0x01, 0x33, 0x1B, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x01, 0x1D, 0x3E, 0x01, 0x03, 0x1B, 0x88,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x32, 0x00, 0x31, 0x01, 0x15, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x19, 0x14,
+	0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x32, 0x12, 0x87, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x1B, 0x01, 0x31, 0x87,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x80, 0x19, 0x89, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x03, 0x01, 0x02, 0x00, 0x14, 0x8A, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x31, 0x01, 0x15, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x21, 0x0D, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x02, 0x8C, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x0F, 0x33, 0x15,
+	0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x01,
+	0x16, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x02, 0x8C, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x02, 0x19,
+	0x38, 0x27, 0x84, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x1E, 0x33, 0x2D, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x1B,
+	0x01, 0x19, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x3B, 0x24, 0x89, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x8C, 0x00, 0x02, 0x19, 0x01, 0x27, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x29, 0x01, 0x3A, 0x1B, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x02, 0x1B, 0x01, 0x19, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0E, 0x01, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x01, 0x30, 0x1C, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x02, 0x19, 0x01, 0x27, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x24, 0x2D,
+	0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x1B, 0x01, 0x19, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x11, 0x8B, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x30, 0x25, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83,
+	0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x0B, 0x36, 0x26, 0x24, 0x18, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0x18, 0x09, 0x10, 0x02,
+	0x87, 0x00, 0x00, 0x01, 0x89, 0x00, 0x05, 0x1F, 0x1C, 0x16, 0x14, 0x01, 0x27, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x2F, 0x2E, 0x35, 0x36,
+	0x27, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x27, 0x26, 0x17, 0x80, 0x09, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x1B, 0x01, 0x19, 0x06,
+	0x25, 0x29, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0B, 0x1C, 0x8B, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x30, 0x10, 0x80, 0x00, 0x01, 0x36,
+	0x2B, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x05, 0x3E, 0x0A, 0x28, 0x0A, 0x01, 0x08, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x11, 0x01, 0x2E, 0x24, 0x01, 0x87, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x06, 0x36, 0x01, 0x2A, 0x2C, 0x3D, 0x01, 0x27, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x80, 0x05, 0x02, 0x3D, 0x04, 0x3F, 0x88, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x05, 0x2B, 0x04, 0x2A, 0x0D, 0x39, 0x2A, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x1B, 0x01, 0x3F, 0x04, 0x2A, 0x01,
+	0x36, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x31, 0x01, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x88, 0x00, 0x05, 0x30, 0x21, 0x00, 0x28, 0x03, 0x31,
+	0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x00, 0x08, 0x81, 0x00, 0x01, 0x35, 0x16, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x0E, 0x3D, 0x8A, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2D,
+	0x28, 0x80, 0x00, 0x02, 0x16, 0x01, 0x27, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x25, 0x03, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x0F,
+	0x01, 0x14, 0x00, 0x1A, 0x01, 0x1A, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x1B, 0x01, 0x1C, 0x80, 0x00, 0x01, 0x2F, 0x2E, 0x85, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x02, 0x31, 0x01, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x30, 0x21, 0x09, 0x01, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x14, 0x22, 0x12, 0x83, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x04, 0x14, 0x15, 0x36, 0x05, 0x17, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x23, 0x01, 0x10, 0x11, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x02, 0x20, 0x01, 0x23, 0x80, 0x00, 0x02, 0x19, 0x01, 0x27, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x25, 0x35, 0x8A, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x06, 0x1A, 0x01, 0x08, 0x00, 0x12, 0x01, 0x12, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x1B, 0x01, 0x19, 0x80, 0x00, 0x01, 0x17, 0x2D,
+	0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x31, 0x01, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0x30, 0x2D, 0x01, 0x15, 0x87, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x3C, 0x09, 0x3D, 0x01, 0x14, 0x83, 0x00, 0x83, 0x01, 0x80,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x26, 0x01, 0x2A, 0x10, 0x03, 0x17, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0x11, 0x0A, 0x01, 0x1D, 0x87,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x18, 0x01, 0x23, 0x80, 0x00, 0x02, 0x19, 0x01, 0x27, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x25, 0x05,
+	0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x3E, 0x81, 0x01, 0x00, 0x0A, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x1B, 0x01, 0x19, 0x80, 0x00,
+	0x01, 0x24, 0x30, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x31, 0x01, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0x30, 0x2C, 0x01, 0x25,
+	0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x02, 0x38, 0x81, 0x01, 0x05, 0x15, 0x11,
+	0x31, 0x1A, 0x18, 0x0F, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x31, 0x01, 0x29, 0x80, 0x00, 0x01, 0x05, 0x17, 0x87, 0x00, 0x00,
+	0x01, 0x8A, 0x00, 0x02, 0x11, 0x01, 0x37, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x0B, 0x01, 0x1F, 0x80, 0x00, 0x02, 0x0B, 0x01, 0x27, 0x84,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x28, 0x38, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x37, 0x2D, 0x37, 0x24, 0x27, 0x89, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x02, 0x1B, 0x01, 0x19, 0x80, 0x00, 0x01, 0x24, 0x38, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x31, 0x01, 0x32, 0x8A, 0x00, 0x00,
+	0x01, 0x88, 0x00, 0x04, 0x30, 0x24, 0x1E, 0x01, 0x02, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x81,
+	0x00, 0x01, 0x18, 0x2B, 0x8E, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x08, 0x01, 0x16, 0x00, 0x1F, 0x01, 0x17, 0x87, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x05, 0x05, 0x12, 0x00, 0x1B, 0x01, 0x1B, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x06, 0x2E, 0x04, 0x20, 0x14, 0x2F, 0x01, 0x27, 0x84,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1C, 0x2D, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x1F, 0x01, 0x22, 0x25, 0x17, 0x15, 0x88, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x02, 0x1B, 0x01, 0x19, 0x80, 0x00, 0x01, 0x24, 0x38, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x31, 0x01, 0x32, 0x8A, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x05, 0x30, 0x24, 0x00, 0x0A, 0x3E, 0x32, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00, 0x04,
+	0x01, 0x00, 0x20, 0x26, 0x3B, 0x8F, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x21, 0x01, 0x33, 0x2E, 0x2B, 0x17, 0x87, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x04, 0x28, 0x39, 0x33, 0x01, 0x1E, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x06, 0x31, 0x38, 0x01, 0x3D, 0x16, 0x33, 0x27, 0x84, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x01, 0x09, 0x01, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x18, 0x3E, 0x2E, 0x26, 0x21, 0x01, 0x21, 0x87, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x02, 0x1B, 0x01, 0x19, 0x80, 0x00, 0x01, 0x24, 0x01, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x31, 0x01, 0x32, 0x8A, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x24, 0x80, 0x00, 0x01, 0x2E, 0x01, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x14, 0x01, 0x08, 0x8B, 0x00,
+	0x02, 0x01, 0x00, 0x25, 0x91, 0x01, 0x80, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x19, 0x20, 0x8A, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x14, 0x3C,
+	0x88, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x14, 0x80, 0x00, 0x00, 0x3C, 0x85, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x20, 0x8A, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x01, 0x26, 0x05, 0x81, 0x00, 0x01, 0x1E, 0x3D, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x1B, 0x01, 0x20,
+	0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x15, 0x05, 0x8F, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x28, 0x01, 0x06, 0x31, 0x1C, 0x34,
+	0x21, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x1F, 0x25, 0x05, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x19, 0x25, 0x8E, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x28, 0x2E, 0x33, 0x13, 0x09, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x02, 0x2D, 0x2E, 0x37, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x31, 0x3F, 0x80, 0x01, 0x09,
+	0x3D, 0x1B, 0x02, 0x1F, 0x29, 0x06, 0x3A, 0x0E, 0x36, 0x16, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x03, 0x3C, 0x17, 0x39, 0x03, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x01, 0x18, 0x2A, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x04, 0x0B,
+	0x36, 0x26, 0x24, 0x18, 0x87, 0x00, 0x00, 0x1A, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x05, 0x3E, 0x0A, 0x28, 0x0A, 0x01, 0x08, 0x85, 0x00, 0x02, 0x16, 0x01, 0x22, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23, 0x01, 0x0B, 0x8A, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x81, 0x00, 0x01, 0x35, 0x16, 0x85, 0x00,
+	0x03, 0x34, 0x38, 0x39, 0x3C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23, 0x01, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x81, 0x00, 0x04, 0x14, 0x15, 0x36, 0x05, 0x17, 0x84, 0x00, 0x04, 0x1A, 0x01, 0x11, 0x01, 0x27, 0x82, 0x00, 0x00, 0x01, 0x83,
+	0x00, 0x80, 0x12, 0x00, 0x20, 0x84, 0x00, 0x02, 0x0B, 0x1B, 0x12, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23, 0x01, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x26, 0x01, 0x2A, 0x10, 0x03, 0x17, 0x84, 0x00, 0x04, 0x1C, 0x01, 0x00, 0x33, 0x2B, 0x82, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x00, 0x0A, 0x81, 0x01, 0x01, 0x3E, 0x28, 0x81, 0x00, 0x04, 0x21, 0x01, 0x2D, 0x01, 0x2B, 0x83, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x00, 0x29, 0x82, 0x16, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x06, 0x17, 0x81, 0x00, 0x01, 0x17, 0x1D, 0x86, 0x00, 0x00, 0x01, 0x89,
+	0x00, 0x03, 0x23, 0x17, 0x1C, 0x1B, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x21, 0x09, 0x81, 0x00, 0x02, 0x19, 0x17, 0x31, 0x87, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x05, 0x23, 0x01, 0x32, 0x36, 0x26, 0x1F, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x08, 0x09, 0x00, 0x0E, 0x07, 0x37, 0x88,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x09, 0x15, 0x0A, 0x0B, 0x24, 0x28, 0x12, 0x00, 0x02, 0x1E, 0x36, 0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x04, 0x01,
+	0x00, 0x31, 0x01, 0x29, 0x80, 0x00, 0x01, 0x05, 0x17, 0x84, 0x00, 0x05, 0x2D, 0x26, 0x00, 0x36, 0x01, 0x14, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00,
+	0x01, 0x0A, 0x38, 0x80, 0x00, 0x09, 0x10, 0x01, 0x23, 0x00, 0x02, 0x01, 0x29, 0x00, 0x14, 0x1C, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x17,
+	0x2A, 0x2B, 0x05, 0x01, 0x12, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x1A, 0x01, 0x1C, 0x00, 0x06, 0x01, 0x18, 0x86, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x05, 0x0E, 0x01, 0x21, 0x1E, 0x01, 0x1B, 0x85, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x23, 0x01, 0x11, 0x80, 0x00, 0x02, 0x3A, 0x3B, 0x19,
+	0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x23, 0x01, 0x34, 0x2A, 0x22, 0x01, 0x1D, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x06, 0x3B, 0x05,
+	0x2C, 0x2F, 0x01, 0x1F, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x0A, 0x17, 0x35, 0x01, 0x1D, 0x03, 0x3E, 0x26, 0x30, 0x10, 0x01, 0x26, 0x84, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x16, 0x00, 0x1F, 0x01, 0x17, 0x83, 0x00, 0x02, 0x11, 0x01, 0x18, 0x80, 0x00, 0x01, 0x01,
+	0x24, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x0A, 0x38, 0x81, 0x00, 0x04, 0x3B, 0x1F, 0x00, 0x07, 0x3E, 0x87, 0x00, 0x00, 0x01, 0x89, 0x00,
+	0x01, 0x3B, 0x25, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x1C, 0x01, 0x08, 0x01, 0x1C, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x19, 0x03,
+	0x09, 0x80, 0x00, 0x01, 0x18, 0x20, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x30, 0x25, 0x80, 0x00, 0x01, 0x2C, 0x2A, 0x88, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x02, 0x23, 0x01, 0x09, 0x80, 0x00, 0x01, 0x2A, 0x39, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x06, 0x01, 0x36, 0x80, 0x00, 0x01,
+	0x13, 0x2A, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x17, 0x01, 0x02, 0x00, 0x14, 0x01, 0x2B, 0x80, 0x00, 0x01, 0x1C, 0x35, 0x84, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x21, 0x01, 0x33, 0x2E, 0x2B, 0x17, 0x83, 0x00, 0x01, 0x25, 0x01, 0x82, 0x39, 0x00, 0x0D, 0x81,
+	0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x0A, 0x38, 0x80, 0x00, 0x06, 0x02, 0x01, 0x18, 0x00, 0x1F, 0x01, 0x25, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x01, 0x21, 0x33, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x05, 0x39, 0x2D, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x1A, 0x01, 0x31, 0x89,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x28, 0x05, 0x00, 0x20, 0x01, 0x1F, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23, 0x01, 0x0B, 0x80, 0x00,
+	0x02, 0x31, 0x01, 0x31, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x06, 0x01, 0x81, 0x00, 0x01, 0x1E, 0x2E, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x01, 0x17, 0x30, 0x81, 0x00, 0x01, 0x33, 0x36, 0x80, 0x00, 0x01, 0x37, 0x3B, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01,
+	0x19, 0x20, 0x86, 0x00, 0x01, 0x05, 0x0A, 0x81, 0x29, 0x02, 0x25, 0x01, 0x31, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x0A, 0x3B, 0x80, 0x34,
+	0x01, 0x01, 0x07, 0x81, 0x00, 0x04, 0x24, 0x39, 0x3E, 0x07, 0x3C, 0x83, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x0C, 0x01, 0x27, 0x89, 0x00, 0x00,
+	0x01, 0x88, 0x00, 0x02, 0x1D, 0x01, 0x21, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x0C, 0x01, 0x18, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04,
+	0x08, 0x01, 0x0C, 0x27, 0x03, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23, 0x01, 0x0B, 0x80, 0x00, 0x02, 0x12, 0x01, 0x1B, 0x85, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x01, 0x06, 0x39, 0x81, 0x00, 0x01, 0x25, 0x2E, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x17, 0x2D, 0x81, 0x00, 0x01, 0x33,
+	0x0E, 0x80, 0x00, 0x01, 0x37, 0x01, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x1B, 0x01, 0x0F, 0x82, 0x00, 0x01, 0x03,
+	0x25, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x06, 0x0A, 0x38, 0x3A, 0x06, 0x07, 0x01, 0x17, 0x81, 0x00, 0x03, 0x0B, 0x07, 0x01, 0x34, 0x83, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x01, 0x34, 0x2E, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x1B, 0x01, 0x07, 0x01, 0x1B, 0x87, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x02, 0x12, 0x01, 0x15, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x3F, 0x1E, 0x2F, 0x1D, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23,
+	0x01, 0x32, 0x80, 0x00, 0x02, 0x02, 0x01, 0x0F, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x06, 0x3D, 0x81, 0x00, 0x01, 0x25, 0x13, 0x87, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x01, 0x17, 0x2D, 0x81, 0x00, 0x01, 0x33, 0x0E, 0x80, 0x00, 0x01, 0x37, 0x01, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x83, 0x00, 0x01, 0x32, 0x26, 0x80, 0x3B, 0x04, 0x01, 0x29, 0x00, 0x1D, 0x2E, 0x83, 0x00, 0x01, 0x1E, 0x05, 0x80, 0x00, 0x00, 0x01, 0x82,
+	0x00, 0x01, 0x0A, 0x38, 0x81, 0x00, 0x01, 0x07, 0x33, 0x83, 0x00, 0x02, 0x37, 0x01, 0x37, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x16, 0x01,
+	0x1A, 0x80, 0x18, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x0D, 0x07, 0x00, 0x2B, 0x0D, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x05, 0x04, 0x38,
+	0x14, 0x3C, 0x24, 0x02, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x09, 0x35, 0x01, 0x15, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x23, 0x01,
+	0x34, 0x08, 0x32, 0x04, 0x2B, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x06, 0x3D, 0x81, 0x00, 0x01, 0x25, 0x13, 0x87, 0x00, 0x00, 0x01, 0x84,
+	0x00, 0x01, 0x17, 0x2D, 0x81, 0x00, 0x01, 0x33, 0x0E, 0x80, 0x00, 0x01, 0x37, 0x01, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00,
+	0x07, 0x14, 0x3B, 0x0C, 0x19, 0x00, 0x19, 0x0A, 0x15, 0x86, 0x00, 0x00, 0x32, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x0A, 0x38, 0x81, 0x00,
+	0x01, 0x17, 0x3E, 0x84, 0x00, 0x01, 0x3B, 0x0E, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x2F, 0x82, 0x01, 0x00, 0x1F, 0x87, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x01, 0x24, 0x05, 0x80, 0x00, 0x02, 0x0F, 0x3D, 0x16, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x1A, 0x0D, 0x80, 0x01, 0x01, 0x34,
+	0x14, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0F, 0x01, 0x35, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x23, 0x01, 0x17, 0x80, 0x01, 0x01,
+	0x0D, 0x12, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x06, 0x01, 0x81, 0x00, 0x01, 0x25, 0x13, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x17,
+	0x3F, 0x81, 0x00, 0x01, 0x01, 0x0E, 0x80, 0x00, 0x01, 0x37, 0x01, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x22, 0x0C,
+	0x17, 0x2C, 0x3B, 0x28, 0x1B, 0x26, 0x89, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x0A, 0x38, 0x80, 0x18, 0x05, 0x29, 0x3E, 0x21, 0x00, 0x3D, 0x06,
+	0x80, 0x19, 0x02, 0x0A, 0x01, 0x31, 0x82, 0x00, 0x00, 0x01, 0x87, 0x00, 0x82, 0x19, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00,
+	0x01, 0x20, 0x12, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x14, 0x20, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x01, 0x14, 0x13, 0x00, 0x09, 0x29, 0x23, 0x10, 0x89, 0x00, 0x00, 0x01, 0x82,
+	0x00, 0x00, 0x2A, 0x81, 0x01, 0x01, 0x35, 0x1D, 0x80, 0x00, 0x01, 0x3A, 0x3E, 0x80, 0x01, 0x01, 0x33, 0x27, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x08, 0x12, 0x0A, 0x0C, 0x26, 0x00, 0x22, 0x1A, 0x0E, 0x36, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00,
+	0x81, 0x3C, 0x84, 0x00, 0x80, 0x0F, 0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x19, 0x2E, 0x18,
+	0x81, 0x01, 0x01, 0x21, 0x3B, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x05,
+	0x34, 0x1A, 0x0B, 0x19, 0x00, 0x0F, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00,
+	0x05, 0x1B, 0x01, 0x26, 0x2C, 0x28, 0x2B, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84,
+	0x00, 0x02, 0x18, 0x15, 0x1A, 0x8C, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+};
+const ardPort::PackedImage picKB0_packed = {240, 95, picKB0_palette, picKB0_data, 7221};
+
+// picKB1: 240×95, 64色, 45600 → 7784 バイト
+const uint16_t picKB1_palette[] = {
+	0xFFFF, 0x0000, 0xB5B6, 0x1082, 0x4228, 0x2104, 0xA534, 0x7BCF, 0xD69A, 0x8C51, 0x52AA, 0xEF7D, 0xC618, 0x31A6, 0x9CD3, 0xDEFB,
+	0x6B4D, 0xE71C, 0xEF5D, 0xCE59, 0xE73C, 0xD6BA, 0xDEDB, 0x4A69, 0x94B2, 0x18C3, 0x4208, 0xBDD7, 0xB596, 0x0020, 0x3186, 0x632C,
+	0xF7BE, 0x8430, 0xBDF7, 0x2124, 0x630C, 0x7BEF, 0xA514, 0x9492, 0xAD55, 0xAD75, 0x738E, 0x5AEB, 0x2965, 0x73AE, 0x528A, 0x6B6D,
+	0x39C7, 0x0861, 0xFFDF, 0x5ACB, 0xCE79, 0x4A49, 0x39E7, 0x10A2, 0xF79E, 0x9CF3, 0x8C71, 0x2945, 0x8410, 0xC638, 0x0841, 0x18E3,
+};
+const uint8_t picKB1_data[] = {
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x02, 0x02, 0x03, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x02, 0x05, 0x01, 0x05, 0x06, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x04, 0x07, 0x03, 0x01, 0x04, 0x08, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x02, 0x80, 0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x04,
+	0x82, 0x01, 0x00, 0x09, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x07, 0x80, 0x01, 0x01, 0x0A, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
+	0x0C, 0x83, 0x01, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x07, 0x03, 0x01, 0x0D, 0x08, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00,
+	0x07, 0x80, 0x01, 0x01, 0x0A, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x0B, 0x04, 0x01, 0x03, 0x06, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x00, 0x0D, 0x80, 0x01, 0x00, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x08, 0x01, 0x0A, 0x0C, 0x04, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x05, 0x09, 0x01, 0x0E, 0x02, 0x05, 0x03, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x04, 0x0D, 0x01, 0x88, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x01, 0x04, 0x0D, 0x81, 0x0C, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x07, 0x01, 0x0E, 0x02, 0x05, 0x06, 0x89, 0x00, 0x00,
+	0x01, 0x82, 0x00, 0x00, 0x0B, 0x81, 0x0C, 0x02, 0x02, 0x01, 0x09, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x09, 0x01, 0x06, 0x0C, 0x0D, 0x03,
+	0x0B, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x09, 0x01, 0x0E, 0x02, 0x03, 0x10, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x04, 0x03, 0x02,
+	0x10, 0x01, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x10, 0x06, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x06, 0x05, 0x0F,
+	0x00, 0x0C, 0x01, 0x09, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x0E, 0x04, 0x80, 0x00, 0x01, 0x09, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x03, 0x0C, 0x03, 0x09, 0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x04, 0x0A, 0x8C, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x03, 0x10, 0x8D,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x07, 0x03, 0x0B, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x04, 0x0D, 0x80, 0x00, 0x02, 0x02, 0x01, 0x0C,
+	0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x05, 0x0D, 0x80, 0x00, 0x02, 0x09, 0x01, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x0F, 0x01,
+	0x09, 0x00, 0x0B, 0x01, 0x10, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x06, 0x01, 0x06,
+	0x88, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x0F, 0x80, 0x0D, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x0A, 0x07, 0x09, 0x01, 0x88, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x05, 0x04, 0x0A, 0x05, 0x01, 0x0A, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x06, 0x0C, 0x01, 0x0E, 0x04, 0x01, 0x10, 0x0B,
+	0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x0F, 0x01, 0x09, 0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x07, 0x01, 0x09, 0x0F, 0x04, 0x05, 0x88,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x04, 0x80, 0x00, 0x02, 0x0C, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0C, 0x01, 0x0C,
+	0x80, 0x00, 0x01, 0x05, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x08, 0x03, 0x0D,
+	0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x80, 0x01, 0x01, 0x04, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x0F, 0x01, 0x0F, 0x09, 0x01, 0x88,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x04, 0x03, 0x02, 0x0E, 0x01, 0x10, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x06, 0x0C, 0x01, 0x0A, 0x02, 0x0E,
+	0x01, 0x09, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x07, 0x01, 0x0B, 0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x0B, 0x0A, 0x80, 0x01, 0x01,
+	0x05, 0x0F, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x0A, 0x01, 0x08, 0x0B, 0x0D, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x09,
+	0x01, 0x0C, 0x80, 0x00, 0x80, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x08, 0x03,
+	0x0D, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x03, 0x0C, 0x0E, 0x03, 0x0D, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x10, 0x0A, 0x00, 0x09,
+	0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x80, 0x02, 0x80, 0x00, 0x01, 0x04, 0x03, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x02,
+	0x80, 0x00, 0x01, 0x0D, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x05, 0x04, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x08, 0x0D, 0x07,
+	0x10, 0x01, 0x04, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x08, 0x03, 0x80, 0x01, 0x02, 0x10, 0x01, 0x0C, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x02, 0x09, 0x01, 0x0C, 0x80, 0x00, 0x80, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03,
+	0x0F, 0x03, 0x0D, 0x0B, 0x8A, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x02, 0x0E, 0x01, 0x0C, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x0B, 0x01, 0x0C,
+	0x00, 0x09, 0x01, 0x88, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x04, 0x01, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x0C, 0x80, 0x00,
+	0x80, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x08, 0x01, 0x09, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00, 0x80, 0x04, 0x80, 0x00, 0x02, 0x0E,
+	0x01, 0x02, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x0C, 0x0F, 0x06, 0x01, 0x08, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0C, 0x01, 0x0C,
+	0x80, 0x00, 0x01, 0x03, 0x04, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x04, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x80, 0x0D, 0x00, 0x0B,
+	0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x80, 0x10, 0x80, 0x00, 0x02, 0x06, 0x01, 0x0C, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x0C, 0x84, 0x01,
+	0x00, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x0B, 0x0A, 0x07, 0x80, 0x00, 0x01, 0x0D, 0x03, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02,
+	0x0F, 0x01, 0x09, 0x80, 0x00, 0x01, 0x05, 0x04, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x01, 0x01, 0x07, 0x80, 0x00, 0x02, 0x0F, 0x01, 0x09, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x10, 0x03, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x06, 0x08, 0x01, 0x09, 0x00, 0x0B, 0x01, 0x07, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x08, 0x0C, 0x01, 0x0D, 0x0C, 0x0F, 0x87, 0x00, 0x00,
+	0x01, 0x84, 0x00, 0x02, 0x09, 0x01, 0x0E, 0x81, 0x0C, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x10, 0x01, 0x0E, 0x02, 0x05, 0x03,
+	0x0B, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x0B, 0x81, 0x0C, 0x03, 0x10, 0x01, 0x0C, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x0D,
+	0x03, 0x02, 0x0E, 0x01, 0x09, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x04, 0x03, 0x02, 0x0E, 0x01, 0x06, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x02, 0x0A, 0x01, 0x08, 0x8C, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x04, 0x03, 0x02, 0x0C, 0x0A, 0x01, 0x0F, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x01, 0x06, 0x05, 0x80, 0x06, 0x01, 0x01, 0x07, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x04, 0x03, 0x02, 0x10, 0x01, 0x0C, 0x86, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x00, 0x04, 0x82, 0x01, 0x00, 0x09, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x04, 0x83, 0x01, 0x00, 0x09, 0x88, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x01, 0x0B, 0x10, 0x80, 0x01, 0x01, 0x04, 0x08, 0x86, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x09, 0x01, 0x88, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x04, 0x08, 0x04, 0x01, 0x03, 0x07, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x0B, 0x0A, 0x01, 0x03, 0x09, 0x8A, 0x00, 0x00, 0x01,
+	0x84, 0x00, 0x01, 0x04, 0x01, 0x8D, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x0B, 0x10, 0x80, 0x01, 0x01, 0x0D, 0x02, 0x88, 0x00, 0x00, 0x01, 0x84,
+	0x00, 0x01, 0x0B, 0x04, 0x80, 0x01, 0x01, 0x07, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x08, 0x04, 0x01, 0x03, 0x06, 0x87, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x0C, 0x0D, 0x80, 0x01, 0x01, 0x04, 0x0C, 0x88, 0x00, 0x00,
+	0x01, 0x80, 0x00, 0x02, 0x0F, 0x01, 0x0A, 0x80, 0x00, 0x02, 0x04, 0x01, 0x0A, 0x80, 0x00, 0x01, 0x0A, 0x01, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x00, 0x09, 0x84, 0x01, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x04, 0x82, 0x01, 0x01, 0x0D, 0x02, 0x8B, 0x00, 0x00, 0x01, 0x81, 0x00, 0x85,
+	0x01, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x0B, 0x05, 0x03, 0x0B, 0x80, 0x00, 0x02, 0x0B, 0x03, 0x05, 0x8A, 0x00, 0x00, 0x01,
+	0x82, 0x00, 0x01, 0x04, 0x01, 0x82, 0x00, 0x80, 0x04, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00, 0x01, 0x84,
+	0x00, 0x01, 0x0E, 0x05, 0x80, 0x01, 0x01, 0x10, 0x0F, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x04, 0x82, 0x01, 0x01, 0x0D, 0x02, 0x88, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x02, 0x02, 0x01, 0x05, 0x80, 0x09, 0x02, 0x05, 0x01, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x03, 0x0D, 0x80,
+	0x00, 0x02, 0x03, 0x01, 0x05, 0x80, 0x00, 0x01, 0x0D, 0x04, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x10, 0x82, 0x09, 0x87, 0x00,
+	0x00, 0x01, 0x81, 0x00, 0x01, 0x04, 0x01, 0x80, 0x0C, 0x03, 0x06, 0x0D, 0x01, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x81, 0x00, 0x80, 0x09, 0x02, 0x10,
+	0x01, 0x05, 0x80, 0x09, 0x00, 0x06, 0x8A, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x06, 0x01, 0x10, 0x80, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x8A, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x01, 0x04, 0x01, 0x82, 0x00, 0x80, 0x04, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00,
+	0x01, 0x83, 0x00, 0x04, 0x07, 0x01, 0x04, 0x06, 0x07, 0x80, 0x03, 0x00, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x80, 0x0C,
+	0x03, 0x06, 0x03, 0x01, 0x0F, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x05, 0x03, 0x0F, 0x80, 0x00, 0x02, 0x0F, 0x01, 0x05, 0x87, 0x00, 0x00,
+	0x01, 0x81, 0x00, 0x06, 0x04, 0x01, 0x00, 0x0F, 0x01, 0x04, 0x01, 0x80, 0x00, 0x01, 0x01, 0x07, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09,
+	0x01, 0x0C, 0x8B, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x04, 0x01, 0x81, 0x00, 0x02, 0x02, 0x01, 0x0E, 0x8A, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02,
+	0x0C, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x82, 0x00, 0x05, 0x0D, 0x01, 0x0C, 0x0F, 0x01, 0x04, 0x8B, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x04,
+	0x01, 0x82, 0x00, 0x80, 0x04, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x0F, 0x01,
+	0x04, 0x81, 0x00, 0x02, 0x06, 0x01, 0x10, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x81, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x87, 0x00,
+	0x00, 0x01, 0x83, 0x00, 0x02, 0x08, 0x01, 0x0A, 0x82, 0x00, 0x02, 0x04, 0x01, 0x08, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x06, 0x09, 0x01, 0x08,
+	0x0C, 0x01, 0x02, 0x01, 0x80, 0x0C, 0x01, 0x01, 0x06, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x8B, 0x00, 0x00, 0x01, 0x81,
+	0x00, 0x01, 0x04, 0x01, 0x80, 0x00, 0x03, 0x0B, 0x0A, 0x01, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x8D, 0x00, 0x00,
+	0x01, 0x82, 0x00, 0x05, 0x0C, 0x01, 0x04, 0x10, 0x01, 0x0F, 0x8B, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x04, 0x01, 0x82, 0x00, 0x80, 0x04, 0x89,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x0E, 0x01, 0x0E, 0x82, 0x00, 0x01, 0x01, 0x03,
+	0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x80, 0x00, 0x03, 0x0B, 0x0A, 0x01, 0x08, 0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C,
+	0x01, 0x09, 0x82, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0A, 0x02, 0x01, 0x02, 0x09, 0x03, 0x08, 0x01, 0x0E, 0x06,
+	0x01, 0x08, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x09, 0x83, 0x01, 0x88, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x04, 0x82, 0x01, 0x01, 0x03,
+	0x09, 0x8B, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0x07, 0x8C,
+	0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x04, 0x01, 0x82, 0x00, 0x80, 0x04, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x82, 0x00, 0x01, 0x04, 0x01, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x04, 0x83, 0x01, 0x00,
+	0x07, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x09, 0x82, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x09,
+	0x0F, 0x01, 0x09, 0x10, 0x04, 0x00, 0x01, 0x07, 0x09, 0x01, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x10, 0x81, 0x09, 0x88, 0x00,
+	0x00, 0x01, 0x81, 0x00, 0x05, 0x04, 0x01, 0x0C, 0x02, 0x01, 0x10, 0x8C, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x8D, 0x00, 0x00,
+	0x01, 0x83, 0x00, 0x03, 0x0F, 0x01, 0x03, 0x0B, 0x8C, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x04, 0x01, 0x82, 0x00, 0x80, 0x04, 0x89, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x82, 0x00, 0x01, 0x04, 0x01, 0x88, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x81, 0x0C, 0x00, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x10, 0x82, 0x00, 0x02,
+	0x04, 0x01, 0x08, 0x86, 0x00, 0x00, 0x01, 0x82, 0x00, 0x04, 0x03, 0x10, 0x04, 0x09, 0x00, 0x80, 0x04, 0x01, 0x0A, 0x04, 0x88, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x8B, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x04, 0x01, 0x80, 0x00, 0x02, 0x10, 0x01, 0x0F, 0x8B, 0x00, 0x00,
+	0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x04,
+	0x01, 0x82, 0x00, 0x80, 0x04, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x09, 0x01,
+	0x06, 0x82, 0x00, 0x01, 0x01, 0x03, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x8D, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x05, 0x03,
+	0x0B, 0x80, 0x00, 0x02, 0x0F, 0x01, 0x05, 0x87, 0x00, 0x00, 0x01, 0x82, 0x00, 0x80, 0x04, 0x06, 0x03, 0x06, 0x00, 0x07, 0x05, 0x04, 0x07, 0x88,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x8B, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x04, 0x01, 0x80, 0x00, 0x02, 0x0C, 0x01, 0x07,
+	0x8B, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x82,
+	0x00, 0x02, 0x0A, 0x01, 0x0F, 0x80, 0x00, 0x02, 0x0B, 0x03, 0x0A, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00,
+	0x01, 0x82, 0x00, 0x02, 0x0F, 0x01, 0x04, 0x81, 0x00, 0x02, 0x06, 0x01, 0x10, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x8D, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x07, 0x02, 0x01, 0x0D, 0x02, 0x06, 0x0D, 0x01, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x09, 0x80, 0x01, 0x02,
+	0x0C, 0x00, 0x06, 0x80, 0x01, 0x00, 0x06, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x10, 0x82, 0x09, 0x00, 0x0F, 0x86, 0x00, 0x00,
+	0x01, 0x81, 0x00, 0x01, 0x04, 0x01, 0x81, 0x00, 0x02, 0x0D, 0x03, 0x0B, 0x8A, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x8D, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x0C, 0x01, 0x0D, 0x06, 0x02, 0x04, 0x01, 0x02, 0x89, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00, 0x04, 0x07, 0x01, 0x0A, 0x02, 0x09, 0x80, 0x03, 0x00, 0x0B,
+	0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x8D, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x02, 0x0D, 0x80, 0x01, 0x01, 0x0D, 0x0C, 0x88,
+	0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x02, 0x80, 0x01, 0x80, 0x00, 0x00, 0x08, 0x80, 0x01, 0x00, 0x08, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00,
+	0x09, 0x84, 0x01, 0x00, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x04, 0x01, 0x81, 0x00, 0x02, 0x06, 0x01, 0x09, 0x8A, 0x00, 0x00, 0x01,
+	0x83, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x01, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x02, 0x0D,
+	0x80, 0x01, 0x01, 0x0D, 0x02, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x05, 0x09, 0x05,
+	0x01, 0x03, 0x10, 0x0F, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x8D, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x0C, 0x01, 0x10, 0x0C,
+	0x08, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x07, 0x80, 0x01, 0x00,
+	0x04, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E,
+	0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x02, 0x0D, 0x01, 0x0A, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x0B, 0x07, 0x03, 0x01, 0x05, 0x09, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x00, 0x09, 0x82, 0x01, 0x01, 0x0D, 0x06, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x82, 0x11, 0x00, 0x12, 0x87, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x02,
+	0x11, 0x13, 0x14, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x15, 0x83, 0x00, 0x00, 0x15, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x11, 0x16,
+	0x8B, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x15, 0x82, 0x00, 0x00, 0x15, 0x85, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x15, 0x8B, 0x00, 0x00, 0x01,
+	0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x0B, 0x01, 0x0D, 0x03, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x07, 0x01,
+	0x07, 0x0C, 0x0A, 0x01, 0x07, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x09, 0x01, 0x0E, 0x0C, 0x09, 0x05, 0x01, 0x10, 0x86, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x00, 0x0A, 0x82, 0x01, 0x00, 0x17, 0x87, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x18, 0x19, 0x81, 0x01, 0x01, 0x1A, 0x15, 0x83, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x02, 0x1B, 0x01, 0x0F, 0x81, 0x00, 0x01, 0x1C, 0x1D, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x1E, 0x1F, 0x8B, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x02, 0x20, 0x01, 0x0E, 0x80, 0x00, 0x02, 0x21, 0x01, 0x13, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x22, 0x01, 0x16,
+	0x8A, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x06, 0x01, 0x06, 0x01, 0x02, 0x88, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x01, 0x03, 0x0D, 0x81, 0x00, 0x01, 0x0D, 0x0A, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x80, 0x00, 0x03, 0x0B,
+	0x0D, 0x01, 0x08, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0A, 0x23, 0x81, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x07, 0x24, 0x01, 0x0E,
+	0x0B, 0x00, 0x11, 0x25, 0x26, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x1B, 0x01, 0x0F, 0x81, 0x00, 0x01, 0x1C, 0x1D, 0x87, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x01, 0x1E, 0x1F, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x20, 0x01, 0x09, 0x00, 0x1C, 0x01, 0x27, 0x85, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x02, 0x22, 0x01, 0x15, 0x8A, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x0A, 0x0D, 0x0B, 0x01,
+	0x10, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x04, 0x01, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x81, 0x00, 0x02,
+	0x06, 0x01, 0x09, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0A, 0x23, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x28, 0x01, 0x29, 0x89, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x02, 0x1B, 0x01, 0x0F, 0x81, 0x00, 0x01, 0x1C, 0x1D, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x1E, 0x1F, 0x8B, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x05, 0x20, 0x01, 0x07, 0x16, 0x01, 0x2A, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x22, 0x01, 0x15, 0x8A, 0x00, 0x00,
+	0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x01, 0x07, 0x00, 0x0D, 0x03, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05,
+	0x08, 0x03, 0x01, 0x0D, 0x07, 0x08, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x81, 0x00, 0x02, 0x0C, 0x01, 0x09, 0x85, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x01, 0x0A, 0x23, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x2B, 0x2C, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x1B,
+	0x01, 0x0F, 0x81, 0x00, 0x01, 0x29, 0x1D, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x1E, 0x1F, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x20,
+	0x01, 0x2D, 0x1D, 0x2E, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x22, 0x01, 0x15, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x14, 0x24, 0x11,
+	0x83, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x02, 0x01, 0x02, 0x00, 0x09, 0x01, 0x08, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x02, 0x0B, 0x06, 0x0A, 0x80, 0x01, 0x00, 0x09, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01, 0x0C, 0x81, 0x00, 0x02, 0x0C, 0x01, 0x09,
+	0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0A, 0x23, 0x2F, 0x80, 0x07, 0x00, 0x28, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x30, 0x2B, 0x80,
+	0x00, 0x00, 0x17, 0x81, 0x2F, 0x00, 0x09, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x1B, 0x84, 0x01, 0x00, 0x1D, 0x87, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x01, 0x0D, 0x1F, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x20, 0x80, 0x01, 0x00, 0x31, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x22,
+	0x01, 0x15, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x32, 0x09, 0x31, 0x01, 0x14, 0x83, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x00, 0x10, 0x83, 0x01, 0x00, 0x07, 0x87, 0x00, 0x00, 0x01, 0x89, 0x00, 0x03, 0x0B, 0x05, 0x01, 0x0F, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02,
+	0x09, 0x01, 0x0C, 0x81, 0x00, 0x02, 0x0E, 0x01, 0x0E, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x0A, 0x23, 0x2B, 0x1F, 0x2F, 0x06, 0x87, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x01, 0x0D, 0x2B, 0x80, 0x00, 0x04, 0x25, 0x33, 0x2E, 0x01, 0x26, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x1B, 0x01,
+	0x18, 0x81, 0x28, 0x01, 0x2F, 0x1D, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0D, 0x1F, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x20, 0x01,
+	0x1F, 0x01, 0x25, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x22, 0x01, 0x15, 0x8A, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x02, 0x23, 0x81, 0x01,
+	0x05, 0x1B, 0x13, 0x34, 0x15, 0x16, 0x0F, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x03, 0x0D, 0x81, 0x0C, 0x01, 0x01, 0x05, 0x87,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x0F, 0x0A, 0x10, 0x81, 0x00, 0x02, 0x07, 0x01, 0x08, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x09, 0x01,
+	0x0C, 0x80, 0x00, 0x03, 0x0B, 0x05, 0x01, 0x0F, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0A, 0x2C, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01,
+	0x2B, 0x2C, 0x82, 0x00, 0x02, 0x32, 0x01, 0x26, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x1B, 0x01, 0x11, 0x81, 0x00, 0x01, 0x06, 0x1D, 0x87,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x30, 0x1F, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x20, 0x01, 0x26, 0x24, 0x01, 0x02, 0x86, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x02, 0x22, 0x01, 0x15, 0x8A, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x16, 0x35, 0x8E, 0x01, 0x80, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x02, 0x08, 0x01, 0x0E, 0x81, 0x00, 0x02, 0x0A, 0x01, 0x0F, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x0D, 0x01, 0x07, 0x0C, 0x0E, 0x03, 0x0D,
+	0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x09, 0x01, 0x0E, 0x0C, 0x09, 0x05, 0x01, 0x06, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0A, 0x0D,
+	0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x28, 0x01, 0x26, 0x81, 0x00, 0x02, 0x32, 0x01, 0x26, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x1B,
+	0x01, 0x11, 0x81, 0x00, 0x01, 0x06, 0x1D, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x30, 0x1F, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x20,
+	0x01, 0x26, 0x00, 0x36, 0x37, 0x12, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x22, 0x01, 0x15, 0x8A, 0x00, 0x04, 0x01, 0x00, 0x38, 0x2A, 0x1D,
+	0x8F, 0x01, 0x80, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x07, 0x01, 0x0F, 0x81, 0x00, 0x02, 0x06, 0x01, 0x0E, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x06, 0x0B, 0x10, 0x03, 0x01, 0x03, 0x10, 0x0F, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x09, 0x82, 0x01, 0x01, 0x0A, 0x0C, 0x87, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x01, 0x0A, 0x36, 0x8B, 0x00, 0x00, 0x01, 0x88, 0x00, 0x07, 0x2E, 0x01, 0x27, 0x08, 0x11, 0x39, 0x01, 0x26, 0x83, 0x00, 0x00,
+	0x01, 0x84, 0x00, 0x02, 0x1B, 0x01, 0x11, 0x81, 0x00, 0x01, 0x28, 0x1D, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x03, 0x1C, 0x15, 0x37, 0x25, 0x8B,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x20, 0x01, 0x26, 0x00, 0x0B, 0x37, 0x17, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x22, 0x01, 0x28, 0x81,
+	0x13, 0x87, 0x00, 0x02, 0x01, 0x00, 0x2D, 0x91, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x01, 0x33, 0x36, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x3A, 0x23, 0x81, 0x01, 0x01, 0x17, 0x11, 0x83, 0x00, 0x00, 0x01,
+	0x84, 0x00, 0x02, 0x1B, 0x01, 0x11, 0x81, 0x00, 0x01, 0x1C, 0x01, 0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x0F, 0x80, 0x01, 0x01, 0x3B, 0x14,
+	0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x20, 0x01, 0x26, 0x80, 0x00, 0x02, 0x02, 0x01, 0x3C, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x3D,
+	0x83, 0x01, 0x87, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x1B, 0x05, 0x8F, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x80, 0x32, 0x8B, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x14, 0x32, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x00, 0x38, 0x83, 0x00, 0x00, 0x38, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x08, 0x8D, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x38, 0x82, 0x00,
+	0x00, 0x32, 0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x20, 0x2D, 0x8E, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x34, 0x1E, 0x80, 0x01, 0x09, 0x31, 0x22, 0x02, 0x29, 0x28, 0x06, 0x39,
+	0x0E, 0x18, 0x27, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x03, 0x32, 0x21,
+	0x3E, 0x03, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x16, 0x33, 0x8B,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x04, 0x0B, 0x18, 0x2A, 0x3A, 0x16, 0x87, 0x00, 0x00,
+	0x15, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x37, 0x0A, 0x25, 0x0A,
+	0x01, 0x08, 0x85, 0x00, 0x02, 0x27, 0x01, 0x24, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x83, 0x11, 0x00, 0x14, 0x8A, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x01, 0x15, 0x11, 0x82, 0x00, 0x01, 0x15, 0x32, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x38, 0x3D, 0x11, 0x8A, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x01, 0x16, 0x14, 0x83, 0x00, 0x01, 0x16, 0x15, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x81, 0x11, 0x8A, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x01, 0x11, 0x0B, 0x82, 0x00, 0x80, 0x14, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x80, 0x11, 0x85, 0x00, 0x01, 0x11, 0x14, 0x82, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x81, 0x00, 0x01, 0x19, 0x27, 0x85, 0x00, 0x03, 0x30, 0x23, 0x3E, 0x32, 0x82, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x27, 0x83, 0x01, 0x00, 0x1D, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x35, 0x1E, 0x81,
+	0x00, 0x02, 0x28, 0x01, 0x34, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x38, 0x0A, 0x01, 0x31, 0x01, 0x1E, 0x13, 0x88, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x01, 0x1F, 0x0D, 0x83, 0x00, 0x01, 0x35, 0x24, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x16, 0x81, 0x01, 0x02, 0x1D, 0x35, 0x16, 0x87,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x31, 0x01, 0x02, 0x81, 0x00, 0x01, 0x2E, 0x1A, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x15, 0x80, 0x01,
+	0x00, 0x28, 0x83, 0x00, 0x02, 0x07, 0x01, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x04, 0x14, 0x1B, 0x18, 0x05, 0x21,
+	0x84, 0x00, 0x04, 0x15, 0x01, 0x13, 0x01, 0x26, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x82, 0x0B, 0x01, 0x01, 0x10, 0x8A,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x13, 0x01, 0x25, 0x80, 0x00, 0x01, 0x05, 0x10, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x30, 0x2C, 0x26,
+	0x00, 0x11, 0x2D, 0x26, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x1B, 0x01, 0x13, 0x81, 0x00, 0x02, 0x12, 0x01, 0x1B, 0x85, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x06, 0x16, 0x01, 0x02, 0x00, 0x11, 0x30, 0x1A, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x1D, 0x3F, 0x36, 0x81, 0x00, 0x01, 0x2E,
+	0x1A, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03, 0x08, 0x01, 0x31, 0x2E, 0x83, 0x00, 0x02, 0x37, 0x3E, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x80, 0x00, 0x05, 0x2A, 0x01, 0x33, 0x10, 0x03, 0x21, 0x84, 0x00, 0x04, 0x3C, 0x01, 0x00, 0x3F, 0x35, 0x82, 0x00, 0x00, 0x01, 0x80,
+	0x00, 0x04, 0x18, 0x27, 0x18, 0x1B, 0x14, 0x81, 0x00, 0x00, 0x06, 0x82, 0x27, 0x02, 0x00, 0x20, 0x21, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02,
+	0x2B, 0x03, 0x0B, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x2A, 0x01, 0x0B, 0x09, 0x3E, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0E,
+	0x01, 0x16, 0x8D, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x3F, 0x2F, 0x81, 0x00, 0x01, 0x0E, 0x3F, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x16,
+	0x01, 0x02, 0x80, 0x00, 0x01, 0x09, 0x3B, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03, 0x1D, 0x2D, 0x01, 0x26, 0x80, 0x00, 0x01, 0x2E, 0x04, 0x86,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x08, 0x01, 0x07, 0x01, 0x0F, 0x81, 0x00, 0x03, 0x26, 0x01, 0x3F, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x04, 0x01, 0x00, 0x34, 0x01, 0x28, 0x80, 0x00, 0x01, 0x05, 0x21, 0x84, 0x00, 0x05, 0x2C, 0x2A, 0x00, 0x18, 0x01, 0x14, 0x81, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x05, 0x19, 0x17, 0x3C, 0x2E, 0x31, 0x18, 0x80, 0x00, 0x07, 0x2E, 0x1E, 0x2D, 0x25, 0x21, 0x00, 0x15, 0x01, 0x83, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x02, 0x3D, 0x01, 0x27, 0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x20, 0x31, 0x36, 0x01, 0x09, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00,
+	0x01, 0x0A, 0x2E, 0x8E, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x2A, 0x31, 0x81, 0x00, 0x01, 0x1A, 0x2A, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02,
+	0x16, 0x01, 0x02, 0x80, 0x00, 0x01, 0x35, 0x24, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03, 0x1D, 0x18, 0x1F, 0x23, 0x80, 0x00, 0x01, 0x2E, 0x04,
+	0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x08, 0x01, 0x3D, 0x01, 0x07, 0x81, 0x00, 0x03, 0x36, 0x25, 0x23, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x08, 0x01, 0x00, 0x08, 0x01, 0x27, 0x00, 0x29, 0x01, 0x21, 0x83, 0x00, 0x02, 0x13, 0x01, 0x16, 0x80, 0x00, 0x01, 0x01, 0x3A, 0x81, 0x00,
+	0x00, 0x01, 0x80, 0x00, 0x01, 0x19, 0x29, 0x80, 0x00, 0x05, 0x29, 0x01, 0x11, 0x00, 0x2E, 0x2A, 0x82, 0x00, 0x01, 0x15, 0x01, 0x83, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x01, 0x3B, 0x30, 0x8C, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x18, 0x01, 0x05, 0x8A, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x1E,
+	0x2A, 0x8E, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x3D, 0x01, 0x02, 0x00, 0x0B, 0x01, 0x3D, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x16, 0x01,
+	0x1E, 0x1A, 0x01, 0x19, 0x12, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x1D, 0x27, 0x11, 0x01, 0x09, 0x00, 0x2E, 0x04, 0x86, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x04, 0x08, 0x01, 0x3D, 0x0A, 0x19, 0x80, 0x00, 0x04, 0x13, 0x01, 0x38, 0x1E, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x05, 0x2B, 0x01, 0x3F, 0x1A, 0x35, 0x21, 0x83, 0x00, 0x01, 0x2D, 0x01, 0x82, 0x3E, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00,
+	0x01, 0x19, 0x29, 0x81, 0x00, 0x04, 0x35, 0x27, 0x00, 0x2E, 0x2A, 0x82, 0x00, 0x01, 0x15, 0x01, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x25,
+	0x01, 0x34, 0x8C, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x2F, 0x80, 0x01, 0x00, 0x12, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x3B, 0x2A, 0x8E,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x3B, 0x04, 0x00, 0x39, 0x3B, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x16, 0x01, 0x2F, 0x06, 0x0E, 0x04,
+	0x3B, 0x38, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x1D, 0x27, 0x00, 0x2D, 0x03, 0x0B, 0x2E, 0x04, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x0B,
+	0x08, 0x01, 0x3D, 0x11, 0x01, 0x29, 0x00, 0x24, 0x2E, 0x00, 0x30, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x20,
+	0x38, 0x86, 0x00, 0x01, 0x05, 0x0A, 0x81, 0x28, 0x02, 0x2D, 0x01, 0x34, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x19, 0x29, 0x81, 0x00, 0x80,
+	0x10, 0x08, 0x00, 0x2E, 0x01, 0x3E, 0x37, 0x25, 0x00, 0x15, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x15, 0x01, 0x1F, 0x8D, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x04, 0x34, 0x01, 0x39, 0x01, 0x10, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00, 0x80, 0x2E, 0x8E, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04,
+	0x25, 0x01, 0x00, 0x19, 0x25, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x16, 0x01, 0x02, 0x80, 0x00, 0x02, 0x38, 0x01, 0x0E, 0x86, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x07, 0x1D, 0x27, 0x00, 0x38, 0x31, 0x3C, 0x2E, 0x04, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x0B, 0x08, 0x01, 0x3D, 0x00, 0x0D,
+	0x04, 0x20, 0x01, 0x0C, 0x00, 0x04, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x22, 0x01, 0x0F, 0x82, 0x00, 0x01,
+	0x03, 0x2D, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x19, 0x29, 0x81, 0x00, 0x04, 0x33, 0x3C, 0x00, 0x2E, 0x2F, 0x80, 0x32, 0x80, 0x00, 0x01,
+	0x15, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x17, 0x3E, 0x8E, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x04, 0x0D, 0x00, 0x3C, 0x01, 0x34,
+	0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x3A, 0x01, 0x16, 0x8D, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x15, 0x01, 0x0E, 0x01, 0x08, 0x87, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x02, 0x16, 0x01, 0x02, 0x81, 0x00, 0x01, 0x3E, 0x27, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x1D, 0x27, 0x80, 0x00,
+	0x03, 0x09, 0x3E, 0x36, 0x04, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x08, 0x01, 0x3D, 0x00, 0x39, 0x01, 0x07, 0x23, 0x80, 0x00, 0x01, 0x2E,
+	0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x12, 0x2A, 0x80, 0x1D, 0x04, 0x01, 0x28, 0x00, 0x1F, 0x1A, 0x83, 0x00,
+	0x01, 0x2F, 0x05, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x19, 0x29, 0x81, 0x00, 0x04, 0x05, 0x06, 0x00, 0x2E, 0x2A, 0x82, 0x00, 0x01, 0x15,
+	0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x02, 0x01, 0x18, 0x82, 0x16, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x06, 0x01, 0x13, 0x80,
+	0x00, 0x01, 0x2C, 0x17, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x23, 0x2C, 0x0E, 0x12, 0x1B, 0x2B, 0x21, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x02, 0x0D, 0x03, 0x0D, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x16, 0x01, 0x0E, 0x16, 0x34, 0x2A, 0x01, 0x08, 0x86, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x01, 0x3E, 0x27, 0x81, 0x00, 0x02, 0x05, 0x01, 0x04, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x08, 0x01, 0x3D, 0x80, 0x00, 0x02, 0x37,
+	0x01, 0x3A, 0x80, 0x00, 0x01, 0x33, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x14, 0x1D, 0x0C, 0x20, 0x00, 0x20,
+	0x0A, 0x1B, 0x86, 0x00, 0x00, 0x12, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x19, 0x29, 0x00, 0x14, 0x2B, 0x30, 0x80, 0x00, 0x01, 0x2E, 0x2A,
+	0x82, 0x00, 0x01, 0x15, 0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x2D, 0x84, 0x01, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01,
+	0x23, 0x10, 0x81, 0x00, 0x02, 0x1B, 0x01, 0x26, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x0B, 0x33, 0x31, 0x01, 0x1D, 0x0A, 0x16, 0x88, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x02, 0x3A, 0x01, 0x09, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x0F, 0x81, 0x01, 0x02, 0x3E, 0x0D, 0x29, 0x87, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x27, 0x81, 0x00, 0x02, 0x28, 0x01, 0x2E, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x08, 0x01, 0x3D, 0x80,
+	0x00, 0x02, 0x25, 0x01, 0x0B, 0x80, 0x00, 0x01, 0x1F, 0x2C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x24, 0x0C, 0x21,
+	0x17, 0x1D, 0x25, 0x22, 0x2A, 0x89, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x01, 0x02, 0x23, 0x2F, 0x38, 0x80, 0x00, 0x00, 0x2E, 0x82,
+	0x01, 0x01, 0x20, 0x15, 0x82, 0x01, 0x02, 0x34, 0x00, 0x01, 0x83, 0x00, 0x84, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x0B, 0x83, 0x00,
+	0x00, 0x12, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x14, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x12, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x81, 0x32, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x32, 0x82, 0x00, 0x00, 0x32, 0x82, 0x00, 0x00, 0x32, 0x82, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x01, 0x14, 0x36, 0x00, 0x09, 0x28, 0x3D, 0x10, 0x89, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00,
+	0x32, 0x85, 0x00, 0x82, 0x32, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x08, 0x11, 0x0A, 0x0C, 0x2A,
+	0x00, 0x24, 0x15, 0x0E, 0x18, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02,
+	0x20, 0x1A, 0x16, 0x81, 0x01, 0x01, 0x2B, 0x1D, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x82, 0x00, 0x05, 0x30, 0x15, 0x0B, 0x20, 0x00, 0x0F, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x82, 0x00, 0x05, 0x22, 0x01, 0x2A, 0x17, 0x25, 0x35, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x02, 0x16, 0x1B, 0x15, 0x8C, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+};
+const ardPort::PackedImage picKB1_packed = {240, 95, picKB1_palette, picKB1_data, 7656};
+
+// picKB2: 240×95, 64色, 45600 → 6989 バイト
+const uint16_t picKB2_palette[] = {
+	0xFFFF, 0x0000, 0xA534, 0xF7BE, 0xEF5D, 0x4A49, 0x738E, 0x632C, 0x2965, 0x0020, 0xD6BA, 0xE73C, 0xE71C, 0x10A2, 0xBDF7, 0xD69A,
+	0xFFDF, 0xAD75, 0x9CF3, 0x9492, 0x6B6D, 0x8410, 0x6B4D, 0x31A6, 0x73AE, 0x52AA, 0x630C, 0x3186, 0x4228, 0x39C7, 0x8430, 0xC618,
+	0x5ACB, 0x2124, 0x18E3, 0x0861, 0x0841, 0x528A, 0x7BEF, 0x4208, 0xCE59, 0xCE79, 0x94B2, 0x39E7, 0x2104, 0x8C71, 0xB5B6, 0x7BCF,
+	0xBDD7, 0x18C3, 0x5AEB, 0x8C51, 0xF79E, 0x2945, 0xA514, 0xEF7D, 0xDEFB, 0x9CD3, 0xC638, 0xB596, 0xDEDB, 0xAD55, 0x1082, 0x4A69,
+};
+const uint8_t picKB2_data[] = {
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01,
+	0x02, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x03, 0x8B, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x00, 0x04, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x05, 0x06, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x04, 0x07, 0x08, 0x00, 0x09, 0x06, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x01, 0x0B, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0x0D, 0x0E, 0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x0F, 0x10, 0x82, 0x00, 0x01, 0x11, 0x12, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x04, 0x04, 0x13, 0x14, 0x15, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x01, 0x16, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x17, 0x18,
+	0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x19, 0x1A, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x1B, 0x06, 0x89, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x04, 0x18, 0x1C, 0x00, 0x1D, 0x1E, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x09, 0x1F, 0x00, 0x20, 0x06, 0x86, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x05, 0x03, 0x19, 0x01, 0x09, 0x01, 0x19, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x04, 0x0C, 0x21, 0x22, 0x23, 0x11, 0x80,
+	0x00, 0x02, 0x0B, 0x0D, 0x0E, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x0A, 0x24, 0x25, 0x26, 0x1B, 0x21, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x01, 0x27, 0x26, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x28, 0x01, 0x29, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x11, 0x24, 0x8A, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x17, 0x18, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x15, 0x20, 0x00, 0x05, 0x2A, 0x88,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x04, 0x01, 0x0C, 0x00, 0x2B, 0x15, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x14, 0x2C, 0x0A, 0x00, 0x0A,
+	0x18, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x04, 0x18, 0x16, 0x00, 0x1E, 0x20, 0x80, 0x00, 0x01, 0x25, 0x26, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x01, 0x2D, 0x0D, 0x80, 0x00, 0x02, 0x0A, 0x01, 0x0F, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x25, 0x2D, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x01, 0x18, 0x17, 0x8C, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x0D, 0x2E, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x1D,
+	0x2F, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x13, 0x16, 0x00, 0x20, 0x02, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x30, 0x14, 0x01, 0x80,
+	0x2D, 0x02, 0x31, 0x07, 0x30, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x1B, 0x32, 0x8C, 0x00, 0x00, 0x01, 0x83, 0x00, 0x07, 0x1A, 0x33, 0x00,
+	0x18, 0x27, 0x00, 0x13, 0x27, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x2D, 0x01, 0x0C, 0x00, 0x2F, 0x22, 0x34, 0x86, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x01, 0x1A, 0x12, 0x8A, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x35, 0x33, 0x8C, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x16, 0x07, 0x89, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x1D, 0x26, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x34, 0x0C, 0x00, 0x30, 0x10, 0x88,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x07, 0x12, 0x1D, 0x09, 0x19, 0x25, 0x01, 0x20, 0x2A, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x07, 0x01, 0x15,
+	0x8B, 0x00, 0x00, 0x01, 0x83, 0x00, 0x07, 0x2F, 0x20, 0x00, 0x18, 0x32, 0x29, 0x01, 0x0F, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x35, 0x25,
+	0x07, 0x0D, 0x28, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x03, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x34, 0x01, 0x36, 0x8C, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x15, 0x2B, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2B, 0x26, 0x89, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x2F, 0x21, 0x00, 0x04, 0x01, 0x34, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x37, 0x05, 0x01, 0x1D,
+	0x33, 0x03, 0x88, 0x00, 0x00, 0x01, 0x83, 0x00, 0x08, 0x04, 0x1B, 0x21, 0x08, 0x38, 0x2B, 0x2A, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x07, 0x25, 0x01, 0x21, 0x03, 0x00, 0x0A, 0x14, 0x10, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x0A, 0x01, 0x30, 0x8C,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x39, 0x31, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x27, 0x15, 0x89, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x20, 0x1C, 0x00, 0x30, 0x01, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x28, 0x2F, 0x01, 0x21,
+	0x03, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x08, 0x10, 0x00, 0x2F, 0x19, 0x38, 0x21, 0x22, 0x31, 0x29, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x08,
+	0x07, 0x24, 0x14, 0x01, 0x36, 0x00, 0x11, 0x01, 0x10, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x3A, 0x01, 0x0A, 0x8C,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x3B, 0x01, 0x34, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x27, 0x1E, 0x89, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x84, 0x01, 0x00, 0x22, 0x86, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x1F, 0x01, 0x12, 0x87, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x07, 0x30, 0x31, 0x04, 0x06, 0x14, 0x00, 0x18, 0x32, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x08, 0x3B, 0x01, 0x3C, 0x00,
+	0x33, 0x01, 0x39, 0x15, 0x1D, 0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x28, 0x01, 0x28, 0x8C, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x02, 0x02, 0x01, 0x37, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x36, 0x3A, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x06, 0x3A, 0x0D, 0x14, 0x3A, 0x25, 0x2B, 0x3A, 0x86, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x03, 0x01, 0x13, 0x87, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x08, 0x03, 0x21, 0x3D, 0x00, 0x20, 0x19, 0x00, 0x33, 0x05, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x2A, 0x01, 0x81,
+	0x00, 0x00, 0x33, 0x80, 0x01, 0x00, 0x12, 0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x38, 0x01, 0x3B, 0x8C, 0x00, 0x00,
+	0x01, 0x88, 0x00, 0x01, 0x2D, 0x01, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x20, 0x14, 0x89, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x09, 0x30, 0x00, 0x19, 0x16, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x07, 0x10, 0x01, 0x11, 0x0A, 0x3B, 0x1D,
+	0x01, 0x0F, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x07, 0x14, 0x80, 0x00, 0x04, 0x06, 0x16, 0x00, 0x06, 0x2F, 0x85, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x05, 0x29, 0x01, 0x27, 0x34, 0x00, 0x36, 0x80, 0x01, 0x01, 0x07, 0x10, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01,
+	0x23, 0x39, 0x8C, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x18, 0x08, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x3E, 0x25,
+	0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x03, 0x01, 0x0A, 0x00, 0x01, 0x33, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01,
+	0x06, 0x21, 0x80, 0x01, 0x01, 0x27, 0x2E, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x36, 0x08, 0x81, 0x00, 0x04, 0x0C, 0x08, 0x1C, 0x08, 0x0F,
+	0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x2D, 0x2C, 0x80, 0x01, 0x04, 0x21, 0x1E, 0x0E, 0x17, 0x01, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x01, 0x1C, 0x16, 0x8C, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x05, 0x07, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x00, 0x03, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x37, 0x88, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x01, 0x01, 0x34, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x3A, 0x0A, 0x83, 0x00, 0x00, 0x38, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x80,
+	0x04, 0x82, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x13, 0x31, 0x8C, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x02, 0x0C, 0x01, 0x3B, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x01, 0x04, 0x01, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02,
+	0x04, 0x01, 0x0E, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x33, 0x31, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x01, 0x1D, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x0D, 0x33, 0x8A, 0x00, 0x00, 0x01, 0x83, 0x00, 0x86, 0x29, 0x88, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x03, 0x86, 0x22, 0x00, 0x10, 0x87, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x04, 0x0F, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x13, 0x3A, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x01, 0x0F, 0x28, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x19,
+	0x16, 0x8A, 0x00, 0x00, 0x01, 0x89, 0x00, 0x04, 0x38, 0x1F, 0x02, 0x3A, 0x04, 0x85, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x32, 0x01, 0x0E, 0x89,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x07, 0x31, 0x2A, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x80, 0x01, 0x00, 0x09, 0x88, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x00, 0x1C, 0x80, 0x01, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x0A, 0x01, 0x24, 0x03, 0x88, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x11, 0x3E, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x08, 0x0F, 0x25, 0x01, 0x1D, 0x05, 0x35, 0x01, 0x20, 0x0A, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x04, 0x01, 0x1F, 0x8A, 0x00, 0x00, 0x01,
+	0x89, 0x00, 0x01, 0x39, 0x35, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x31, 0x3D, 0x03, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x10, 0x30,
+	0x24, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x3D, 0x16, 0x1C, 0x16, 0x29, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x06, 0x27, 0x01, 0x13,
+	0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x12, 0x1B, 0x2B, 0x3A, 0x00, 0x37, 0x19, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x3E, 0x3D, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x0E, 0x24, 0x15, 0x03, 0x81, 0x00, 0x02, 0x0B, 0x32,
+	0x2B, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0A, 0x09, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x11, 0x21, 0x88, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x01, 0x33, 0x36, 0x07,
+	0x01, 0x28, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x3E, 0x36, 0x25, 0x35, 0x88, 0x00, 0x00, 0x01, 0x84, 0x00, 0x06, 0x24, 0x18, 0x20, 0x3E,
+	0x3D, 0x02, 0x08, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x16, 0x3F, 0x89, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x0B, 0x34, 0x22, 0x2A, 0x00, 0x11, 0x14, 0x3B, 0x11, 0x02, 0x34, 0x3E, 0x2E, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x29,
+	0x09, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x11, 0x21, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x1B, 0x06, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x39, 0x3E, 0x00, 0x0C,
+	0x01, 0x11, 0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x04, 0x17, 0x80, 0x00, 0x03, 0x2D, 0x24, 0x23, 0x02, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x1F, 0x01, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x0B, 0x33, 0x17, 0x00, 0x36,
+	0x01, 0x2F, 0x1C, 0x31, 0x11, 0x00, 0x1D, 0x33, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x2E, 0x01, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01,
+	0x3B, 0x09, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01,
+	0x8A, 0x00, 0x01, 0x05, 0x20, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x1D, 0x06, 0x80, 0x00, 0x01, 0x25, 0x05, 0x87, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x35, 0x2D, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x0B,
+	0x27, 0x33, 0x00, 0x0D, 0x12, 0x00, 0x0A, 0x01, 0x3C, 0x00, 0x1C, 0x26, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x80, 0x2B, 0x8B, 0x00, 0x00, 0x01,
+	0x89, 0x00, 0x02, 0x0F, 0x01, 0x30, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x24,
+	0x8A, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x0C, 0x23, 0x2D, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x34, 0x06, 0x0A, 0x80, 0x00, 0x01, 0x28,
+	0x06, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x15, 0x17, 0x88,
+	0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x24, 0x0E, 0x0A, 0x01, 0x34, 0x00, 0x29, 0x24, 0x80, 0x00, 0x01, 0x1B, 0x36, 0x82, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x02, 0x14, 0x0D, 0x0A, 0x8B, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x15, 0x01, 0x1F, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11,
+	0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x28, 0x0D, 0x01, 0x20, 0x88, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x3C, 0x01, 0x28, 0x87,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x04, 0x01, 0x0B, 0x3B, 0x22, 0x80, 0x00, 0x05, 0x16, 0x08, 0x00, 0x0C, 0x01, 0x38, 0x82, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x02, 0x03, 0x14, 0x20, 0x8B, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x22, 0x36, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11,
+	0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x0E, 0x01, 0x38, 0x89, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x2B, 0x06, 0x87, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x05, 0x01, 0x0F, 0x28, 0x01, 0x33, 0x2F, 0x80, 0x01, 0x02, 0x1A, 0x3F, 0x07, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0E,
+	0x01, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x3A, 0x24, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x0E, 0x09, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x2A, 0x31, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x09, 0x35, 0x06,
+	0x00, 0x26, 0x05, 0x26, 0x00, 0x1E, 0x25, 0x2D, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x29, 0x09, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01,
+	0x11, 0x21, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x01, 0x04, 0x02, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00,
+	0x00, 0x01, 0x8A, 0x00, 0x02, 0x37, 0x01, 0x11, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x15, 0x21, 0x10, 0x8B, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x01, 0x29, 0x09, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x11, 0x21, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00,
+	0x01, 0x87, 0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x3B, 0x19, 0x37, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x80, 0x19, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x07,
+	0x27, 0x2C, 0x36, 0x0E, 0x0A, 0x29, 0x2A, 0x11, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x38, 0x01, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01,
+	0x11, 0x21, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x31, 0x11, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x1F, 0x24, 0x8A, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x02, 0x39, 0x01, 0x0A, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x27, 0x89,
+	0x00, 0x00, 0x01, 0x8B, 0x00, 0x02, 0x11, 0x01, 0x37, 0x85, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x2A, 0x25, 0x1B, 0x22, 0x1D, 0x20, 0x0F, 0x85,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x23, 0x27, 0x3C, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x16, 0x80, 0x20, 0x88, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x02, 0x31, 0x20, 0x2D, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x3F, 0x20, 0x24, 0x8A, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x03, 0x8A,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x13, 0x01, 0x89, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x0C,
+	0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x0E, 0x18, 0x0F, 0x89, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x36, 0x33, 0x10,
+	0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x2F, 0x80, 0x26, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x15, 0x2F, 0x26, 0x8A, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00,
+	0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x34, 0x89, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x2E, 0x1E, 0x85,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E,
+	0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x01, 0x28, 0x88, 0x00, 0x00, 0x01,
+	0x8C, 0x00, 0x01, 0x05, 0x15, 0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05,
+	0x01, 0x26, 0x01, 0x3B, 0x01, 0x29, 0x86, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x02, 0x0C, 0x01, 0x3C, 0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x00, 0x0F, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x2E, 0x17, 0x01, 0x23, 0x33, 0x87, 0x00, 0x00, 0x01,
+	0x8B, 0x00, 0x01, 0x1E, 0x2B, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x24, 0x1F, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x87, 0x00, 0x00, 0x1A, 0x80, 0x01, 0x02, 0x09, 0x19, 0x0A, 0x86, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x01, 0x08, 0x2A, 0x86, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x0A, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0C, 0x3C, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x01, 0x0E, 0x89, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x1C, 0x3C, 0x01, 0x0B, 0x1A, 0x37, 0x86, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x3A, 0x01, 0x37, 0x86, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x84, 0x14, 0x00, 0x2D, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x38, 0x01, 0x1E, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x01, 0x27, 0x35, 0x8B, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x00, 0x34, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x3A, 0x8E, 0x00, 0x00, 0x01, 0x8E,
+	0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x04, 0x01, 0x01, 0x11, 0x80, 0x04, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x89, 0x00, 0x01, 0x17, 0x29, 0x88, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x16, 0x19, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x84, 0x26, 0x00, 0x39,
+	0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x25, 0x02, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x2F, 0x1A, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00,
+	0x03, 0x03, 0x15, 0x01, 0x3C, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x1D, 0x19, 0x28, 0x8C, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0B, 0x1A,
+	0x0C, 0x83, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x35, 0x84, 0x01, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x33, 0x81,
+	0x1E, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x3E, 0x11, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x10, 0x1E, 0x01, 0x2B, 0x2E, 0x87, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x3C, 0x14, 0x01,
+	0x19, 0x28, 0x8A, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x10, 0x33, 0x23, 0x01, 0x0B, 0x83, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x85, 0x00,
+	0x81, 0x0B, 0x01, 0x01, 0x11, 0x80, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x82, 0x07, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89,
+	0x00, 0x01, 0x3D, 0x0D, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x16, 0x83, 0x07, 0x00, 0x2A, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x33, 0x0D, 0x21, 0x11, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x04, 0x18, 0x01, 0x19, 0x28, 0x88,
+	0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x2E, 0x21, 0x81, 0x01, 0x05, 0x30, 0x28, 0x29, 0x0A, 0x3C, 0x38, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0x01, 0x3A, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x01, 0x3F, 0x16, 0x88, 0x00, 0x00,
+	0x01, 0x85, 0x00, 0x84, 0x07, 0x00, 0x33, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x33, 0x01,
+	0x18, 0x8B, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x0C, 0x22, 0x35, 0x88, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x3C, 0x05, 0x8E, 0x01, 0x80, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x09, 0x3A, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x0B, 0x01,
+	0x1F, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x03, 0x27, 0x39, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x15, 0x05,
+	0x8B, 0x00, 0x00, 0x01, 0x85, 0x00, 0x04, 0x10, 0x15, 0x23, 0x21, 0x30, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x04, 0x3C, 0x3F, 0x01, 0x25, 0x28,
+	0x88, 0x00, 0x04, 0x01, 0x00, 0x34, 0x06, 0x09, 0x8F, 0x01, 0x80, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x29, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x2D, 0x35, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x38, 0x01,
+	0x1E, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x16, 0x35, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x34, 0x26, 0x24, 0x1C, 0x30, 0x87, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x04, 0x3C, 0x1A, 0x01, 0x3F, 0x1F, 0x8A, 0x00, 0x02, 0x01, 0x00, 0x18, 0x91, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x1B, 0x15, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x00, 0x34, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x2C, 0x14, 0x8B, 0x00, 0x00, 0x01, 0x89, 0x00, 0x03, 0x37, 0x2F, 0x09, 0x3C, 0x86,
+	0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x1D, 0x05, 0x0E, 0x8C, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x30, 0x2C, 0x8F, 0x01, 0x80, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02, 0x28, 0x01, 0x3C, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x2A, 0x3F, 0x8C, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x01, 0x04, 0x10, 0x86, 0x00, 0x00, 0x01,
+	0x84, 0x00, 0x00, 0x28, 0x8E, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x03, 0x18, 0x8E, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x0A, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x01, 0x0E, 0x04, 0x8C, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x29, 0x1B, 0x80, 0x01, 0x09,
+	0x23, 0x0E, 0x2E, 0x11, 0x3D, 0x02, 0x12, 0x39, 0x2A, 0x13, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x03, 0x10, 0x1E, 0x24, 0x3E, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x86, 0x00, 0x01, 0x3C, 0x20, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0xFF, 0xF1, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x04, 0x37,
+	0x2A, 0x06, 0x2D, 0x3C, 0x87, 0x00, 0x00, 0x0A, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x05, 0x0D, 0x19, 0x26, 0x19, 0x01, 0x0F, 0x85, 0x00, 0x02, 0x13, 0x01, 0x1A, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86,
+	0x00, 0x02, 0x0B, 0x01, 0x3B, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x0E, 0x35, 0x88, 0x01,
+	0x01, 0x24, 0x18, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x07, 0x89, 0x01, 0x00, 0x39, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0x81, 0x00, 0x01, 0x31, 0x13, 0x85, 0x00, 0x03, 0x1D, 0x21, 0x24, 0x10, 0x82,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x2E, 0x21, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x83, 0x00, 0x01, 0x38, 0x17, 0x88, 0x01, 0x01, 0x09, 0x25, 0x82, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x10, 0x1D, 0x88, 0x01, 0x01, 0x09, 0x3A,
+	0x85, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x04, 0x0B, 0x30, 0x2A, 0x2C, 0x1E,
+	0x84, 0x00, 0x04, 0x0A, 0x01, 0x28, 0x01, 0x36, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x19, 0x3B, 0x89, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1C, 0x89, 0x01, 0x01, 0x1D, 0x03, 0x82, 0x00, 0x00, 0x01, 0x81,
+	0x00, 0x01, 0x0B, 0x31, 0x88, 0x01, 0x01, 0x31, 0x0B, 0x84, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x0E, 0x0A, 0x91, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x06, 0x01, 0x20, 0x16, 0x3E, 0x1E, 0x84, 0x00, 0x04, 0x15, 0x01, 0x00, 0x22, 0x05, 0x82,
+	0x00, 0x00, 0x01, 0x80, 0x00, 0x04, 0x2A, 0x13, 0x2A, 0x30, 0x0B, 0x81, 0x00, 0x00, 0x02, 0x82, 0x13, 0x02, 0x00, 0x03, 0x1E, 0x83, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x20, 0x09, 0x88, 0x01, 0x01, 0x08, 0x3C, 0x83,
+	0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x3A, 0x09, 0x88, 0x01, 0x01, 0x1D, 0x10, 0x83, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x3E, 0x1A, 0x91, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x04, 0x01, 0x00, 0x29, 0x01, 0x3D, 0x80, 0x00, 0x01, 0x2C, 0x1E, 0x84, 0x00, 0x05, 0x08, 0x06,
+	0x00, 0x2A, 0x01, 0x0B, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x31, 0x3F, 0x15, 0x25, 0x23, 0x2A, 0x80, 0x00, 0x07, 0x25, 0x1B, 0x18, 0x26,
+	0x1E, 0x00, 0x0A, 0x01, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x26,
+	0x23, 0x88, 0x01, 0x01, 0x21, 0x30, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x39, 0x89, 0x01, 0x00, 0x07, 0x83, 0x00, 0x00, 0x01, 0x80, 0x00,
+	0x01, 0x3C, 0x10, 0x91, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x0A, 0x13, 0x2F, 0x12, 0x81, 0x00, 0x03, 0x03, 0x13, 0x16, 0x02, 0x81, 0x00, 0x03,
+	0x38, 0x33, 0x2F, 0x3D, 0x81, 0x00, 0x00, 0x01, 0x95, 0x00, 0x08, 0x01, 0x00, 0x0F, 0x01, 0x13, 0x00, 0x11, 0x01, 0x1E, 0x83, 0x00, 0x02, 0x28,
+	0x01, 0x3C, 0x80, 0x00, 0x01, 0x01, 0x2D, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x31, 0x11, 0x80, 0x00, 0x05, 0x11, 0x01, 0x0C, 0x00, 0x25,
+	0x06, 0x82, 0x00, 0x01, 0x0A, 0x01, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00,
+	0x01, 0x3D, 0x3E, 0x88, 0x01, 0x01, 0x31, 0x2A, 0x85, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x07, 0x89, 0x01, 0x00, 0x39, 0x82, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x01, 0x33, 0x3D, 0x80, 0x00, 0x04, 0x1E, 0x00, 0x02, 0x14, 0x12, 0x82, 0x00, 0x03, 0x39, 0x16, 0x39, 0x10, 0x82, 0x00, 0x15, 0x01,
+	0x00, 0x02, 0x01, 0x2F, 0x07, 0x01, 0x06, 0x00, 0x10, 0x08, 0x07, 0x2A, 0x05, 0x0F, 0x00, 0x1F, 0x24, 0x25, 0x18, 0x01, 0x13, 0x80, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x32, 0x01, 0x22, 0x27, 0x05, 0x1E, 0x83, 0x00, 0x01, 0x18, 0x01, 0x82, 0x24, 0x00, 0x17, 0x81,
+	0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x31, 0x11, 0x81, 0x00, 0x04, 0x05, 0x13, 0x00, 0x25, 0x06, 0x82, 0x00, 0x01, 0x0A, 0x01, 0x83, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x03, 0x01, 0x00, 0x29, 0x0D, 0x88, 0x01, 0x01, 0x23, 0x2F, 0x86, 0x00, 0x00,
+	0x01, 0x84, 0x00, 0x01, 0x10, 0x1D, 0x88, 0x01, 0x01, 0x09, 0x3A, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x09, 0x22, 0x06, 0x00, 0x38, 0x01, 0x27,
+	0x1D, 0x07, 0x01, 0x2F, 0x80, 0x00, 0x04, 0x27, 0x20, 0x39, 0x19, 0x3B, 0x82, 0x00, 0x03, 0x01, 0x10, 0x31, 0x36, 0x80, 0x00, 0x05, 0x1E, 0x01,
+	0x03, 0x29, 0x01, 0x03, 0x82, 0x00, 0x01, 0x17, 0x32, 0x80, 0x00, 0x01, 0x03, 0x29, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00,
+	0x01, 0x03, 0x34, 0x86, 0x00, 0x01, 0x2C, 0x19, 0x81, 0x3D, 0x02, 0x18, 0x01, 0x29, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x31, 0x11, 0x81,
+	0x00, 0x80, 0x16, 0x08, 0x00, 0x25, 0x01, 0x24, 0x0D, 0x26, 0x00, 0x0A, 0x01, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x02, 0x01, 0x00, 0x2B, 0x89, 0x01, 0x01, 0x1C, 0x04, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x29, 0x89, 0x01, 0x00, 0x1B,
+	0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x22, 0x06, 0x00, 0x38, 0x01, 0x14, 0x80, 0x00, 0x05, 0x14, 0x2C, 0x00, 0x37, 0x01, 0x3A, 0x85, 0x00,
+	0x0C, 0x01, 0x0A, 0x01, 0x18, 0x33, 0x1E, 0x16, 0x01, 0x29, 0x03, 0x22, 0x25, 0x30, 0x81, 0x00, 0x01, 0x09, 0x12, 0x84, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x0E, 0x01, 0x38, 0x82, 0x00, 0x01, 0x3E, 0x18, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x31, 0x11, 0x81,
+	0x00, 0x04, 0x20, 0x15, 0x00, 0x25, 0x14, 0x80, 0x10, 0x80, 0x00, 0x01, 0x0A, 0x01, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x03, 0x01, 0x00, 0x29, 0x0D, 0x88, 0x01, 0x01, 0x23, 0x2F, 0x86, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x10, 0x1D, 0x88,
+	0x01, 0x01, 0x09, 0x3A, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x22, 0x06, 0x00, 0x38, 0x01, 0x3C, 0x80, 0x00, 0x01, 0x36, 0x23, 0x80, 0x00,
+	0x02, 0x17, 0x3E, 0x11, 0x84, 0x00, 0x07, 0x01, 0x0E, 0x01, 0x27, 0x3F, 0x19, 0x32, 0x07, 0x80, 0x00, 0x07, 0x0B, 0x14, 0x01, 0x1C, 0x03, 0x37,
+	0x01, 0x3D, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x04, 0x06, 0x80, 0x09, 0x04, 0x01, 0x3D, 0x00, 0x07, 0x27, 0x83,
+	0x00, 0x01, 0x14, 0x2C, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x31, 0x11, 0x81, 0x00, 0x04, 0x2C, 0x02, 0x00, 0x25, 0x06, 0x82, 0x00, 0x01,
+	0x0A, 0x01, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x3D, 0x3E, 0x88,
+	0x01, 0x01, 0x31, 0x2A, 0x85, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x07, 0x89, 0x01, 0x00, 0x39, 0x82, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x22,
+	0x06, 0x00, 0x38, 0x01, 0x3C, 0x80, 0x00, 0x01, 0x3D, 0x24, 0x80, 0x00, 0x04, 0x03, 0x26, 0x24, 0x1B, 0x38, 0x82, 0x00, 0x03, 0x01, 0x38, 0x01,
+	0x28, 0x86, 0x00, 0x05, 0x04, 0x2C, 0x26, 0x00, 0x3E, 0x2D, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x0B, 0x09, 0x1F,
+	0x03, 0x00, 0x03, 0x19, 0x30, 0x86, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x31, 0x11, 0x00, 0x0B, 0x32, 0x1D, 0x80, 0x00,
+	0x01, 0x25, 0x06, 0x82, 0x00, 0x01, 0x0A, 0x01, 0x83, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x81, 0x00, 0x01, 0x26, 0x23, 0x88, 0x01, 0x01, 0x21, 0x30, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x39, 0x89, 0x01, 0x00, 0x07, 0x83, 0x00,
+	0x00, 0x01, 0x80, 0x00, 0x05, 0x22, 0x06, 0x00, 0x38, 0x01, 0x3C, 0x80, 0x00, 0x01, 0x3D, 0x24, 0x83, 0x00, 0x01, 0x2B, 0x1A, 0x82, 0x00, 0x15,
+	0x01, 0x00, 0x27, 0x1A, 0x37, 0x00, 0x37, 0x39, 0x00, 0x15, 0x28, 0x00, 0x03, 0x17, 0x1E, 0x00, 0x14, 0x1D, 0x2E, 0x00, 0x02, 0x1E, 0x80, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x1A, 0x1F, 0x1E, 0x3F, 0x09, 0x26, 0x0E, 0x06, 0x89, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+	0x22, 0x80, 0x01, 0x02, 0x21, 0x14, 0x34, 0x80, 0x00, 0x00, 0x25, 0x82, 0x01, 0x01, 0x03, 0x0A, 0x82, 0x01, 0x02, 0x29, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x20, 0x09, 0x88, 0x01, 0x01, 0x08, 0x3C, 0x83, 0x00, 0x00, 0x01,
+	0x82, 0x00, 0x01, 0x3A, 0x09, 0x88, 0x01, 0x01, 0x1D, 0x10, 0x83, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x22, 0x06, 0x00, 0x38, 0x01, 0x3C, 0x80,
+	0x00, 0x04, 0x3D, 0x09, 0x00, 0x3D, 0x2E, 0x80, 0x00, 0x01, 0x25, 0x16, 0x82, 0x00, 0x09, 0x01, 0x00, 0x0A, 0x3F, 0x01, 0x22, 0x01, 0x19, 0x00,
+	0x3D, 0x80, 0x31, 0x01, 0x01, 0x25, 0x80, 0x00, 0x01, 0x34, 0x25, 0x80, 0x01, 0x01, 0x35, 0x3A, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x82, 0x00, 0x07, 0x01, 0x0B, 0x2B, 0x00, 0x33, 0x3D, 0x3A, 0x16, 0x89, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x10, 0x85, 0x00, 0x82, 0x10, 0x86,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1C, 0x89, 0x01, 0x01, 0x1D,
+	0x03, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x0B, 0x31, 0x88, 0x01, 0x01, 0x31, 0x0B, 0x84, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x22, 0x06,
+	0x00, 0x38, 0x01, 0x3C, 0x80, 0x00, 0x08, 0x3D, 0x01, 0x00, 0x3A, 0x2C, 0x0D, 0x01, 0x1C, 0x37, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x0B,
+	0x03, 0x82, 0x00, 0x01, 0x0B, 0x03, 0x83, 0x00, 0x01, 0x03, 0x0C, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x81, 0x00, 0x08, 0x0C, 0x19,
+	0x1F, 0x06, 0x00, 0x1A, 0x0A, 0x39, 0x2A, 0x89, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x38, 0x17, 0x88, 0x01, 0x01, 0x09, 0x25, 0x82, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x10, 0x1D, 0x88, 0x01,
+	0x01, 0x09, 0x3A, 0x85, 0x00, 0x00, 0x01, 0x8D, 0x00, 0x01, 0x0B, 0x34, 0x84, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x81, 0x00, 0x02, 0x03, 0x27, 0x3C, 0x81, 0x01, 0x01, 0x32, 0x09, 0x8A, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x0E, 0x35, 0x88, 0x01, 0x01, 0x24, 0x18, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+	0x07, 0x89, 0x01, 0x00, 0x39, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00, 0x05,
+	0x1D, 0x0A, 0x37, 0x03, 0x00, 0x38, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x82, 0x00,
+	0x05, 0x0E, 0x01, 0x06, 0x3F, 0x26, 0x05, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84,
+	0x00, 0x02, 0x3C, 0x30, 0x0A, 0x8C, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+};
+const ardPort::PackedImage picKB2_packed = {240, 95, picKB2_palette, picKB2_data, 6861};
+
+// picKBNum: 96×95, 63色, 18240 → 3016 バイト
+const uint16_t picKBNum_palette[] = {
+	0xFFFF, 0x0000, 0xC618, 0x4228, 0x7BCF, 0x1082, 0x31A6, 0xD69A, 0x52AA, 0xEF7D, 0xB5B6, 0x8C51, 0xA534, 0x9CD3, 0x6B4D, 0xD6BA,
+	0x9492, 0x9CF3, 0xF7BE, 0xDEFB, 0xAD55, 0x2104, 0x632C, 0x738E, 0xFFDF, 0x2965, 0x94B2, 0x4A49, 0x0841, 0x528A, 0x73AE, 0x18C3,
+	0xA514, 0x8430, 0xCE79, 0x5AEB, 0x18E3, 0xBDD7, 0x0020, 0xBDF7, 0x4208, 0x4A69, 0xE73C, 0x6B6D, 0xCE59, 0xEF5D, 0x7BEF, 0x8C71,
+	0x630C, 0x8410, 0x39C7, 0xF79E, 0x2945, 0xC638, 0xE71C, 0x5ACB, 0xDEDB, 0x0861, 0x2124, 0x10A2, 0x39E7, 0x3186, 0xAD75,
+};
+const uint8_t picKBNum_data[] = {
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x03, 0x88, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x04,
+	0x05, 0x01, 0x06, 0x07, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x04, 0x80, 0x01, 0x01, 0x08, 0x09, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x84, 0x00, 0x00, 0x09, 0x81, 0x02, 0x02, 0x0A, 0x01, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x0B, 0x01, 0x0C, 0x02, 0x06, 0x05,
+	0x09, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x0B, 0x01, 0x0D, 0x0A, 0x05, 0x0E, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x0F, 0x10, 0x04,
+	0x11, 0x81, 0x00, 0x03, 0x12, 0x10, 0x0E, 0x0C, 0x81, 0x00, 0x03, 0x13, 0x0B, 0x04, 0x14, 0x80, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0x04, 0x05,
+	0x09, 0x88, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x03, 0x06, 0x80, 0x00, 0x02, 0x0A, 0x01, 0x02, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x15,
+	0x06, 0x80, 0x00, 0x02, 0x0B, 0x01, 0x09, 0x86, 0x00, 0x00, 0x01, 0x80, 0x00, 0x15, 0x0C, 0x01, 0x04, 0x16, 0x01, 0x17, 0x00, 0x18, 0x19, 0x16,
+	0x1A, 0x1B, 0x07, 0x00, 0x02, 0x1C, 0x1D, 0x1E, 0x01, 0x10, 0x00, 0x01, 0x87, 0x00, 0x02, 0x13, 0x01, 0x0B, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x05, 0x04, 0x01, 0x0B, 0x13, 0x03, 0x15, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x01, 0x03, 0x80, 0x00, 0x02, 0x02, 0x01, 0x02, 0x86, 0x00,
+	0x04, 0x01, 0x00, 0x18, 0x1F, 0x20, 0x80, 0x00, 0x05, 0x21, 0x01, 0x12, 0x22, 0x01, 0x12, 0x82, 0x00, 0x01, 0x06, 0x23, 0x80, 0x00, 0x03, 0x12,
+	0x22, 0x00, 0x01, 0x87, 0x00, 0x02, 0x04, 0x01, 0x09, 0x89, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x09, 0x08, 0x80, 0x01, 0x01, 0x15, 0x13, 0x86,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x08, 0x01, 0x07, 0x09, 0x06, 0x01, 0x02, 0x86, 0x00, 0x0D, 0x01, 0x00, 0x0F, 0x01, 0x1E, 0x0B, 0x21, 0x0E,
+	0x01, 0x22, 0x12, 0x24, 0x1D, 0x25, 0x81, 0x00, 0x01, 0x26, 0x11, 0x83, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x15, 0x03, 0x8A, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x05, 0x07, 0x06, 0x04, 0x0E, 0x01, 0x03, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x07, 0x05, 0x80, 0x01, 0x02, 0x0E, 0x01, 0x02,
+	0x86, 0x00, 0x08, 0x01, 0x00, 0x27, 0x01, 0x28, 0x29, 0x08, 0x23, 0x16, 0x80, 0x00, 0x07, 0x2A, 0x2B, 0x01, 0x03, 0x12, 0x09, 0x01, 0x14, 0x83,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x07, 0x01, 0x0B, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x80, 0x03, 0x80, 0x00, 0x02, 0x0D, 0x01, 0x0A, 0x85,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x02, 0x13, 0x0C, 0x01, 0x07, 0x86, 0x00, 0x04, 0x01, 0x00, 0x13, 0x01, 0x2C, 0x86, 0x00, 0x05, 0x2D, 0x15,
+	0x2E, 0x00, 0x05, 0x2F, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0B, 0x01, 0x02, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x01, 0x04, 0x80,
+	0x00, 0x02, 0x13, 0x01, 0x0B, 0x85, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x0E, 0x05, 0x87, 0x00, 0x00, 0x01, 0x80, 0x00, 0x15, 0x28, 0x30, 0x09,
+	0x00, 0x09, 0x0D, 0x00, 0x31, 0x2C, 0x00, 0x12, 0x06, 0x21, 0x00, 0x2B, 0x32, 0x0A, 0x00, 0x0C, 0x21, 0x00, 0x01, 0x86, 0x00, 0x02, 0x08, 0x01,
+	0x07, 0x8A, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06, 0x03, 0x05, 0x0A, 0x02, 0x08, 0x01, 0x13, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x0C, 0x15,
+	0x80, 0x0C, 0x01, 0x01, 0x04, 0x87, 0x00, 0x00, 0x01, 0x80, 0x00, 0x07, 0x0F, 0x29, 0x01, 0x24, 0x01, 0x08, 0x00, 0x14, 0x80, 0x1F, 0x01, 0x01,
+	0x1D, 0x80, 0x00, 0x01, 0x33, 0x1D, 0x80, 0x01, 0x03, 0x34, 0x35, 0x00, 0x01, 0x86, 0x00, 0x01, 0x03, 0x01, 0x8B, 0x00, 0x00, 0x01, 0x87, 0x00,
+	0x01, 0x09, 0x0E, 0x80, 0x01, 0x01, 0x06, 0x0A, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x09, 0x03, 0x80, 0x01, 0x01, 0x04, 0x09, 0x87, 0x00,
+	0x00, 0x01, 0x83, 0x00, 0x01, 0x2A, 0x12, 0x82, 0x00, 0x01, 0x2A, 0x12, 0x83, 0x00, 0x01, 0x12, 0x36, 0x81, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0xDF, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x0A, 0x80, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87,
+	0x00, 0x00, 0x03, 0x82, 0x01, 0x00, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x04, 0x80, 0x01, 0x01, 0x08, 0x09, 0x87, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x03, 0x06, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x03, 0x06, 0x81, 0x02, 0x00, 0x13, 0x86,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x04, 0x01, 0x0D, 0x0A, 0x15, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x03, 0x02,
+	0x05, 0x0B, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x01, 0x03, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x05, 0x0E, 0x8B, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x03, 0x08, 0x04, 0x0B, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x03, 0x08, 0x15, 0x01, 0x08,
+	0x09, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x06, 0x02, 0x01, 0x0D, 0x03, 0x01, 0x0E, 0x09, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x04, 0x13, 0x01, 0x13, 0x0B, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x03, 0x05, 0x0A, 0x0D, 0x01, 0x0E, 0x86, 0x00, 0x00, 0x01,
+	0x85, 0x00, 0x06, 0x02, 0x01, 0x08, 0x0A, 0x0D, 0x01, 0x0B, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0x0E, 0x08, 0x00,
+	0x0B, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x80, 0x0A, 0x80, 0x00, 0x01, 0x03, 0x05, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x02, 0x01,
+	0x0A, 0x80, 0x00, 0x01, 0x06, 0x03, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x09, 0x01, 0x02, 0x00, 0x0B, 0x01, 0x86,
+	0x00, 0x00, 0x01, 0x8B, 0x00, 0x01, 0x03, 0x01, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x02, 0x01, 0x02, 0x80, 0x00, 0x80, 0x03, 0x87, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x09, 0x08, 0x04,
+	0x80, 0x00, 0x01, 0x06, 0x05, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x13, 0x01, 0x0B, 0x80, 0x00, 0x01, 0x15, 0x03, 0x87, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x09, 0x81, 0x02, 0x03, 0x0E, 0x01, 0x02, 0x09, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x06, 0x05,
+	0x0A, 0x0D, 0x01, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x03, 0x05, 0x0A, 0x0D, 0x01, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x8B, 0x00, 0x01, 0x0B, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x07, 0x03, 0x01, 0x05, 0x04, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x04, 0x09, 0x08, 0x01, 0x05, 0x0B, 0x88, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xDF, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x0A, 0x05, 0x03, 0x87, 0x00, 0x00, 0x01,
+	0x87, 0x00, 0x04, 0x0A, 0x15, 0x01, 0x15, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x04, 0x05, 0x01, 0x03, 0x07, 0x87, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x06, 0x80, 0x01, 0x00, 0x03, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x07, 0x01, 0x08, 0x02, 0x03,
+	0x01, 0x02, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x05, 0x0B, 0x01, 0x0D, 0x0A, 0x15, 0x05, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x03, 0x0E, 0x0C, 0x01, 0x03, 0x87, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x0C, 0x15, 0x13, 0x00, 0x02, 0x01, 0x0B, 0x86, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x01, 0x0D, 0x03, 0x80, 0x00, 0x01, 0x0B, 0x01, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x01, 0x03, 0x87,
+	0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x0C, 0x01, 0x0C, 0x86, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x13, 0x80, 0x06, 0x87, 0x00, 0x00, 0x01, 0x95,
+	0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x01, 0x03, 0x87, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x07, 0x05, 0x06, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x80, 0x01, 0x01, 0x03, 0x09, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x01, 0x03, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x03, 0x07, 0x05, 0x06, 0x09, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0x02, 0x0D, 0x05, 0x06, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x8A, 0x00, 0x01, 0x01, 0x03, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x13, 0x05, 0x06, 0x09, 0x88, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x0D,
+	0x01, 0x02, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x01, 0x03, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x80, 0x06, 0x00,
+	0x09, 0x89, 0x00, 0x00, 0x01, 0x86, 0x00, 0x80, 0x0E, 0x80, 0x00, 0x02, 0x0C, 0x01, 0x02, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x05, 0x07, 0x02, 0x01, 0x06, 0x02, 0x13, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0B, 0x01, 0x0D, 0x81, 0x02, 0x00, 0x13, 0x86, 0x00,
+	0x00, 0x01, 0x86, 0x00, 0x06, 0x0E, 0x01, 0x0D, 0x0A, 0x15, 0x05, 0x09, 0x86, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x03,
+	0x82, 0x01, 0x00, 0x0B, 0x85, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x03, 0x83, 0x01, 0x00, 0x0B, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x09,
+	0x0E, 0x80, 0x01, 0x01, 0x03, 0x07, 0x87, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0xDF, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x27, 0x34, 0x88,
+	0x01, 0x01, 0x1C, 0x1E, 0x80, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x16, 0x89, 0x01, 0x00, 0x0D, 0x85, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01,
+	0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x13, 0x06, 0x88, 0x01, 0x01, 0x26, 0x1D, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00,
+	0x01, 0x18, 0x32, 0x88, 0x01, 0x01, 0x26, 0x35, 0x84, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x09,
+	0x03, 0x01, 0x05, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x12, 0x03, 0x89, 0x01, 0x01, 0x32, 0x12, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00,
+	0x01, 0x2A, 0x1F, 0x88, 0x01, 0x01, 0x1F, 0x2A, 0x83, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x03,
+	0x05, 0x0A, 0x0E, 0x01, 0x02, 0x86, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x37, 0x26, 0x88, 0x01, 0x01, 0x19, 0x38, 0x82, 0x00, 0x00, 0x01, 0x83,
+	0x00, 0x01, 0x35, 0x26, 0x88, 0x01, 0x01, 0x32, 0x18, 0x82, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06,
+	0x13, 0x01, 0x0B, 0x00, 0x09, 0x01, 0x0E, 0x86, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x2E, 0x39, 0x88, 0x01, 0x01, 0x3A, 0x25, 0x83, 0x00, 0x00,
+	0x01, 0x84, 0x00, 0x00, 0x0D, 0x89, 0x01, 0x00, 0x16, 0x82, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02,
+	0x02, 0x01, 0x02, 0x80, 0x00, 0x01, 0x15, 0x03, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x14, 0x05, 0x88, 0x01, 0x01, 0x1F, 0x1A, 0x84, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x00, 0x16, 0x89, 0x01, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00,
+	0x02, 0x0B, 0x01, 0x02, 0x80, 0x00, 0x80, 0x03, 0x86, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x22, 0x3B, 0x88, 0x01, 0x01, 0x39, 0x04, 0x85, 0x00,
+	0x00, 0x01, 0x85, 0x00, 0x01, 0x18, 0x32, 0x88, 0x01, 0x01, 0x26, 0x35, 0x80, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01,
+	0x86, 0x00, 0x02, 0x0B, 0x01, 0x02, 0x80, 0x00, 0x80, 0x03, 0x86, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3C, 0x89, 0x01, 0x01, 0x03, 0x2D, 0x85,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x22, 0x89, 0x01, 0x00, 0x3D, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x2A, 0x30, 0x36, 0x83, 0x00, 0x83,
+	0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x02, 0x01, 0x02, 0x80, 0x00, 0x01, 0x05, 0x03, 0x86, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x22,
+	0x3B, 0x88, 0x01, 0x01, 0x39, 0x04, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x18, 0x32, 0x88, 0x01, 0x01, 0x26, 0x35, 0x80, 0x00, 0x00, 0x01,
+	0x84, 0x00, 0x04, 0x18, 0x0B, 0x39, 0x01, 0x2A, 0x83, 0x00, 0x83, 0x01, 0x80, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x07, 0x01, 0x0B, 0x00, 0x09,
+	0x01, 0x04, 0x86, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x14, 0x05, 0x88, 0x01, 0x01, 0x1F, 0x1A, 0x84, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x16,
+	0x89, 0x01, 0x00, 0x0D, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x0A, 0x3A, 0x81, 0x01, 0x05, 0x25, 0x2C, 0x22, 0x0F, 0x38, 0x13, 0x83, 0x01,
+	0x80, 0x00, 0x00, 0x01, 0x87, 0x00, 0x05, 0x03, 0x05, 0x0A, 0x0E, 0x01, 0x02, 0x86, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x2E, 0x39, 0x88, 0x01,
+	0x01, 0x3A, 0x25, 0x83, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x0D, 0x89, 0x01, 0x00, 0x16, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x38, 0x1B,
+	0x8E, 0x01, 0x80, 0x00, 0x00, 0x01, 0x87, 0x00, 0x04, 0x07, 0x03, 0x01, 0x05, 0x0C, 0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x37, 0x26, 0x88,
+	0x01, 0x01, 0x19, 0x38, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x35, 0x26, 0x88, 0x01, 0x01, 0x32, 0x18, 0x82, 0x00, 0x04, 0x01, 0x00, 0x33,
+	0x17, 0x26, 0x8F, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x12, 0x03, 0x89, 0x01, 0x01, 0x32, 0x12, 0x81, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x01, 0x2A, 0x1F, 0x88, 0x01, 0x01, 0x1F, 0x2A, 0x83, 0x00, 0x02, 0x01, 0x00, 0x1E, 0x91, 0x01, 0x80, 0x00, 0x00, 0x01,
+	0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x01, 0x13, 0x06, 0x88, 0x01, 0x01, 0x26, 0x1D, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x18, 0x32, 0x88,
+	0x01, 0x01, 0x26, 0x35, 0x84, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x25, 0x15, 0x8F, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x85,
+	0x00, 0x01, 0x27, 0x34, 0x88, 0x01, 0x01, 0x1C, 0x1E, 0x80, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x16, 0x89, 0x01, 0x00, 0x0D, 0x85, 0x00, 0x00,
+	0x01, 0x81, 0x00, 0x01, 0x12, 0x1E, 0x8E, 0x01, 0x80, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+	0x83, 0x00, 0x01, 0x22, 0x3D, 0x80, 0x01, 0x09, 0x39, 0x27, 0x0A, 0x3E, 0x14, 0x0C, 0x11, 0x0D, 0x1A, 0x10, 0x82, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x84, 0x00, 0x03, 0x18, 0x21, 0x1C, 0x05, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00,
+	0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x38, 0x37, 0x8B, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00,
+	0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01,
+};
+const ardPort::PackedImage picKBNum_packed = {96, 95, picKBNum_palette, picKBNum_data, 2890};
+
+// picThndr: 15×15, 透過色 0x0000, 15区間, 221ピクセル
+const ardPort::SpriteSpan picThndr_spans[] = {
+	{0, 1, 13},
+	{1, 0, 15},
+	{2, 0, 15},
+	{3, 0, 15},
+	{4, 0, 15},
+	{5, 0, 15},
+	{6, 0, 15},
+	{7, 0, 15},
+	{8, 0, 15},
+	{9, 0, 15},
+	{10, 0, 15},
+	{11, 0, 15},
+	{12, 0, 15},
+	{13, 0, 15},
+	{14, 1, 13},
+};
+const uint16_t picThndr_pixels[] = {
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x73B2, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x946F, 0x944F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0xA4ED, 0xA4CD, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+	0x00BF, 0xA4ED, 0xD607, 0xA4ED, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xA4ED,
+	0xEEA5, 0xB54B, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xA4ED, 0xEEA5, 0xFF22,
+	0xB54B, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xA4ED, 0xB54B, 0xEEA5, 0xFF22, 0xFF22, 0xEEA5,
+	0xB54B, 0xB54B, 0xB54B, 0xA4ED, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x9CAD, 0xD627, 0xFF22, 0xFF22, 0xFF22, 0xFF22, 0xFF22, 0xFF22,
+	0xFF22, 0xFF22, 0xEEA5, 0xA4CD, 0x4258, 0x00BF, 0x00BF, 0x00BF, 0x9CAF, 0xB54B, 0xB54B, 0xB54B, 0xEEA5, 0xFF22, 0xFF22, 0xFF22,
+	0xFF22, 0xEEA5, 0xA4ED, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xB54B, 0xFF22, 0xFF22, 0xFF22, 0xEEA5,
+	0xA4ED, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xB54B, 0xFF22, 0xEEA5, 0xB54B, 0x9CAF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xB54B, 0xEEA5, 0xA4ED, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xA4ED, 0xD607, 0xA4ED, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0xA4CD, 0xA4ED, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x73B2, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+};
+const ardPort::SpanSprite picThndr_sprite = {15, 15, 15, picThndr_spans, picThndr_pixels};
+
+// picFalse: 15×15, 透過色 0x0000, 15区間, 221ピクセル
+const ardPort::SpriteSpan picFalse_spans[] = {
+	{0, 1, 13},
+	{1, 0, 15},
+	{2, 0, 15},
+	{3, 0, 15},
+	{4, 0, 15},
+	{5, 0, 15},
+	{6, 0, 15},
+	{7, 0, 15},
+	{8, 0, 15},
+	{9, 0, 15},
+	{10, 0, 15},
+	{11, 0, 15},
+	{12, 0, 15},
+	{13, 0, 15},
+	{14, 1, 13},
+};
+const uint16_t picFalse_pixels[] = {
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x427F, 0x3A3F,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x3A3F, 0x427F, 0x00BF, 0x00BF, 0x00BF, 0x4A9F, 0x73DF, 0x73DF, 0x427F,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x427F, 0x73DF, 0x73DF, 0x4A9F, 0x00BF, 0x00BF, 0x219F, 0x73BF, 0x73DF, 0x73DF, 0x4ABF,
+	0x00BF, 0x00BF, 0x00BF, 0x4ABF, 0x73DF, 0x73DF, 0x73BF, 0x219F, 0x00BF, 0x00BF, 0x00BF, 0x197F, 0x6B9F, 0x73DF, 0x73DF, 0x52DF,
+	0x08FF, 0x52DF, 0x73DF, 0x73DF, 0x6B9F, 0x197F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x193F, 0x6B7F, 0x73DF, 0x73DF, 0x73BF,
+	0x73DF, 0x73DF, 0x6B7F, 0x193F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x111F, 0x635F, 0x73DF, 0x73DF, 0x73DF,
+	0x635F, 0x111F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x111F, 0x635F, 0x73DF, 0x73DF, 0x73DF, 0x635F,
+	0x111F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x193F, 0x6B7F, 0x73DF, 0x73DF, 0x73BF, 0x73DF, 0x73DF, 0x6B7F,
+	0x193F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x195F, 0x6B9F, 0x73DF, 0x73DF, 0x52FF, 0x08FF, 0x52DF, 0x73DF, 0x73DF, 0x6B9F,
+	0x195F, 0x00BF, 0x00BF, 0x00BF, 0x219F, 0x73BF, 0x73DF, 0x73DF, 0x4ABF, 0x00BF, 0x00BF, 0x00BF, 0x4ABF, 0x73DF, 0x73DF, 0x73BF,
+	0x219F, 0x00BF, 0x00BF, 0x4ABF, 0x73DF, 0x73DF, 0x427F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x427F, 0x73DF, 0x73DF, 0x4ABF,
+	0x00BF, 0x00BF, 0x00BF, 0x427F, 0x3A3F, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x3A3F, 0x429F, 0x00BF, 0x00BF,
+	0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF, 0x00BF,
+};
+const ardPort::SpanSprite picFalse_sprite = {15, 15, 15, picFalse_spans, picFalse_pixels};
+
+// wifiIcon_OK: 16×16, 透過色 0x0000, 16区間, 244ピクセル
+const ardPort::SpriteSpan wifiIcon_OK_spans[] = {
+	{0, 2, 12},
+	{1, 1, 14},
+	{2, 0, 16},
+	{3, 0, 16},
+	{4, 0, 16},
+	{5, 0, 16},
+	{6, 0, 16},
+	{7, 0, 16},
+	{8, 0, 16},
+	{9, 0, 16},
+	{10, 0, 16},
+	{11, 0, 16},
+	{12, 0, 16},
+	{13, 0, 16},
+	{14, 1, 14},
+	{15, 2, 12},
+};
+const uint16_t wifiIcon_OK_pixels[] = {
+	0x041F, 0x143F, 0x3C7F, 0x751F, 0x9DDF, 0xAE1F, 0xAE1F, 0x9DDF, 0x751F, 0x3C7F, 0x143F, 0x041F, 0x041F, 0x447F, 0xA5FF, 0xDF1F,
+	0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xDF3F, 0xA5FF, 0x447F, 0x041F, 0x143F, 0x6CFF, 0xD71F, 0xFFDF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD71F, 0x6CFF, 0x143F, 0x7D3F, 0xE75F, 0xFFFF, 0xFFFF, 0xFFDF, 0xE75F,
+	0xC6BF, 0xB63F, 0xAE3F, 0xC69F, 0xE75F, 0xFFDF, 0xFFFF, 0xFFFF, 0xE77F, 0x855F, 0xDF1F, 0xFFFF, 0xFFFF, 0xE77F, 0xA5FF, 0x4C9F,
+	0x2C5F, 0x2C5F, 0x2C5F, 0x2C5F, 0x4C9F, 0x9DDF, 0xE75F, 0xFFFF, 0xFFFF, 0xDF3F, 0xCEDF, 0xFFDF, 0xDF3F, 0x64FF, 0x2C5F, 0x753F,
+	0xB65F, 0xCEDF, 0xCEFF, 0xB65F, 0x7D3F, 0x2C5F, 0x64DF, 0xD71F, 0xFFDF, 0xD6FF, 0x549F, 0x8D7F, 0x54BF, 0x447F, 0xB65F, 0xF7BF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xB65F, 0x4C9F, 0x549F, 0x8D7F, 0x54BF, 0x041F, 0x041F, 0x1C3F, 0xBE7F, 0xFFDF, 0xFFFF,
+	0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC69F, 0x243F, 0x041F, 0x041F, 0x041F, 0x041F, 0x345F, 0xE77F, 0xFFFF, 0xF7DF,
+	0xBE7F, 0x8D7F, 0x8D7F, 0xBE7F, 0xF7BF, 0xFFFF, 0xEF7F, 0x3C7F, 0x041F, 0x041F, 0x041F, 0x041F, 0x1C3F, 0xAE1F, 0xDF3F, 0x9DDF,
+	0x2C5F, 0x243F, 0x243F, 0x2C5F, 0x95BF, 0xDF3F, 0xAE3F, 0x1C3F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x243F, 0x3C7F, 0x2C5F,
+	0x8D7F, 0xC6BF, 0xCEDF, 0x9DDF, 0x345F, 0x3C7F, 0x243F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x857F,
+	0xF7BF, 0xFFFF, 0xFFFF, 0xFFDF, 0xA5FF, 0x0C3F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x1C3F, 0xCEDF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75F, 0x345F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x243F, 0xD71F,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7F, 0x3C7F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x0C3F, 0xA61F, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xC69F, 0x1C3F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x3C7F, 0xBE9F, 0xEFBF, 0xF7BF, 0xCEDF,
+	0x54BF, 0x041F, 0x041F, 0x041F,
+};
+const ardPort::SpanSprite wifiIcon_OK_sprite = {16, 16, 16, wifiIcon_OK_spans, wifiIcon_OK_pixels};
+
+// wifiIcon_NG: 16×16, 透過色 0x0000, 16区間, 244ピクセル
+const ardPort::SpriteSpan wifiIcon_NG_spans[] = {
+	{0, 2, 12},
+	{1, 1, 14},
+	{2, 0, 16},
+	{3, 0, 16},
+	{4, 0, 16},
+	{5, 0, 16},
+	{6, 0, 16},
+	{7, 0, 16},
+	{8, 0, 16},
+	{9, 0, 16},
+	{10, 0, 16},
+	{11, 0, 16},
+	{12, 0, 16},
+	{13, 0, 16},
+	{14, 1, 14},
+	{15, 2, 12},
+};
+const uint16_t wifiIcon_NG_pixels[] = {
+	0x041F, 0x143F, 0x3C7F, 0x751F, 0x9DDF, 0xAE1F, 0xAE1F, 0x9DDF, 0x751F, 0x3C7F, 0x143F, 0x041F, 0x041F, 0x7358, 0xD28D, 0xDF1F,
+	0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xDF1F, 0xD28D, 0x7358, 0x041F, 0x143F, 0x8BB8, 0xF841, 0xF800, 0xFB2C, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB2C, 0xF800, 0xF841, 0x93B8, 0x143F, 0x7D3F, 0xF2ED, 0xF800, 0xF800, 0xF800, 0xF2EC,
+	0xC69F, 0xB63F, 0xAE3F, 0xC69F, 0xF2EC, 0xF800, 0xF800, 0xF800, 0xF30D, 0x855F, 0xDF1F, 0xFFDF, 0xFAEB, 0xF800, 0xF800, 0xF800,
+	0xA9AC, 0x343F, 0x343F, 0xA9AC, 0xF800, 0xF800, 0xF800, 0xFAEB, 0xFFDF, 0xDF3F, 0xCEDF, 0xFFDF, 0xDF1F, 0xC1CB, 0xF800, 0xF800,
+	0xF800, 0xEAAC, 0xEAAC, 0xF800, 0xF800, 0xF800, 0xC1CB, 0xD6FF, 0xFFDF, 0xD6FF, 0x549F, 0x8D7F, 0x54BF, 0x447F, 0xE24B, 0xF800,
+	0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xE24B, 0x4C7F, 0x549F, 0x8D7F, 0x54BF, 0x041F, 0x041F, 0x1C3F, 0xBE7F, 0xFFDF, 0xFAEB,
+	0xF800, 0xF800, 0xF800, 0xF800, 0xFAEB, 0xFFDF, 0xC69F, 0x243F, 0x041F, 0x041F, 0x041F, 0x041F, 0x345F, 0xE77F, 0xFFFF, 0xFB0C,
+	0xF800, 0xF800, 0xF800, 0xF800, 0xFAEC, 0xFFFF, 0xEF7F, 0x3C7F, 0x041F, 0x041F, 0x041F, 0x041F, 0x1C3F, 0xAE1F, 0xF2CC, 0xF800,
+	0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF2CC, 0xAE3F, 0x1C3F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0xA1AC, 0xF800, 0xF800,
+	0xF800, 0xEA6B, 0xEA6B, 0xF800, 0xF800, 0xF800, 0xA1AC, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x998C, 0xF800, 0xF800, 0xF800,
+	0xFACB, 0xFFDF, 0xFFDF, 0xFACB, 0xF800, 0xF800, 0xF800, 0x998C, 0x041F, 0x041F, 0x041F, 0x91CD, 0xF800, 0xF800, 0xF800, 0xEA8B,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2AB, 0xF800, 0xF800, 0xF800, 0x91CD, 0x041F, 0x041F, 0x3B18, 0xF021, 0xF800, 0xA98B, 0xD6FF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5F, 0xB18B, 0xF800, 0xF021, 0x3B18, 0x041F, 0x041F, 0x3B18, 0x91AD, 0x0C1F, 0xA61F, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xC69F, 0x1C1F, 0x91AD, 0x3B18, 0x041F, 0x041F, 0x041F, 0x041F, 0x3C7F, 0xBE9F, 0xEFBF, 0xF7BF, 0xCEDF,
+	0x54BF, 0x041F, 0x041F, 0x041F,
+};
+const ardPort::SpanSprite wifiIcon_NG_sprite = {16, 16, 16, wifiIcon_NG_spans, wifiIcon_NG_pixels};
+
+// 合計 206968 → 35849 バイト
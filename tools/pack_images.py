@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+pictData.h の RGB565 配列を、パレット＋ランレングスの圧縮形式（PackedImage）と、
+透過しない区間で表したスプライト（SpanSprite）に変換して pictPacked.h を作る。
+
+使い方:
+    python3 tools/pack_images.py [pictData.h] [pictPacked.h]
+
+形式は lib-9341/Adafruit_GFX_Library/PackedImage.h と SpanSprite.h を参照。
+変換した画像は展開して元の配列と一致することを確かめてから書き出す。
+画像の幅と高さは pictData.h に無いので、下の IMAGES と SPRITES に書いておく（描画している側の幅・高さと同じ）。
+"""
+import re
+import sys
+
+# 変換する画像（名前, 幅, 高さ）
+IMAGES = [
+	("num_blank", 32, 51),
+	("num_0", 32, 51), ("num_1", 32, 51), ("num_2", 32, 51), ("num_3", 32, 51), ("num_4", 32, 51),
+	("num_5", 32, 51), ("num_6", 32, 51), ("num_7", 32, 51), ("num_8", 32, 51), ("num_9", 32, 51),
+	("num_10", 32, 51), ("num_11", 32, 51), ("num_12", 32, 51),
+	("num_am", 30, 30), ("num_pm", 30, 30),
+	("colon", 16, 51),
+	("secQ0", 10, 10), ("secQ1", 10, 10), ("secQ2", 10, 10), ("secQ3", 10, 10), ("secQ4", 10, 10),
+	("picKB0", 240, 95), ("picKB1", 240, 95), ("picKB2", 240, 95),
+	("picKBNum", 96, 95),
+]
+
+# スプライトにする画像（名前, 幅, 高さ, 透過色）
+SPRITES = [
+	("picThndr", 15, 15, 0x0000), ("picFalse", 15, 15, 0x0000),
+	("wifiIcon_OK", 16, 16, 0x0000), ("wifiIcon_NG", 16, 16, 0x0000),
+]
+
+LONG_RUN = 0xFF
+MAX_LITERAL = 128
+MAX_SHORT_RUN = 128
+
+
+def read_arrays(path):
+	"""pictData.h から「名前 → 値の並び」を読む"""
+	text = open(path, encoding="utf-8").read()
+	arrays = {}
+	for m in re.finditer(r"const\s+uint16_t\s+(\w+)\s*\[\]\s*=\s*\{([^}]*)\}", text):
+		arrays[m.group(1)] = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", m.group(2))]
+	return arrays
+
+
+def encode(pixels):
+	"""パレットとデータを作る"""
+	palette = []
+	index_of = {}
+	for c in pixels:
+		if c not in index_of:
+			index_of[c] = len(palette)
+			palette.append(c)
+	if len(palette) > 256:
+		raise ValueError("256色を超える画像は変換できない")
+	idx = [index_of[c] for c in pixels]
+
+	data = bytearray()
+	literal = []
+
+	def flush_literal():
+		while literal:
+			n = min(len(literal), MAX_LITERAL)
+			data.append(n - 1)
+			data.extend(literal[:n])
+			del literal[:n]
+
+	i = 0
+	while i < len(idx):
+		j = i
+		while j < len(idx) and idx[j] == idx[i]:
+			j += 1
+		run = j - i
+		if run >= 2:
+			flush_literal()
+			if run > MAX_SHORT_RUN:
+				while run > 0xFFFF:
+					data.extend([LONG_RUN, 0xFF, 0xFF, idx[i]])
+					run -= 0xFFFF
+				data.extend([LONG_RUN, run & 0xFF, run >> 8, idx[i]])
+			else:
+				data.extend([0x80 | (run - 2), idx[i]])
+		else:
+			literal.append(idx[i])
+		i = j
+	flush_literal()
+	return palette, bytes(data)
+
+
+def decode(palette, data):
+	"""encode() の逆（確認用。PackedImageReader と同じ読み方）"""
+	out = []
+	pos = 0
+	while pos < len(data):
+		tag = data[pos]
+		pos += 1
+		if tag & 0x80 == 0:
+			n = tag + 1
+			out.extend(palette[k] for k in data[pos:pos + n])
+			pos += n
+		else:
+			if tag == LONG_RUN:
+				n = data[pos] | (data[pos + 1] << 8)
+				pos += 2
+			else:
+				n = (tag & 0x7F) + 2
+			out.extend([palette[data[pos]]] * n)
+			pos += 1
+	return out
+
+
+def make_spans(pixels, w, h, transparent):
+	"""透過しない区間（行, 左端, 長さ）と、区間のピクセルの並びを作る"""
+	spans = []
+	opaque = []
+	for y in range(h):
+		x = 0
+		while x < w:
+			if pixels[y * w + x] == transparent:
+				x += 1
+				continue
+			start = x
+			while x < w and pixels[y * w + x] != transparent:
+				x += 1
+			spans.append((y, start, x - start))
+			opaque.extend(pixels[y * w + start:y * w + x])
+	return spans, opaque
+
+
+def c_array(ctype, name, values, fmt, per_line):
+	lines = []
+	for k in range(0, len(values), per_line):
+		lines.append("\t" + ", ".join(fmt.format(v) for v in values[k:k + per_line]) + ",")
+	return "const {} {}[] = {{\n{}\n}};\n".format(ctype, name, "\n".join(lines))
+
+
+def main():
+	src = sys.argv[1] if len(sys.argv) > 1 else "pictData.h"
+	dst = sys.argv[2] if len(sys.argv) > 2 else "pictPacked.h"
+	arrays = read_arrays(src)
+
+	out = []
+	out.append("/**\n")
+	out.append(" * @file pictPacked.h\n")
+	out.append(" * @brief pictData.h の画像をパレット＋ランレングスで圧縮したものと、アイコンのスプライト（tools/pack_images.py で生成。直接編集しないこと）\n")
+	out.append(" */\n")
+	out.append("#pragma once\n")
+	out.append('#include "lib-9341/Adafruit_GFX_Library/PackedImage.h"\n')
+	out.append('#include "lib-9341/Adafruit_GFX_Library/SpanSprite.h"\n\n')
+	total_raw = total_packed = 0
+	for name, w, h in IMAGES:
+		pixels = arrays[name]
+		if len(pixels) < w * h:
+			raise ValueError("{}: {}×{} に対してピクセルが足りない（{}）".format(name, w, h, len(pixels)))
+		pixels = pixels[:w * h]
+		palette, data = encode(pixels)
+		if decode(palette, data) != pixels:
+			raise ValueError("{}: 展開した結果が一致しない".format(name))
+		raw = len(pixels) * 2
+		packed = len(palette) * 2 + len(data)
+		total_raw += raw
+		total_packed += packed
+		out.append("// {}: {}×{}, {}色, {} → {} バイト\n".format(name, w, h, len(palette), raw, packed))
+		out.append(c_array("uint16_t", name + "_palette", palette, "0x{:04X}", 16))
+		out.append(c_array("uint8_t", name + "_data", list(data), "0x{:02X}", 24))
+		out.append("const ardPort::PackedImage {}_packed = {{{}, {}, {}_palette, {}_data, {}}};\n\n".format(name, w, h, name, name, len(data)))
+	for name, w, h, transparent in SPRITES:
+		pixels = arrays[name][:w * h]
+		if len(pixels) < w * h:
+			raise ValueError("{}: {}×{} に対してピクセルが足りない（{}）".format(name, w, h, len(pixels)))
+		spans, opaque = make_spans(pixels, w, h, transparent)
+		out.append("// {}: {}×{}, 透過色 0x{:04X}, {}区間, {}ピクセル\n".format(name, w, h, transparent, len(spans), len(opaque)))
+		out.append("const ardPort::SpriteSpan {}_spans[] = {{\n{}\n}};\n".format(
+			name, "\n".join("\t{{{}, {}, {}}},".format(*sp) for sp in spans)))
+		out.append(c_array("uint16_t", name + "_pixels", opaque, "0x{:04X}", 16))
+		out.append("const ardPort::SpanSprite {}_sprite = {{{}, {}, {}, {}_spans, {}_pixels}};\n\n".format(name, w, h, len(spans), name, name))
+	out.append("// 合計 {} → {} バイト\n".format(total_raw, total_packed))
+	open(dst, "w", encoding="utf-8", newline="\n").write("".join(out))
+	print("{} → {} bytes".format(total_raw, total_packed))
+
+
+if __name__ == "__main__":
+	main()